@@ -24,6 +24,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 #include <AzCore/IO/Path/Path.h>
 
@@ -1165,6 +1166,11 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::Tick:OnTick");
                 EBUS_EVENT(TickBus, OnTick, m_deltaTime, ScriptTimePoint(now));
             }
+            // Memory from the frame allocator only lives until the end of the tick.
+            if (AllocatorInstance<FrameAllocator>::IsReady())
+            {
+                static_cast<FrameAllocator&>(AllocatorInstance<FrameAllocator>::GetAllocator()).EndFrame();
+            }
         }
         if (m_drillerManager)
         {
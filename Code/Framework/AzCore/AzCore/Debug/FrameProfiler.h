@@ -13,6 +13,7 @@
 #define AZCORE_FRAME_PROFILER_H
 
 #include <AzCore/Driller/DrillerBus.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/ring_buffer.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/std/parallel/config.h>
@@ -58,7 +59,7 @@ namespace AZ
                 RegistersMap        m_registers;    ///< Map with all the registers (with history)
             };
 
-            typedef AZStd::fixed_vector<ThreadData, Profiler::m_maxNumberOfThreads>  ThreadDataArray;        ///< Array with samplers for all threads
+            typedef AZStd::deque<ThreadData>  ThreadDataArray;        ///< Array with samplers for all threads, a deque so existing thread data doesn't move when threads are added
         } // namespace FrameProfiler
     } // namespace Debug
 } // namespace AZ
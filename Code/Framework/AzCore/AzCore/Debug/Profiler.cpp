@@ -15,11 +15,18 @@
 
 #include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/shared_spin_mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/time.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Math/Crc.h>
 
 namespace AZ
@@ -34,6 +41,87 @@ namespace AZ
         int Profiler::s_useCount = 0;
         //////////////////////////////////////////////////////////////////////////
 
+        enum class ProfilerEventType : AZ::u32
+        {
+            Begin,
+            End
+        };
+
+        /**
+         * Single entry of the event trace.
+         */
+        struct ProfilerEvent
+        {
+            const char*         m_name;         ///< Register name, or the function if the register doesn't have one.
+            AZStd::sys_time_t   m_time;         ///< Time stamp in ticks.
+            AZ::u32             m_systemId;
+            ProfilerEventType   m_type;
+        };
+        typedef AZStd::vector<ProfilerEvent, OSStdAllocator> ProfilerEventList;
+
+        /**
+         * Event ring owned by a single thread. Only the owning thread pushes events, so pushing is a plain write followed by publishing
+         * the new write index. When the ring is full the oldest events are overwritten. Other threads can copy the events at any time,
+         * events that the owner overwrote during the copy are dropped from the result.
+         */
+        class ProfilerEventRing
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(ProfilerEventRing, OSAllocator, 0);
+
+            explicit ProfilerEventRing(AZ::u32 capacity)
+                : m_events(capacity)
+                , m_mask(capacity - 1)
+            {
+                AZ_Assert((capacity & m_mask) == 0, "Capacity of the profiler event ring must be a power of two.");
+            }
+
+            void Push(const char* name, AZ::u32 systemId, ProfilerEventType type)
+            {
+                AZ::u64 writeIndex = m_writeIndex.load(AZStd::memory_order_relaxed);
+                ProfilerEvent& event = m_events[writeIndex & m_mask];
+                event.m_name = name;
+                event.m_time = AZStd::GetTimeNowTicks();
+                event.m_systemId = systemId;
+                event.m_type = type;
+                m_writeIndex.store(writeIndex + 1, AZStd::memory_order_release);
+            }
+
+            void Read(ProfilerEventList& events) const
+            {
+                const AZ::u64 capacity = m_mask + 1;
+                const AZ::u64 end = m_writeIndex.load(AZStd::memory_order_acquire);
+                const AZ::u64 begin = AZStd::max(m_firstIndex.load(AZStd::memory_order_relaxed), end > capacity ? end - capacity : 0);
+                events.clear();
+                events.reserve(static_cast<size_t>(end - begin));
+                for (AZ::u64 i = begin; i < end; ++i)
+                {
+                    events.push_back(m_events[i & m_mask]);
+                }
+
+                // The owner may have overwritten the oldest events while they were copied, which makes them unreliable. The owner writes
+                // event endAfterRead before publishing it, so the slot it shares with event endAfterRead - capacity may be mid write too.
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                const AZ::u64 endAfterRead = m_writeIndex.load(AZStd::memory_order_relaxed);
+                const AZ::u64 firstValid = endAfterRead >= capacity ? endAfterRead - capacity + 1 : 0;
+                if (firstValid > begin)
+                {
+                    events.erase(events.begin(), events.begin() + static_cast<size_t>(AZStd::min(firstValid - begin, end - begin)));
+                }
+            }
+
+            void Clear()
+            {
+                m_firstIndex.store(m_writeIndex.load(AZStd::memory_order_acquire), AZStd::memory_order_relaxed);
+            }
+
+        private:
+            ProfilerEventList       m_events;
+            AZ::u64                 m_mask;
+            AZStd::atomic<AZ::u64>  m_writeIndex{ 0 };  ///< Only written by the owning thread.
+            AZStd::atomic<AZ::u64>  m_firstIndex{ 0 };  ///< Index of the first event that wasn't cleared.
+        };
+
         /**
          * Profile data stored per thread.
          */
@@ -43,10 +131,18 @@ namespace AZ
             typedef AZStd::list<ProfilerRegister, OSStdAllocator>   ProfilerRegisterList;
             typedef AZStd::fixed_vector<ProfilerSection*, m_maxStackSize> ProfilerSectionStack;
 
+            ~ProfilerThreadData()
+            {
+                delete m_events.load(AZStd::memory_order_acquire);
+            }
+
             AZStd::thread::id                   m_id;               ///< Thread id.
             ProfilerRegisterList                m_registers;        ///< Thread profiler registers (for this thread).
             mutable AZStd::shared_spin_mutex    m_registersLock;    ///< Lock for accessing thread profiler entries. Sadly the only reason for this to exists is so we can read safe the register counters.
             ProfilerSectionStack                m_stack;            ///< Current active sections stack.
+            AZStd::atomic<ProfilerEventRing*>   m_events{ nullptr };///< Event trace of this thread, created by the thread the first time it records an event.
+            AZ::u32                             m_index = 0;        ///< Order in which the thread was added, used to identify it in traces.
+            ProfilerData*                       m_profilerData = nullptr; ///< Profiler that owns this data, not set for the data used to measure the timer overhead.
         };
 
         struct ProfilerSystemData
@@ -63,19 +159,48 @@ namespace AZ
         {
             AZ_CLASS_ALLOCATOR(ProfilerData, OSAllocator, 0);
 
-            AZStd::fixed_vector<ProfilerThreadData, Profiler::m_maxNumberOfThreads>  m_threads;  ///< Array with thread with all belonging information.
-            AZStd::shared_spin_mutex                                                m_threadDataMutex;  ///< Spin read/write lock (shared_mutex) for access to the m_threads.
-            AZStd::fixed_vector<ProfilerSystemData, Profiler::m_maxNumberOfSystems>  m_systems; ///< Array with systems (profiler/timer groups) that you can enable/disable.
+            AZStd::list<ProfilerThreadData, OSStdAllocator>     m_threads;          ///< List with thread with all belonging information. A list so thread data never moves.
+            AZStd::shared_spin_mutex                            m_threadDataMutex;  ///< Spin read/write lock (shared_mutex) for access to the m_threads and m_systems.
+            AZStd::vector<ProfilerSystemData, OSStdAllocator>   m_systems;          ///< Array with systems (profiler/timer groups) that you can enable/disable.
+            AZStd::atomic<bool>                                 m_recordEvents{ false };
+            AZ::u32                                             m_eventRingCapacity = 0;
+            AZ::u32                                             m_nextThreadIndex = 1; ///< Never reused, so removed threads can't be confused with live ones in traces.
         };
 
+        //=========================================================================
+        // RecordEvent
+        //=========================================================================
+        static void RecordEvent(ProfilerThreadData& threadData, const ProfilerRegister& reg, ProfilerEventType type)
+        {
+            if (!threadData.m_profilerData || !threadData.m_profilerData->m_recordEvents.load(AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+
+            // Only the owning thread creates its ring, other threads only read the pointer.
+            ProfilerEventRing* ring = threadData.m_events.load(AZStd::memory_order_relaxed);
+            if (ring == nullptr)
+            {
+                ring = aznew ProfilerEventRing(threadData.m_profilerData->m_eventRingCapacity);
+                threadData.m_events.store(ring, AZStd::memory_order_release);
+            }
+            ring->Push(reg.m_name ? reg.m_name : reg.m_function, reg.m_systemId, type);
+        }
+
         //=========================================================================
         // Profiler
         // [12/3/2012]
         //=========================================================================
         Profiler::Profiler(const Descriptor& desc)
         {
-            (void)desc;
             m_data = aznew ProfilerData;
+            AZ_Assert(desc.m_eventRingCapacity > 0, "The profiler needs room for at least one event per thread.");
+            m_data->m_eventRingCapacity = 1;
+            while (m_data->m_eventRingCapacity < desc.m_eventRingCapacity)
+            {
+                m_data->m_eventRingCapacity <<= 1;
+            }
+            m_data->m_recordEvents = desc.m_recordEvents;
 
             // we can periodically call this function (like the end of every frame to refresh the current estimation).
             ProfilerRegister::TimerComputeStartStopOverhead();
@@ -147,18 +272,30 @@ namespace AZ
             }
         }
 
+        //=========================================================================
+        // FindSystem
+        //=========================================================================
+        const ProfilerSystemData* Profiler::FindSystem(AZ::u32 systemId) const
+        {
+            for (const ProfilerSystemData& system : m_data->m_systems)
+            {
+                if (system.m_id == systemId)
+                {
+                    return &system;
+                }
+            }
+            return nullptr;
+        }
+
         //=========================================================================
         // RegisterSystem
         // [12/3/2012]
         //=========================================================================
         bool Profiler::RegisterSystem(AZ::u32 systemId, const char* name, bool isActive)
         {
-            for (size_t i = 0; i < m_data->m_systems.size(); ++i)
+            if (FindSystem(systemId))
             {
-                if (m_data->m_systems[i].m_id == systemId)
-                {
-                    return false;
-                }
+                return false;
             }
             ProfilerSystemData sd;
             sd.m_id = systemId;
@@ -213,10 +350,8 @@ namespace AZ
                     if (sd.m_isActive != isActive)
                     {
                         sd.m_isActive = isActive;
-                        size_t numThreads = m_data->m_threads.size();
-                        for (size_t j = 0; j < numThreads; ++j)
+                        for (ProfilerThreadData& data : m_data->m_threads)
                         {
-                            ProfilerThreadData& data = m_data->m_threads[j];
                             ProfilerThreadData::ProfilerRegisterList::iterator it = data.m_registers.begin();
                             ProfilerThreadData::ProfilerRegisterList::iterator end = data.m_registers.end();
                             for (; it != end; ++it)
@@ -306,14 +441,9 @@ namespace AZ
         //=========================================================================
         bool Profiler::IsSystemActive(AZ::u32 systemId) const
         {
-            for (size_t i = 0; i < m_data->m_systems.size(); ++i)
-            {
-                if (m_data->m_systems[i].m_id == systemId)
-                {
-                    return m_data->m_systems[i].m_isActive != 0;
-                }
-            }
-            return false;
+            AZStd::shared_lock<AZStd::shared_spin_mutex> readLock(m_data->m_threadDataMutex);
+            const ProfilerSystemData* system = FindSystem(systemId);
+            return system && system->m_isActive;
         }
 
         //=========================================================================
@@ -322,6 +452,7 @@ namespace AZ
         //=========================================================================
         int Profiler::GetNumberOfSystems() const
         {
+            AZStd::shared_lock<AZStd::shared_spin_mutex> readLock(m_data->m_threadDataMutex);
             return static_cast<int>(m_data->m_systems.size());
         }
 
@@ -331,6 +462,7 @@ namespace AZ
         //=========================================================================
         const char* Profiler::GetSystemName(int index) const
         {
+            AZStd::shared_lock<AZStd::shared_spin_mutex> readLock(m_data->m_threadDataMutex);
             return m_data->m_systems[index].m_name;
         }
 
@@ -340,14 +472,9 @@ namespace AZ
         //=========================================================================
         const char* Profiler::GetSystemName(AZ::u32 systemId) const
         {
-            for (size_t i = 0; i < m_data->m_systems.size(); ++i)
-            {
-                if (m_data->m_systems[i].m_id == systemId)
-                {
-                    return m_data->m_systems[i].m_name;
-                }
-            }
-            return NULL;
+            AZStd::shared_lock<AZStd::shared_spin_mutex> readLock(m_data->m_threadDataMutex);
+            const ProfilerSystemData* system = FindSystem(systemId);
+            return system ? system->m_name : nullptr;
         }
 
         //=========================================================================
@@ -360,11 +487,9 @@ namespace AZ
             // otherwise we will crash badly. We can do only because nobody should
             // reference this registers but the thread local data.
             AZStd::unique_lock<AZStd::shared_spin_mutex> writeLock(m_data->m_threadDataMutex);
-            size_t numThreads = m_data->m_threads.size();
             ProfilerThreadData* threadData = NULL;
-            for (size_t i = 0; i < numThreads; ++i)
+            for (ProfilerThreadData& data : m_data->m_threads)
             {
-                ProfilerThreadData& data = m_data->m_threads[i];
                 if (data.m_id == id)
                 {
                     threadData = &data;
@@ -387,10 +512,8 @@ namespace AZ
         void Profiler::ReadRegisterValues(const ReadProfileRegisterCB& callback, AZ::u32 systemFilter, const AZStd::thread_id* threadFilter) const
         {
             AZStd::shared_lock<AZStd::shared_spin_mutex> readLock(s_instance->m_data->m_threadDataMutex);
-            size_t numThreads = Profiler::s_instance->m_data->m_threads.size();
-            for (size_t i = 0; i < numThreads; ++i)
+            for (const ProfilerThreadData& data : s_instance->m_data->m_threads)
             {
-                const ProfilerThreadData& data = s_instance->m_data->m_threads[i];
                 if (threadFilter && *threadFilter != data.m_id)
                 {
                     continue;
@@ -422,10 +545,8 @@ namespace AZ
         void Profiler::ResetRegisters()
         {
             AZStd::unique_lock<AZStd::shared_spin_mutex> writeLock(s_instance->m_data->m_threadDataMutex);
-            size_t numThreads = Profiler::s_instance->m_data->m_threads.size();
-            for (size_t i = 0; i < numThreads; ++i)
+            for (ProfilerThreadData& data : s_instance->m_data->m_threads)
             {
-                ProfilerThreadData& data = s_instance->m_data->m_threads[i];
                 {
                     AZStd::unique_lock<AZStd::shared_spin_mutex> registersLock(data.m_registersLock);
                     ProfilerThreadData::ProfilerRegisterList::iterator it = data.m_registers.begin();
@@ -441,6 +562,201 @@ namespace AZ
             // Reset registers event
         }
 
+        //=========================================================================
+        // SetEventRecording
+        //=========================================================================
+        void Profiler::SetEventRecording(bool isEnabled)
+        {
+            m_data->m_recordEvents.store(isEnabled, AZStd::memory_order_relaxed);
+        }
+
+        //=========================================================================
+        // IsEventRecording
+        //=========================================================================
+        bool Profiler::IsEventRecording() const
+        {
+            return m_data->m_recordEvents.load(AZStd::memory_order_relaxed);
+        }
+
+        //=========================================================================
+        // ClearEvents
+        //=========================================================================
+        void Profiler::ClearEvents()
+        {
+            AZStd::shared_lock<AZStd::shared_spin_mutex> readLock(m_data->m_threadDataMutex);
+            for (ProfilerThreadData& data : m_data->m_threads)
+            {
+                if (ProfilerEventRing* ring = data.m_events.load(AZStd::memory_order_acquire))
+                {
+                    ring->Clear();
+                }
+            }
+        }
+
+        static void AppendJsonString(AZStd::string& output, const char* text)
+        {
+            output += '"';
+            for (const char* c = text ? text : "Anonymous"; *c; ++c)
+            {
+                switch (*c)
+                {
+                case '"':
+                    output += "\\\"";
+                    break;
+                case '\\':
+                    output += "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(*c) < 0x20)
+                    {
+                        output += ' ';
+                    }
+                    else
+                    {
+                        output += *c;
+                    }
+                    break;
+                }
+            }
+            output += '"';
+        }
+
+        //=========================================================================
+        // WriteChromeTrace
+        //=========================================================================
+        bool Profiler::WriteChromeTrace(AZ::IO::GenericStream& stream) const
+        {
+            struct ThreadEvents
+            {
+                AZ::u32 m_index;
+                ProfilerEventList m_events;
+            };
+
+            // Copy the events first so threads that start profiling aren't blocked while the trace is written.
+            AZStd::vector<ThreadEvents, OSStdAllocator> threads;
+            AZStd::vector<ProfilerSystemData, OSStdAllocator> systems;
+            {
+                AZStd::shared_lock<AZStd::shared_spin_mutex> readLock(m_data->m_threadDataMutex);
+                systems = m_data->m_systems;
+                threads.reserve(m_data->m_threads.size());
+                for (const ProfilerThreadData& data : m_data->m_threads)
+                {
+                    if (const ProfilerEventRing* ring = data.m_events.load(AZStd::memory_order_acquire))
+                    {
+                        threads.emplace_back();
+                        threads.back().m_index = data.m_index;
+                        ring->Read(threads.back().m_events);
+                    }
+                }
+            }
+
+            AZStd::sys_time_t startTime = AZStd::numeric_limits<AZStd::sys_time_t>::max();
+            for (const ThreadEvents& thread : threads)
+            {
+                if (!thread.m_events.empty())
+                {
+                    startTime = AZStd::min(startTime, thread.m_events.front().m_time);
+                }
+            }
+            const double microsecondsPerTick = 1000000.0 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+
+            auto getSystemName = [&systems](AZ::u32 systemId) -> const char*
+            {
+                for (const ProfilerSystemData& system : systems)
+                {
+                    if (system.m_id == systemId)
+                    {
+                        return system.m_name;
+                    }
+                }
+                return nullptr;
+            };
+
+            AZStd::string output;
+            bool isValid = true;
+            auto flush = [&output, &isValid, &stream]()
+            {
+                isValid = isValid && stream.Write(output.size(), output.data()) == output.size();
+                output.clear();
+            };
+
+            char buffer[256];
+            bool isFirstEvent = true;
+            auto writeEvent = [&](const ProfilerEvent& event, AZ::u32 threadIndex, const ProfilerEvent* endEvent)
+            {
+                output += isFirstEvent ? "\n{\"name\":" : ",\n{\"name\":";
+                isFirstEvent = false;
+                AppendJsonString(output, event.m_name);
+                output += ",\"cat\":";
+                AppendJsonString(output, getSystemName(event.m_systemId));
+                const double start = static_cast<double>(event.m_time - startTime) * microsecondsPerTick;
+                if (endEvent)
+                {
+                    const double duration = static_cast<double>(endEvent->m_time - event.m_time) * microsecondsPerTick;
+                    azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}", start, duration, threadIndex);
+                }
+                else
+                {
+                    // The scope was still open when the events were read.
+                    azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), ",\"ph\":\"B\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", start, threadIndex);
+                }
+                output += buffer;
+            };
+
+            output = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            AZStd::vector<size_t, OSStdAllocator> openEvents;
+            for (const ThreadEvents& thread : threads)
+            {
+                azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+                    isFirstEvent ? "" : ",", thread.m_index, thread.m_index);
+                output += buffer;
+                isFirstEvent = false;
+
+                // Pair begin and end events into complete events. Ends without a begin had their begin overwritten, so they're skipped.
+                openEvents.clear();
+                for (size_t i = 0; i < thread.m_events.size(); ++i)
+                {
+                    const ProfilerEvent& event = thread.m_events[i];
+                    if (event.m_type == ProfilerEventType::Begin)
+                    {
+                        openEvents.push_back(i);
+                    }
+                    else if (!openEvents.empty())
+                    {
+                        writeEvent(thread.m_events[openEvents.back()], thread.m_index, &event);
+                        openEvents.pop_back();
+                    }
+
+                    if (output.size() > 64 * 1024)
+                    {
+                        flush();
+                    }
+                }
+                for (size_t openEvent : openEvents)
+                {
+                    writeEvent(thread.m_events[openEvent], thread.m_index, nullptr);
+                }
+            }
+            output += "\n]}\n";
+            flush();
+            return isValid;
+        }
+
+        //=========================================================================
+        // WriteChromeTrace
+        //=========================================================================
+        bool Profiler::WriteChromeTrace(const char* filePath) const
+        {
+            AZ::IO::SystemFile file;
+            if (!file.Open(filePath, AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Error("Profiler", false, "Unable to open '%s' to write the profiler trace.", filePath);
+                return false;
+            }
+            AZ::IO::SystemFileStream stream(&file, false);
+            return WriteChromeTrace(stream);
+        }
+
         //=========================================================================
         // CreateRegister
         // [6/28/2013]
@@ -469,9 +785,12 @@ namespace AZ
                 if (threadData == nullptr)  // if this is a new thread add the data
                 {
                     AZStd::thread::id threadId = AZStd::this_thread::get_id();
-                    Profiler::s_instance->m_data->m_threads.push_back();
-                    threadData = &Profiler::s_instance->m_data->m_threads.back();
+                    ProfilerData* profilerData = Profiler::s_instance->m_data;
+                    profilerData->m_threads.emplace_back();
+                    threadData = &profilerData->m_threads.back();
                     threadData->m_id = threadId;
+                    threadData->m_index = profilerData->m_nextThreadIndex++;
+                    threadData->m_profilerData = profilerData;
                 }
                 threadData->m_registers.push_back();
                 reg = &threadData->m_registers.back();
@@ -479,7 +798,8 @@ namespace AZ
                 reg->m_function = function;
                 reg->m_line = line;
                 reg->m_systemId = systemId;
-                reg->m_isActive = Profiler::s_instance->IsSystemActive(systemId) ? 1 : 0;
+                const ProfilerSystemData* system = Profiler::s_instance->FindSystem(systemId);
+                reg->m_isActive = system && system->m_isActive ? 1 : 0;
                 reg->m_type = type;
                 reg->m_threadData = threadData;
 
@@ -515,6 +835,7 @@ namespace AZ
                 section->m_register = reg;
                 section->m_start = end;
                 reg->m_threadData->m_stack.push_back(section);
+                RecordEvent(*reg->m_threadData, *reg, ProfilerEventType::Begin);
             }
             else
             {
@@ -545,6 +866,7 @@ namespace AZ
             {
                 section->m_register = reg;
                 reg->m_threadData->m_stack.push_back(section);
+                RecordEvent(*reg->m_threadData, *reg, ProfilerEventType::Begin);
                 section->m_start =  AZStd::chrono::system_clock::now();
             }
             else
@@ -560,6 +882,7 @@ namespace AZ
         void ProfilerRegister::TimerStop()
         {
             AZStd::chrono::system_clock::time_point end = AZStd::chrono::system_clock::now();
+            RecordEvent(*m_threadData, *this, ProfilerEventType::End);
             ProfilerSection* section = m_threadData->m_stack.back();
             AZStd::chrono::microseconds elapsedTime = end - section->m_start;
             {
@@ -320,6 +320,14 @@ namespace AZStd
     struct thread_id; // forward declare. This is the same type as AZStd::thread::id
 }
 
+namespace AZ
+{
+    namespace IO
+    {
+        class GenericStream;
+    }
+}
+
 namespace AZ
 {
     namespace Debug
@@ -327,6 +335,7 @@ namespace AZ
         class ProfilerSection;
         class ProfilerRegister;
         struct ProfilerThreadData;
+        struct ProfilerSystemData;
         struct ProfilerData;
 
         /**
@@ -337,15 +346,19 @@ namespace AZ
             friend class ProfilerRegister;
             friend struct ProfilerData;
         public:
-            /// Max number of threads supported by the profiler.
-            static const int m_maxNumberOfThreads = 32;
-            /// Max number of systems supported by the profiler. (We can switch this container if needed)
-            static const int m_maxNumberOfSystems = 64;
-
             ~Profiler();
 
             struct Descriptor
             {
+                Descriptor()
+                    : m_eventRingCapacity(16 * 1024)
+                    , m_recordEvents(false)
+                {}
+
+                /// Number of events each thread keeps for the event trace, rounded up to a power of two. When a ring is full the oldest events are overwritten.
+                AZ::u32 m_eventRingCapacity;
+                /// Record the event trace from the start. Recording adds two small writes to a thread local ring per profiled scope, so it can be left on.
+                bool m_recordEvents;
             };
 
             static bool         Create(const Descriptor& desc = Descriptor());
@@ -389,7 +402,25 @@ namespace AZ
             /// You can remove thread data ONLY IF YOU ARE SURE THIS THREAD IS NO LONGER ACTIVE! This will work only is specific cases.
             void                RemoveThreadData(AZStd::thread_id id);
 
+            /**
+             * Enables or disables the event trace. While enabled every active timer register writes a begin and end event to a ring owned
+             * by the thread, without taking any locks. Events are kept until they are overwritten, so the trace always covers the most recent
+             * activity of each thread.
+             */
+            void                SetEventRecording(bool isEnabled);
+            bool                IsEventRecording() const;
+            /// Discards the events recorded so far.
+            void                ClearEvents();
+            /**
+             * Writes the recorded events of all threads in the Chrome trace event format, which can be loaded in chrome://tracing or Perfetto.
+             * Events can be written while other threads keep recording.
+             */
+            bool                WriteChromeTrace(AZ::IO::GenericStream& stream) const;
+            bool                WriteChromeTrace(const char* filePath) const;
+
         private:
+            /// Returns the system data for systemId. Make sure the proper locks are LOCKED when calling this function (m_threadDataMutex)
+            const ProfilerSystemData*    FindSystem(AZ::u32 systemId) const;
             /// Register a new system in the profiler. Make sure the proper locks are LOCKED when calling this function (m_threadDataMutex)
             bool                RegisterSystem(AZ::u32 systemId, const char* name, bool isActive);
             /// Unregister a system. Make sure the proper locks are LOCKED when calling this function (m_threadDataMutex)
@@ -174,6 +174,22 @@ namespace AZ
          */
         static const bool EnableQueuedReferences = false;
 
+        /**
+         * Specifies whether queued events are stored in a lock-free ring instead of a mutex protected queue.
+         * Queuing an event on a lock-free queue never takes a lock and doesn't allocate memory for small events, which
+         * reduces contention on buses where many threads queue events, such as job threads reporting back to the main thread.
+         * Used only when #EnableEventQueue is true. #EventQueueMutexType is not used for lock-free queues.
+         * @see AZ::EBusLockFreeQueuePolicy
+         */
+        static const bool EnableLockFreeEventQueue = false;
+
+        /**
+         * The number of events the lock-free event queue can hold before events spill over into a slower, locked queue.
+         * Needs to be a power of two.
+         * Used only when #EnableLockFreeEventQueue is true.
+         */
+        static const size_t LockFreeEventQueueCapacity = 1024;
+
         /**
          * Locking primitive that is used when adding and removing
          * events from the queue.
@@ -445,7 +461,9 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = typename AZStd::Utils::if_c<Traits::EnableEventQueue && Traits::EnableLockFreeEventQueue,
+            EBusLockFreeQueuePolicy<ThisType, Traits::LockFreeEventQueueCapacity>,
+            EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>>::type;
 
         /**
          * Enables custom logic to run when a handler connects to
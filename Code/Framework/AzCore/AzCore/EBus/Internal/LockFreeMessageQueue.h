@@ -0,0 +1,268 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_constructible.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Number of bytes a queued message can store inline. Callables that are larger, such as lambdas that capture
+         * several strings by value, are allocated from the bus allocator instead.
+         */
+        inline static constexpr size_t QueuedMessageInlineSize = 64;
+        inline static constexpr size_t QueuedMessageAlignment = 16;
+
+        /**
+         * Type-erased, move-only callable used by queued EBus messages. Unlike AZStd::function the callable is stored in
+         * a fixed size buffer inside the message, so queuing a message doesn't need to allocate memory as long as the
+         * callable fits in InlineSize bytes.
+         */
+        template<size_t InlineSize, class Allocator>
+        class QueuedMessage
+        {
+        public:
+            QueuedMessage() = default;
+
+            template<class Function, typename = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::decay_t<Function>, QueuedMessage>>>
+            explicit QueuedMessage(Function&& function)
+            {
+                using Callable = AZStd::decay_t<Function>;
+                if constexpr (StoresInline<Callable>())
+                {
+                    new (&m_storage) Callable(AZStd::forward<Function>(function));
+                    m_manage = &ManageInline<Callable>;
+                }
+                else
+                {
+                    void* memory = Allocator().allocate(sizeof(Callable), alignof(Callable));
+                    *reinterpret_cast<Callable**>(&m_storage) = new (memory) Callable(AZStd::forward<Function>(function));
+                    m_manage = &ManageAllocated<Callable>;
+                }
+            }
+
+            QueuedMessage(QueuedMessage&& rhs)
+            {
+                MoveFrom(rhs);
+            }
+
+            QueuedMessage& operator=(QueuedMessage&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    Reset();
+                    MoveFrom(rhs);
+                }
+                return *this;
+            }
+
+            QueuedMessage(const QueuedMessage&) = delete;
+            QueuedMessage& operator=(const QueuedMessage&) = delete;
+
+            ~QueuedMessage()
+            {
+                Reset();
+            }
+
+            void operator()()
+            {
+                AZ_Assert(m_manage, "Calling an empty queued message.");
+                m_manage(Operation::Invoke, &m_storage, nullptr);
+            }
+
+            explicit operator bool() const
+            {
+                return m_manage != nullptr;
+            }
+
+            void Reset()
+            {
+                if (m_manage)
+                {
+                    m_manage(Operation::Destroy, &m_storage, nullptr);
+                    m_manage = nullptr;
+                }
+            }
+
+        private:
+            enum class Operation
+            {
+                Invoke,
+                MoveConstruct,
+                Destroy
+            };
+            using ManageFunction = void(*)(Operation operation, void* storage, void* target);
+            using Storage = AZStd::aligned_storage_t<InlineSize, QueuedMessageAlignment>;
+
+            template<class Callable>
+            static constexpr bool StoresInline()
+            {
+                return sizeof(Callable) <= InlineSize && alignof(Callable) <= QueuedMessageAlignment &&
+                    AZStd::is_nothrow_move_constructible_v<Callable>;
+            }
+
+            template<class Callable>
+            static void ManageInline(Operation operation, void* storage, void* target)
+            {
+                Callable* callable = reinterpret_cast<Callable*>(storage);
+                switch (operation)
+                {
+                case Operation::Invoke:
+                    (*callable)();
+                    break;
+                case Operation::MoveConstruct:
+                    new (target) Callable(AZStd::move(*callable));
+                    callable->~Callable();
+                    break;
+                case Operation::Destroy:
+                    callable->~Callable();
+                    break;
+                }
+            }
+
+            template<class Callable>
+            static void ManageAllocated(Operation operation, void* storage, void* target)
+            {
+                Callable* callable = *reinterpret_cast<Callable**>(storage);
+                switch (operation)
+                {
+                case Operation::Invoke:
+                    (*callable)();
+                    break;
+                case Operation::MoveConstruct:
+                    *reinterpret_cast<Callable**>(target) = callable;
+                    break;
+                case Operation::Destroy:
+                    callable->~Callable();
+                    Allocator().deallocate(callable, sizeof(Callable), alignof(Callable));
+                    break;
+                }
+            }
+
+            void MoveFrom(QueuedMessage& rhs)
+            {
+                if (rhs.m_manage)
+                {
+                    rhs.m_manage(Operation::MoveConstruct, &rhs.m_storage, &m_storage);
+                    m_manage = rhs.m_manage;
+                    rhs.m_manage = nullptr;
+                }
+            }
+
+            Storage m_storage;
+            ManageFunction m_manage{ nullptr };
+        };
+
+        /**
+         * Bounded multi-producer, single-consumer ring of queued messages. Producers claim a cell by advancing the
+         * enqueue position with a compare-and-swap, so pushing never takes a lock or allocates. Each cell carries a
+         * sequence number that tells the consumer when the message in it has been fully written.
+         * Only a single thread may pop at a time, which is left to the caller to guarantee.
+         */
+        template<class Message, size_t Capacity>
+        class LockFreeMessageRing
+        {
+            static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "The capacity of the message ring needs to be a power of two.");
+
+        public:
+            LockFreeMessageRing()
+            {
+                for (size_t i = 0; i < Capacity; ++i)
+                {
+                    m_cells[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+                }
+            }
+
+            //! Tries to add a message to the ring. The message is only moved from if there was room.
+            //! Safe to call from any number of threads.
+            bool TryPush(Message& message)
+            {
+                size_t position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                Cell* cell;
+                while (true)
+                {
+                    cell = &m_cells[position & Mask];
+                    size_t sequence = cell->m_sequence.load(AZStd::memory_order_acquire);
+                    ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+                    if (difference == 0)
+                    {
+                        if (m_enqueuePosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        // The consumer hasn't released this cell yet, so the ring is full.
+                        return false;
+                    }
+                    else
+                    {
+                        position = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                    }
+                }
+
+                cell->m_message = AZStd::move(message);
+                cell->m_sequence.store(position + 1, AZStd::memory_order_release);
+                return true;
+            }
+
+            //! Takes the oldest message from the ring. Returns false if the ring is empty or if the oldest message is
+            //! still being written by a producer. Only one thread can pop at a time.
+            bool TryPop(Message& message)
+            {
+                size_t position = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                Cell& cell = m_cells[position & Mask];
+                if (cell.m_sequence.load(AZStd::memory_order_acquire) != position + 1)
+                {
+                    return false;
+                }
+
+                message = AZStd::move(cell.m_message);
+                cell.m_sequence.store(position + Capacity, AZStd::memory_order_release);
+                m_dequeuePosition.store(position + 1, AZStd::memory_order_relaxed);
+                return true;
+            }
+
+            //! Approximate number of messages in the ring. Only exact if no other threads are pushing or popping.
+            size_t Count() const
+            {
+                size_t enqueued = m_enqueuePosition.load(AZStd::memory_order_relaxed);
+                size_t dequeued = m_dequeuePosition.load(AZStd::memory_order_relaxed);
+                return enqueued > dequeued ? enqueued - dequeued : 0;
+            }
+
+        private:
+            static constexpr size_t Mask = Capacity - 1;
+            static constexpr size_t CacheLineSize = 64;
+
+            struct Cell
+            {
+                AZStd::atomic<size_t> m_sequence;
+                Message m_message;
+            };
+
+            Cell m_cells[Capacity];
+            // Keep the positions on separate cache lines so producers and the consumer don't invalidate each other.
+            alignas(CacheLineSize) AZStd::atomic<size_t> m_enqueuePosition{ 0 };
+            alignas(CacheLineSize) AZStd::atomic<size_t> m_dequeuePosition{ 0 };
+        };
+    } // namespace Internal
+} // namespace AZ
@@ -22,6 +22,9 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/EBus/Internal/LockFreeMessageQueue.h>
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
@@ -307,6 +310,171 @@ namespace AZ
             AZStd::lock_guard<MutexType> lock(m_messagesMutex);
             return m_messages.size();
         }
+
+        template<class Function>
+        void QueueMessage(Function&& function)
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_messages.push(BusMessageCall(AZStd::forward<Function>(function), typename Bus::AllocatorType()));
+        }
+    };
+
+    /**
+     * Queue policy used when AZ::EBusTraits::EnableLockFreeEventQueue is true.
+     * Queued messages are stored in a fixed-size, lock-free ring so producers never take a lock and, as long as the
+     * message fits in the inline storage of AZ::Internal::QueuedMessage, never allocate. This makes it a good fit for buses
+     * that many job threads queue results on. When the ring is full, messages spill over into a mutex protected queue.
+     * Messages from a single thread are always executed in the order they were queued.
+     * The executing side holds an internal lock while taking messages from the queue, but not while calling them,
+     * so it's safe to queue new messages or call ExecuteQueuedEvents from a queued message.
+     */
+    template <class Bus, size_t Capacity>
+    struct EBusLockFreeQueuePolicy
+    {
+        using BusMessageCall = AZ::Internal::QueuedMessage<AZ::Internal::QueuedMessageInlineSize, typename Bus::AllocatorType>;
+        using MessageRing = AZ::Internal::LockFreeMessageRing<BusMessageCall, Capacity>;
+        using OverflowQueue = AZStd::deque<BusMessageCall, typename Bus::AllocatorType>;
+
+        //! Maximum number of messages that are taken from the queue at once before they're executed.
+        static constexpr size_t ExecuteBatchSize = 32;
+
+        EBusLockFreeQueuePolicy() = default;
+
+        template<class Function>
+        void QueueMessage(Function&& function)
+        {
+            BusMessageCall message(AZStd::forward<Function>(function));
+
+            // Producers announce themselves before pushing to the ring. This allows the executing thread to wait for pushes
+            // that started before the ring overflowed, which keeps messages from the same thread in order. Producers only
+            // announce themselves while the ring is in use, so once it overflows the executing thread only waits for the
+            // pushes already underway rather than for every producer that keeps queuing. The flag is checked again after the
+            // announcement in case the ring overflowed in between, after the executing thread may have stopped waiting.
+            if (!m_overflowActive.load())
+            {
+                m_ringProducers.fetch_add(1);
+                if (!m_overflowActive.load() && m_ring.TryPush(message))
+                {
+                    m_ringProducers.fetch_sub(1);
+                    return;
+                }
+                m_ringProducers.fetch_sub(1);
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            m_overflow.push_back(AZStd::move(message));
+            m_overflowActive.store(true);
+        }
+
+        void Execute()
+        {
+            AZ_Warning("System", IsActive(), "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+
+            BusMessageCall batch[ExecuteBatchSize];
+            while (true)
+            {
+                size_t count;
+                {
+                    AZStd::lock_guard<AZStd::recursive_mutex> lock(m_consumerMutex);
+                    count = PopBatch(batch);
+                }
+                if (count == 0)
+                {
+                    break;
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    batch[i]();
+                    batch[i].Reset();
+                }
+            }
+        }
+
+        void Clear()
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_consumerMutex);
+            BusMessageCall message;
+            while (m_ring.TryPop(message))
+            {
+                message.Reset();
+            }
+
+            AZStd::lock_guard<AZStd::mutex> overflowLock(m_overflowMutex);
+            m_overflow.clear();
+            m_overflowActive.store(false);
+        }
+
+        void SetActive(bool isActive)
+        {
+            m_isActive = isActive;
+            if (!isActive)
+            {
+                Clear();
+            }
+        };
+
+        bool IsActive()
+        {
+            return m_isActive;
+        }
+
+        size_t Count()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            return m_ring.Count() + m_overflow.size();
+        }
+
+    private:
+        size_t PopBatch(BusMessageCall (&batch)[ExecuteBatchSize])
+        {
+            size_t count = 0;
+            while (count < ExecuteBatchSize && m_ring.TryPop(batch[count]))
+            {
+                ++count;
+            }
+            if (count != 0 || !m_overflowActive.load())
+            {
+                return count;
+            }
+
+            // The ring overflowed. New messages go to the overflow queue now, but pushes to the ring that were already
+            // underway have to be executed first.
+            AZStd::exponential_backoff backoff;
+            while (m_ringProducers.load() != 0)
+            {
+                backoff.wait();
+            }
+            while (count < ExecuteBatchSize && m_ring.TryPop(batch[count]))
+            {
+                ++count;
+            }
+            if (count != 0)
+            {
+                return count;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_overflowMutex);
+            while (count < ExecuteBatchSize && !m_overflow.empty())
+            {
+                batch[count++] = AZStd::move(m_overflow.front());
+                m_overflow.pop_front();
+            }
+            if (m_overflow.empty())
+            {
+                m_overflow.clear(); // Free all memory, the overflow should only be used in rare cases.
+                m_overflowActive.store(false);
+            }
+            return count;
+        }
+
+        MessageRing m_ring;
+        AZStd::atomic<u32> m_ringProducers{ 0 };
+        AZStd::atomic_bool m_overflowActive{ false };
+        AZStd::atomic_bool m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+        AZStd::mutex m_overflowMutex;               ///< Used to control access to m_overflow. Never held while calling a message.
+        AZStd::recursive_mutex m_consumerMutex;     ///< Makes sure only one thread at a time takes messages from the ring.
+        OverflowQueue m_overflow;
     };
 
     /// @endcond
@@ -51,7 +51,7 @@ namespace AZ
             }
 
             auto stackEntry = AZStd::make_shared<BlockCache>(
-                cacheSize, blockSize, aznumeric_caster(hardware.m_maxPhysicalSectorSize), false);
+                cacheSize, blockSize, aznumeric_caster(hardware.m_maxPhysicalSectorSize), false, m_readAheadBlocks);
             stackEntry->SetNext(AZStd::move(parent));
             return stackEntry;
         }
@@ -69,12 +69,72 @@ namespace AZ
                 serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
                     ->Version(1)
                     ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                    ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                    ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                    ->Field("ReadAheadBlocks", &BlockCacheConfig::m_readAheadBlocks);
             }
         }
 
         static constexpr char CacheHitRateName[] = "Cache hit rate";
         static constexpr char CacheableName[] = "Cacheable";
+        static constexpr char ReadAheadHitRateName[] = "Read-ahead hit rate";
+
+        void BlockCache::GhostList::Resize(u32 capacity)
+        {
+            m_keys = AZStd::unique_ptr<size_t[]>(new size_t[capacity]);
+            m_capacity = capacity;
+            Clear();
+        }
+
+        void BlockCache::GhostList::Push(size_t key)
+        {
+            if (m_capacity == 0)
+            {
+                return;
+            }
+            if (m_keys[m_next] == s_emptyKey)
+            {
+                m_count++;
+            }
+            m_keys[m_next] = key;
+            m_next = (m_next + 1) % m_capacity;
+        }
+
+        bool BlockCache::GhostList::Remove(size_t key)
+        {
+            for (u32 i = 0; i < m_capacity; ++i)
+            {
+                if (m_keys[i] == key)
+                {
+                    m_keys[i] = s_emptyKey;
+                    m_count--;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void BlockCache::GhostList::Clear()
+        {
+            for (u32 i = 0; i < m_capacity; ++i)
+            {
+                m_keys[i] = s_emptyKey;
+            }
+            m_next = 0;
+            m_count = 0;
+        }
+
+        u32 BlockCache::GhostList::GetCount() const
+        {
+            return m_count;
+        }
+
+        size_t BlockCache::CalculateBlockKey(const RequestPath& filePath, u64 offset)
+        {
+            size_t key = filePath.GetHash();
+            AZStd::hash_combine(key, offset);
+            // The empty key is used to mark unused slots in the ghost lists.
+            return key != GhostList::s_emptyKey ? key : key + 1;
+        }
 
         void BlockCache::Section::Prefix(const Section& section)
         {
@@ -104,9 +164,10 @@ namespace AZ
             m_blockOffset = 0; // Two merged sections do not support caching.
         }
         
-        BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+        BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u32 readAheadBlocks)
             : StreamStackEntry("Block cache")
             , m_alignment(alignment)
+            , m_readAheadBlocks(readAheadBlocks)
             , m_onlyEpilogWrites(onlyEpilogWrites)
         {
             AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
@@ -126,6 +187,10 @@ namespace AZ
             m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
             m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
             m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+            m_blockLists = AZStd::unique_ptr<BlockList[]>(new BlockList[m_numBlocks]);
+            m_blockReadAhead = AZStd::unique_ptr<bool[]>(new bool[m_numBlocks]);
+            m_recentGhosts.Resize(m_numBlocks);
+            m_frequentGhosts.Resize(m_numBlocks);
             
             ResetCache();
         }
@@ -293,7 +358,26 @@ namespace AZ
                 // Nothing to cache so simply forward the call to the next entry in the stack for direct reading.
                 m_cacheableStat.PushSample(0.0);
                 Statistic::PlotImmediate(m_name, CacheableName, m_cacheableStat.GetMostRecentSample());
-                m_next->QueueRequest(request);
+                // Blocks that were read ahead can still be used though.
+                const u64 mainReadOffset = main.m_readOffset;
+                ReadMainPrefixFromCache(main, data.m_path);
+                if (main.m_readOffset == mainReadOffset)
+                {
+                    m_next->QueueRequest(request);
+                }
+                else if (main.m_used)
+                {
+                    FileRequest* mainRequest = m_context->GetNewInternalRequest();
+                    mainRequest->CreateRead(request, main.m_output, main.m_readSize, data.m_path,
+                        main.m_readOffset, main.m_readSize, data.m_sharedRead);
+                    m_next->QueueRequest(mainRequest);
+                }
+                else
+                {
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                }
+                ReadAhead(request, data, fileLength);
                 return;
             }
 
@@ -334,6 +418,7 @@ namespace AZ
                 }
             }
 
+            ReadMainPrefixFromCache(main, data.m_path);
             if (main.m_used)
             {
                 FileRequest* mainRequest = m_context->GetNewInternalRequest();
@@ -358,6 +443,88 @@ namespace AZ
                 request->SetStatus(IStreamerTypes::RequestStatus::Completed);
                 m_context->MarkRequestAsCompleted(request);
             }
+
+            ReadAhead(request, data, fileLength);
+        }
+
+        void BlockCache::ReadMainPrefixFromCache(Section& main, const RequestPath& filePath)
+        {
+            // Reads that are merged with a prolog don't start at a block boundary and can't be partially serviced from the cache.
+            while (main.m_used && IStreamerTypes::IsAlignedTo(main.m_readOffset, m_blockSize))
+            {
+                u32 cacheLocation = FindInCache(filePath, main.m_readOffset);
+                if (cacheLocation == s_fileNotCached || IsCacheBlockInFlight(cacheLocation))
+                {
+                    return;
+                }
+
+                u64 copySize = AZStd::min(main.m_readSize, aznumeric_cast<u64>(m_blockSize));
+                UseBlock(cacheLocation);
+                TouchBlock(cacheLocation);
+                memcpy(main.m_output, GetCacheBlockData(cacheLocation), copySize);
+
+                main.m_output += copySize;
+                main.m_readOffset += copySize;
+                main.m_readSize -= copySize;
+                main.m_used = main.m_readSize != 0;
+            }
+        }
+
+        void BlockCache::ReadAhead(FileRequest* request, const FileRequest::ReadData& data, u64 fileLength)
+        {
+            if (m_readAheadBlocks == 0 || !request->IsSequentialRead())
+            {
+                return;
+            }
+
+            u64 offset = AZ_SIZE_ALIGN_UP(data.m_offset + data.m_size, aznumeric_cast<u64>(m_blockSize));
+            for (u32 i = 0; i < m_readAheadBlocks && offset < fileLength; ++i, offset += m_blockSize)
+            {
+                if (!QueueReadAhead(data.m_path, offset, fileLength, data.m_sharedRead))
+                {
+                    return;
+                }
+            }
+        }
+
+        bool BlockCache::QueueReadAhead(const RequestPath& filePath, u64 offset, u64 fileLength, bool sharedRead)
+        {
+            // Reading ahead only uses spare capacity, so at least half of the slots are always available for actual requests.
+            if (CalculateAvailableRequestSlots() <= aznumeric_cast<s32>(m_numBlocks / 2))
+            {
+                return false;
+            }
+            if (FindInCache(filePath, offset) != s_fileNotCached)
+            {
+                return true;
+            }
+
+            u32 cacheLocation = RecycleOldestBlock(filePath, offset, true);
+            if (cacheLocation == s_fileNotCached)
+            {
+                return false;
+            }
+
+            Section section;
+            section.m_readOffset = offset;
+            section.m_readSize = AZStd::min(fileLength - offset, aznumeric_cast<u64>(m_blockSize));
+            section.m_cacheBlockIndex = cacheLocation;
+            section.m_used = true;
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(nullptr, GetCacheBlockData(cacheLocation), m_blockSize, filePath, offset, section.m_readSize, sharedRead);
+            readRequest->SetCompletionCallback([this](FileRequest& request)
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    CompleteRead(request);
+                });
+            m_inFlightRequests[cacheLocation] = readRequest;
+            m_numInFlightRequests++;
+            m_numReadAheads++;
+
+            m_pendingRequests.emplace(readRequest, section);
+            m_next->QueueRequest(readRequest);
+            return true;
         }
 
         void BlockCache::FlushCache(const RequestPath& filePath)
@@ -381,6 +548,14 @@ namespace AZ
             statistics.push_back(Statistic::CreatePercentage(m_name, CacheHitRateName, CalculateHitRatePercentage()));
             statistics.push_back(Statistic::CreatePercentage(m_name, CacheableName, CalculateCacheableRatePercentage()));
             statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateAvailableRequestSlots()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Recent blocks", m_numRecentBlocks));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Frequent blocks", m_numFrequentBlocks));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Recent target", m_recentTarget));
+            if (m_readAheadBlocks > 0)
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "Read-aheads", aznumeric_cast<s64>(m_numReadAheads)));
+                statistics.push_back(Statistic::CreatePercentage(m_name, ReadAheadHitRateName, CalculateReadAheadHitRatePercentage()));
+            }
 
             StreamStackEntry::CollectStatistics(statistics);
         }
@@ -395,6 +570,11 @@ namespace AZ
             return m_cacheableStat.GetAverage();
         }
 
+        double BlockCache::CalculateReadAheadHitRatePercentage() const
+        {
+            return m_readAheadHitStat.GetAverage();
+        }
+
         s32 BlockCache::CalculateAvailableRequestSlots() const
         {
             return  aznumeric_cast<s32>(m_numBlocks) - m_numInFlightRequests - m_numMetaDataRetrievalInProgress -
@@ -416,6 +596,7 @@ namespace AZ
 
         BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, u32 cacheBlock)
         {
+            UseBlock(cacheBlock);
             if (!IsCacheBlockInFlight(cacheBlock))
             {
                 TouchBlock(cacheBlock);
@@ -524,7 +705,8 @@ namespace AZ
                     section.m_wait = nullptr;
                 }
 
-                if (requestWasSuccessful)
+                // Sections that read ahead don't have an output and only fill the cache block.
+                if (requestWasSuccessful && section.m_output)
                 {
                     memcpy(section.m_output, GetCacheBlockData(cacheBlockIndex) + section.m_blockOffset, section.m_copySize);
                 }
@@ -678,34 +860,125 @@ namespace AZ
             m_blockLastTouched[index] = AZStd::chrono::high_resolution_clock::now();
         }
 
-        u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
+        void BlockCache::UseBlock(u32 index)
+        {
+            AZ_Assert(index < m_numBlocks, "Index for using a cache entry in the BlockCache is out of bounds.");
+            if (m_blockReadAhead[index])
+            {
+                // The first use of a block that was read ahead is the use it was loaded for, so it doesn't count towards the frequency.
+                m_blockReadAhead[index] = false;
+                m_readAheadHitStat.PushSample(1.0);
+                Statistic::PlotImmediate(m_name, ReadAheadHitRateName, m_readAheadHitStat.GetMostRecentSample());
+            }
+            else if (m_blockLists[index] == BlockList::Recent)
+            {
+                SetBlockList(index, BlockList::Frequent);
+            }
+        }
+
+        void BlockCache::SetBlockList(u32 index, BlockList list)
+        {
+            switch (m_blockLists[index])
+            {
+            case BlockList::Recent:
+                m_numRecentBlocks--;
+                break;
+            case BlockList::Frequent:
+                m_numFrequentBlocks--;
+                break;
+            default:
+                break;
+            }
+            switch (list)
+            {
+            case BlockList::Recent:
+                m_numRecentBlocks++;
+                break;
+            case BlockList::Frequent:
+                m_numFrequentBlocks++;
+                break;
+            default:
+                break;
+            }
+            m_blockLists[index] = list;
+        }
+
+        u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset, bool isReadAhead)
         {
             AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
 
-            // Find the oldest cache block.
-            TimePoint oldest = m_blockLastTouched[0];
-            u32 oldestIndex = 0;
-            for (u32 i = 1; i < m_numBlocks; ++i)
+            // Find the oldest cache block in both lists, or an unused block if there's one available.
+            u32 oldestRecent = s_fileNotCached;
+            u32 oldestFrequent = s_fileNotCached;
+            u32 unused = s_fileNotCached;
+            for (u32 i = 0; i < m_numBlocks; ++i)
             {
-                if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+                if (IsCacheBlockInFlight(i))
+                {
+                    continue;
+                }
+                
+                if (m_blockLists[i] == BlockList::Unused)
+                {
+                    unused = i;
+                    break;
+                }
+                u32& oldest = m_blockLists[i] == BlockList::Recent ? oldestRecent : oldestFrequent;
+                if (oldest == s_fileNotCached || m_blockLastTouched[i] < m_blockLastTouched[oldest])
                 {
-                    oldest = m_blockLastTouched[i];
-                    oldestIndex = i;
+                    oldest = i;
                 }
             }
 
-            if (!IsCacheBlockInFlight(oldestIndex))
+            u32 index = unused;
+            if (index == s_fileNotCached)
             {
-                // Recycle the block.
-                m_cachedPaths[oldestIndex] = filePath;
-                m_cachedOffsets[oldestIndex] = offset;
-                TouchBlock(oldestIndex);
-                return oldestIndex;
+                // Evict from the recent list once it has grown past its target, unless it's the only list with blocks to evict.
+                bool evictRecent = oldestRecent != s_fileNotCached && (oldestFrequent == s_fileNotCached || m_numRecentBlocks > m_recentTarget);
+                index = evictRecent ? oldestRecent : oldestFrequent;
+                if (index == s_fileNotCached)
+                {
+                    return s_fileNotCached;
+                }
+
+                if (m_blockReadAhead[index])
+                {
+                    m_readAheadHitStat.PushSample(0.0);
+                    Statistic::PlotImmediate(m_name, ReadAheadHitRateName, m_readAheadHitStat.GetMostRecentSample());
+                }
+                GhostList& ghosts = evictRecent ? m_recentGhosts : m_frequentGhosts;
+                ghosts.Push(CalculateBlockKey(m_cachedPaths[index], m_cachedOffsets[index]));
             }
-            else
+
+            BlockList list = BlockList::Recent;
+            if (!isReadAhead)
             {
-                return s_fileNotCached;
+                // A block that's requested again shortly after being evicted means the list it was evicted from was too small.
+                // Adjust the target size of the recent list towards that list and treat the block as frequently used.
+                size_t key = CalculateBlockKey(filePath, offset);
+                u32 recentGhostCount = m_recentGhosts.GetCount();
+                u32 frequentGhostCount = m_frequentGhosts.GetCount();
+                if (m_recentGhosts.Remove(key))
+                {
+                    u32 delta = AZStd::max(frequentGhostCount / recentGhostCount, 1u);
+                    m_recentTarget = AZStd::min(m_recentTarget + delta, m_numBlocks);
+                    list = BlockList::Frequent;
+                }
+                else if (m_frequentGhosts.Remove(key))
+                {
+                    u32 delta = AZStd::max(recentGhostCount / frequentGhostCount, 1u);
+                    m_recentTarget = m_recentTarget > delta ? m_recentTarget - delta : 0;
+                    list = BlockList::Frequent;
+                }
             }
+
+            // Recycle the block.
+            m_cachedPaths[index] = filePath;
+            m_cachedOffsets[index] = offset;
+            m_blockReadAhead[index] = isReadAhead;
+            SetBlockList(index, list);
+            TouchBlock(index);
+            return index;
         }
 
         u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset) const
@@ -736,14 +1009,22 @@ namespace AZ
             m_cachedOffsets[index] = 0;
             m_blockLastTouched[index] = TimePoint::min();
             m_inFlightRequests[index] = nullptr;
+            m_blockReadAhead[index] = false;
+            SetBlockList(index, BlockList::Unused);
         }
 
         void BlockCache::ResetCache()
         {
             for (u32 i = 0; i < m_numBlocks; ++i)
             {
+                m_blockLists[i] = BlockList::Unused;
                 ResetCacheEntry(i);
             }
+            m_numRecentBlocks = 0;
+            m_numFrequentBlocks = 0;
+            m_recentTarget = 0;
+            m_recentGhosts.Clear();
+            m_frequentGhosts.Clear();
             m_numInFlightRequests = 0;
         }
     } // namespace IO
@@ -54,13 +54,15 @@ namespace AZ
             u32 m_cacheSizeMib{ 8 };
             //! The size of the individual blocks inside the cache.
             BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+            //! The number of blocks following a read to load into the cache when the Scheduler detects the file is read sequentially.
+            u32 m_readAheadBlocks{ 0 };
         };
 
         class BlockCache
             : public StreamStackEntry
         {
         public:
-            BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+            BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites, u32 readAheadBlocks = 0);
             BlockCache(BlockCache&& rhs) = delete;
             BlockCache(const BlockCache& rhs) = delete;
             ~BlockCache() override;
@@ -84,6 +86,7 @@ namespace AZ
 
             double CalculateHitRatePercentage() const;
             double CalculateCacheableRatePercentage() const;
+            double CalculateReadAheadHitRatePercentage() const;
             s32 CalculateAvailableRequestSlots() const;
 
         protected:
@@ -113,8 +116,41 @@ namespace AZ
                 void Prefix(const Section& section);
             };
 
+            //! Cache blocks are split in two lists following the Adaptive Replacement Cache (ARC) policy. Blocks that have been
+            //! used once are kept in the recent list and blocks that have been used more than once are kept in the frequent list.
+            //! A single pass over a large file only cycles through the recent list, so it can't push out frequently used blocks.
+            enum class BlockList : u8
+            {
+                Unused, //!< The block doesn't contain any data.
+                Recent, //!< The block has been used once since it was loaded.
+                Frequent //!< The block has been used multiple times since it was loaded.
+            };
+
+            //! Fixed size history of blocks that were recently evicted from one of the lists. Only hashes of the file and offset are
+            //! stored, so a collision can at worst cause a suboptimal adjustment of the list sizes.
+            class GhostList
+            {
+            public:
+                static constexpr size_t s_emptyKey = 0;
+
+                void Resize(u32 capacity);
+                void Push(size_t key);
+                //! Removes the key if it's in the list and returns whether or not it was found.
+                bool Remove(size_t key);
+                void Clear();
+                u32 GetCount() const;
+
+            private:
+                AZStd::unique_ptr<size_t[]> m_keys;
+                u32 m_capacity{ 0 };
+                u32 m_next{ 0 };
+                u32 m_count{ 0 };
+            };
+
             using TimePoint = AZStd::chrono::system_clock::time_point;
 
+            static size_t CalculateBlockKey(const RequestPath& filePath, u64 offset);
+
             void ReadFile(FileRequest* request, FileRequest::ReadData& data);
             void ContinueReadFile(FileRequest* request, u64 fileLength);
             CacheResult ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath);
@@ -123,10 +159,18 @@ namespace AZ
             void CompleteRead(FileRequest& request);
             bool SplitRequest(Section& prolog, Section& main, Section& epilog, const RequestPath& filePath, u64 fileLength,
                 u64 offset, u64 size, u8* buffer) const;
+            //! Copies the leading blocks of the main section that are already available in the cache, for instance because they
+            //! were read ahead, and shrinks the section accordingly.
+            void ReadMainPrefixFromCache(Section& main, const RequestPath& filePath);
+            void ReadAhead(FileRequest* request, const FileRequest::ReadData& data, u64 fileLength);
+            bool QueueReadAhead(const RequestPath& filePath, u64 offset, u64 fileLength, bool sharedRead);
 
             u8* GetCacheBlockData(u32 index);
             void TouchBlock(u32 index);
-            AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
+            //! Registers a use of a cache block, which moves it to the frequent list if it's in the recent list.
+            void UseBlock(u32 index);
+            void SetBlockList(u32 index, BlockList list);
+            AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset, bool isReadAhead = false);
             u32 FindInCache(const RequestPath& filePath, u64 offset) const;
             bool IsCacheBlockInFlight(u32 index) const;
             void ResetCacheEntry(u32 index);
@@ -139,13 +183,26 @@ namespace AZ
 
             AZ::Statistics::RunningStatistic m_hitRateStat;
             AZ::Statistics::RunningStatistic m_cacheableStat;
+            //! Whether or not blocks that were read ahead were used before being evicted.
+            AZ::Statistics::RunningStatistic m_readAheadHitStat;
+
+            //! History of the blocks evicted from the recent and frequent lists.
+            GhostList m_recentGhosts;
+            GhostList m_frequentGhosts;
 
             u8* m_cache;
             u64 m_cacheSize;
             u32 m_blockSize;
             u32 m_alignment;
             u32 m_numBlocks;
+            u32 m_readAheadBlocks;
+            //! The number of blocks the recent list is allowed to grow to before frequently used blocks are evicted. This adapts to
+            //! the workload whenever a block is requested again shortly after it was evicted.
+            u32 m_recentTarget{ 0 };
+            u32 m_numRecentBlocks{ 0 };
+            u32 m_numFrequentBlocks{ 0 };
             s32 m_numInFlightRequests{ 0 };
+            u64 m_numReadAheads{ 0 };
             //! The file path associated with a cache block.
             AZStd::unique_ptr<RequestPath[]> m_cachedPaths; // Array of m_numBlocks size.
             //! The offset into the file the cache blocks starts at.
@@ -154,6 +211,10 @@ namespace AZ
             AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
             //! The file request that's currently read data into the cache block. If null, the block has been read.
             AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+            //! The eviction list the cache block belongs to.
+            AZStd::unique_ptr<BlockList[]> m_blockLists; // Array of m_numBlocks size.
+            //! Whether or not the cache block was read ahead and hasn't been used yet.
+            AZStd::unique_ptr<bool[]> m_blockReadAhead; // Array of m_numBlocks size.
             
             //! The number of requests waiting for meta data to be retrieved.
             s32 m_numMetaDataRetrievalInProgress{ 0 };
@@ -386,6 +386,7 @@ namespace AZ
             m_parent = nullptr;
             m_status = IStreamerTypes::RequestStatus::Pending;
             m_dependencies = 0;
+            m_isSequentialRead = false;
         }
 
         void FileRequest::SetOptionalParent(FileRequest* parent)
@@ -437,6 +438,25 @@ namespace AZ
             return m_estimatedCompletion;
         }
 
+        void FileRequest::SetSequentialRead(bool isSequentialRead)
+        {
+            m_isSequentialRead = isSequentialRead;
+        }
+
+        bool FileRequest::IsSequentialRead() const
+        {
+            const FileRequest* current = this;
+            while (current)
+            {
+                if (current->m_isSequentialRead)
+                {
+                    return true;
+                }
+                current = current->m_parent;
+            }
+            return false;
+        }
+
         //
         // ExternalFileRequest
         //
@@ -318,6 +318,12 @@ namespace AZ
             //! it's own additional delay.
             void SetEstimatedCompletion(AZStd::chrono::system_clock::time_point time);
             AZStd::chrono::system_clock::time_point GetEstimatedCompletion() const;
+
+            //! Marks the request as continuing where the previous read in the same file ended. This is set by the Scheduler
+            //! when it queues the request and can be used by entries in the stack to read ahead.
+            void SetSequentialRead(bool isSequentialRead);
+            //! Whether or not this request, or any request in its chain of parents, was marked as a sequential read.
+            bool IsSequentialRead() const;
             
         private:
             explicit FileRequest(Usage usage = Usage::Internal);
@@ -363,6 +369,9 @@ namespace AZ
 
             //! Whether or not this request is currently in a recycle bin. This allows detecting double deletes.
             bool m_inRecycleBin{ false };
+
+            //! Whether or not the Scheduler detected this request continues reading where the previous request ended.
+            bool m_isSequentialRead{ false };
         };
 
         class StreamerContext;
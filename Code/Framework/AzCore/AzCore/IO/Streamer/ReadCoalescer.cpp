@@ -0,0 +1,247 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> ReadCoalescerConfig::AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            auto stackEntry = AZStd::make_shared<ReadCoalescer>(
+                m_maxReadSizeKib * 1_kib, m_maxGapSizeKib * 1_kib, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void ReadCoalescerConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<ReadCoalescerConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("MaxReadSizeKib", &ReadCoalescerConfig::m_maxReadSizeKib)
+                    ->Field("MaxGapSizeKib", &ReadCoalescerConfig::m_maxGapSizeKib);
+            }
+        }
+
+        static constexpr char ReadsPerCombinedReadName[] = "Avg. reads per combined read";
+        static constexpr char CombinedReadsName[] = "Combined reads";
+        static constexpr char BufferMemoryName[] = "Buffer memory (MB)";
+
+        ReadCoalescer::ReadCoalescer(u64 maxReadSize, u64 maxGapSize, u32 memoryAlignment)
+            : StreamStackEntry("Read coalescer")
+            , m_maxReadSize(maxReadSize)
+            , m_maxGapSize(maxGapSize)
+            , m_memoryAlignment(memoryAlignment)
+        {
+            AZ_Assert(IStreamerTypes::IsPowerOf2(memoryAlignment), "Memory alignment needs to be a power of 2");
+        }
+
+        void ReadCoalescer::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+            if (!m_next)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+
+            // Reads are held until the next call to ExecuteRequests so all reads the scheduler queues in one pass
+            // can be checked for neighbors.
+            auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+            if (data != nullptr && data->m_size < m_maxReadSize)
+            {
+                m_pendingReads.push_back(request);
+            }
+            else
+            {
+                StreamStackEntry::QueueRequest(request);
+            }
+        }
+
+        bool ReadCoalescer::ExecuteRequests()
+        {
+            bool result = !m_pendingReads.empty();
+            while (!m_pendingReads.empty())
+            {
+                QueueNextRead();
+            }
+            return StreamStackEntry::ExecuteRequests() || result;
+        }
+
+        void ReadCoalescer::QueueNextRead()
+        {
+            FileRequest* first = m_pendingReads.front();
+            m_pendingReads.pop_front();
+            auto& firstData = AZStd::get<FileRequest::ReadData>(first->GetCommand());
+
+            // Collect the other pending reads in the same file, ordered by offset.
+            m_neighbors.clear();
+            m_neighbors.push_back(first);
+            for (FileRequest* pending : m_pendingReads)
+            {
+                auto& data = AZStd::get<FileRequest::ReadData>(pending->GetCommand());
+                if (data.m_path == firstData.m_path)
+                {
+                    m_neighbors.push_back(pending);
+                }
+            }
+
+            if (m_neighbors.size() == 1)
+            {
+                m_combinedReadsStat.PushSample(0.0);
+                StreamStackEntry::QueueRequest(first);
+                return;
+            }
+
+            AZStd::sort(m_neighbors.begin(), m_neighbors.end(), [](FileRequest* lhs, FileRequest* rhs)
+                {
+                    return AZStd::get<FileRequest::ReadData>(lhs->GetCommand()).m_offset <
+                        AZStd::get<FileRequest::ReadData>(rhs->GetCommand()).m_offset;
+                });
+
+            // Grow the range around the oldest read in both directions for as long as the gaps are small enough and the
+            // combined read fits.
+            auto firstIt = AZStd::find(m_neighbors.begin(), m_neighbors.end(), first);
+            auto rangeBegin = firstIt;
+            auto rangeEnd = firstIt + 1;
+            u64 rangeStart = firstData.m_offset;
+            u64 rangeStop = firstData.m_offset + firstData.m_size;
+            while (rangeEnd != m_neighbors.end())
+            {
+                auto& data = AZStd::get<FileRequest::ReadData>((*rangeEnd)->GetCommand());
+                u64 stop = AZStd::max(rangeStop, data.m_offset + data.m_size);
+                if (data.m_offset > rangeStop + m_maxGapSize || stop - rangeStart > m_maxReadSize)
+                {
+                    break;
+                }
+                rangeStop = stop;
+                ++rangeEnd;
+            }
+            while (rangeBegin != m_neighbors.begin())
+            {
+                auto& data = AZStd::get<FileRequest::ReadData>((*(rangeBegin - 1))->GetCommand());
+                u64 stop = AZStd::max(rangeStop, data.m_offset + data.m_size);
+                if (data.m_offset + data.m_size + m_maxGapSize < rangeStart || stop - data.m_offset > m_maxReadSize)
+                {
+                    break;
+                }
+                rangeStart = data.m_offset;
+                rangeStop = stop;
+                --rangeBegin;
+            }
+
+            size_t numCombined = AZStd::distance(rangeBegin, rangeEnd);
+            if (numCombined == 1)
+            {
+                m_combinedReadsStat.PushSample(0.0);
+                StreamStackEntry::QueueRequest(first);
+                return;
+            }
+
+            m_combinedReadsStat.PushSample(1.0);
+            m_readsPerCombinedReadStat.PushSample(aznumeric_cast<double>(numCombined));
+            Statistic::PlotImmediate(m_name, ReadsPerCombinedReadName, m_readsPerCombinedReadStat.GetMostRecentSample());
+
+            CombinedRead combinedRead;
+            combinedRead.m_offset = rangeStart;
+            combinedRead.m_bufferSize = AZ_SIZE_ALIGN_UP(rangeStop - rangeStart, aznumeric_cast<u64>(m_memoryAlignment));
+            combinedRead.m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                combinedRead.m_bufferSize, m_memoryAlignment, 0, "AZ::IO::Streamer ReadCoalescer", __FILE__, __LINE__));
+            m_memoryUsage += combinedRead.m_bufferSize;
+
+            // Add a wait to every read that's combined so they stay alive until the data has been copied.
+            combinedRead.m_waits.reserve(numCombined);
+            bool sharedRead = false;
+            for (auto it = rangeBegin; it != rangeEnd; ++it)
+            {
+                FileRequest* wait = m_context->GetNewInternalRequest();
+                wait->CreateWait(*it);
+                combinedRead.m_waits.push_back(wait);
+                sharedRead = sharedRead || AZStd::get<FileRequest::ReadData>((*it)->GetCommand()).m_sharedRead;
+
+                if (*it != first)
+                {
+                    m_pendingReads.erase(AZStd::find(m_pendingReads.begin(), m_pendingReads.end(), *it));
+                }
+            }
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(nullptr, combinedRead.m_buffer, combinedRead.m_bufferSize, firstData.m_path,
+                rangeStart, rangeStop - rangeStart, sharedRead);
+            read->SetCompletionCallback([this, combinedRead = AZStd::move(combinedRead)](FileRequest& request) mutable
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    FinishCombinedRead(request, combinedRead);
+                });
+            StreamStackEntry::QueueRequest(read);
+        }
+
+        void ReadCoalescer::FinishCombinedRead(FileRequest& request, CombinedRead& combinedRead)
+        {
+            const bool success = request.GetStatus() == IStreamerTypes::RequestStatus::Completed;
+            for (FileRequest* wait : combinedRead.m_waits)
+            {
+                if (success)
+                {
+                    auto& data = AZStd::get<FileRequest::ReadData>(wait->GetParent()->GetCommand());
+                    memcpy(data.m_output, combinedRead.m_buffer + (data.m_offset - combinedRead.m_offset), data.m_size);
+                }
+                wait->SetStatus(request.GetStatus());
+                m_context->MarkRequestAsCompleted(wait);
+            }
+
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(combinedRead.m_buffer, combinedRead.m_bufferSize, m_memoryAlignment);
+            m_memoryUsage -= combinedRead.m_bufferSize;
+            combinedRead.m_buffer = nullptr;
+        }
+
+        void ReadCoalescer::UpdateStatus(Status& status) const
+        {
+            StreamStackEntry::UpdateStatus(status);
+            // Reads that are held for combining haven't reached the next entry yet, so they still need to be subtracted from the
+            // slots it reported.
+            if (!m_pendingReads.empty())
+            {
+                status.m_numAvailableSlots -= aznumeric_cast<s32>(m_pendingReads.size());
+                status.m_isIdle = false;
+            }
+        }
+
+        void ReadCoalescer::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+        {
+            AZStd::reverse_copy(m_pendingReads.begin(), m_pendingReads.end(), AZStd::back_inserter(internalPending));
+            StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        }
+
+        void ReadCoalescer::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            constexpr double bytesToMB = 1.0 / (1024.0 * 1024.0);
+            statistics.push_back(Statistic::CreateFloat(m_name, ReadsPerCombinedReadName, m_readsPerCombinedReadStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, CombinedReadsName, m_combinedReadsStat.GetAverage()));
+            statistics.push_back(Statistic::CreateFloat(m_name, BufferMemoryName, m_memoryUsage * bytesToMB));
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,90 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct ReadCoalescerConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::ReadCoalescerConfig, "{1A8A4C2E-5B0F-4D6B-9E57-3C1D2F8B6A90}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(ReadCoalescerConfig, AZ::SystemAllocator, 0);
+
+            ~ReadCoalescerConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! The maximum size of a read after neighboring reads have been combined.
+            u32 m_maxReadSizeKib{ 1024 };
+            //! The largest number of unrequested bytes between two reads for them to still be combined. For archives this
+            //! should be at least the size of a local file header including the file name.
+            u32 m_maxGapSizeKib{ 4 };
+        };
+
+        //! Entry in the streaming stack that combines reads to neighboring parts of the same file into a single read.
+        //! Files in an archive are stored one after another, separated by a small header. When several files from the
+        //! same archive are requested together, such as during level loads, this entry issues a single read for all of
+        //! them instead of a read per file, after which the data is copied from the combined buffer to the requests.
+        //! Reads that don't have a neighbor queued at the same time are forwarded unchanged, so they're still read
+        //! directly into the output of the request.
+        class ReadCoalescer
+            : public StreamStackEntry
+        {
+        public:
+            ReadCoalescer(u64 maxReadSize, u64 maxGapSize, u32 memoryAlignment);
+            ~ReadCoalescer() override = default;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void UpdateStatus(Status& status) const override;
+            void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+                StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        private:
+            struct CombinedRead
+            {
+                AZStd::vector<FileRequest*> m_waits; //!< Wait requests that keep the original reads from completing.
+                u8* m_buffer{ nullptr };
+                u64 m_bufferSize{ 0 };
+                u64 m_offset{ 0 };
+            };
+
+            //! Combines the oldest pending read with any pending neighbors and queues the result to the next entry.
+            void QueueNextRead();
+            void FinishCombinedRead(FileRequest& request, CombinedRead& combinedRead);
+
+            AZStd::deque<FileRequest*> m_pendingReads;
+            AZStd::vector<FileRequest*> m_neighbors;
+            AZ::Statistics::RunningStatistic m_readsPerCombinedReadStat;
+            AZ::Statistics::RunningStatistic m_combinedReadsStat;
+            size_t m_memoryUsage{ 0 };
+            u64 m_maxReadSize;
+            u64 m_maxGapSize;
+            u32 m_memoryAlignment;
+        };
+    } // namespace IO
+} // namespace AZ
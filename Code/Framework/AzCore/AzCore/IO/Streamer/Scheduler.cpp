@@ -268,6 +268,7 @@ namespace AZ::IO
                 
                 if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
                 {
+                    next->SetSequentialRead(m_threadData.m_lastFilePath == args.m_path && m_threadData.m_lastFileOffset == args.m_offset);
                     m_threadData.m_lastFilePath = args.m_path;
                     m_threadData.m_lastFileOffset = args.m_offset + args.m_size;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -277,6 +278,7 @@ namespace AZ::IO
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
                 {
                     const CompressionInfo& info = args.m_compressionInfo;
+                    next->SetSequentialRead(m_threadData.m_lastFilePath == info.m_archiveFilename && m_threadData.m_lastFileOffset == info.m_offset);
                     m_threadData.m_lastFilePath = info.m_archiveFilename;
                     m_threadData.m_lastFileOffset = info.m_offset + info.m_compressedSize;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -18,8 +18,10 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathIntrinsics.h>
 
 #ifdef JOBMANAGER_ENABLE_STATS
 #   include <stdio.h>
@@ -33,55 +35,100 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
     return value > job->GetPriority();
 }
 
-void WorkQueue::LocalInsert(Job* job)
+WorkQueue::~WorkQueue()
 {
-    LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
-                                                                                   job->GetPriority(),
-                                                                                   CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    for (AZStd::atomic<DequeType*>& deque : m_deques)
+    {
+        DequeType* localDeque = deque.load(AZStd::memory_order_acquire);
+        if (localDeque)
+        {
+            azdestroy(localDeque);
+        }
+    }
 }
 
-Job* WorkQueue::LocalPopFront()
+unsigned int WorkQueue::GetPriorityIndex(const Job* job)
 {
-    LockGuard lock(m_lock);
+    // map [-128, 127] to [0, 255], higher index means higher priority
+    return static_cast<unsigned int>(static_cast<int>(job->GetPriority()) - AZStd::numeric_limits<AZ::s8>::min());
+}
 
-    Job* result = nullptr;
-    if (!m_queue.empty())
+WorkQueue::DequeType* WorkQueue::GetOrCreateDeque(unsigned int priorityIndex)
+{
+    // only the owner creates deques, so there is no race on creation, thieves only need to see the fully constructed deque
+    DequeType* deque = m_deques[priorityIndex].load(AZStd::memory_order_relaxed);
+    if (!deque)
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        deque = azcreate(DequeType, ());
+        m_deques[priorityIndex].store(deque, AZStd::memory_order_release);
     }
+    return deque;
+}
+
+void WorkQueue::LocalInsert(Job* job)
+{
+    const unsigned int priorityIndex = GetPriorityIndex(job);
+    GetOrCreateDeque(priorityIndex)->push(job);
 
-    return result;
+    // publish the occupancy after the push, a thief which sees the bit will find the job
+    AZStd::atomic<AZ::u64>& occupancy = m_occupancy[priorityIndex / 64];
+    const AZ::u64 bit = AZ::u64(1) << (priorityIndex % 64);
+    if ((occupancy.load(AZStd::memory_order_relaxed) & bit) == 0)
+    {
+        occupancy.fetch_or(bit, AZStd::memory_order_release);
+    }
 }
 
-Job* WorkQueue::TryStealFront()
+Job* WorkQueue::LocalPop()
 {
-    AZStd::exponential_backoff backoff;
-    for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
+    for (int word = NumOccupancyWords - 1; word >= 0; --word)
     {
-        // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        AZ::u64 occupancy = m_occupancy[word].load(AZStd::memory_order_relaxed);
+        while (occupancy)
         {
+            const unsigned int bitIndex = 63 - az_clz_u64(occupancy);
+            const AZ::u64 bit = AZ::u64(1) << bitIndex;
+            DequeType* deque = m_deques[word * 64 + bitIndex].load(AZStd::memory_order_relaxed);
+
             Job* result = nullptr;
-            if (!m_queue.empty())
+            if (deque->pop(&result))
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                return result;
             }
 
-            m_lock.unlock();
-            return result;
+            // the deque is empty and only we can push to it, so it's safe to clear the bit
+            m_occupancy[word].fetch_and(~bit, AZStd::memory_order_relaxed);
+            occupancy &= ~bit;
         }
-
-        backoff.wait();
     }
 
     return nullptr;
 }
 
+Job* WorkQueue::TrySteal()
+{
+    for (int word = NumOccupancyWords - 1; word >= 0; --word)
+    {
+        AZ::u64 occupancy = m_occupancy[word].load(AZStd::memory_order_acquire);
+        while (occupancy)
+        {
+            const unsigned int bitIndex = 63 - az_clz_u64(occupancy);
+            DequeType* deque = m_deques[word * 64 + bitIndex].load(AZStd::memory_order_acquire);
+
+            // a failed steal means the deque is empty or we lost the race to another thief/the owner,
+            // either way move on to the next priority rather than spinning on a contended deque
+            Job* result = nullptr;
+            if (deque && deque->steal(&result))
+            {
+                return result;
+            }
+
+            occupancy &= ~(AZ::u64(1) << bitIndex);
+        }
+    }
+
+    return nullptr;
+}
 
 AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_currentThreadInfo = nullptr;
 
@@ -407,7 +454,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
         if (!job && pendingJobs)
         {
             //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            job = pendingJobs->LocalPop();
         }
 
         bool isTerminated = false;
@@ -437,7 +484,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 //pop a new job from the local queue
                 if (pendingJobs)
                 {
-                    job = pendingJobs->LocalPopFront();
+                    job = pendingJobs->LocalPop();
                     if (job)
                     {
                         // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
@@ -478,7 +525,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
 
                     //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    job = victimQueue->TrySteal();
                     if (job)
                     {
                         //success, continue with the stolen job
@@ -19,6 +19,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/parallel/containers/work_stealing_deque.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
@@ -31,23 +32,41 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Per worker job queue. Jobs are kept in one lock-free work-stealing deque per priority, the owning worker
+         * pushes and pops at the bottom of the deques (LIFO for equal priorities, which keeps forked jobs hot in cache)
+         * while other workers steal from the top (FIFO), always starting with the highest priority available.
+         * IMPORTANT: LocalInsert and LocalPop must only be called from the worker that owns the queue.
+         */
         class WorkQueue final
         {
         public:
+            WorkQueue() = default;
+            ~WorkQueue();
+
             void LocalInsert(Job *job);
-            Job* LocalPopFront();
-            Job* TryStealFront();
+            Job* LocalPop();
+            Job* TrySteal();
 
         private:
+            WorkQueue(const WorkQueue&) = delete;
+            WorkQueue& operator=(const WorkQueue&) = delete;
+
             enum
             {
-                TryStealSpinAttemps = 16,
+                NumPriorities = 256, ///< One deque for each value of Job::GetPriority
+                NumOccupancyWords = NumPriorities / 64,
             };
-            using LockType = AZStd::shared_mutex;
-            using LockGuard = AZStd::lock_guard<LockType>;
+            using DequeType = AZStd::work_stealing_deque<Job*>;
+
+            static unsigned int GetPriorityIndex(const Job* job);
+            DequeType* GetOrCreateDeque(unsigned int priorityIndex);
 
-            AZStd::deque<Job*> m_queue;
-            LockType m_lock;
+            /// Deques are created lazily by the owner, most queues only ever see the default priority.
+            AZStd::atomic<DequeType*> m_deques[NumPriorities] = {};
+            /// One bit per priority which may contain jobs. Only written by the owner, a set bit can be stale
+            /// (the deque was stolen empty) but a non empty deque always has its bit set.
+            AZStd::atomic<AZ::u64> m_occupancy[NumOccupancyWords] = {};
         };
 
         /**
@@ -0,0 +1,260 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Jobs/TaskGraph.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    /**
+     * Job running a single task of the graph. The job is reused for every submission, and instead of a single dependent
+     * it notifies all the successors of the task when the task completes.
+     */
+    class TaskGraph::TaskJob
+        : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TaskJob, ThreadPoolAllocator, 0)
+
+        TaskJob(const Task& task, AZ::s8 priority, JobContext* context)
+            : Job(false, context, false, priority)
+            , m_task(task)
+        {
+        }
+
+        void SetSuccessors(Job* const* successors, size_t successorCount)
+        {
+            m_successors = successors;
+            m_successorCount = successorCount;
+        }
+
+    protected:
+        void Process() override
+        {
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "%s", m_task.m_descriptor.m_name);
+                m_task.m_function();
+            }
+
+            for (size_t i = 0; i < m_successorCount; ++i)
+            {
+                m_successors[i]->DecrementDependentCount();
+            }
+        }
+
+    private:
+        const Task& m_task;
+        Job* const* m_successors = nullptr;
+        size_t m_successorCount = 0;
+    };
+
+    TaskGraph::TaskGraph(const char* name, JobContext* context)
+        : m_name(name)
+        , m_context(context)
+    {
+    }
+
+    TaskGraph::~TaskGraph()
+    {
+        AZ_Assert(!m_isSubmitted, "Task graph '%s' destroyed while it's running, wait for it to complete first.", m_name);
+    }
+
+    TaskToken TaskGraph::AddTask(const TaskDescriptor& descriptor, AZStd::function<void()> function)
+    {
+        AZ_Assert(!IsCompiled(), "Tasks can't be added to task graph '%s' after it has been compiled.", m_name);
+        AZ_Assert(function, "Task '%s' added to task graph '%s' without a function.", descriptor.m_name, m_name);
+
+        Task& task = m_tasks.emplace_back();
+        task.m_descriptor = descriptor;
+        task.m_function = AZStd::move(function);
+        return TaskToken(static_cast<AZ::u32>(m_tasks.size() - 1));
+    }
+
+    void TaskGraph::AddDependency(TaskToken predecessor, TaskToken successor)
+    {
+        AZ_Assert(!IsCompiled(), "Dependencies can't be added to task graph '%s' after it has been compiled.", m_name);
+        AZ_Assert(predecessor.m_index < m_tasks.size() && successor.m_index < m_tasks.size(), "Invalid task token used in task graph '%s'.", m_name);
+
+        m_tasks[predecessor.m_index].m_successors.push_back(successor.m_index);
+        ++m_tasks[successor.m_index].m_predecessorCount;
+    }
+
+    bool TaskGraph::Compile()
+    {
+        AZ_Assert(!IsCompiled(), "Task graph '%s' has already been compiled.", m_name);
+        if (m_tasks.empty())
+        {
+            return false;
+        }
+
+        // Sort the tasks topologically, any task left over is part of a cycle
+        const AZ::u32 taskCount = static_cast<AZ::u32>(m_tasks.size());
+        size_t dependencyCount = 0;
+        AZStd::vector<AZ::u32> remainingPredecessors(taskCount);
+        AZStd::vector<AZ::u32> order;
+        order.reserve(taskCount);
+        for (AZ::u32 i = 0; i < taskCount; ++i)
+        {
+            remainingPredecessors[i] = m_tasks[i].m_predecessorCount;
+            dependencyCount += m_tasks[i].m_successors.size();
+            if (remainingPredecessors[i] == 0)
+            {
+                order.push_back(i);
+            }
+        }
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            for (AZ::u32 successor : m_tasks[order[i]].m_successors)
+            {
+                if (--remainingPredecessors[successor] == 0)
+                {
+                    order.push_back(successor);
+                }
+            }
+        }
+        if (order.size() != taskCount)
+        {
+            AZ_Error("TaskGraph", false, "Task graph '%s' can't be compiled because its dependencies contain a cycle.", m_name);
+            return false;
+        }
+
+        // The cost of a task's path is its own cost plus the cost of the most expensive path of its successors
+        AZStd::vector<AZ::u64> pathCosts(taskCount, 0);
+        m_criticalPathCost = 0;
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
+        {
+            const Task& task = m_tasks[*it];
+            AZ::u64 successorPathCost = 0;
+            for (AZ::u32 successor : task.m_successors)
+            {
+                successorPathCost = AZStd::max(successorPathCost, pathCosts[successor]);
+            }
+            pathCosts[*it] = task.m_descriptor.m_cost + successorPathCost;
+            m_criticalPathCost = AZStd::max(m_criticalPathCost, pathCosts[*it]);
+        }
+
+        m_completion = AZStd::make_unique<JobCompletion>(m_context);
+        m_jobs.reserve(taskCount);
+        for (AZ::u32 i = 0; i < taskCount; ++i)
+        {
+            const AZ::s32 boost = (m_criticalPathCost > 0)
+                ? static_cast<AZ::s32>((CriticalPathPriorityBoost * pathCosts[i]) / m_criticalPathCost)
+                : 0;
+            const AZ::s32 priority = AZ::GetClamp<AZ::s32>(m_tasks[i].m_descriptor.m_priority + boost,
+                AZStd::numeric_limits<AZ::s8>::min(), AZStd::numeric_limits<AZ::s8>::max());
+            m_jobs.emplace_back(AZStd::make_unique<TaskJob>(m_tasks[i], static_cast<AZ::s8>(priority), m_context));
+        }
+
+        // Reserved up front so the successor ranges handed to the jobs stay valid
+        m_successorJobs.reserve(dependencyCount);
+        for (AZ::u32 i = 0; i < taskCount; ++i)
+        {
+            const size_t firstSuccessor = m_successorJobs.size();
+            for (AZ::u32 successor : m_tasks[i].m_successors)
+            {
+                m_successorJobs.push_back(m_jobs[successor].get());
+            }
+            m_jobs[i]->SetSuccessors(m_successorJobs.data() + firstSuccessor, m_tasks[i].m_successors.size());
+
+            // Tasks without successors are the ones the completion waits on
+            if (m_tasks[i].m_successors.empty())
+            {
+                m_jobs[i]->SetDependent(m_completion.get());
+            }
+        }
+
+        return true;
+    }
+
+    bool TaskGraph::IsCompiled() const
+    {
+        return m_completion != nullptr;
+    }
+
+    void TaskGraph::Submit()
+    {
+        AZ_Assert(IsCompiled(), "Task graph '%s' must be compiled before it can be submitted.", m_name);
+        AZ_Assert(!m_isSubmitted, "Task graph '%s' submitted while the previous submission is still running.", m_name);
+        AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::AzCore, this, "TaskGraph: %s", m_name);
+
+        // The completion has to be reset first, resetting a job without successors adds it back to the completion's count
+        m_completion->Reset(true);
+        const size_t taskCount = m_tasks.size();
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            m_jobs[i]->Reset(false);
+            for (AZ::u32 j = 0; j < m_tasks[i].m_predecessorCount; ++j)
+            {
+                m_jobs[i]->IncrementDependentCount();
+            }
+        }
+
+        // All counts must be in place before any job starts, a finished task could otherwise start a successor too early
+        m_isSubmitted = true;
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            m_jobs[i]->Start();
+        }
+    }
+
+    void TaskGraph::Wait()
+    {
+        AZ_Assert(m_isSubmitted, "Task graph '%s' waited on without being submitted.", m_name);
+        m_completion->StartAndWaitForCompletion();
+        m_isSubmitted = false;
+        AZ_PROFILE_INTERVAL_END(AZ::Debug::ProfileCategory::AzCore, this);
+    }
+
+    void TaskGraph::SubmitAndWait()
+    {
+        Submit();
+        Wait();
+    }
+
+    bool TaskGraph::IsSubmitted() const
+    {
+        return m_isSubmitted;
+    }
+
+    void TaskGraph::Clear()
+    {
+        AZ_Assert(!m_isSubmitted, "Task graph '%s' cleared while it's running, wait for it to complete first.", m_name);
+        m_jobs.clear();
+        m_successorJobs.clear();
+        m_completion.reset();
+        m_tasks.clear();
+        m_criticalPathCost = 0;
+    }
+
+    const char* TaskGraph::GetName() const
+    {
+        return m_name;
+    }
+
+    size_t TaskGraph::GetTaskCount() const
+    {
+        return m_tasks.size();
+    }
+
+    AZ::s8 TaskGraph::GetSchedulingPriority(TaskToken token) const
+    {
+        AZ_Assert(token.m_index < m_jobs.size(), "Invalid task token or task graph '%s' isn't compiled.", m_name);
+        return m_jobs[token.m_index]->GetPriority();
+    }
+
+    AZ::u64 TaskGraph::GetCriticalPathCost() const
+    {
+        return m_criticalPathCost;
+    }
+}
@@ -0,0 +1,143 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    /**
+     * Settings of a single task in a TaskGraph.
+     */
+    struct TaskDescriptor
+    {
+        //! Name of the task in profiler captures. The string is not copied and must outlive the graph.
+        const char* m_name = "Task";
+        //! Priority of the task, with the same range and meaning as the Job priority.
+        AZ::s8 m_priority = 0;
+        //! Estimated cost of the task relative to the other tasks in the graph, used to find the critical path.
+        AZ::u32 m_cost = 1;
+    };
+
+    /**
+     * Handle to a task in a TaskGraph, used to declare dependencies between tasks.
+     */
+    class TaskToken
+    {
+    public:
+        TaskToken() = default;
+
+        bool IsValid() const { return m_index != InvalidIndex; }
+
+    private:
+        friend class TaskGraph;
+
+        static constexpr AZ::u32 InvalidIndex = static_cast<AZ::u32>(-1);
+
+        explicit TaskToken(AZ::u32 index) : m_index(index) {}
+
+        AZ::u32 m_index = InvalidIndex;
+    };
+
+    /**
+     * A graph of tasks and the dependencies between them which is built once and then submitted for execution
+     * as many times as needed, typically once per frame. Compile creates a job for every task, and Submit resets
+     * and restarts those same jobs, so running the graph doesn't allocate.
+     *
+     * Every task is scheduled with its own priority plus a boost of up to CriticalPathPriorityBoost, proportional to
+     * the cost of the longest chain of tasks starting at it. When several tasks are ready, the ones that hold up the
+     * rest of the graph the longest run first. Each task is a named profiler scope, and each submission is a profiler
+     * interval named after the graph.
+     *
+     * Usage:
+     *     AZ::TaskGraph graph("Prepare");
+     *     AZ::TaskToken culling = graph.AddTask({ "Culling" }, [this]() { Cull(); });
+     *     AZ::TaskToken sorting = graph.AddTask({ "Sorting", 0, 4 }, [this]() { Sort(); });
+     *     graph.AddDependency(culling, sorting);
+     *     graph.Compile();
+     *     ...
+     *     graph.SubmitAndWait(); // every frame
+     */
+    class TaskGraph
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TaskGraph, SystemAllocator, 0);
+
+        //! Largest priority boost given to the tasks on the critical path of the graph.
+        static constexpr AZ::s32 CriticalPathPriorityBoost = 16;
+
+        //! If a JobContext is not specified, the jobs are created with the default context when the graph is compiled, like any other job.
+        explicit TaskGraph(const char* name, JobContext* context = nullptr);
+        ~TaskGraph();
+
+        //! Adds a task to the graph, only allowed before the graph is compiled.
+        TaskToken AddTask(const TaskDescriptor& descriptor, AZStd::function<void()> function);
+
+        //! Makes the successor wait for the predecessor to complete before it starts, only allowed before the graph is compiled.
+        void AddDependency(TaskToken predecessor, TaskToken successor);
+
+        //! Creates the jobs that run the graph and calculates the priorities they're scheduled with.
+        //! @return false if the graph is empty or the dependencies contain a cycle, in which case the graph can't be submitted.
+        bool Compile();
+        bool IsCompiled() const;
+
+        //! Starts running the graph. The previous submission must have been waited on.
+        void Submit();
+
+        //! Blocks until the submitted graph completed. Don't call this from a job, it blocks the worker thread.
+        void Wait();
+
+        //! Submits the graph and blocks until it completed.
+        void SubmitAndWait();
+
+        bool IsSubmitted() const;
+
+        //! Removes all tasks and jobs, after which the graph can be built again.
+        void Clear();
+
+        const char* GetName() const;
+        size_t GetTaskCount() const;
+
+        //! Returns the priority the job of the task is scheduled with, only valid once the graph is compiled.
+        AZ::s8 GetSchedulingPriority(TaskToken token) const;
+
+        //! Returns the total cost of the most expensive chain of tasks in the graph, only valid once the graph is compiled.
+        AZ::u64 GetCriticalPathCost() const;
+
+    private:
+        class TaskJob;
+
+        struct Task
+        {
+            TaskDescriptor m_descriptor;
+            AZStd::function<void()> m_function;
+            AZStd::vector<AZ::u32> m_successors;
+            AZ::u32 m_predecessorCount = 0;
+        };
+
+        AZStd::vector<Task> m_tasks;
+
+        // Created by Compile, the successors of each task are a contiguous range of m_successorJobs
+        AZStd::vector<AZStd::unique_ptr<TaskJob>> m_jobs;
+        AZStd::vector<Job*> m_successorJobs;
+        AZStd::unique_ptr<JobCompletion> m_completion;
+        AZ::u64 m_criticalPathCost = 0;
+
+        const char* m_name;
+        JobContext* m_context;
+        bool m_isSubmitted = false;
+    };
+}
@@ -0,0 +1,79 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Memory/FrameSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    /**
+     * Frame allocator
+     * Allocator for temporary memory that doesn't outlive the current frame, such as the scratch containers used while
+     * culling or gathering instances. Allocations are a thread local pointer bump and all memory is reclaimed at once
+     * when the frame ends, see FrameSchema for details. The ComponentApplication ends the frame at the end of every tick
+     * if the allocator has been created.
+     * Allocations are not recorded, since most of them are never freed individually.
+     */
+    class FrameAllocator
+        : public SimpleSchemaAllocator<FrameSchema, FrameSchema::Descriptor, false, true>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameAllocator, SystemAllocator, 0)
+        AZ_TYPE_INFO(FrameAllocator, "{F8840724-5F4C-4583-B600-EB9E2C7F2E64}");
+
+        using Base = SimpleSchemaAllocator<FrameSchema, FrameSchema::Descriptor, false, true>;
+        using Descriptor = Base::Descriptor;
+
+        FrameAllocator()
+            : Base("FrameAllocator", "Linear allocator for memory that only lives for a single frame")
+        {
+        }
+
+        AllocatorDebugConfig GetDebugConfig() override
+        {
+            return AllocatorDebugConfig()
+                .ExcludeFromDebugging()
+                .MarksUnallocatedMemory(m_schema && GetFrameSchema()->GetDescriptor().m_debugChecks);
+        }
+
+        /// Ends the current frame, see FrameSchema::EndFrame.
+        void EndFrame()
+        {
+            GetFrameSchema()->EndFrame();
+        }
+
+        AZ::u32 GetFrame() const
+        {
+            return GetFrameSchema()->GetFrame();
+        }
+
+        size_type GetHighWatermark() const
+        {
+            return GetFrameSchema()->GetHighWatermark();
+        }
+
+        void ResetHighWatermark()
+        {
+            GetFrameSchema()->ResetHighWatermark();
+        }
+
+    private:
+        FrameSchema* GetFrameSchema() const
+        {
+            return static_cast<FrameSchema*>(m_schema);
+        }
+    };
+
+    typedef AZStdAlloc<FrameAllocator> FrameStdAllocator;
+}
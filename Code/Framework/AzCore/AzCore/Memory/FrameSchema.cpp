@@ -0,0 +1,551 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Memory/FrameSchema.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    struct FrameBlock
+    {
+        FrameBlock* m_next;
+        size_t m_size; ///< Size of the block including this header.
+
+        char* Begin() { return reinterpret_cast<char*>(this + 1); }
+        char* End() { return reinterpret_cast<char*>(this) + m_size; }
+    };
+
+    struct FrameArena
+    {
+        AZ_CLASS_ALLOCATOR(FrameArena, SystemAllocator, 0)
+
+        AZStd::thread_id m_threadId; ///< Reset when the owning thread exits.
+        bool m_ownerExited = false; ///< Set when the owning thread exits, guarded by the arena mutex of the schema.
+        FrameBlock* m_usedBlocks = nullptr; ///< Blocks with allocations from the current frame. The first one is allocated from.
+        FrameBlock* m_freeBlocks = nullptr; ///< Blocks that are kept for the following frames.
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        // The most recent allocation and where the arena was before it, so the allocation can be resized or freed.
+        char* m_lastAllocation = nullptr;
+        char* m_lastAllocationStart = nullptr;
+
+        // The members below are read by other threads to gather statistics, or written by them to make requests.
+        AZStd::atomic<AZ::u32> m_frame{ 0 };
+        AZStd::atomic<size_t> m_usedBytes{ 0 };
+        AZStd::atomic<size_t> m_peakBytes{ 0 };
+        AZStd::atomic<size_t> m_reservedBytes{ 0 };
+        AZStd::atomic<int> m_liveAllocations{ 0 }; ///< Only tracked if debug checks are enabled.
+        AZStd::atomic<bool> m_releaseFreeBlocks{ false };
+    };
+
+    namespace FrameSchemaInternal
+    {
+        // Freed memory and memory from previous frames is filled with this when debug checks are enabled.
+        static const unsigned char FreedMemoryPattern = 0xdd;
+        static const AZ::u32 AllocationGuard = 0xf4a3e5c1;
+
+        // Placed in front of every allocation when debug checks are enabled, otherwise only the size is.
+        struct AllocationHeader
+        {
+            FrameArena* m_arena;
+            AZ::u32 m_frame;
+            AZ::u32 m_guard;
+            size_t m_size; ///< Last, so it's right in front of the allocation either way.
+        };
+        static_assert(offsetof(AllocationHeader, m_size) + sizeof(size_t) == sizeof(AllocationHeader), "The size must directly precede the allocation.");
+
+        static AZStd::atomic<AZ::u32> s_generationCounter{ 0 };
+
+        // Cache of the arena of the calling thread. The generation makes sure it's not used with another schema.
+        static AZ_THREAD_LOCAL FrameArena* s_threadArena = nullptr;
+        static AZ_THREAD_LOCAL AZ::u32 s_threadArenaGeneration = 0;
+
+        // Only the owning thread changes the used bytes, so there's no need for an atomic add.
+        static void AddUsedBytes(FrameArena& arena, ptrdiff_t byteCount)
+        {
+            const size_t usedBytes = arena.m_usedBytes.load(AZStd::memory_order_relaxed) + byteCount;
+            arena.m_usedBytes.store(usedBytes, AZStd::memory_order_relaxed);
+            if (usedBytes > arena.m_peakBytes.load(AZStd::memory_order_relaxed))
+            {
+                arena.m_peakBytes.store(usedBytes, AZStd::memory_order_relaxed);
+            }
+        }
+
+        static AllocationHeader* GetHeader(void* ptr)
+        {
+            return reinterpret_cast<AllocationHeader*>(ptr) - 1;
+        }
+
+        static size_t& GetSize(void* ptr)
+        {
+            return *(reinterpret_cast<size_t*>(ptr) - 1);
+        }
+    }
+
+    FrameSchema::FrameSchema(const Descriptor& desc)
+        : m_desc(desc)
+    {
+        AZ_Assert(m_desc.m_blockSize > sizeof(FrameBlock), "The block size of the frame schema is too small.");
+        m_blockAllocator = m_desc.m_blockAllocator ? m_desc.m_blockAllocator : &AllocatorInstance<SystemAllocator>::Get();
+        m_generation = ++FrameSchemaInternal::s_generationCounter;
+        AZStd::ThreadEventBus::Handler::BusConnect();
+    }
+
+    FrameSchema::~FrameSchema()
+    {
+        using namespace FrameSchemaInternal;
+
+        AZStd::ThreadEventBus::Handler::BusDisconnect();
+
+        // IMPORTANT: We assume that no other threads use the schema anymore, as with the other thread aware schemas.
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        for (FrameArena* arena : m_arenas)
+        {
+            ReleaseArena(arena);
+        }
+        m_arenas.set_capacity(0);
+
+        if (s_threadArenaGeneration == m_generation)
+        {
+            s_threadArena = nullptr;
+            s_threadArenaGeneration = 0;
+        }
+    }
+
+    FrameSchema::pointer_type FrameSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+        using namespace FrameSchemaInternal;
+
+        FrameArena* arena = GetThreadArena();
+        const AZ::u32 frame = m_frame.load(AZStd::memory_order_acquire);
+        if (arena->m_frame.load(AZStd::memory_order_relaxed) != frame)
+        {
+            ResetArena(*arena, frame);
+        }
+
+        // The size is always stored so allocations can be moved by ReAllocate.
+        size_t headerSize = sizeof(size_t);
+        alignment = AZStd::max(alignment, AZStd::alignment_of<size_t>::value);
+        if (m_desc.m_debugChecks)
+        {
+            headerSize = sizeof(AllocationHeader);
+            alignment = AZStd::max(alignment, AZStd::alignment_of<AllocationHeader>::value);
+        }
+
+        uintptr_t address = AZ_SIZE_ALIGN_UP(reinterpret_cast<uintptr_t>(arena->m_current) + headerSize, alignment);
+        if (!arena->m_current || address + byteSize > reinterpret_cast<uintptr_t>(arena->m_end))
+        {
+            if (!AddBlock(*arena, byteSize + headerSize + alignment))
+            {
+                return nullptr;
+            }
+            address = AZ_SIZE_ALIGN_UP(reinterpret_cast<uintptr_t>(arena->m_current) + headerSize, alignment);
+        }
+
+        arena->m_lastAllocationStart = arena->m_current;
+        arena->m_lastAllocation = reinterpret_cast<char*>(address);
+        arena->m_current = arena->m_lastAllocation + byteSize;
+        AddUsedBytes(*arena, arena->m_current - arena->m_lastAllocationStart);
+
+        GetSize(arena->m_lastAllocation) = byteSize;
+        if (m_desc.m_debugChecks)
+        {
+            AllocationHeader* header = GetHeader(arena->m_lastAllocation);
+            header->m_arena = arena;
+            header->m_frame = frame;
+            header->m_guard = AllocationGuard;
+            arena->m_liveAllocations.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+
+        return arena->m_lastAllocation;
+    }
+
+    void FrameSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+        using namespace FrameSchemaInternal;
+
+        if (!ptr)
+        {
+            return;
+        }
+
+        const AZ::u32 frame = m_frame.load(AZStd::memory_order_acquire);
+        if (m_desc.m_debugChecks)
+        {
+            AllocationHeader* header = GetHeader(ptr);
+            if (header->m_guard != AllocationGuard)
+            {
+                AZ_Error("FrameAllocator", false, "Address %p was not allocated by the frame allocator, was already freed, "
+                    "or was allocated in a frame that has ended.", ptr);
+                return;
+            }
+            if (header->m_frame != frame)
+            {
+                AZ_Error("FrameAllocator", false, "Address %p was allocated in frame %u but freed in frame %u. "
+                    "Memory from the frame allocator can't be used after the frame it was allocated in.", ptr, header->m_frame, frame);
+                return;
+            }
+            header->m_guard = 0;
+            header->m_arena->m_liveAllocations.fetch_sub(1, AZStd::memory_order_relaxed);
+            memset(ptr, FreedMemoryPattern, header->m_size);
+        }
+
+        // Memory is only reclaimed if this was the last allocation on this thread, which is common for temporary containers.
+        // Everything else is reclaimed when the frame ends.
+        FrameArena* arena = s_threadArenaGeneration == m_generation ? s_threadArena : nullptr;
+        if (arena && ptr == arena->m_lastAllocation && arena->m_frame.load(AZStd::memory_order_relaxed) == frame)
+        {
+            AddUsedBytes(*arena, -(arena->m_current - arena->m_lastAllocationStart));
+            arena->m_current = arena->m_lastAllocationStart;
+            arena->m_lastAllocation = nullptr;
+        }
+    }
+
+    FrameSchema::size_type FrameSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        using namespace FrameSchemaInternal;
+
+        FrameArena* arena = s_threadArenaGeneration == m_generation ? s_threadArena : nullptr;
+        if (!arena || !ptr || ptr != arena->m_lastAllocation || arena->m_frame.load(AZStd::memory_order_relaxed) != m_frame.load(AZStd::memory_order_acquire))
+        {
+            return 0;
+        }
+
+        char* address = reinterpret_cast<char*>(ptr);
+        if (newSize > static_cast<size_t>(arena->m_end - address))
+        {
+            return 0;
+        }
+
+        AddUsedBytes(*arena, (address + newSize) - arena->m_current);
+        arena->m_current = address + newSize;
+        GetSize(ptr) = newSize;
+        return newSize;
+    }
+
+    FrameSchema::pointer_type FrameSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+        if ((reinterpret_cast<uintptr_t>(ptr) & (AZStd::max<size_t>(newAlignment, 1) - 1)) == 0 && Resize(ptr, newSize) == newSize)
+        {
+            return ptr;
+        }
+
+        // Only the most recent allocation of the calling thread can grow in place, everything else is moved.
+        const size_t oldSize = FrameSchemaInternal::GetSize(ptr);
+        pointer_type newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZStd::min(oldSize, newSize));
+            DeAllocate(ptr);
+        }
+        return newPtr;
+    }
+
+    FrameSchema::size_type FrameSchema::AllocationSize(pointer_type ptr)
+    {
+        return ptr ? FrameSchemaInternal::GetSize(ptr) : 0;
+    }
+
+    void FrameSchema::GarbageCollect()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        ReleaseOwnerlessArenas(m_frame.load(AZStd::memory_order_acquire));
+        // The free blocks of an arena can only be touched by its own thread, so ask the arenas to release them.
+        for (FrameArena* arena : m_arenas)
+        {
+            arena->m_releaseFreeBlocks.store(true, AZStd::memory_order_relaxed);
+        }
+    }
+
+    FrameSchema::size_type FrameSchema::NumAllocatedBytes() const
+    {
+        const AZ::u32 frame = m_frame.load(AZStd::memory_order_acquire);
+        size_type result = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        for (const FrameArena* arena : m_arenas)
+        {
+            // Arenas that haven't been reset yet only hold memory from previous frames.
+            if (arena->m_frame.load(AZStd::memory_order_relaxed) == frame)
+            {
+                result += arena->m_usedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+
+    FrameSchema::size_type FrameSchema::Capacity() const
+    {
+        size_type result = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        for (const FrameArena* arena : m_arenas)
+        {
+            result += arena->m_reservedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    FrameSchema::size_type FrameSchema::GetMaxAllocationSize() const
+    {
+        return m_blockAllocator->GetMaxAllocationSize();
+    }
+
+    FrameSchema::size_type FrameSchema::GetUnAllocatedMemory(bool isPrint) const
+    {
+        const size_type capacity = Capacity();
+        const size_type allocated = NumAllocatedBytes();
+        if (isPrint)
+        {
+            AZ_TracePrintf("FrameAllocator", "Frame %u: allocated %zu, reserved %zu, high watermark %zu bytes\n",
+                GetFrame(), allocated, capacity, GetHighWatermark());
+        }
+        return capacity > allocated ? capacity - allocated : 0;
+    }
+
+    IAllocatorAllocate* FrameSchema::GetSubAllocator()
+    {
+        return m_blockAllocator;
+    }
+
+    void FrameSchema::EndFrame()
+    {
+        using namespace FrameSchemaInternal;
+
+        const AZ::u32 frame = m_frame.fetch_add(1, AZStd::memory_order_acq_rel) + 1;
+        if (s_threadArenaGeneration == m_generation)
+        {
+            ResetArena(*s_threadArena, frame);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        ReleaseOwnerlessArenas(frame);
+    }
+
+    AZ::u32 FrameSchema::GetFrame() const
+    {
+        return m_frame.load(AZStd::memory_order_acquire);
+    }
+
+    FrameSchema::size_type FrameSchema::GetHighWatermark() const
+    {
+        size_type result = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        for (const FrameArena* arena : m_arenas)
+        {
+            result += arena->m_peakBytes.load(AZStd::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    void FrameSchema::ResetHighWatermark()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        for (FrameArena* arena : m_arenas)
+        {
+            arena->m_peakBytes.store(arena->m_usedBytes.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        }
+    }
+
+    FrameArena* FrameSchema::GetThreadArena()
+    {
+        using namespace FrameSchemaInternal;
+
+        if (s_threadArenaGeneration == m_generation)
+        {
+            return s_threadArena;
+        }
+
+        // The cache holds the arena of another schema, or this thread hasn't allocated from this schema before.
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        FrameArena* arena = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+            auto existing = AZStd::find_if(m_arenas.begin(), m_arenas.end(), [threadId](const FrameArena* arena) { return arena->m_threadId == threadId; });
+            if (existing != m_arenas.end())
+            {
+                arena = *existing;
+            }
+            else
+            {
+                arena = aznew FrameArena();
+                arena->m_threadId = threadId;
+                arena->m_frame.store(m_frame.load(AZStd::memory_order_acquire), AZStd::memory_order_relaxed);
+                m_arenas.push_back(arena);
+            }
+        }
+
+        s_threadArena = arena;
+        s_threadArenaGeneration = m_generation;
+        return arena;
+    }
+
+    void FrameSchema::ResetArena(FrameArena& arena, AZ::u32 frame)
+    {
+        using namespace FrameSchemaInternal;
+
+        if (m_desc.m_debugChecks)
+        {
+            const int liveAllocations = arena.m_liveAllocations.exchange(0, AZStd::memory_order_relaxed);
+            AZ_Error("FrameAllocator", liveAllocations == 0, "%d allocation(s) made in frame %u were not freed before the frame ended. "
+                "Memory from the frame allocator can't be used after the frame it was allocated in.", liveAllocations, arena.m_frame.load(AZStd::memory_order_relaxed));
+
+            for (FrameBlock* block = arena.m_usedBlocks; block; block = block->m_next)
+            {
+                memset(block->Begin(), FreedMemoryPattern, block->End() - block->Begin());
+            }
+        }
+
+        const bool releaseFreeBlocks = arena.m_releaseFreeBlocks.exchange(false, AZStd::memory_order_relaxed);
+        auto releaseBlock = [this, &arena](FrameBlock* block)
+        {
+            arena.m_reservedBytes.fetch_sub(block->m_size, AZStd::memory_order_relaxed);
+            m_blockAllocator->DeAllocate(block, block->m_size);
+        };
+
+        if (releaseFreeBlocks)
+        {
+            while (arena.m_freeBlocks)
+            {
+                FrameBlock* block = arena.m_freeBlocks;
+                arena.m_freeBlocks = block->m_next;
+                releaseBlock(block);
+            }
+        }
+
+        while (arena.m_usedBlocks)
+        {
+            FrameBlock* block = arena.m_usedBlocks;
+            arena.m_usedBlocks = block->m_next;
+            // Blocks that were made for large allocations aren't kept, as those are usually one-offs.
+            if (block->m_size == m_desc.m_blockSize && !releaseFreeBlocks)
+            {
+                block->m_next = arena.m_freeBlocks;
+                arena.m_freeBlocks = block;
+            }
+            else
+            {
+                releaseBlock(block);
+            }
+        }
+
+        arena.m_current = nullptr;
+        arena.m_end = nullptr;
+        arena.m_lastAllocation = nullptr;
+        arena.m_lastAllocationStart = nullptr;
+        arena.m_usedBytes.store(0, AZStd::memory_order_relaxed);
+        arena.m_frame.store(frame, AZStd::memory_order_relaxed);
+    }
+
+    bool FrameSchema::AddBlock(FrameArena& arena, size_t minimumSize)
+    {
+        FrameBlock* block = nullptr;
+        const size_t requiredSize = minimumSize + sizeof(FrameBlock);
+        if (requiredSize <= m_desc.m_blockSize && arena.m_freeBlocks)
+        {
+            block = arena.m_freeBlocks;
+            arena.m_freeBlocks = block->m_next;
+        }
+        else
+        {
+            const size_t blockSize = AZStd::max(requiredSize, m_desc.m_blockSize);
+            void* memory = m_blockAllocator->Allocate(blockSize, AZStd::alignment_of<FrameBlock>::value, 0, "AZ::FrameSchema block", __FILE__, __LINE__);
+            if (!memory)
+            {
+                return false;
+            }
+            block = new (memory) FrameBlock{ nullptr, blockSize };
+            arena.m_reservedBytes.fetch_add(blockSize, AZStd::memory_order_relaxed);
+        }
+
+        block->m_next = arena.m_usedBlocks;
+        arena.m_usedBlocks = block;
+        arena.m_current = block->Begin();
+        arena.m_end = block->End();
+        return true;
+    }
+
+    void FrameSchema::ReleaseArena(FrameArena* arena)
+    {
+        for (FrameBlock* blockList : { arena->m_usedBlocks, arena->m_freeBlocks })
+        {
+            while (blockList)
+            {
+                FrameBlock* block = blockList;
+                blockList = block->m_next;
+                m_blockAllocator->DeAllocate(block, block->m_size);
+            }
+        }
+        delete arena;
+    }
+
+    void FrameSchema::ReleaseOwnerlessArenas(AZ::u32 frame)
+    {
+        // Memory allocated by a thread may still be used by other threads until the frame it was allocated in ends.
+        auto isReleasable = [frame](const FrameArena* arena)
+        {
+            return arena->m_ownerExited && arena->m_frame.load(AZStd::memory_order_relaxed) != frame;
+        };
+        size_t keptCount = 0;
+        for (FrameArena* arena : m_arenas)
+        {
+            if (isReleasable(arena))
+            {
+                ReleaseArena(arena);
+            }
+            else
+            {
+                m_arenas[keptCount++] = arena;
+            }
+        }
+        m_arenas.resize(keptCount);
+    }
+
+    void FrameSchema::OnThreadEnter(const AZStd::thread::id& id, const AZStd::thread_desc* desc)
+    {
+        (void)id;
+        (void)desc;
+    }
+
+    void FrameSchema::OnThreadExit(const AZStd::thread::id& id)
+    {
+        using namespace FrameSchemaInternal;
+
+        // This is called on the exiting thread. Its arena can't be released yet, so it's marked and released once the frame ends.
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        for (FrameArena* arena : m_arenas)
+        {
+            if (arena->m_threadId == id && !arena->m_ownerExited)
+            {
+                arena->m_threadId = AZStd::thread_id();
+                arena->m_ownerExited = true;
+            }
+        }
+        if (s_threadArenaGeneration == m_generation)
+        {
+            s_threadArena = nullptr;
+            s_threadArenaGeneration = 0;
+        }
+    }
+}
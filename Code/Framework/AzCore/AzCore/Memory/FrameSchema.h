@@ -0,0 +1,122 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/threadbus.h>
+
+namespace AZ
+{
+    struct FrameArena;
+
+    /**
+     * Frame schema
+     * Linear (bump pointer) allocation for memory that only lives for a single frame. Every thread allocates from its own
+     * arena, so allocating doesn't take any locks. Freeing memory is mostly a no-op; memory is reclaimed in bulk at the
+     * start of the next frame, which is started by calling EndFrame. The arena of a thread is reset the first time the
+     * thread allocates in a new frame, so memory must not be used after the frame it was allocated in.
+     * The blocks used by the arenas are kept between frames, so after a few frames allocations no longer hit the
+     * block allocator. The arena of a thread that exits is released when the frame it exited in has ended.
+     */
+    class FrameSchema
+        : public IAllocatorAllocate
+        , protected AZStd::ThreadEventBus::Handler
+    {
+    public:
+        struct Descriptor
+        {
+            Descriptor()
+                : m_blockSize(1024 * 1024)
+#if defined(AZ_DEBUG_BUILD)
+                , m_debugChecks(true)
+#else
+                , m_debugChecks(false)
+#endif
+                , m_blockAllocator(nullptr)
+            {}
+
+            size_t m_blockSize; ///< Size of the blocks arenas allocate from. Larger allocations get a block of their own.
+            /**
+             * Adds a larger header to every allocation so mistakes can be detected. Freed memory and memory from previous frames
+             * is filled with a pattern, memory that is freed after the frame it was allocated in is reported, and allocations
+             * that are still alive when a frame ends are reported.
+             */
+            bool m_debugChecks;
+            IAllocatorAllocate* m_blockAllocator; ///< If you provide this interface we will use it for block allocations, otherwise SystemAllocator will be used.
+        };
+
+        FrameSchema(const Descriptor& desc = Descriptor());
+        ~FrameSchema() override;
+
+        //---------------------------------------------------------------------
+        // IAllocatorAllocate
+        //---------------------------------------------------------------------
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Only the most recent allocation of the calling thread can be resized.
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        /// Resizes in place if possible, otherwise the memory is moved to a new allocation.
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+        /// Blocks that are not in use are released the next time their thread starts a frame. The arenas of threads
+        /// that exited in a previous frame are released right away.
+        void GarbageCollect() override;
+
+        /// Number of bytes allocated by all threads in the current frame.
+        size_type NumAllocatedBytes() const override;
+        /// Number of bytes in blocks that are held by the arenas.
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        size_type GetUnAllocatedMemory(bool isPrint = false) const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+        const Descriptor& GetDescriptor() const { return m_desc; }
+
+        /// Ends the current frame. Memory allocated before this call must not be used anymore. The arena of the calling
+        /// thread is reset right away, the arenas of other threads the next time they allocate.
+        void EndFrame();
+
+        /// Returns the index of the current frame.
+        AZ::u32 GetFrame() const;
+
+        /// Returns the highest number of bytes each thread allocated in a single frame, summed over all threads.
+        size_type GetHighWatermark() const;
+        void ResetHighWatermark();
+
+    protected:
+        FrameSchema(const FrameSchema&) = delete;
+        FrameSchema& operator=(const FrameSchema&) = delete;
+
+        //---------------------------------------------------------------------
+        // AZStd::ThreadEventBus
+        //---------------------------------------------------------------------
+        void OnThreadEnter(const AZStd::thread::id& id, const AZStd::thread_desc* desc) override;
+        void OnThreadExit(const AZStd::thread::id& id) override;
+
+        FrameArena* GetThreadArena();
+        void ResetArena(FrameArena& arena, AZ::u32 frame);
+        bool AddBlock(FrameArena& arena, size_t minimumSize);
+        void ReleaseArena(FrameArena* arena);
+        /// Releases the arenas of exited threads that only hold memory from frames before the given one, m_arenaMutex must be held.
+        void ReleaseOwnerlessArenas(AZ::u32 frame);
+
+        Descriptor m_desc;
+        IAllocatorAllocate* m_blockAllocator = nullptr;
+        AZStd::vector<FrameArena*> m_arenas;
+        mutable AZStd::mutex m_arenaMutex;
+        AZStd::atomic<AZ::u32> m_frame{ 0 };
+        AZ::u32 m_generation = 0; ///< Identifies this schema in the thread local arena cache.
+    };
+}
@@ -46,6 +46,19 @@ namespace AZ
                 AZ::NameDictionary::Instance().TryReleaseName(this);
             }
         }
+
+        bool NameData::TryAddRef()
+        {
+            int useCount = m_useCount.load(AZStd::memory_order_relaxed);
+            while (useCount >= 0)
+            {
+                if (m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acquire))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
     }
 }
 
@@ -44,6 +44,10 @@ namespace AZ
             void add_ref();
             void release();
 
+            // Adds a reference unless the entry has already been released from the dictionary. This is used by lookups
+            // that don't lock the dictionary and may find an entry that's being released on another thread.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
@@ -53,6 +57,7 @@ namespace AZ
 
             // TODO: We should be able to change this to a normal bool after introducing name dictionary garbage collection
             AZStd::atomic<bool> m_hashCollision = false; // Tracks whether the hash has been involved in a collision
+            AZStd::atomic<bool> m_isLiteral = false; // Tracks whether the entry is cached by an AZ_NAME_LITERAL
         };
     }
 }
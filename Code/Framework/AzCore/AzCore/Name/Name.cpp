@@ -37,6 +37,13 @@ namespace AZ
         *this = NameDictionary::Instance().FindName(hash);
     }
 
+    Name::Name(Internal::NameLiteral& literal)
+    {
+        AZ_Assert(NameDictionary::IsReady(), "Attempted to initialize Name '%.*s' before the NameDictionary is ready.", AZ_STRING_ARG(literal.m_name));
+
+        *this = NameDictionary::Instance().MakeName(literal);
+    }
+
     Name::Name(Internal::NameData* data)
         : m_data{data}
         , m_view{data->GetName()}
@@ -16,10 +16,48 @@
 
 namespace AZ
 {
+    class Name;
     class NameDictionary;
     class ScriptDataContext;
     class ReflectContext;
 
+    namespace Internal
+    {
+        //! Calculates the hash for a name string. Collisions aren't resolved here; that's handled by the NameDictionary.
+        //! This is constexpr so the hash of a string literal can be calculated at compile time.
+        constexpr NameData::Hash CalcNameHash(AZStd::string_view name)
+        {
+            // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            // of network synchronization. So just take the low 32 bits.
+            return static_cast<NameData::Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+        }
+
+        //! Backing storage for AZ_NAME_LITERAL. The hash is calculated at compile time and the dictionary entry is
+        //! cached the first time a Name is created from the literal, so later uses don't hash or look up the string.
+        class NameLiteral
+        {
+            friend Name;
+            friend NameDictionary;
+        public:
+            constexpr explicit NameLiteral(AZStd::string_view name)
+                : m_name(name)
+                , m_hash(CalcNameHash(name))
+            {}
+
+            NameLiteral(const NameLiteral&) = delete;
+            NameLiteral& operator=(const NameLiteral&) = delete;
+
+        private:
+            AZStd::string_view m_name;
+            NameData::Hash m_hash;
+
+            // The NameDictionary can be destroyed and created again, so the cached entry is only used if it was stored by
+            // the dictionary that's currently active.
+            AZStd::atomic<uint32_t> m_generation{ 0 };
+            AZStd::atomic<NameData*> m_data{ nullptr };
+        };
+    }
+
     //! The Name class provides very fast string equality comparison, so that names can be used as IDs without sacrificing performance.
     //! It is a smart pointer to a NameData held in a NameDictionary, where names are tracked, de-duplicated, and ref-counted.
     //!
@@ -56,6 +94,9 @@ namespace AZ
         //! The hash will be used to find an existing name in the dictionary. If there is no
         //! name with this hash, the resulting name will be empty.
         explicit Name(Hash hash);
+
+        //! Creates an instance of a name from a literal. Use AZ_NAME_LITERAL instead of calling this directly.
+        explicit Name(Internal::NameLiteral& literal);
         
         //! Assigns a new name.  
         //! The name string is used as a key to lookup an entry in the dictionary, and is not 
@@ -122,6 +163,12 @@ namespace AZ
 
 } // namespace AZ
 
+//! Creates a Name from a string literal. The hash is calculated at compile time and the dictionary is only searched the
+//! first time the expression runs, which makes this much cheaper than Name(AZStd::string_view) in frequently run code.
+//! The result is a regular Name, so like any other Name it must not be stored in a static variable.
+#define AZ_NAME_LITERAL(str) \
+    ([]() -> AZ::Name { static AZ::Internal::NameLiteral s_azNameLiteral{ str }; return AZ::Name(s_azNameLiteral); }())
+
 namespace AZStd
 {
     template <typename T>
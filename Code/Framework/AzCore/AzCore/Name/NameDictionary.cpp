@@ -14,7 +14,7 @@
 #include <AzCore/Name/Internal/NameData.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
-#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -22,10 +22,20 @@
 namespace AZ
 {
     static const char* NameDictionaryInstanceName = "NameDictionaryInstance";
+    static const char* NameDictionaryGenerationName = "NameDictionaryGeneration";
 
     namespace NameDictionaryInternal
     {
         static AZ::EnvironmentVariable<NameDictionary*> s_instance = nullptr;
+        static AZ::EnvironmentVariable<uint32_t> s_generation = nullptr;
+
+        static constexpr size_t InitialTableCapacity = 1024;
+
+        // Marks a slot of an entry that has been released. Lookups continue past these slots.
+        static Internal::NameData* RemovedEntry()
+        {
+            return reinterpret_cast<Internal::NameData*>(static_cast<uintptr_t>(1));
+        }
     }
 
     void NameDictionary::Create()
@@ -38,10 +48,16 @@ namespace AZ
         {
             s_instance = AZ::Environment::CreateVariable<NameDictionary*>(NameDictionaryInstanceName);
         }
+        if (!s_generation)
+        {
+            s_generation = AZ::Environment::CreateVariable<uint32_t>(NameDictionaryGenerationName, 0u);
+        }
 
         if (!s_instance.Get())
         {
-            s_instance.Set(aznew NameDictionary());
+            NameDictionary* dictionary = aznew NameDictionary();
+            dictionary->m_generation = ++(*s_generation);
+            s_instance.Set(dictionary);
         }
     }
 
@@ -79,43 +95,62 @@ namespace AZ
 
         return *(*s_instance);
     }
-    
+
+    NameDictionary::NameTable::NameTable(size_t capacity)
+        : m_slots(aznew Slot[capacity])
+        , m_mask(capacity - 1)
+    {
+        AZ_Assert((capacity & m_mask) == 0, "The capacity of the name table needs to be a power of two.");
+    }
+
     NameDictionary::NameDictionary()
-    {}
+    {
+        m_tables.push_back(AZStd::make_unique<NameTable>(NameDictionaryInternal::InitialTableCapacity));
+        m_table = m_tables.back().get();
+    }
 
     NameDictionary::~NameDictionary()
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (Internal::NameData* nameData : GetEntries())
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
+            const int useCount = nameData->m_useCount;
+            const bool hadCollision = nameData->m_hashCollision;
+            const bool isLiteral = nameData->m_isLiteral;
 
             if (useCount == 0)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                // Entries that had resolved hash collisions or are cached by literals are allowed to remain in the dictionary until shutdown.
+                AZ_Assert(hadCollision || isLiteral, "Only colliding or literal names are allowed to remain in the dictionary");
                 delete nameData;
             }
             else
             {
                 leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
             }
         }
 
+        for (Internal::NameData* nameData : m_freeEntries)
+        {
+            delete nameData;
+        }
+
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        if (Internal::NameData* nameData = AcquireEntry(hash))
+        {
+            return AdoptEntry(nameData);
+        }
+
+        AZStd::scoped_lock lock(m_mutex);
+        if (Slot* slot = FindSlot(hash))
         {
-            return Name(iter->second);
+            return Name(slot->m_data.load(AZStd::memory_order_relaxed));
         }
         return Name();
     }
@@ -128,48 +163,256 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
 
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // This path is faster than the loop below because it doesn't need to lock the dictionary.
+        if (Internal::NameData* nameData = AcquireEntry(hash))
         {
-            return AZStd::move(name);
+            Name name = AdoptEntry(nameData);
+            if (name.GetStringView() == nameString)
+            {
+                return name;
+            }
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::scoped_lock lock(m_mutex);
 
-        auto iter = m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
+            Slot* slot = FindSlot(hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (!slot)
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                Internal::NameData* nameData = CreateEntry(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                InsertEntry(nameData);
                 return Name(nameData);
             }
+
+            Internal::NameData* nameData = slot->m_data.load(AZStd::memory_order_relaxed);
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            if (nameData->GetName() == nameString)
             {
-                return Name(iter->second);
+                return Name(nameData);
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
 
+    Name NameDictionary::MakeName(Internal::NameLiteral& literal)
+    {
+        if (literal.m_generation.load(AZStd::memory_order_acquire) == m_generation)
+        {
+            return Name(literal.m_data.load(AZStd::memory_order_relaxed));
+        }
+
+        if (literal.m_name.empty())
+        {
+            return Name();
+        }
+
+        Name name = MakeName(literal.m_name, literal.m_hash);
+        {
+            // The literal keeps a pointer to the entry, so it has to stay in the dictionary until the dictionary is destroyed.
+            // This is set under the lock so it can't race with TryReleaseName.
+            AZStd::scoped_lock lock(m_mutex);
+            name.m_data->m_isLiteral = true;
+        }
+        // Multiple threads may get here for the same literal, but they'll all store the same entry.
+        literal.m_data.store(name.m_data.get(), AZStd::memory_order_relaxed);
+        literal.m_generation.store(m_generation, AZStd::memory_order_release);
+        return name;
+    }
+
+    Internal::NameData* NameDictionary::AcquireEntry(Name::Hash hash) const
+    {
+        using namespace NameDictionaryInternal;
+
+        const NameTable* table = m_table.load(AZStd::memory_order_acquire);
+        const size_t mask = table->m_mask;
+        size_t index = hash & mask;
+        for (size_t probeCount = 0; probeCount <= mask; ++probeCount)
+        {
+            const Slot& slot = table->m_slots[index];
+            Internal::NameData* nameData = slot.m_data.load(AZStd::memory_order_acquire);
+            if (!nameData)
+            {
+                break;
+            }
+
+            if (nameData != RemovedEntry() && slot.m_hash.load(AZStd::memory_order_relaxed) == hash)
+            {
+                // The entry could have been released and reused for another name since it was read from the slot. Once a
+                // reference is held it can't be reused anymore, so checking the hash after that is enough to detect this.
+                if (nameData->TryAddRef())
+                {
+                    if (nameData->m_hash == hash)
+                    {
+                        return nameData;
+                    }
+                    nameData->release();
+                }
+                break;
+            }
+
+            index = (index + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    Name NameDictionary::AdoptEntry(Internal::NameData* nameData)
+    {
+        Name name(nameData);
+        // The Name added its own reference, so the one from AcquireEntry can be dropped. This can't be the last reference.
+        nameData->m_useCount.fetch_sub(1);
+        return name;
+    }
+
+    NameDictionary::Slot* NameDictionary::FindSlot(Name::Hash hash) const
+    {
+        using namespace NameDictionaryInternal;
+
+        NameTable* table = m_table.load(AZStd::memory_order_relaxed);
+        const size_t mask = table->m_mask;
+        size_t index = hash & mask;
+        for (size_t probeCount = 0; probeCount <= mask; ++probeCount)
+        {
+            Slot& slot = table->m_slots[index];
+            Internal::NameData* nameData = slot.m_data.load(AZStd::memory_order_relaxed);
+            if (!nameData)
+            {
+                break;
+            }
+            if (nameData != RemovedEntry() && slot.m_hash.load(AZStd::memory_order_relaxed) == hash)
+            {
+                return &slot;
+            }
+            index = (index + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    void NameDictionary::InsertEntry(Internal::NameData* nameData)
+    {
+        // Keep at least half of the slots empty so lookups stay short. If most of the used slots belong to released
+        // entries the table is cleaned up at its current size, otherwise it grows.
+        NameTable* table = m_table.load(AZStd::memory_order_relaxed);
+        const size_t capacity = table->m_mask + 1;
+        if ((m_entryCount + m_removedCount + 1) * 2 > capacity)
+        {
+            RebuildTable((m_entryCount + 1) * 4 > capacity ? capacity * 2 : capacity);
+            table = m_table.load(AZStd::memory_order_relaxed);
+        }
+
+        PlaceEntry(*table, nameData);
+        ++m_entryCount;
+    }
+
+    void NameDictionary::PlaceEntry(NameTable& table, Internal::NameData* nameData)
+    {
+        using namespace NameDictionaryInternal;
+
+        const size_t mask = table.m_mask;
+        size_t index = nameData->m_hash & mask;
+        while (true)
+        {
+            Slot& slot = table.m_slots[index];
+            Internal::NameData* current = slot.m_data.load(AZStd::memory_order_relaxed);
+            if (!current || current == RemovedEntry())
+            {
+                if (current)
+                {
+                    --m_removedCount;
+                }
+                // The hash is stored first so lookups that see the new entry also see its hash.
+                slot.m_hash.store(nameData->m_hash, AZStd::memory_order_relaxed);
+                slot.m_data.store(nameData, AZStd::memory_order_release);
+                return;
+            }
+            index = (index + 1) & mask;
+        }
+    }
+
+    void NameDictionary::RebuildTable(size_t capacity)
+    {
+        AZStd::vector<Internal::NameData*> entries = GetEntries();
+        NameTable* table = m_table.load(AZStd::memory_order_relaxed);
+        if (capacity != table->m_mask + 1)
+        {
+            m_tables.push_back(AZStd::make_unique<NameTable>(capacity));
+            table = m_tables.back().get();
+            m_removedCount = 0;
+            for (Internal::NameData* nameData : entries)
+            {
+                PlaceEntry(*table, nameData);
+            }
+            m_table.store(table, AZStd::memory_order_release);
+        }
+        else
+        {
+            // Clear out the released entries in place. Lookups that run while this happens can miss entries, but
+            // then fall back to searching under the lock, which waits for this to complete.
+            for (size_t i = 0; i <= table->m_mask; ++i)
+            {
+                table->m_slots[i].m_data.store(nullptr, AZStd::memory_order_relaxed);
+            }
+            m_removedCount = 0;
+            for (Internal::NameData* nameData : entries)
+            {
+                PlaceEntry(*table, nameData);
+            }
+        }
+    }
+
+    Internal::NameData* NameDictionary::CreateEntry(AZStd::string_view nameString, Name::Hash hash)
+    {
+        if (m_freeEntries.empty())
+        {
+            return aznew Internal::NameData(nameString, hash);
+        }
+
+        Internal::NameData* nameData = m_freeEntries.back();
+        m_freeEntries.pop_back();
+        nameData->m_name = nameString;
+        nameData->m_hash = hash;
+        nameData->m_hashCollision = false;
+        nameData->m_isLiteral = false;
+        // Lookups that still hold a pointer to this entry can add a reference from here on, so all
+        // other members have to be written before this.
+        nameData->m_useCount.store(0, AZStd::memory_order_release);
+        return nameData;
+    }
+
+    AZStd::vector<Internal::NameData*> NameDictionary::GetEntries() const
+    {
+        using namespace NameDictionaryInternal;
+
+        AZStd::vector<Internal::NameData*> entries;
+        entries.reserve(m_entryCount);
+        const NameTable* table = m_table.load(AZStd::memory_order_relaxed);
+        for (size_t i = 0; i <= table->m_mask; ++i)
+        {
+            Internal::NameData* nameData = table->m_slots[i].m_data.load(AZStd::memory_order_relaxed);
+            if (nameData && nameData != RemovedEntry())
+            {
+                entries.push_back(nameData);
+            }
+        }
+        return entries;
+    }
+
     void NameDictionary::TryReleaseName(Internal::NameData* nameData)
     {
         // Note that we don't remove NameData from the dictionary if it has been involved in a collision.
@@ -182,18 +425,19 @@ namespace AZ
         //      try to find that hash in the dictionary, and nothing is found. So now "world" is added to
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
+        // Entries that are cached by an AZ_NAME_LITERAL are kept as well.
 
         // Early exit to avoid locking the mutex unnecessarily.
-        if (nameData->m_hashCollision)
+        if (nameData->m_hashCollision || nameData->m_isLiteral)
         {
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::scoped_lock lock(m_mutex);
 
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
+        // Check the flags again inside the m_mutex because a new collision could have happened
         // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+        if (nameData->m_hashCollision || nameData->m_isLiteral)
         {
             return;
         }
@@ -201,12 +445,19 @@ namespace AZ
         // We need to check the count again in here in case
         // someone was trying to get the name on another thread.
         // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
+        // dictionary and release the name.
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            Slot* slot = FindSlot(nameData->m_hash);
+            AZ_Assert(slot && slot->m_data.load(AZStd::memory_order_relaxed) == nameData, "Released name '%.*s' wasn't found in the dictionary.",
+                AZ_STRING_ARG(nameData->GetName()));
+            slot->m_data.store(NameDictionaryInternal::RemovedEntry(), AZStd::memory_order_release);
+            --m_entryCount;
+            ++m_removedCount;
+
+            nameData->m_name = AZStd::string();
+            m_freeEntries.push_back(nameData);
         }
 
         ReportStats();
@@ -227,34 +478,34 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            for (Internal::NameData* nameData : GetEntries())
             {
-                const size_t nameLength = iter.second->m_name.size();
+                const size_t nameLength = nameData->m_name.size();
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_entryCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -279,9 +530,6 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        return Internal::CalcNameHash(name);
     }
 }
@@ -12,10 +12,12 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -47,6 +49,9 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! Names are stored in an open addressing table that can be searched without taking a lock, so looking up
+    //! existing names doesn't contend with other threads. Only adding and releasing names takes a lock.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -80,6 +85,48 @@ namespace AZ
         NameDictionary();
         ~NameDictionary();
 
+        // Slot in the name table. The hash is stored next to the entry so lookups can skip entries with a
+        // different hash without touching the NameData.
+        struct Slot
+        {
+            AZ_CLASS_ALLOCATOR(Slot, AZ::OSAllocator, 0);
+
+            AZStd::atomic<Name::Hash> m_hash{ 0 };
+            AZStd::atomic<Internal::NameData*> m_data{ nullptr };
+        };
+
+        struct NameTable
+        {
+            AZ_CLASS_ALLOCATOR(NameTable, AZ::OSAllocator, 0);
+
+            explicit NameTable(size_t capacity);
+
+            AZStd::unique_ptr<Slot[]> m_slots;
+            size_t m_mask;
+        };
+
+        // Makes a Name with a hash that has already been calculated.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
+        // Makes a Name from an AZ_NAME_LITERAL, using the entry cached in the literal if possible.
+        Name MakeName(Internal::NameLiteral& literal);
+
+        // Searches the table without locking. If an entry is found a reference to it is added, which the
+        // caller takes ownership of. This can fail to find entries that are being added or released on
+        // other threads, in which case the caller falls back to searching under m_mutex.
+        Internal::NameData* AcquireEntry(Name::Hash hash) const;
+
+        // Creates a Name that takes over the reference added by AcquireEntry.
+        static Name AdoptEntry(Internal::NameData* nameData);
+
+        // The following functions require m_mutex to be locked.
+        Slot* FindSlot(Name::Hash hash) const;
+        void InsertEntry(Internal::NameData* nameData);
+        void PlaceEntry(NameTable& table, Internal::NameData* nameData);
+        void RebuildTable(size_t capacity);
+        Internal::NameData* CreateEntry(AZStd::string_view name, Name::Hash hash);
+        AZStd::vector<Internal::NameData*> GetEntries() const;
+
         void ReportStats() const;
 
         //////////////////////////////////////////////////////////////////////////
@@ -93,9 +140,23 @@ namespace AZ
 
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
-        Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        static Name::Hash CalcHash(AZStd::string_view name);
+
+        // The table that's searched by lookups. Tables that are replaced when growing are kept alive in m_tables
+        // until the dictionary is destroyed because lookups on other threads may still be using them.
+        AZStd::atomic<NameTable*> m_table{ nullptr };
+        AZStd::vector<AZStd::unique_ptr<NameTable>> m_tables;
+
+        // Released entries aren't deleted because lookups on other threads may still be reading them. Instead
+        // they're reused for new names. Lookups detect reuse because the entry's hash no longer matches.
+        AZStd::vector<Internal::NameData*> m_freeEntries;
+
+        size_t m_entryCount = 0;
+        size_t m_removedCount = 0;
+
+        // Identifies this dictionary so entries cached by AZ_NAME_LITERAL in a previous dictionary aren't used.
+        uint32_t m_generation = 0;
+
+        mutable AZStd::mutex m_mutex;
     };
 }
@@ -152,6 +152,7 @@ set(FILES
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
+    EBus/Internal/LockFreeMessageQueue.h
     EBus/Internal/StoragePolicies.h
     Interface/Interface.h
     IO/ByteContainerStream.h
@@ -194,6 +195,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/ReadCoalescer.h
+    IO/Streamer/ReadCoalescer.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -238,6 +241,8 @@ set(FILES
     Jobs/JobManagerDesc.h
     Jobs/LegacyJobExecutor.h
     Jobs/MultipleDependentJob.h
+    Jobs/TaskGraph.cpp
+    Jobs/TaskGraph.h
     Jobs/task_group.h
     Math/Aabb.cpp
     Math/Aabb.h
@@ -370,6 +375,9 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameAllocator.h
+    Memory/FrameSchema.cpp
+    Memory/FrameSchema.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
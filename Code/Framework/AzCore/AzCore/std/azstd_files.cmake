@@ -99,6 +99,7 @@ set(FILES
     parallel/containers/lock_free_stack.h
     parallel/containers/lock_free_stamped_queue.h
     parallel/containers/lock_free_stamped_stack.h
+    parallel/containers/work_stealing_deque.h
     parallel/containers/internal/concurrent_hash_table.h
     delegate/delegate.h
     delegate/delegate_bind.h
@@ -0,0 +1,253 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        /**
+         * Circular storage used by work_stealing_deque. Indices grow monotonically and are wrapped with the mask,
+         * elements are atomics so a thief can read a slot while the owner is writing a different generation of it.
+         */
+        template<typename T>
+        struct work_stealing_deque_array
+        {
+            AZ::s64 m_mask;
+            work_stealing_deque_array* m_retiredNext; ///< Arrays replaced by a grow are kept alive until the deque is destroyed.
+            atomic<T> m_elements[1];
+
+            AZ::s64 capacity() const                { return m_mask + 1; }
+            T       get(AZ::s64 index) const        { return m_elements[index & m_mask].load(memory_order_relaxed); }
+            void    put(AZ::s64 index, T value)     { m_elements[index & m_mask].store(value, memory_order_relaxed); }
+        };
+    }
+
+    /**
+     * Lock-free, single owner / multiple thieves work-stealing deque (Chase-Lev, using the weak memory model
+     * formulation from Le, Pop, Cohen and Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models").
+     * The owning thread pushes and pops at the bottom (LIFO), any other thread can steal from the top (FIFO).
+     * The storage grows without blocking thieves, replaced arrays are retired and only released in the destructor,
+     * since a thief may still be reading from them. T must be trivially copyable (typically a pointer).
+     * IMPORTANT: push and pop must only be called from the owning thread.
+     */
+    template<typename T, typename Allocator = AZStd::allocator>
+    class work_stealing_deque
+    {
+        static_assert(AZStd::is_trivially_copyable<T>::value, "work_stealing_deque only supports trivially copyable types");
+
+        enum
+        {
+            DefaultCapacity = 64,
+        };
+    public:
+        typedef T*                                          pointer;
+        typedef const T&                                    const_reference;
+        typedef AZStd::size_t                               size_type;
+        typedef Allocator                                   allocator_type;
+        typedef T                                           value_type;
+        typedef Internal::work_stealing_deque_array<T>      array_type;
+
+        explicit work_stealing_deque(size_type initialCapacity = DefaultCapacity);
+        ~work_stealing_deque();
+
+        ///Pushes a value on the bottom of the deque. Owner thread only.
+        void push(const_reference value);
+
+        ///Pops the most recently pushed value from the bottom of the deque. Owner thread only.
+        ///Returns false if the deque was empty (or the last element was stolen concurrently).
+        bool pop(pointer value_out);
+
+        ///Attempts to steal the oldest value from the top of the deque, can be called from any thread. Returns false
+        ///if the deque was empty or if another thread won the race for the element, in which case the caller may retry.
+        bool steal(pointer value_out);
+
+        ///Tests if the deque is empty, limited utility for a concurrent container.
+        bool empty() const;
+
+        ///Returns the approximate number of elements, limited utility for a concurrent container.
+        size_type size() const;
+
+        ///Returns the current capacity of the storage.
+        size_type capacity() const;
+
+    private:
+        //non-copyable
+        work_stealing_deque(const work_stealing_deque&);
+        work_stealing_deque& operator=(const work_stealing_deque&);
+
+        array_type* create_array(AZ::s64 capacity);
+        void destroy_array(array_type* array);
+        array_type* grow(array_type* array, AZ::s64 bottom, AZ::s64 top);
+
+        // top and bottom are on separate cache lines, the owner hammers bottom while thieves contend on top.
+        alignas(64) atomic<AZ::s64> m_top;
+        alignas(64) atomic<AZ::s64> m_bottom;
+        atomic<array_type*> m_array;
+        array_type* m_retired; ///< Owner only
+        allocator_type m_allocator;
+    };
+
+    //============================================================================================================
+    //============================================================================================================
+    //============================================================================================================
+
+    template<typename T, typename Allocator>
+    inline work_stealing_deque<T, Allocator>::work_stealing_deque(size_type initialCapacity)
+        : m_top(0)
+        , m_bottom(0)
+        , m_retired(nullptr)
+    {
+        AZ_Assert(initialCapacity > 0 && (initialCapacity & (initialCapacity - 1)) == 0, "work_stealing_deque capacity must be a power of 2");
+        m_array.store(create_array(static_cast<AZ::s64>(initialCapacity)), memory_order_relaxed);
+    }
+
+    template<typename T, typename Allocator>
+    inline work_stealing_deque<T, Allocator>::~work_stealing_deque()
+    {
+        destroy_array(m_array.load(memory_order_relaxed));
+        while (m_retired)
+        {
+            array_type* next = m_retired->m_retiredNext;
+            destroy_array(m_retired);
+            m_retired = next;
+        }
+    }
+
+    template<typename T, typename Allocator>
+    inline void work_stealing_deque<T, Allocator>::push(const_reference value)
+    {
+        const AZ::s64 bottom = m_bottom.load(memory_order_relaxed);
+        const AZ::s64 top = m_top.load(memory_order_acquire);
+        array_type* array = m_array.load(memory_order_relaxed);
+        if (bottom - top > array->m_mask)
+        {
+            array = grow(array, bottom, top);
+        }
+        array->put(bottom, value);
+        atomic_thread_fence(memory_order_release);
+        m_bottom.store(bottom + 1, memory_order_relaxed);
+    }
+
+    template<typename T, typename Allocator>
+    inline bool work_stealing_deque<T, Allocator>::pop(pointer value_out)
+    {
+        const AZ::s64 bottom = m_bottom.load(memory_order_relaxed) - 1;
+        array_type* array = m_array.load(memory_order_relaxed);
+        m_bottom.store(bottom, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        AZ::s64 top = m_top.load(memory_order_relaxed);
+
+        bool result = false;
+        if (top <= bottom)
+        {
+            *value_out = array->get(bottom);
+            result = true;
+            if (top == bottom)
+            {
+                // last element, race the thieves for it
+                if (!m_top.compare_exchange_strong(top, top + 1, memory_order_seq_cst, memory_order_relaxed))
+                {
+                    result = false;
+                }
+                m_bottom.store(bottom + 1, memory_order_relaxed);
+            }
+        }
+        else
+        {
+            m_bottom.store(bottom + 1, memory_order_relaxed);
+        }
+        return result;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool work_stealing_deque<T, Allocator>::steal(pointer value_out)
+    {
+        AZ::s64 top = m_top.load(memory_order_acquire);
+        atomic_thread_fence(memory_order_seq_cst);
+        const AZ::s64 bottom = m_bottom.load(memory_order_acquire);
+        if (top < bottom)
+        {
+            // consume semantics are what we need, but acquire is what compilers implement for it anyway
+            array_type* array = m_array.load(memory_order_acquire);
+            const T value = array->get(top);
+            if (m_top.compare_exchange_strong(top, top + 1, memory_order_seq_cst, memory_order_relaxed))
+            {
+                *value_out = value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename T, typename Allocator>
+    inline bool work_stealing_deque<T, Allocator>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template<typename T, typename Allocator>
+    inline typename work_stealing_deque<T, Allocator>::size_type work_stealing_deque<T, Allocator>::size() const
+    {
+        const AZ::s64 bottom = m_bottom.load(memory_order_acquire);
+        const AZ::s64 top = m_top.load(memory_order_acquire);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    template<typename T, typename Allocator>
+    inline typename work_stealing_deque<T, Allocator>::size_type work_stealing_deque<T, Allocator>::capacity() const
+    {
+        return static_cast<size_type>(m_array.load(memory_order_acquire)->capacity());
+    }
+
+    template<typename T, typename Allocator>
+    inline typename work_stealing_deque<T, Allocator>::array_type* work_stealing_deque<T, Allocator>::create_array(AZ::s64 capacity)
+    {
+        const size_type byteSize = sizeof(array_type) + sizeof(atomic<T>) * static_cast<size_type>(capacity - 1);
+        array_type* array = reinterpret_cast<array_type*>(m_allocator.allocate(byteSize, alignof(array_type)));
+        array->m_mask = capacity - 1;
+        array->m_retiredNext = nullptr;
+        for (AZ::s64 i = 0; i < capacity; ++i)
+        {
+            new (&array->m_elements[i]) atomic<T>();
+        }
+        return array;
+    }
+
+    template<typename T, typename Allocator>
+    inline void work_stealing_deque<T, Allocator>::destroy_array(array_type* array)
+    {
+        const size_type byteSize = sizeof(array_type) + sizeof(atomic<T>) * static_cast<size_type>(array->m_mask);
+        m_allocator.deallocate(array, byteSize, alignof(array_type));
+    }
+
+    template<typename T, typename Allocator>
+    inline typename work_stealing_deque<T, Allocator>::array_type* work_stealing_deque<T, Allocator>::grow(array_type* array, AZ::s64 bottom, AZ::s64 top)
+    {
+        array_type* newArray = create_array(array->capacity() * 2);
+        for (AZ::s64 i = top; i < bottom; ++i)
+        {
+            newArray->put(i, array->get(i));
+        }
+        m_array.store(newArray, memory_order_release);
+
+        // thieves may still be reading from the old array, keep it around until we are destroyed
+        array->m_retiredNext = m_retired;
+        m_retired = array;
+        return newArray;
+    }
+}
@@ -0,0 +1,346 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/AsyncReadQueue_Linux.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#   include <linux/io_uring.h>
+#   define AZ_STREAMER_IO_URING_SUPPORTED 1
+#else
+#   define AZ_STREAMER_IO_URING_SUPPORTED 0
+#endif
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_IO_URING_SUPPORTED
+    //! Queue that submits reads directly to the kernel through io_uring. The rings are used directly through the system
+    //! calls instead of liburing to avoid an additional dependency. Only the streamer thread touches the rings, so the only
+    //! synchronization needed is with the kernel.
+    class IoUringReadQueue final
+        : public AsyncReadQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(IoUringReadQueue, AZ::SystemAllocator, 0);
+
+        ~IoUringReadQueue() override
+        {
+            if (m_sqes != nullptr)
+            {
+                ::munmap(m_sqes, m_sqesSize);
+            }
+            if (m_cqRing != nullptr && m_cqRing != m_sqRing)
+            {
+                ::munmap(m_cqRing, m_cqRingSize);
+            }
+            if (m_sqRing != nullptr)
+            {
+                ::munmap(m_sqRing, m_sqRingSize);
+            }
+            if (m_ring >= 0)
+            {
+                ::close(m_ring);
+            }
+        }
+
+        bool Initialize(u32 queueDepth, int completionEventDescriptor)
+        {
+            io_uring_params params{};
+            m_ring = aznumeric_cast<int>(::syscall(__NR_io_uring_setup, queueDepth, &params));
+            if (m_ring < 0)
+            {
+                AZ_Printf("Streamer", "io_uring isn't available (Error: %s).\n", strerror(errno));
+                return false;
+            }
+
+            m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+            m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMap)
+            {
+                m_sqRingSize = m_cqRingSize = AZStd::max(m_sqRingSize, m_cqRingSize);
+            }
+
+            m_sqRing = MapRing(m_sqRingSize, IORING_OFF_SQ_RING);
+            if (m_sqRing == nullptr)
+            {
+                return false;
+            }
+            m_cqRing = singleMap ? m_sqRing : MapRing(m_cqRingSize, IORING_OFF_CQ_RING);
+            if (m_cqRing == nullptr)
+            {
+                return false;
+            }
+            m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            m_sqes = reinterpret_cast<io_uring_sqe*>(MapRing(m_sqesSize, IORING_OFF_SQES));
+            if (m_sqes == nullptr)
+            {
+                return false;
+            }
+
+            m_sqTail = reinterpret_cast<u32*>(m_sqRing + params.sq_off.tail);
+            m_sqMask = *reinterpret_cast<u32*>(m_sqRing + params.sq_off.ring_mask);
+            m_sqArray = reinterpret_cast<u32*>(m_sqRing + params.sq_off.array);
+            m_cqHead = reinterpret_cast<u32*>(m_cqRing + params.cq_off.head);
+            m_cqTail = reinterpret_cast<u32*>(m_cqRing + params.cq_off.tail);
+            m_cqMask = *reinterpret_cast<u32*>(m_cqRing + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe*>(m_cqRing + params.cq_off.cqes);
+
+            if (::syscall(__NR_io_uring_register, m_ring, IORING_REGISTER_EVENTFD, &completionEventDescriptor, 1) != 0)
+            {
+                AZ_Printf("Streamer", "Unable to register the completion eventfd with io_uring (Error: %s).\n", strerror(errno));
+                return false;
+            }
+
+            m_iovecs.resize(queueDepth);
+            return true;
+        }
+
+        const char* GetName() const override
+        {
+            return "io_uring";
+        }
+
+        bool Submit(size_t slot, int file, void* buffer, size_t size, u64 offset) override
+        {
+            AZ_Assert(slot < m_iovecs.size(), "Slot %zu is outside the range of the io_uring queue.", slot);
+
+            // The iovec needs to stay alive until the kernel has picked up the read, so it's stored per slot.
+            iovec& vec = m_iovecs[slot];
+            vec.iov_base = buffer;
+            vec.iov_len = size;
+
+            const u32 tail = *m_sqTail;
+            const u32 index = tail & m_sqMask;
+            io_uring_sqe& sqe = m_sqes[index];
+            memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_READV;
+            sqe.fd = file;
+            sqe.addr = reinterpret_cast<u64>(&vec);
+            sqe.len = 1;
+            sqe.off = offset;
+            sqe.user_data = slot;
+            m_sqArray[index] = index;
+            __atomic_store_n(m_sqTail, tail + 1, __ATOMIC_RELEASE);
+
+            long result;
+            do
+            {
+                result = ::syscall(__NR_io_uring_enter, m_ring, 1, 0, 0, nullptr, 0);
+            } while (result < 0 && errno == EINTR);
+
+            if (result != 1)
+            {
+                AZ_Error("Streamer", false, "Failed to submit read to io_uring (Error: %s).", strerror(errno));
+                // Take the entry back so it's not picked up by a later submission.
+                __atomic_store_n(m_sqTail, tail, __ATOMIC_RELEASE);
+                return false;
+            }
+            return true;
+        }
+
+        bool PopCompletion(Completion& completion) override
+        {
+            const u32 head = *m_cqHead;
+            if (head == __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE))
+            {
+                return false;
+            }
+
+            const io_uring_cqe& cqe = m_cqes[head & m_cqMask];
+            completion.m_slot = aznumeric_caster(cqe.user_data);
+            completion.m_result = cqe.res;
+            __atomic_store_n(m_cqHead, head + 1, __ATOMIC_RELEASE);
+            return true;
+        }
+
+    private:
+        u8* MapRing(size_t size, u64 offset)
+        {
+            void* result = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring, offset);
+            if (result == MAP_FAILED)
+            {
+                AZ_Printf("Streamer", "Unable to map the io_uring rings (Error: %s).\n", strerror(errno));
+                return nullptr;
+            }
+            return reinterpret_cast<u8*>(result);
+        }
+
+        AZStd::vector<iovec> m_iovecs;
+        u8* m_sqRing{ nullptr };
+        u8* m_cqRing{ nullptr };
+        io_uring_sqe* m_sqes{ nullptr };
+        io_uring_cqe* m_cqes{ nullptr };
+        u32* m_sqTail{ nullptr };
+        u32* m_sqArray{ nullptr };
+        u32* m_cqHead{ nullptr };
+        u32* m_cqTail{ nullptr };
+        size_t m_sqRingSize{ 0 };
+        size_t m_cqRingSize{ 0 };
+        size_t m_sqesSize{ 0 };
+        u32 m_sqMask{ 0 };
+        u32 m_cqMask{ 0 };
+        int m_ring{ -1 };
+    };
+#endif // AZ_STREAMER_IO_URING_SUPPORTED
+
+    //! Queue that runs blocking preads on a pool of threads. This is used on kernels without io_uring support or where
+    //! io_uring has been disabled, for instance by container security policies.
+    class ThreadPoolReadQueue final
+        : public AsyncReadQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ThreadPoolReadQueue, AZ::SystemAllocator, 0);
+
+        ThreadPoolReadQueue(u32 numThreads, int completionEventDescriptor)
+            : m_completionEventDescriptor(completionEventDescriptor)
+        {
+            m_threadDesc.m_name = "IO Read Worker";
+            m_threads.reserve(numThreads);
+            for (u32 i = 0; i < numThreads; ++i)
+            {
+                m_threads.emplace_back([this]()
+                    {
+                        Thread_MainLoop();
+                    }, &m_threadDesc);
+            }
+        }
+
+        ~ThreadPoolReadQueue() override
+        {
+            {
+                AZStd::scoped_lock lock(m_submissionLock);
+                m_isRunning = false;
+            }
+            m_submissionSignal.notify_all();
+            for (AZStd::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        const char* GetName() const override
+        {
+            return "pread thread pool";
+        }
+
+        bool Submit(size_t slot, int file, void* buffer, size_t size, u64 offset) override
+        {
+            {
+                AZStd::scoped_lock lock(m_submissionLock);
+                m_submissions.push_back(Submission{ slot, file, buffer, size, offset });
+            }
+            m_submissionSignal.notify_one();
+            return true;
+        }
+
+        bool PopCompletion(Completion& completion) override
+        {
+            AZStd::scoped_lock lock(m_completionLock);
+            if (m_completions.empty())
+            {
+                return false;
+            }
+            completion = m_completions.front();
+            m_completions.pop_front();
+            return true;
+        }
+
+    private:
+        struct Submission
+        {
+            size_t m_slot;
+            int m_file;
+            void* m_buffer;
+            size_t m_size;
+            u64 m_offset;
+        };
+
+        void Thread_MainLoop()
+        {
+            while (true)
+            {
+                Submission submission;
+                {
+                    AZStd::unique_lock lock(m_submissionLock);
+                    m_submissionSignal.wait(lock, [this]() { return !m_isRunning || !m_submissions.empty(); });
+                    if (m_submissions.empty())
+                    {
+                        return;
+                    }
+                    submission = m_submissions.front();
+                    m_submissions.pop_front();
+                }
+
+                ssize_t result;
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ThreadPoolReadQueue pread");
+                    do
+                    {
+                        result = ::pread(submission.m_file, submission.m_buffer, submission.m_size, aznumeric_cast<off_t>(submission.m_offset));
+                    } while (result < 0 && errno == EINTR);
+                }
+
+                {
+                    AZStd::scoped_lock lock(m_completionLock);
+                    m_completions.push_back(Completion{ submission.m_slot, result < 0 ? -errno : aznumeric_cast<s64>(result) });
+                }
+                ::eventfd_write(m_completionEventDescriptor, 1);
+            }
+        }
+
+        AZStd::thread_desc m_threadDesc;
+        AZStd::vector<AZStd::thread> m_threads;
+        AZStd::mutex m_submissionLock;
+        AZStd::condition_variable m_submissionSignal;
+        AZStd::deque<Submission> m_submissions;
+        AZStd::mutex m_completionLock;
+        AZStd::deque<Completion> m_completions;
+        int m_completionEventDescriptor;
+        bool m_isRunning{ true };
+    };
+
+    AZStd::unique_ptr<AsyncReadQueue> AsyncReadQueue::Create(u32 queueDepth, int completionEventDescriptor, [[maybe_unused]] bool allowIoUring)
+    {
+#if AZ_STREAMER_IO_URING_SUPPORTED
+        if (allowIoUring)
+        {
+            auto ioUring = AZStd::make_unique<IoUringReadQueue>();
+            if (ioUring->Initialize(queueDepth, completionEventDescriptor))
+            {
+                return ioUring;
+            }
+        }
+#endif // AZ_STREAMER_IO_URING_SUPPORTED
+
+        // There's no benefit to having more threads than requests that can be in flight, but a large number of threads
+        // mostly adds contention, so the pool is capped.
+        constexpr u32 MaxNumThreads = 16;
+        return AZStd::make_unique<ThreadPoolReadQueue>(AZStd::min(queueDepth, MaxNumThreads), completionEventDescriptor);
+    }
+} // namespace AZ::IO
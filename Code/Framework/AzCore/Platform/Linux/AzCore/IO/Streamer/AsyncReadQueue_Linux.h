@@ -0,0 +1,52 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::IO
+{
+    //! Mechanism used by StorageDriveLinux to keep multiple reads in flight. Reads are identified by a slot index that's
+    //! returned with their completion. Once a read completes the eventfd the queue was created with is signaled, so the
+    //! scheduler thread can be woken up to finalize the read.
+    class AsyncReadQueue
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AsyncReadQueue, AZ::SystemAllocator, 0);
+
+        struct Completion
+        {
+            size_t m_slot{ 0 };
+            //! The number of bytes that were read or a negative errno if the read failed.
+            s64 m_result{ 0 };
+        };
+
+        virtual ~AsyncReadQueue() = default;
+
+        //! Creates a queue that's backed by io_uring if allowed and supported by the kernel. If not, a queue that runs
+        //! preads on a pool of threads is created.
+        //! @param queueDepth The maximum number of reads that can be in flight. Slots need to be smaller than this value.
+        //! @param completionEventDescriptor The eventfd that's signaled when reads complete.
+        //! @param allowIoUring If false io_uring will not be used, even if supported.
+        static AZStd::unique_ptr<AsyncReadQueue> Create(u32 queueDepth, int completionEventDescriptor, bool allowIoUring);
+
+        virtual const char* GetName() const = 0;
+        //! Starts reading from a file. The buffer needs to stay alive until the read has completed.
+        //! @return False if the read couldn't be started, in which case no completion will be returned for the slot.
+        virtual bool Submit(size_t slot, int file, void* buffer, size_t size, u64 offset) = 0;
+        //! Retrieves a completed read if there's one, without blocking.
+        virtual bool PopCompletion(Completion& completion) = 0;
+    };
+} // namespace AZ::IO
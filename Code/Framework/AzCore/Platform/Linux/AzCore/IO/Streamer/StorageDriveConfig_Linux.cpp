@@ -0,0 +1,70 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        const DriveList* drives = AZStd::any_cast<DriveList>(&hardware.m_platformData);
+
+        if (drives && !drives->empty())
+        {
+            // The drive list is sorted so drives with deeper mount points are added later and therefore end up higher in the
+            // stack, where they get the first chance to claim a request.
+            for (const DriveInformation& drive : *drives)
+            {
+                StorageDriveLinux::ConstructionOptions options;
+                options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+                options.m_enableIoUring = m_enableIoUring;
+                options.m_hasSeekPenalty = drive.m_hasSeekPenalty;
+
+                u32 queueDepth = drive.m_queueDepth != 0 ? AZStd::min(drive.m_queueDepth, m_maxQueueDepth) : m_maxQueueDepth;
+
+                AZStd::vector<AZStd::string_view> mountPoints(drive.m_paths.begin(), drive.m_paths.end());
+                AZ_Assert(!drive.m_paths.empty(), "Expected at least one mount point.");
+                auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+                    AZStd::move(mountPoints), m_maxFileHandles, m_maxMetaDataCache, drive.m_physicalSectorSize, drive.m_logicalSectorSize,
+                    queueDepth, m_overcommit, options);
+
+                stackEntry->SetNext(AZStd::move(parent));
+                parent = stackEntry;
+            }
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "No drives found that can make use of the available optimizations.\n");
+        }
+        return parent;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("MaxQueueDepth", &LinuxStorageDriveConfig::m_maxQueueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableUnbufferedReads", &LinuxStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("EnableIoUring", &LinuxStorageDriveConfig::m_enableIoUring);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,316 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+namespace AZ::IO
+{
+    struct MountInformation
+    {
+        AZStd::string m_mountPoint;
+        AZStd::string m_devicePath; //!< The sysfs folder of the device that holds the file system.
+    };
+
+    static bool ReadSysFsValue(const AZStd::string& devicePath, const char* name, u64& value)
+    {
+        AZStd::string path = AZStd::string::format("%s/queue/%s", devicePath.c_str(), name);
+        FILE* file = fopen(path.c_str(), "r");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        bool success = fscanf(file, "%llu", &result) == 1;
+        fclose(file);
+        value = result;
+        return success;
+    }
+
+    // Maps a device number to the sysfs folder of the whole device. Partitions don't have their own queue
+    // information, so for those the folder of the parent device is used.
+    static bool GetDevicePath(const char* deviceNumber, AZStd::string& devicePath)
+    {
+        AZStd::string path = AZStd::string::format("/sys/dev/block/%s", deviceNumber);
+        char resolved[PATH_MAX];
+        if (realpath(path.c_str(), resolved) == nullptr)
+        {
+            // Not backed by a block device, for instance a network or virtual file system.
+            return false;
+        }
+        devicePath = resolved;
+
+        struct stat attributes;
+        if (::stat((devicePath + "/partition").c_str(), &attributes) == 0)
+        {
+            AZ::StringFunc::Path::StripComponent(devicePath, true);
+            if (!devicePath.empty() && devicePath.back() == AZ_CORRECT_FILESYSTEM_SEPARATOR)
+            {
+                devicePath.pop_back();
+            }
+        }
+        return true;
+    }
+
+    static AZStd::vector<MountInformation> CollectMounts()
+    {
+        AZStd::vector<MountInformation> mounts;
+        FILE* mountInfo = fopen("/proc/self/mountinfo", "r");
+        if (mountInfo == nullptr)
+        {
+            return mounts;
+        }
+
+        // Each line starts with: mount id, parent id, major:minor, root, mount point. See "man 5 proc" for details.
+        char line[4096];
+        char deviceNumber[64];
+        char mountPoint[PATH_MAX];
+        while (fgets(line, sizeof(line), mountInfo) != nullptr)
+        {
+            if (sscanf(line, "%*u %*u %63s %*s %4095s", deviceNumber, mountPoint) != 2)
+            {
+                continue;
+            }
+            MountInformation mount;
+            if (GetDevicePath(deviceNumber, mount.m_devicePath))
+            {
+                mount.m_mountPoint = mountPoint;
+                mounts.push_back(AZStd::move(mount));
+            }
+        }
+        fclose(mountInfo);
+        return mounts;
+    }
+
+    static const MountInformation* FindMount(const AZStd::vector<MountInformation>& mounts, AZStd::string_view path)
+    {
+        // The deepest mount point that contains the path is the file system the path is on.
+        const MountInformation* result = nullptr;
+        for (const MountInformation& mount : mounts)
+        {
+            AZStd::string_view mountPoint = mount.m_mountPoint;
+            if (path.starts_with(mountPoint) &&
+                (path.length() == mountPoint.length() || mountPoint.back() == AZ_CORRECT_FILESYSTEM_SEPARATOR ||
+                    path[mountPoint.length()] == AZ_CORRECT_FILESYSTEM_SEPARATOR))
+            {
+                if (result == nullptr || result->m_mountPoint.length() < mountPoint.length())
+                {
+                    result = &mount;
+                }
+            }
+        }
+        return result;
+    }
+
+    static AZStd::vector<AZStd::string> CollectUsedPaths()
+    {
+        struct PathVisitor : SettingsRegistryInterface::Visitor
+        {
+            ~PathVisitor() override = default;
+
+            AZStd::vector<AZStd::string> m_paths;
+            bool m_firstObject = true;
+
+            SettingsRegistryInterface::VisitResponse Traverse([[maybe_unused]] AZStd::string_view path,
+                [[maybe_unused]] AZStd::string_view valueName, [[maybe_unused]] SettingsRegistryInterface::VisitAction action,
+                SettingsRegistryInterface::Type type) override
+            {
+                if (type == SettingsRegistryInterface::Type::Object)
+                {
+                    if (m_firstObject)
+                    {
+                        m_firstObject = false;
+                        return SettingsRegistryInterface::VisitResponse::Continue;
+                    }
+                    else
+                    {
+                        return SettingsRegistryInterface::VisitResponse::Skip;
+                    }
+                }
+
+                return type == SettingsRegistryInterface::Type::String ?
+                    SettingsRegistryInterface::VisitResponse::Continue : SettingsRegistryInterface::VisitResponse::Skip;
+            }
+
+            void Visit([[maybe_unused]] AZStd::string_view path, [[maybe_unused]] AZStd::string_view valueName,
+                [[maybe_unused]] AZ::SettingsRegistryInterface::Type type, AZStd::string_view value) override
+            {
+                m_paths.emplace_back(value);
+            }
+        };
+
+        PathVisitor visitor;
+        if (auto settingsRegistry = SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Visit(visitor, SettingsRegistryMergeUtils::FilePathsRootKey);
+        }
+        return AZStd::move(visitor.m_paths);
+    }
+
+    static void CollectDriveInfo(DriveInformation& info, const AZStd::string& devicePath)
+    {
+        u64 value = 0;
+        if (ReadSysFsValue(devicePath, "physical_block_size", value) && value != 0)
+        {
+            info.m_physicalSectorSize = aznumeric_caster(value);
+        }
+        if (ReadSysFsValue(devicePath, "logical_block_size", value) && value != 0)
+        {
+            info.m_logicalSectorSize = aznumeric_caster(value);
+        }
+        if (ReadSysFsValue(devicePath, "max_sectors_kb", value))
+        {
+            info.m_maxTransfer = aznumeric_caster(value * 1_kib);
+        }
+        if (ReadSysFsValue(devicePath, "nr_requests", value))
+        {
+            info.m_queueDepth = aznumeric_caster(value);
+        }
+        if (ReadSysFsValue(devicePath, "rotational", value))
+        {
+            info.m_hasSeekPenalty = value != 0;
+        }
+
+        AZStd::string deviceName;
+        AZ::StringFunc::Path::GetFullFileName(devicePath.c_str(), deviceName);
+        info.m_profile = AZ::StringFunc::StartsWith(deviceName, "nvme") ? "Nvme" : "Generic";
+        info.m_profile += info.m_hasSeekPenalty ? "_HDD" : "_SSD";
+
+        AZ_Printf("Streamer",
+            "Drive info for '%s':\n"
+            "    Profile: %s\n"
+            "    Physical sector size: %zu bytes\n"
+            "    Logical sector size: %zu bytes\n"
+            "    Max transfer: %zu kb\n"
+            "    Queue depth: %u\n"
+            "    Has seek penalty: %s\n",
+            deviceName.c_str(), info.m_profile.c_str(), info.m_physicalSectorSize, info.m_logicalSectorSize,
+            info.m_maxTransfer / 1_kib, info.m_queueDepth, info.m_hasSeekPenalty ? "Yes" : "No");
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives)
+    {
+        AZStd::vector<MountInformation> mounts = CollectMounts();
+        if (mounts.empty())
+        {
+            return false;
+        }
+
+        AZStd::vector<const MountInformation*> usedMounts;
+        if (addAllDrives)
+        {
+            for (const MountInformation& mount : mounts)
+            {
+                usedMounts.push_back(&mount);
+            }
+        }
+        else
+        {
+            for (const AZStd::string& path : CollectUsedPaths())
+            {
+                const MountInformation* mount = FindMount(mounts, path);
+                if (mount != nullptr && AZStd::find(usedMounts.begin(), usedMounts.end(), mount) == usedMounts.end())
+                {
+                    usedMounts.push_back(mount);
+                }
+            }
+        }
+
+        AZStd::unordered_map<AZStd::string, DriveInformation> driveMappings;
+        for (const MountInformation* mount : usedMounts)
+        {
+            auto driveInformationEntry = driveMappings.find(mount->m_devicePath);
+            if (driveInformationEntry == driveMappings.end())
+            {
+                DriveInformation driveInformation;
+                driveInformation.m_paths.push_back(mount->m_mountPoint);
+                CollectDriveInfo(driveInformation, mount->m_devicePath);
+
+                hardwareInfo.m_maxPhysicalSectorSize = AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+                hardwareInfo.m_maxLogicalSectorSize = AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+                hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, driveInformation.m_maxTransfer);
+
+                driveMappings.insert({ mount->m_devicePath, AZStd::move(driveInformation) });
+            }
+            else
+            {
+                AZ_Printf("Streamer", "Mount point '%s' is on the same storage drive as '%s'.\n",
+                    mount->m_mountPoint.c_str(), driveInformationEntry->second.m_paths[0].c_str());
+                driveInformationEntry->second.m_paths.push_back(mount->m_mountPoint);
+            }
+        }
+
+        if (driveMappings.empty())
+        {
+            return false;
+        }
+
+        DriveList driveList;
+        driveList.reserve(driveMappings.size());
+        for (auto& drive : driveMappings)
+        {
+            driveList.push_back(AZStd::move(drive.second));
+        }
+        // Storage drives claim requests by comparing the start of the path to their mount points. Drives are added to the
+        // stack in order, so drives with shorter mount points such as the root need to go first to end up at the bottom.
+        auto shortestMountPoint = [](const DriveInformation& drive)
+        {
+            size_t length = std::numeric_limits<size_t>::max();
+            for (const AZStd::string& path : drive.m_paths)
+            {
+                length = AZStd::min(length, path.length());
+            }
+            return length;
+        };
+        AZStd::sort(driveList.begin(), driveList.end(), [&shortestMountPoint](const DriveInformation& lhs, const DriveInformation& rhs)
+            {
+                return shortestMountPoint(lhs) < shortestMountPoint(rhs);
+            });
+
+        hardwareInfo.m_maxPageSize = 4_kib;
+        hardwareInfo.m_profile = driveList.size() == 1 ? driveList.front().m_profile : "Generic";
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,64 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Trace.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_eventDescriptor = ::eventfd(0, EFD_CLOEXEC);
+        AZ_Assert(m_eventDescriptor >= 0, "Failed to create the eventfd for the IO Scheduler (Error: %s).", strerror(errno));
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_eventDescriptor >= 0)
+        {
+            ::close(m_eventDescriptor);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_eventDescriptor >= 0, "There is no eventfd created for the main streamer thread to use to suspend.");
+
+        // Reading blocks until the counter is non-zero and then resets it, so wake up calls that were queued while the
+        // scheduler thread was busy are not lost.
+        eventfd_t value;
+        while (::eventfd_read(m_eventDescriptor, &value) != 0)
+        {
+            if (errno != EINTR)
+            {
+                AZ_Assert(false, "Failed to wait for the IO Scheduler eventfd (Error: %s).", strerror(errno));
+                return;
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_eventDescriptor >= 0, "There is no eventfd created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_eventDescriptor, 1);
+    }
+
+    int StreamerContextThreadSync::GetEventDescriptor() const
+    {
+        return m_eventDescriptor;
+    }
+} // namespace AZ::Platform
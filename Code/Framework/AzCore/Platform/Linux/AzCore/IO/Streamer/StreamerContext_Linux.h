@@ -0,0 +1,37 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Synchronizes the scheduler thread with the rest of the engine through an eventfd. Besides wake up calls from other
+    //! threads, the event descriptor can be signaled by the kernel or worker threads when asynchronous reads complete,
+    //! so the scheduler thread wakes up to finalize them.
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns the eventfd the scheduler thread waits on. Writing any non-zero value to it wakes the scheduler thread up.
+        int GetEventDescriptor() const;
+
+    private:
+        int m_eventDescriptor{ -1 };
+    };
+} // namespace AZ::Platform
@@ -11,4 +11,4 @@
 */
 #pragma once
 
-#include <../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
@@ -15,6 +15,8 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/containers/lock_free_queue.h>
 #include <AzCore/std/parallel/containers/lock_free_stamped_queue.h>
+#include <AzCore/std/parallel/containers/work_stealing_deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -228,4 +230,138 @@ namespace UnitTest
             AZ_TEST_ASSERT(queue.empty());
         }
     }
+
+    class WorkStealingDeque
+        : public AllocatorsFixture
+    {
+    protected:
+#ifdef _DEBUG
+        static const int NUM_ITERATIONS = 5000;
+#else
+        static const int NUM_ITERATIONS = 100000;
+#endif
+        static const int NUM_THIEVES = 4;
+    };
+
+    TEST_F(WorkStealingDeque, OwnerPushPop_IsLastInFirstOut)
+    {
+        work_stealing_deque<int> deque;
+        int result;
+        EXPECT_TRUE(deque.empty());
+        EXPECT_FALSE(deque.pop(&result));
+        EXPECT_FALSE(deque.steal(&result));
+
+        deque.push(20);
+        deque.push(30);
+        EXPECT_EQ(2u, deque.size());
+        EXPECT_TRUE(deque.pop(&result));
+        EXPECT_EQ(30, result);
+        EXPECT_TRUE(deque.pop(&result));
+        EXPECT_EQ(20, result);
+        EXPECT_TRUE(deque.empty());
+        EXPECT_FALSE(deque.pop(&result));
+    }
+
+    TEST_F(WorkStealingDeque, Steal_IsFirstInFirstOut)
+    {
+        work_stealing_deque<int> deque;
+        int result;
+
+        deque.push(20);
+        deque.push(30);
+        EXPECT_TRUE(deque.steal(&result));
+        EXPECT_EQ(20, result);
+        EXPECT_TRUE(deque.steal(&result));
+        EXPECT_EQ(30, result);
+        EXPECT_FALSE(deque.steal(&result));
+        EXPECT_TRUE(deque.empty());
+    }
+
+    TEST_F(WorkStealingDeque, Push_PastCapacity_GrowsAndKeepsOrder)
+    {
+        work_stealing_deque<int> deque(4);
+        int result;
+
+        // offset the indices so the grow has to handle wrapped storage
+        deque.push(-1);
+        EXPECT_TRUE(deque.steal(&result));
+
+        for (int i = 0; i < 100; ++i)
+        {
+            deque.push(i);
+        }
+        EXPECT_GE(deque.capacity(), 100u);
+        EXPECT_EQ(100u, deque.size());
+
+        for (int i = 0; i < 50; ++i)
+        {
+            EXPECT_TRUE(deque.steal(&result));
+            EXPECT_EQ(i, result);
+        }
+        for (int i = 99; i >= 50; --i)
+        {
+            EXPECT_TRUE(deque.pop(&result));
+            EXPECT_EQ(i, result);
+        }
+        EXPECT_TRUE(deque.empty());
+    }
+
+    TEST_F(WorkStealingDeque, OwnerAndThieves_EveryValueIsTakenExactlyOnce)
+    {
+        work_stealing_deque<int> deque;
+        AZStd::vector<atomic<int>> taken(NUM_ITERATIONS);
+        for (atomic<int>& count : taken)
+        {
+            count = 0;
+        }
+        atomic<int> numTaken{ 0 };
+
+        auto thief = [&]()
+        {
+            int value;
+            while (numTaken.load() < NUM_ITERATIONS)
+            {
+                if (deque.steal(&value))
+                {
+                    ++taken[value];
+                    ++numTaken;
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> thieves;
+        for (int i = 0; i < NUM_THIEVES; ++i)
+        {
+            thieves.emplace_back(thief);
+        }
+
+        // owner interleaves pushes and pops, so the thieves race it for the last element and the storage grows under them
+        int value;
+        for (int i = 0; i < NUM_ITERATIONS; ++i)
+        {
+            deque.push(i);
+            if ((i % 3) == 0 && deque.pop(&value))
+            {
+                ++taken[value];
+                ++numTaken;
+            }
+        }
+        while (deque.pop(&value))
+        {
+            ++taken[value];
+            ++numTaken;
+        }
+
+        for (AZStd::thread& thread : thieves)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(NUM_ITERATIONS, numTaken.load());
+        for (int i = 0; i < NUM_ITERATIONS; ++i)
+        {
+            EXPECT_EQ(1, taken[i].load());
+        }
+        EXPECT_TRUE(deque.empty());
+    }
 }
@@ -14,6 +14,7 @@
 #include <AzCore/Debug/StackTracer.h>
 #include <AzCore/Debug/TraceMessagesDrillerBus.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/time.h>
@@ -445,6 +446,111 @@ namespace UnitTest
         run();
     }
 
+#if !defined(AZ_PROFILER_MACRO_DISABLE)
+    class ProfilerEventTraceTest
+        : public AllocatorsFixture
+    {
+    public:
+        static void ProfileNested(int numIterations)
+        {
+            for (int i = 0; i < numIterations; ++i)
+            {
+                AZ_PROFILE_TIMER("UnitTest", "Outer");
+                {
+                    AZ_PROFILE_TIMER("UnitTest", "Inner");
+                }
+            }
+        }
+
+        static void RunThreads(int numThreads, int numIterations)
+        {
+            AZStd::vector<AZStd::thread> threads;
+            for (int i = 0; i < numThreads; ++i)
+            {
+                threads.emplace_back([numIterations]() { ProfileNested(numIterations); });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        static AZStd::string WriteTrace()
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            EXPECT_TRUE(Profiler::Instance().WriteChromeTrace(stream));
+            return AZStd::string(buffer.begin(), buffer.end());
+        }
+
+        static size_t CountOccurrences(const AZStd::string& text, const char* pattern)
+        {
+            size_t count = 0;
+            for (size_t position = text.find(pattern); position != AZStd::string::npos; position = text.find(pattern, position + 1))
+            {
+                ++count;
+            }
+            return count;
+        }
+    };
+
+    TEST_F(ProfilerEventTraceTest, WriteChromeTrace_ManyThreads_AllThreadsAreRecorded)
+    {
+        Profiler::Descriptor desc;
+        desc.m_recordEvents = true;
+        Profiler::Create(desc);
+
+        // More threads than the profiler used to support.
+        const int numThreads = 40;
+        const int numIterations = 10;
+        RunThreads(numThreads, numIterations);
+
+        AZStd::string trace = WriteTrace();
+        EXPECT_EQ(0, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        EXPECT_EQ(numThreads, CountOccurrences(trace, "\"thread_name\""));
+        EXPECT_EQ(numThreads * numIterations, CountOccurrences(trace, "{\"name\":\"Outer\",\"cat\":\"UnitTest\",\"ph\":\"X\""));
+        EXPECT_EQ(numThreads * numIterations, CountOccurrences(trace, "{\"name\":\"Inner\",\"cat\":\"UnitTest\",\"ph\":\"X\""));
+        EXPECT_EQ(0, CountOccurrences(trace, "\"ph\":\"B\""));
+
+        Profiler::Destroy();
+    }
+
+    TEST_F(ProfilerEventTraceTest, WriteChromeTrace_RingIsFull_KeepsMostRecentEvents)
+    {
+        Profiler::Descriptor desc;
+        desc.m_recordEvents = true;
+        desc.m_eventRingCapacity = 16;
+        Profiler::Create(desc);
+
+        // Every iteration records 4 events. The slot the next event goes to is never read, so the 15 most recent events are kept:
+        // the last 3 iterations, and the inner scope of the one before which lost the begin of its outer scope.
+        RunThreads(1, 100);
+
+        AZStd::string trace = WriteTrace();
+        EXPECT_EQ(3, CountOccurrences(trace, "{\"name\":\"Outer\""));
+        EXPECT_EQ(4, CountOccurrences(trace, "{\"name\":\"Inner\""));
+
+        Profiler::Destroy();
+    }
+
+    TEST_F(ProfilerEventTraceTest, SetEventRecording_Disabled_NoEventsAreRecorded)
+    {
+        Profiler::Create();
+        EXPECT_FALSE(Profiler::Instance().IsEventRecording());
+        RunThreads(2, 10);
+        EXPECT_EQ(0, CountOccurrences(WriteTrace(), "{\"name\":\"Outer\""));
+
+        Profiler::Instance().SetEventRecording(true);
+        RunThreads(2, 10);
+        EXPECT_EQ(20, CountOccurrences(WriteTrace(), "{\"name\":\"Outer\""));
+
+        Profiler::Instance().ClearEvents();
+        EXPECT_EQ(0, CountOccurrences(WriteTrace(), "{\"name\":\"Outer\""));
+
+        Profiler::Destroy();
+    }
+#endif // !defined(AZ_PROFILER_MACRO_DISABLE)
+
     TEST(Time, Test)
     {
         AZStd::sys_time_t ticksPerSecond = AZStd::GetTimeTicksPerSecond();
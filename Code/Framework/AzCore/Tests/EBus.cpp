@@ -13,6 +13,8 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
@@ -1852,6 +1854,258 @@ namespace UnitTest
 
     }
 
+    namespace LockFreeQueueTest
+    {
+        class LockFreeQueueEvents
+            : public EBusTraits
+        {
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            typedef AZStd::mutex MutexType;
+            static const bool EnableEventQueue = true;
+            static const bool EnableLockFreeEventQueue = true;
+            // Deliberately small so the tests also exercise spilling over into the overflow queue.
+            static const size_t LockFreeEventQueueCapacity = 8;
+            //////////////////////////////////////////////////////////////////////////
+
+            virtual void OnValue(int producer, int value) = 0;
+            virtual void OnStrings(const AZStd::string& first, const AZStd::string& second, const AZStd::string& third) = 0;
+        };
+        using LockFreeQueueBus = AZ::EBus<LockFreeQueueEvents>;
+
+        class LockFreeQueueHandler
+            : public LockFreeQueueBus::Handler
+        {
+        public:
+            static constexpr int NumProducers = 8;
+
+            LockFreeQueueHandler()
+            {
+                m_lastValues.fill(-1);
+                BusConnect();
+            }
+
+            ~LockFreeQueueHandler() override
+            {
+                BusDisconnect();
+            }
+
+            void OnValue(int producer, int value) override
+            {
+                EXPECT_EQ(m_lastValues[producer] + 1, value);
+                m_lastValues[producer] = value;
+                m_callCount++;
+                m_valueCount++;
+            }
+
+            void OnStrings(const AZStd::string& first, const AZStd::string& second, const AZStd::string& third) override
+            {
+                m_strings = first + second + third;
+                m_callCount++;
+            }
+
+            AZStd::array<int, NumProducers> m_lastValues;
+            AZStd::string m_strings;
+            int m_callCount = 0;
+            AZStd::atomic_int m_valueCount{ 0 }; ///< Same as the number of OnValue calls in m_callCount, but safe to read from other threads.
+        };
+    }
+
+    class LockFreeQueueEbusTest
+        : public ScopedAllocatorSetupFixture
+    {
+    public:
+        void TearDown() override
+        {
+            LockFreeQueueTest::LockFreeQueueBus::ClearQueuedEvents();
+        }
+    };
+
+    TEST_F(LockFreeQueueEbusTest, QueueBroadcast_MultipleProducerThreads_MessagesFromEachThreadExecuteInOrder)
+    {
+        using namespace LockFreeQueueTest;
+        constexpr int NumMessages = 5000;
+
+        LockFreeQueueHandler handler;
+        AZStd::atomic_int numFinishedProducers{ 0 };
+        AZStd::vector<AZStd::thread> producers;
+        for (int producer = 0; producer < LockFreeQueueHandler::NumProducers; ++producer)
+        {
+            producers.emplace_back([producer, &numFinishedProducers]()
+                {
+                    for (int i = 0; i < NumMessages; ++i)
+                    {
+                        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, producer, i);
+                    }
+                    numFinishedProducers++;
+                });
+        }
+
+        while (numFinishedProducers < LockFreeQueueHandler::NumProducers)
+        {
+            LockFreeQueueBus::ExecuteQueuedEvents();
+            AZStd::this_thread::yield();
+        }
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+        LockFreeQueueBus::ExecuteQueuedEvents();
+
+        EXPECT_EQ(LockFreeQueueHandler::NumProducers * NumMessages, handler.m_callCount);
+        for (int lastValue : handler.m_lastValues)
+        {
+            EXPECT_EQ(NumMessages - 1, lastValue);
+        }
+        EXPECT_EQ(0, LockFreeQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(LockFreeQueueEbusTest, ExecuteQueuedEvents_ProducersQueueContinuously_ExecutingThreadKeepsMakingProgress)
+    {
+        using namespace LockFreeQueueTest;
+        // The small ring overflows all the time, so the executing thread keeps having to wait for pushes to the ring that are
+        // underway while the producers never stop queuing.
+        constexpr int MinExecutedMessages = 200000;
+        constexpr int MaxPendingMessages = 64 * 1024;
+
+        LockFreeQueueHandler handler;
+        AZStd::atomic_bool stopProducers{ false };
+        AZStd::atomic_bool stopConsumer{ false };
+        AZStd::atomic_int numQueued{ 0 };
+        AZStd::array<int, LockFreeQueueHandler::NumProducers> numQueuedPerProducer;
+        numQueuedPerProducer.fill(0);
+
+        AZStd::thread consumer([&stopConsumer]()
+            {
+                while (!stopConsumer)
+                {
+                    LockFreeQueueBus::ExecuteQueuedEvents();
+                    AZStd::this_thread::yield();
+                }
+            });
+
+        AZStd::vector<AZStd::thread> producers;
+        for (int producer = 0; producer < LockFreeQueueHandler::NumProducers; ++producer)
+        {
+            producers.emplace_back([producer, &stopProducers, &numQueued, &numQueuedPerProducer, &handler]()
+                {
+                    int value = 0;
+                    while (!stopProducers)
+                    {
+                        // Only keeps the overflow queue from growing without bound, the producers still keep the ring busy.
+                        if (numQueued - handler.m_valueCount > MaxPendingMessages)
+                        {
+                            AZStd::this_thread::yield();
+                            continue;
+                        }
+                        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, producer, value++);
+                        numQueued++;
+                    }
+                    numQueuedPerProducer[producer] = value;
+                });
+        }
+
+        const auto deadline = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(30);
+        while (handler.m_valueCount < MinExecutedMessages && AZStd::chrono::system_clock::now() < deadline)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+        EXPECT_GE(handler.m_valueCount.load(), MinExecutedMessages);
+
+        stopProducers = true;
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+        stopConsumer = true;
+        consumer.join();
+        LockFreeQueueBus::ExecuteQueuedEvents();
+
+        EXPECT_EQ(numQueued.load(), handler.m_valueCount.load());
+        for (int producer = 0; producer < LockFreeQueueHandler::NumProducers; ++producer)
+        {
+            EXPECT_EQ(numQueuedPerProducer[producer] - 1, handler.m_lastValues[producer]);
+        }
+        EXPECT_EQ(0, LockFreeQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(LockFreeQueueEbusTest, QueueBroadcast_ArgumentsTooLargeForInlineStorage_MessageIsExecuted)
+    {
+        using namespace LockFreeQueueTest;
+
+        LockFreeQueueHandler handler;
+        AZStd::string first(128, 'a');
+        AZStd::string second(128, 'b');
+        AZStd::string third(128, 'c');
+        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnStrings, first, second, third);
+        EXPECT_EQ(1, LockFreeQueueBus::QueuedEventCount());
+
+        LockFreeQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(1, handler.m_callCount);
+        EXPECT_EQ(first + second + third, handler.m_strings);
+    }
+
+    TEST_F(LockFreeQueueEbusTest, QueueFunction_QueuedFromQueuedMessage_AllMessagesAreExecuted)
+    {
+        using namespace LockFreeQueueTest;
+
+        // Queue more messages than fit in the ring from within a queued message, which forces the executing thread itself
+        // to spill over into the overflow queue.
+        constexpr int NumMessages = 64;
+        int numExecuted = 0;
+        int lastExecuted = -1;
+        LockFreeQueueBus::QueueFunction([&numExecuted, &lastExecuted]()
+            {
+                for (int i = 0; i < NumMessages; ++i)
+                {
+                    LockFreeQueueBus::QueueFunction([i, &numExecuted, &lastExecuted]()
+                        {
+                            EXPECT_EQ(lastExecuted + 1, i);
+                            lastExecuted = i;
+                            numExecuted++;
+                        });
+                }
+            });
+
+        LockFreeQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(NumMessages, numExecuted);
+        EXPECT_EQ(0, LockFreeQueueBus::QueuedEventCount());
+    }
+
+    TEST_F(LockFreeQueueEbusTest, ClearQueuedEvents_QueueOverflowed_NoMessagesAreExecuted)
+    {
+        using namespace LockFreeQueueTest;
+
+        LockFreeQueueHandler handler;
+        for (int i = 0; i < 32; ++i)
+        {
+            LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, 0, i);
+        }
+        EXPECT_EQ(32, LockFreeQueueBus::QueuedEventCount());
+
+        LockFreeQueueBus::ClearQueuedEvents();
+        EXPECT_EQ(0, LockFreeQueueBus::QueuedEventCount());
+        LockFreeQueueBus::ExecuteQueuedEvents();
+        EXPECT_EQ(0, handler.m_callCount);
+    }
+
+    TEST_F(LockFreeQueueEbusTest, AllowFunctionQueuing_Disabled_MessagesAreRejected)
+    {
+        using namespace LockFreeQueueTest;
+
+        LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, 0, 0);
+        LockFreeQueueBus::AllowFunctionQueuing(false);
+        EXPECT_EQ(0, LockFreeQueueBus::QueuedEventCount());
+        {
+            AZ::Test::AssertAbsorber assertAbsorber;
+            LockFreeQueueBus::QueueBroadcast(&LockFreeQueueBus::Events::OnValue, 0, 1);
+            EXPECT_EQ(assertAbsorber.m_warningCount, 1);
+        }
+        EXPECT_EQ(0, LockFreeQueueBus::QueuedEventCount());
+        LockFreeQueueBus::AllowFunctionQueuing(true);
+    }
+
     class ConnectDisconnectInterface
         : public EBusTraits
     {
@@ -4505,6 +4759,50 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    //////////////////////////////////////////////////////////////////////////
+    // Multithreaded Queued Messages
+    //////////////////////////////////////////////////////////////////////////
+
+    template<bool LockFree>
+    class QueuedMessageBenchmarkEvents
+        : public AZ::EBusTraits
+    {
+    public:
+        using EventQueueMutexType = AZStd::mutex;
+        static const bool EnableEventQueue = true;
+        static const bool EnableLockFreeEventQueue = LockFree;
+        static const size_t LockFreeEventQueueCapacity = 4096;
+
+        virtual void OnMessage(int value) = 0;
+    };
+    using LockedQueueBus = AZ::EBus<QueuedMessageBenchmarkEvents<false>>;
+    using LockFreeQueueBus = AZ::EBus<QueuedMessageBenchmarkEvents<true>>;
+
+    // Every thread queues messages as fast as it can, similar to job threads reporting results back to the main thread.
+    // The first thread also acts as the main thread and periodically executes the queued messages.
+    template<typename Bus>
+    static void BM_EBus_Multithreaded_QueueBroadcast(::benchmark::State& state)
+    {
+        constexpr int ExecuteInterval = 256;
+        int count = 0;
+        while (state.KeepRunning())
+        {
+            Bus::QueueBroadcast(&Bus::Events::OnMessage, count);
+            if (state.thread_index == 0 && (++count % ExecuteInterval) == 0)
+            {
+                Bus::ExecuteQueuedEvents();
+            }
+        }
+
+        if (state.thread_index == 0)
+        {
+            Bus::ClearQueuedEvents();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_QueueBroadcast, LockedQueueBus)->Threads(1)->Threads(16)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_QueueBroadcast, LockFreeQueueBus)->Threads(1)->Threads(16)->UseRealTime();
 }
 
 #endif // HAVE_BENCHMARK
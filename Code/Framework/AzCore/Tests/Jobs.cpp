@@ -15,6 +15,7 @@
 #include <AzCore/Jobs/JobCompletionSpin.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/LegacyJobExecutor.h>
+#include <AzCore/Jobs/TaskGraph.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/Jobs/Algorithms.h>
@@ -28,6 +29,10 @@
 #include <AzCore/std/containers/fixed_list.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
+#include <AzCore/std/parallel/containers/work_stealing_deque.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/containers/deque.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -1655,6 +1660,145 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class TaskGraphTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        TaskGraphTestFixture() : DefaultJobManagerSetupFixture(2)
+        {
+        }
+    };
+
+    TEST_F(TaskGraphTestFixture, SubmitAndWait_Diamond_TasksRunAfterTheirDependencies)
+    {
+        AZStd::atomic<int> value{ 0 };
+        int leftResult = 0;
+        int rightResult = 0;
+        int joinResult = 0;
+
+        TaskGraph graph("Diamond", m_jobContext);
+        TaskToken root = graph.AddTask({ "Root" }, [&value]() { value = 1; });
+        TaskToken left = graph.AddTask({ "Left" }, [&value, &leftResult]() { leftResult = value + 1; });
+        TaskToken right = graph.AddTask({ "Right" }, [&value, &rightResult]() { rightResult = value + 2; });
+        TaskToken join = graph.AddTask({ "Join" }, [&leftResult, &rightResult, &joinResult]() { joinResult = leftResult + rightResult; });
+        graph.AddDependency(root, left);
+        graph.AddDependency(root, right);
+        graph.AddDependency(left, join);
+        graph.AddDependency(right, join);
+        ASSERT_TRUE(graph.Compile());
+
+        // The same compiled graph is submitted repeatedly, like once per frame
+        for (int frame = 0; frame < 100; ++frame)
+        {
+            value = 0;
+            joinResult = 0;
+            graph.SubmitAndWait();
+            EXPECT_EQ(5, joinResult);
+            EXPECT_FALSE(graph.IsSubmitted());
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, SubmitAndWait_IndependentTasks_AllTasksRun)
+    {
+        const int taskCount = 64;
+        AZStd::atomic<int> counter{ 0 };
+
+        TaskGraph graph("Independent", m_jobContext);
+        for (int i = 0; i < taskCount; ++i)
+        {
+            graph.AddTask({ "Increment" }, [&counter]() { ++counter; });
+        }
+        ASSERT_TRUE(graph.Compile());
+        EXPECT_EQ(taskCount, graph.GetTaskCount());
+
+        graph.Submit();
+        graph.Wait();
+        graph.SubmitAndWait();
+        EXPECT_EQ(taskCount * 2, counter);
+    }
+
+    TEST_F(TaskGraphTestFixture, Compile_CriticalPath_PrioritiesFollowPathCost)
+    {
+        TaskGraph graph("CriticalPath", m_jobContext);
+        auto empty = []() {};
+        TaskToken root = graph.AddTask({ "Root", 0, 1 }, empty);
+        TaskToken shortTask = graph.AddTask({ "Short", 0, 1 }, empty);
+        TaskToken longTask = graph.AddTask({ "Long", 0, 10 }, empty);
+        TaskToken longTail = graph.AddTask({ "LongTail", 0, 10 }, empty);
+        TaskToken urgent = graph.AddTask({ "Urgent", 100, 1 }, empty);
+        graph.AddDependency(root, shortTask);
+        graph.AddDependency(root, longTask);
+        graph.AddDependency(longTask, longTail);
+        ASSERT_TRUE(graph.Compile());
+
+        EXPECT_EQ(21, graph.GetCriticalPathCost());
+        EXPECT_EQ(TaskGraph::CriticalPathPriorityBoost, graph.GetSchedulingPriority(root));
+        EXPECT_EQ(TaskGraph::CriticalPathPriorityBoost * 20 / 21, graph.GetSchedulingPriority(longTask));
+        EXPECT_EQ(TaskGraph::CriticalPathPriorityBoost * 10 / 21, graph.GetSchedulingPriority(longTail));
+        EXPECT_EQ(0, graph.GetSchedulingPriority(shortTask));
+        // The task's own priority still dominates
+        EXPECT_EQ(100, graph.GetSchedulingPriority(urgent));
+    }
+
+    TEST_F(TaskGraphTestFixture, Compile_Cycle_Fails)
+    {
+        TaskGraph graph("Cycle", m_jobContext);
+        auto empty = []() {};
+        TaskToken first = graph.AddTask({ "First" }, empty);
+        TaskToken second = graph.AddTask({ "Second" }, empty);
+        graph.AddDependency(first, second);
+        graph.AddDependency(second, first);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(graph.Compile());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(graph.IsCompiled());
+
+        graph.Clear();
+        graph.AddTask({ "Single" }, empty);
+        EXPECT_TRUE(graph.Compile());
+        graph.SubmitAndWait();
+    }
+
+    class TaskGraphSingleWorkerTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        TaskGraphSingleWorkerTestFixture() : DefaultJobManagerSetupFixture(1) // Only 1 worker to serialize task execution
+        {
+        }
+    };
+
+    TEST_F(TaskGraphSingleWorkerTestFixture, SubmitAndWait_SeveralTasksReady_CriticalPathRunsFirst)
+    {
+        // Only the worker runs tasks, so the order isn't racy. After the root both branches are ready, and the branch
+        // with the more expensive chain of tasks has to be picked first even though it was added last.
+        // The root waits until all the jobs have been started, so both branches are queued by the worker itself.
+        AZStd::vector<AZStd::string> namesOfProcessedTasks;
+        AZStd::binary_semaphore submitted;
+        TaskGraph graph("CriticalPathOrder", m_jobContext);
+        TaskToken root = graph.AddTask({ "Root", 0, 1 }, [&namesOfProcessedTasks, &submitted]()
+        {
+            submitted.acquire();
+            namesOfProcessedTasks.push_back("Root");
+        });
+        TaskToken shortTask = graph.AddTask({ "Short", 0, 1 }, [&namesOfProcessedTasks]() { namesOfProcessedTasks.push_back("Short"); });
+        TaskToken longTask = graph.AddTask({ "Long", 0, 10 }, [&namesOfProcessedTasks]() { namesOfProcessedTasks.push_back("Long"); });
+        TaskToken longTail = graph.AddTask({ "LongTail", 0, 10 }, [&namesOfProcessedTasks]() { namesOfProcessedTasks.push_back("LongTail"); });
+        graph.AddDependency(root, shortTask);
+        graph.AddDependency(root, longTask);
+        graph.AddDependency(longTask, longTail);
+        ASSERT_TRUE(graph.Compile());
+
+        graph.Submit();
+        submitted.release();
+        graph.Wait();
+
+        ASSERT_EQ(4, namesOfProcessedTasks.size());
+        EXPECT_EQ(namesOfProcessedTasks[0], "Root");
+        EXPECT_EQ(namesOfProcessedTasks[1], "Long");
+        EXPECT_EQ(namesOfProcessedTasks[2], "LongTail");
+        EXPECT_EQ(namesOfProcessedTasks[3], "Short");
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -2015,6 +2159,229 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    //! Binary tree of tiny jobs, every level forks two children from the worker running the parent, which is the
+    //! pattern that stresses the local queues (fork/pop) and the work stealing between them.
+    class TestJobForkTree : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestJobForkTree, ThreadPoolAllocator, 0)
+
+        TestJobForkTree(AZ::u32 depth, JobContext* context)
+            : Job(true, context)
+            , m_depth(depth)
+        {
+        }
+
+        void Process() override
+        {
+            if (m_depth > 0)
+            {
+                StartAsChild(aznew TestJobForkTree(m_depth - 1, GetContext()));
+                StartAsChild(aznew TestJobForkTree(m_depth - 1, GetContext()));
+                WaitForChildren();
+            }
+        }
+    private:
+        const AZ::u32 m_depth;
+    };
+
+    class JobForkStealBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        static const AZ::u32 FORK_TREE_DEPTH = 14;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+
+    protected:
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(JobForkStealBenchmarkFixture, ForkTree)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            JobCompletion doneJob(m_jobContext);
+            Job* job = aznew TestJobForkTree(FORK_TREE_DEPTH, m_jobContext);
+            job->SetDependent(&doneJob);
+            job->Start();
+            doneJob.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * ((AZ::s64(1) << (FORK_TREE_DEPTH + 1)) - 1));
+    }
+    BENCHMARK_REGISTER_F(JobForkStealBenchmarkFixture, ForkTree)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
+
+    //! The previous worker queue implementation (a deque guarded by a shared_mutex, steals spin on try_lock),
+    //! kept here so the lock-free work stealing deque can be compared against it.
+    class LockedWorkQueue
+    {
+    public:
+        void LocalInsert(void* job)
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_lock);
+            m_queue.push_back(job);
+        }
+
+        void* LocalPop()
+        {
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_lock);
+            void* result = nullptr;
+            if (!m_queue.empty())
+            {
+                result = m_queue.back();
+                m_queue.pop_back();
+            }
+            return result;
+        }
+
+        void* TrySteal()
+        {
+            AZStd::exponential_backoff backoff;
+            for (unsigned int attemptCount = 0; attemptCount < 16; ++attemptCount)
+            {
+                if (m_lock.try_lock())
+                {
+                    void* result = nullptr;
+                    if (!m_queue.empty())
+                    {
+                        result = m_queue.front();
+                        m_queue.pop_front();
+                    }
+                    m_lock.unlock();
+                    return result;
+                }
+                backoff.wait();
+            }
+            return nullptr;
+        }
+
+    private:
+        AZStd::deque<void*> m_queue;
+        AZStd::shared_mutex m_lock;
+    };
+
+    class LockFreeWorkQueue
+    {
+    public:
+        void LocalInsert(void* job)
+        {
+            m_queue.push(job);
+        }
+
+        void* LocalPop()
+        {
+            void* result = nullptr;
+            return m_queue.pop(&result) ? result : nullptr;
+        }
+
+        void* TrySteal()
+        {
+            void* result = nullptr;
+            return m_queue.steal(&result) ? result : nullptr;
+        }
+
+    private:
+        AZStd::work_stealing_deque<void*> m_queue;
+    };
+
+    //! Thread 0 owns the queue and forks/pops batches of items, all the other benchmark threads steal from it.
+    template<class QueueType>
+    class WorkQueueBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        static const AZ::u32 FORKS_PER_ITERATION = 64;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                m_queue = new QueueType();
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                delete m_queue;
+                m_queue = nullptr;
+            }
+        }
+
+        void Run(::benchmark::State& state)
+        {
+            int items[FORKS_PER_ITERATION];
+            AZ::s64 processed = 0;
+            for (auto _ : state)
+            {
+                if (state.thread_index == 0)
+                {
+                    for (AZ::u32 i = 0; i < FORKS_PER_ITERATION; ++i)
+                    {
+                        m_queue->LocalInsert(&items[i]);
+                    }
+                    while (void* item = m_queue->LocalPop())
+                    {
+                        benchmark::DoNotOptimize(item);
+                        ++processed;
+                    }
+                }
+                else
+                {
+                    for (AZ::u32 i = 0; i < FORKS_PER_ITERATION; ++i)
+                    {
+                        if (void* item = m_queue->TrySteal())
+                        {
+                            benchmark::DoNotOptimize(item);
+                            ++processed;
+                        }
+                    }
+                }
+            }
+            state.SetItemsProcessed(processed);
+        }
+
+    protected:
+        static QueueType* m_queue;
+    };
+    template<class QueueType>
+    QueueType* WorkQueueBenchmarkFixture<QueueType>::m_queue = nullptr;
+
+    BENCHMARK_TEMPLATE_DEFINE_F(WorkQueueBenchmarkFixture, LockedDequeForkSteal, LockedWorkQueue)(benchmark::State& state)
+    {
+        Run(state);
+    }
+    BENCHMARK_REGISTER_F(WorkQueueBenchmarkFixture, LockedDequeForkSteal)->ThreadRange(1, 64)->UseRealTime();
+
+    BENCHMARK_TEMPLATE_DEFINE_F(WorkQueueBenchmarkFixture, LockFreeDequeForkSteal, LockFreeWorkQueue)(benchmark::State& state)
+    {
+        Run(state);
+    }
+    BENCHMARK_REGISTER_F(WorkQueueBenchmarkFixture, LockFreeDequeForkSteal)->ThreadRange(1, 64)->UseRealTime();
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
@@ -0,0 +1,321 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class FrameAllocatorTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            FrameAllocator::Descriptor desc;
+            desc.m_blockSize = BlockSize;
+            desc.m_debugChecks = true;
+            AllocatorInstance<FrameAllocator>::Create(desc);
+            m_allocator = static_cast<FrameAllocator*>(&AllocatorInstance<FrameAllocator>::GetAllocator());
+        }
+
+        void TearDown() override
+        {
+            m_allocator = nullptr;
+            AllocatorInstance<FrameAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        static const size_t BlockSize = 64 * 1024;
+
+        FrameAllocator* m_allocator = nullptr;
+    };
+
+    TEST_F(FrameAllocatorTest, Allocate_VariousAlignments_AddressesAreAligned)
+    {
+        const size_t alignments[] = { 1, 4, 8, 16, 64, 256, 4096 };
+        for (size_t alignment : alignments)
+        {
+            void* address = m_allocator->Allocate(13, alignment);
+            ASSERT_NE(nullptr, address);
+            EXPECT_EQ(0, reinterpret_cast<uintptr_t>(address) % alignment);
+            EXPECT_EQ(13, m_allocator->AllocationSize(address));
+        }
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, Allocate_LargerThanBlock_Succeeds)
+    {
+        char* address = reinterpret_cast<char*>(m_allocator->Allocate(BlockSize * 3, 16));
+        ASSERT_NE(nullptr, address);
+        memset(address, 1, BlockSize * 3);
+        EXPECT_GE(m_allocator->Capacity(), BlockSize * 3);
+        m_allocator->DeAllocate(address);
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, DeAllocate_MostRecentAllocation_MemoryIsReused)
+    {
+        void* first = m_allocator->Allocate(128, 16);
+        const size_t allocatedBytes = m_allocator->NumAllocatedBytes();
+        void* second = m_allocator->Allocate(256, 16);
+        EXPECT_GT(m_allocator->NumAllocatedBytes(), allocatedBytes);
+
+        m_allocator->DeAllocate(second);
+        EXPECT_EQ(allocatedBytes, m_allocator->NumAllocatedBytes());
+        void* third = m_allocator->Allocate(256, 16);
+        EXPECT_EQ(second, third);
+
+        m_allocator->DeAllocate(third);
+        m_allocator->DeAllocate(first);
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, Resize_OnlyMostRecentAllocation_Succeeds)
+    {
+        void* first = m_allocator->Allocate(64, 8);
+        void* second = m_allocator->Allocate(64, 8);
+
+        EXPECT_EQ(0, m_allocator->Resize(first, 128));
+        EXPECT_EQ(128, m_allocator->Resize(second, 128));
+        EXPECT_EQ(128, m_allocator->AllocationSize(second));
+        EXPECT_EQ(0, m_allocator->Resize(second, BlockSize * 2));
+
+        m_allocator->DeAllocate(second);
+        m_allocator->DeAllocate(first);
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, ReAllocate_NotMostRecentAllocation_MovesContents)
+    {
+        int* first = reinterpret_cast<int*>(m_allocator->Allocate(16 * sizeof(int), 16));
+        void* second = m_allocator->Allocate(64, 16);
+        for (int i = 0; i < 16; ++i)
+        {
+            first[i] = i;
+        }
+
+        int* grown = reinterpret_cast<int*>(m_allocator->ReAllocate(first, 64 * sizeof(int), 16));
+        ASSERT_NE(nullptr, grown);
+        EXPECT_NE(first, grown);
+        EXPECT_EQ(64 * sizeof(int), m_allocator->AllocationSize(grown));
+        for (int i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(i, grown[i]);
+        }
+
+        // The most recent allocation still grows in place.
+        EXPECT_EQ(grown, m_allocator->ReAllocate(grown, 128 * sizeof(int), 16));
+
+        m_allocator->DeAllocate(grown);
+        m_allocator->DeAllocate(second);
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, ReAllocate_LargerThanBlock_MovesContents)
+    {
+        char* address = reinterpret_cast<char*>(m_allocator->Allocate(64, 16));
+        memset(address, 1, 64);
+
+        char* grown = reinterpret_cast<char*>(m_allocator->ReAllocate(address, BlockSize * 2, 16));
+        ASSERT_NE(nullptr, grown);
+        EXPECT_EQ(1, grown[0]);
+        EXPECT_EQ(1, grown[63]);
+        memset(grown, 2, BlockSize * 2);
+
+        m_allocator->DeAllocate(grown);
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, EndFrame_ThreadExited_ArenaIsReleased)
+    {
+        AZStd::thread thread([this]()
+        {
+            m_allocator->DeAllocate(m_allocator->Allocate(BlockSize / 2, 16));
+        });
+        thread.join();
+
+        // Memory of the exited thread may still be used by other threads until the frame ends.
+        EXPECT_GT(m_allocator->Capacity(), 0);
+        m_allocator->GarbageCollect();
+        EXPECT_GT(m_allocator->Capacity(), 0);
+
+        m_allocator->EndFrame();
+        EXPECT_EQ(0, m_allocator->Capacity());
+    }
+
+    TEST_F(FrameAllocatorTest, EndFrame_ResetsAllocatedBytes_KeepsBlocks)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            m_allocator->Allocate(1024, 16);
+        }
+        const size_t capacity = m_allocator->Capacity();
+        EXPECT_GE(m_allocator->NumAllocatedBytes(), 100 * 1024);
+        EXPECT_GE(capacity, 100 * 1024);
+
+        // The allocations above are never freed on purpose, which is reported when the frame ends.
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_allocator->EndFrame();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_EQ(1, m_allocator->GetFrame());
+        EXPECT_EQ(0, m_allocator->NumAllocatedBytes());
+        EXPECT_EQ(capacity, m_allocator->Capacity());
+
+        // Doing the same amount of work again doesn't need new blocks.
+        for (int i = 0; i < 100; ++i)
+        {
+            m_allocator->DeAllocate(m_allocator->Allocate(1024, 16));
+        }
+        EXPECT_EQ(capacity, m_allocator->Capacity());
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, GarbageCollect_ReleasesBlocksAtNextFrame)
+    {
+        void* address = m_allocator->Allocate(BlockSize / 2, 16);
+        m_allocator->DeAllocate(address);
+        m_allocator->EndFrame();
+        EXPECT_GT(m_allocator->Capacity(), 0);
+
+        m_allocator->GarbageCollect();
+        m_allocator->EndFrame();
+        EXPECT_EQ(0, m_allocator->Capacity());
+    }
+
+    TEST_F(FrameAllocatorTest, HighWatermark_TracksLargestFrame)
+    {
+        void* address = m_allocator->Allocate(4096, 16);
+        m_allocator->DeAllocate(address);
+        m_allocator->EndFrame();
+
+        address = m_allocator->Allocate(1024, 16);
+        m_allocator->DeAllocate(address);
+        m_allocator->EndFrame();
+
+        EXPECT_GE(m_allocator->GetHighWatermark(), 4096);
+        m_allocator->ResetHighWatermark();
+        EXPECT_EQ(0, m_allocator->GetHighWatermark());
+    }
+
+    TEST_F(FrameAllocatorTest, StdAllocator_UsedWithVector_Works)
+    {
+        {
+            AZStd::vector<int, FrameStdAllocator> values;
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+            }
+            for (int i = 0; i < 1000; ++i)
+            {
+                EXPECT_EQ(i, values[i]);
+            }
+        }
+        m_allocator->EndFrame();
+        EXPECT_EQ(0, m_allocator->NumAllocatedBytes());
+    }
+
+    TEST_F(FrameAllocatorTest, StdAllocator_IsVisibleToAllocatorManager)
+    {
+        bool found = false;
+        AllocatorManager& manager = AllocatorManager::Instance();
+        for (int i = 0; i < manager.GetNumAllocators(); ++i)
+        {
+            found = found || manager.GetAllocator(i) == m_allocator;
+        }
+        EXPECT_TRUE(found);
+    }
+
+    TEST_F(FrameAllocatorTest, DeAllocate_AfterFrameEnded_ReportsError)
+    {
+        void* address = m_allocator->Allocate(64, 16);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_allocator->EndFrame();
+        // Memory from the previous frame has been filled with the freed memory pattern.
+        EXPECT_EQ(0xdd, *reinterpret_cast<unsigned char*>(address));
+        m_allocator->DeAllocate(address);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(FrameAllocatorTest, DeAllocate_Twice_ReportsError)
+    {
+        void* first = m_allocator->Allocate(64, 16);
+        void* second = m_allocator->Allocate(64, 16);
+        m_allocator->DeAllocate(first);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_allocator->DeAllocate(first);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        m_allocator->DeAllocate(second);
+        m_allocator->EndFrame();
+    }
+
+    TEST_F(FrameAllocatorTest, Allocate_MultipleThreads_AllocationsDontOverlap)
+    {
+        const size_t threadCount = 4;
+        const size_t allocationCount = 1000;
+        AZStd::atomic<int> failures{ 0 };
+
+        auto work = [this, &failures](unsigned char pattern)
+        {
+            AZStd::vector<unsigned char*> allocations;
+            allocations.reserve(allocationCount);
+            for (size_t i = 0; i < allocationCount; ++i)
+            {
+                unsigned char* address = reinterpret_cast<unsigned char*>(m_allocator->Allocate(48, 16));
+                memset(address, pattern, 48);
+                allocations.push_back(address);
+            }
+            for (unsigned char* address : allocations)
+            {
+                for (size_t i = 0; i < 48; ++i)
+                {
+                    if (address[i] != pattern)
+                    {
+                        ++failures;
+                        break;
+                    }
+                }
+            }
+            for (auto it = allocations.rbegin(); it != allocations.rend(); ++it)
+            {
+                m_allocator->DeAllocate(*it);
+            }
+        };
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&work, i]() { work(static_cast<unsigned char>(i + 1)); });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, failures);
+        EXPECT_GE(m_allocator->GetHighWatermark(), threadCount * allocationCount * 48);
+        m_allocator->EndFrame();
+    }
+}
@@ -29,6 +29,8 @@
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 
 #include <thread>
 #include <stdlib.h>
@@ -52,14 +54,23 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static AZStd::vector<AZ::Internal::NameData*> GetEntries()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            AZ::NameDictionary& dictionary = AZ::NameDictionary::Instance();
+            AZStd::scoped_lock lock(dictionary.m_mutex);
+            return dictionary.GetEntries();
         }
-        
+
         static size_t GetEntryCount()
         {
-            return GetDictionary().size();
+            AZ::NameDictionary& dictionary = AZ::NameDictionary::Instance();
+            AZStd::scoped_lock lock(dictionary.m_mutex);
+            return dictionary.m_entryCount;
+        }
+
+        static size_t GetTableCapacity()
+        {
+            return AZ::NameDictionary::Instance().m_table.load()->m_mask + 1;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -274,9 +285,9 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
+            AZStd::vector<AZ::Internal::NameData*> globalDictionary = NameDictionaryTester::GetEntries();
+            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZ::Internal::NameData* entry) {
+                return entry->GetName() == nameString;
             });
             EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
@@ -584,6 +595,79 @@ namespace UnitTest
         EXPECT_EQ(0, nameSet.count(AZ::Name{ "d" }));
     }
 
+    TEST_F(NameTest, NameLiteral_MatchesNameFromString)
+    {
+        AZ::Name fromString{ "literal" };
+        for (int i = 0; i < 2; ++i)
+        {
+            // The first iteration resolves the literal through the dictionary, the second uses the cached entry.
+            AZ::Name fromLiteral = AZ_NAME_LITERAL("literal");
+            EXPECT_EQ(fromString, fromLiteral);
+            EXPECT_EQ(fromString.GetStringView(), fromLiteral.GetStringView());
+            EXPECT_EQ(fromString.GetHash(), fromLiteral.GetHash());
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+
+        EXPECT_TRUE(AZ_NAME_LITERAL("").IsEmpty());
+    }
+
+    TEST_F(NameTest, NameLiteral_AllNamesReleased_EntryRemainsInDictionary)
+    {
+        {
+            AZ::Name name = AZ_NAME_LITERAL("literal");
+        }
+        // The literal caches the entry, so it's kept until the dictionary is destroyed.
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+        EXPECT_EQ(AZ::Name{ "literal" }.GetStringView(), "literal");
+    }
+
+    TEST_F(NameTest, NameLiteral_DictionaryRecreated_CachedEntryIsNotUsed)
+    {
+        auto makeName = []() { return AZ_NAME_LITERAL("literal"); };
+        AZ::Name::Hash hash = makeName().GetHash();
+
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+        AZ::Name name = makeName();
+        EXPECT_EQ(name.GetStringView(), "literal");
+        EXPECT_EQ(name.GetHash(), hash);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, ManyNames_TableGrows_AllNamesAreFound)
+    {
+        const size_t initialCapacity = NameDictionaryTester::GetTableCapacity();
+
+        AZStd::vector<AZ::Name> names;
+        for (size_t i = 0; i < initialCapacity * 4; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name %zu", i));
+        }
+        EXPECT_GT(NameDictionaryTester::GetTableCapacity(), initialCapacity);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), names.size());
+
+        for (const AZ::Name& name : names)
+        {
+            EXPECT_EQ(AZ::Name{ name.GetHash() }, name);
+            EXPECT_EQ(AZ::Name{ name.GetStringView() }, name);
+        }
+    }
+
+    TEST_F(NameTest, ManyNames_CreatedAndReleased_TableDoesNotGrow)
+    {
+        const size_t initialCapacity = NameDictionaryTester::GetTableCapacity();
+
+        for (size_t i = 0; i < initialCapacity * 4; ++i)
+        {
+            AZ::Name name{ AZStd::string::format("name %zu", i) };
+            EXPECT_EQ(AZ::Name{ name.GetHash() }, name);
+        }
+        EXPECT_EQ(NameDictionaryTester::GetTableCapacity(), initialCapacity);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+    }
+
     TEST_F(NameTest, ConcurrencyDataTest_EachThreadCreatesOneName_NoCollision)
     {
         const uint32_t maxUniqueHashes = std::numeric_limits<uint32_t>::max();
@@ -837,3 +921,126 @@ namespace UnitTest
     }
 }
 
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // Shared by all threads of a benchmark. The first thread sets it up before the timed loop starts.
+    class NameBenchmarkEnvironment
+        : public UnitTest::AllocatorsBase
+    {
+    public:
+        static constexpr size_t NameCount = 1024;
+        static constexpr int MaxThreadCount = 16;
+
+        void SetUp()
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+            for (size_t i = 0; i < NameCount; ++i)
+            {
+                m_strings.push_back(AZStd::string::format("BenchmarkName%zu", i));
+                m_names.emplace_back(m_strings.back());
+            }
+
+            // Strings for names that are unique to each thread. These are made here because the other threads
+            // can't allocate memory until the allocators are set up.
+            m_threadStrings.resize(MaxThreadCount);
+            for (int thread = 0; thread < MaxThreadCount; ++thread)
+            {
+                for (size_t i = 0; i < NameCount; ++i)
+                {
+                    m_threadStrings[thread].push_back(AZStd::string::format("BenchmarkThread%dName%zu", thread, i));
+                }
+            }
+        }
+
+        void TearDown()
+        {
+            m_names.set_capacity(0);
+            m_strings.set_capacity(0);
+            m_threadStrings.set_capacity(0);
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        AZStd::vector<AZStd::string> m_strings;
+        AZStd::vector<AZ::Name> m_names;
+        AZStd::vector<AZStd::vector<AZStd::string>> m_threadStrings;
+    };
+    static NameBenchmarkEnvironment s_nameBenchmarkEnvironment;
+
+    static void SetUpNameBenchmark(const ::benchmark::State& state)
+    {
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.SetUp();
+        }
+    }
+
+    static void TearDownNameBenchmark(::benchmark::State& state)
+    {
+        state.SetItemsProcessed(state.iterations());
+        if (state.thread_index == 0)
+        {
+            s_nameBenchmarkEnvironment.TearDown();
+        }
+    }
+
+    // Creates names that already exist in the dictionary, which is the common case at runtime.
+    static void BM_Name_Multithreaded_CreateExisting(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+        size_t index = state.thread_index;
+        while (state.KeepRunning())
+        {
+            AZ::Name name(s_nameBenchmarkEnvironment.m_strings[index]);
+            ::benchmark::DoNotOptimize(name);
+            index = (index + 1) % NameBenchmarkEnvironment::NameCount;
+        }
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_Multithreaded_CreateExisting)->ThreadRange(1, NameBenchmarkEnvironment::MaxThreadCount)->UseRealTime();
+
+    static void BM_Name_Multithreaded_CreateFromHash(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+        size_t index = state.thread_index;
+        while (state.KeepRunning())
+        {
+            AZ::Name name(s_nameBenchmarkEnvironment.m_names[index].GetHash());
+            ::benchmark::DoNotOptimize(name);
+            index = (index + 1) % NameBenchmarkEnvironment::NameCount;
+        }
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_Multithreaded_CreateFromHash)->ThreadRange(1, NameBenchmarkEnvironment::MaxThreadCount)->UseRealTime();
+
+    static void BM_Name_Multithreaded_CreateLiteral(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+        while (state.KeepRunning())
+        {
+            AZ::Name name = AZ_NAME_LITERAL("BenchmarkName0");
+            ::benchmark::DoNotOptimize(name);
+        }
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_Multithreaded_CreateLiteral)->ThreadRange(1, NameBenchmarkEnvironment::MaxThreadCount)->UseRealTime();
+
+    // Every thread adds and releases its own names, which goes through the locked path of the dictionary.
+    static void BM_Name_Multithreaded_CreateAndRelease(::benchmark::State& state)
+    {
+        SetUpNameBenchmark(state);
+        size_t index = 0;
+        while (state.KeepRunning())
+        {
+            AZ::Name name(s_nameBenchmarkEnvironment.m_threadStrings[state.thread_index][index]);
+            ::benchmark::DoNotOptimize(name);
+            index = (index + 1) % NameBenchmarkEnvironment::NameCount;
+        }
+        TearDownNameBenchmark(state);
+    }
+    BENCHMARK(BM_Name_Multithreaded_CreateAndRelease)->ThreadRange(1, NameBenchmarkEnvironment::MaxThreadCount)->UseRealTime();
+}
+#endif // HAVE_BENCHMARK
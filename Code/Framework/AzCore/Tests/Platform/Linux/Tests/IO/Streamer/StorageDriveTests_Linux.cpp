@@ -0,0 +1,589 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr bool TestEnableUnbufferReads = true;
+    constexpr bool HasSeekPenalty = false;
+
+    static AZStd::string GetTestFilesFolder()
+    {
+        char exePath[AZ_MAX_PATH_LEN] = { 0 };
+        auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+        if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+        {
+            return {};
+        }
+
+        AZStd::string filePath(exePath);
+        if (result.m_pathIncludesFilename)
+        {
+            AZ::StringFunc::Path::StripFullName(filePath);
+        }
+        AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+
+        // Create the "TestFiles" dir in the bin directory if it doesn't exist...
+        if (!AZ::IO::SystemFile::Exists(filePath.c_str()) && !AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+        {
+            return {};
+        }
+        return filePath;
+    }
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            options.m_enableIoUring = true;
+
+            return StorageDriveLinux({ "/" }, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+    // All tests run twice, once with io_uring enabled and once with the fallback to the pool of read threads. If io_uring
+    // isn't available on the machine running the tests, both runs use the thread pool.
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "DummyLinux.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDriveLinux{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            AZStd::string folder = GetTestFilesFolder();
+            if (!folder.empty())
+            {
+                AZ::StringFunc::Path::Join(folder.c_str(), s_dummyFilename, m_dummyFilepath);
+            }
+        }
+
+        StorageDriveLinux::ConstructionOptions GetOptions() const
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = HasSeekPenalty;
+            options.m_enableUnbufferedReads = TestEnableUnbufferReads;
+            options.m_enableIoUring = GetParam();
+            return options;
+        }
+
+        void SetupStorageDrive(s32 overCommit)
+        {
+            if (m_context == nullptr)
+            {
+                m_context = new AZ::IO::StreamerContext();
+            }
+
+            ASSERT_FALSE(m_dummyFilepath.empty());
+
+            m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+                TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, overCommit,
+                GetOptions());
+            m_storageDriveLinux->SetContext(*m_context);
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+            SetupStorageDrive(TestOverCommit);
+        }
+
+        void TearDown() override
+        {
+            m_storageDriveLinux.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            SystemFile file;
+            bool fileCreated = file.Open(m_dummyFilepath.c_str(),
+                SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE);
+            ASSERT_TRUE(fileCreated);
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDriveLinux->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDriveLinux->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+    };
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, Constructor_MultipleMountPoints_AllPathsAreIncludedInTheName)
+    {
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/", "/home" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, TestOverCommit,
+            GetOptions());
+
+        const AZStd::string& name = m_storageDriveLinux->GetName();
+        EXPECT_NE(AZStd::string::npos, name.find("(/,"));
+        EXPECT_NE(AZStd::string::npos, name.find("/home)"));
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0, TestQueueDepth, TestOverCommit, GetOptions());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth,
+            -(aznumeric_cast<s32>(TestQueueDepth) + 2), GetOptions());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_FileOutsideMountPoint_RequestIsForwarded)
+    {
+        m_storageDriveLinux = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/NotAMountPoint" },
+            TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, TestOverCommit,
+            GetOptions());
+        m_storageDriveLinux->SetContext(*m_context);
+
+        char buffer[16];
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath("/NotAMountPointEither/File.bin");
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        // There's no next entry in the stack so the request fails, but it does so without the drive accepting it.
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        m_storageDriveLinux->QueueRequest(request);
+
+        AZ::IO::StreamStackEntry::Status status;
+        m_storageDriveLinux->UpdateStatus(status);
+        EXPECT_TRUE(status.m_isIdle);
+        m_context->FinalizeCompletedRequests();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileDoesntExist_ReturnsFalse)
+    {
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_FALSE(fileMetaData.m_found);
+                EXPECT_EQ(0, fileMetaData.m_fileSize);
+            });
+
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_TRUE(fileExistsCheck.m_found);
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_QueueAndExecuteRequest_DataIsCorrect)
+    {
+        constexpr size_t fileSize = 16_kib;
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+
+        CreateDummyFile(fileSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[1], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetSizeAndMemory_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t fileSize = 16_kib;
+        constexpr char unexpectedChar = 'Z';
+
+        // Allocate with an odd offset so the output buffer isn't aligned either.
+        char* allocation = reinterpret_cast<char*>(azmalloc(unalignedSize + 8, TestPhysicalSectorSize));
+        char* buffer = allocation + 3;
+        buffer[unalignedSize] = unexpectedChar;
+
+        CreateDummyFile(fileSize, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, unalignedSize + 4, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_chunkCharacter);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffer[unalignedSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+
+        azfree(allocation);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ParallelReads_DataIsCorrect)
+    {
+        // More reads than the queue depth so reads need to wait for slots to become available.
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = TestQueueDepth * 4;
+        constexpr size_t fileSize = numChunks * chunkSize;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer + i * chunkSize, chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    numCompleted++;
+                });
+            m_storageDriveLinux->QueueRequest(request);
+        }
+        WaitTillCompleted();
+
+        EXPECT_EQ(numChunks, numCompleted);
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffer[i * chunkSize], s_chunkCharacter);
+            EXPECT_EQ(buffer[i * chunkSize - 1], s_fileCharacter);
+        }
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_ReportsFailure)
+    {
+        char buffer[16];
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        AZStd::vector<Statistic> statistics;
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_TRUE(statistics.empty());
+
+        constexpr size_t fileSize = 16_kib;
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDriveLinux->QueueRequest(request);
+        WaitTillCompleted();
+
+        m_storageDriveLinux->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+
+        azfree(buffer);
+    }
+
+    INSTANTIATE_TEST_CASE_P(Streamer_StorageDriveLinux, Streamer_StorageDriveLinuxTestFixture, ::testing::Bool());
+} // namespace AZ::IO
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Compares the throughput of the generic StorageDrive, which reads one request at a time with blocking reads, against
+    // StorageDriveLinux, which keeps multiple reads in flight. The files are read through the full IStreamer path, so this also
+    // includes the overhead of the scheduler.
+    class StorageDriveLinuxBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        enum class DriveType : int64_t
+        {
+            Generic,
+            LinuxIoUring,
+            LinuxThreadPool
+        };
+
+        static constexpr size_t FileSize = 4_mib;
+        static constexpr size_t NumFiles = 8;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            AZStd::string folder = AZ::IO::GetTestFilesFolder();
+            AZStd::unique_ptr<char[]> content(new char[FileSize]);
+            ::memset(content.get(), 'F', FileSize);
+            for (size_t i = 0; i < NumFiles; ++i)
+            {
+                AZStd::string path;
+                AZ::StringFunc::Path::Join(folder.c_str(), AZStd::string::format("StreamerBenchmark%zu.bin", i).c_str(), path);
+                AZ::IO::SystemFile file;
+                file.Open(path.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_READ_WRITE);
+                file.Write(content.get(), FileSize);
+                file.Close();
+                m_paths.push_back(AZStd::move(path));
+            }
+
+            AZStd::shared_ptr<AZ::IO::StreamStackEntry> drive;
+            auto driveType = static_cast<DriveType>(state.range(0));
+            if (driveType == DriveType::Generic)
+            {
+                drive = AZStd::make_shared<AZ::IO::StorageDrive>(32);
+            }
+            else
+            {
+                AZ::IO::StorageDriveLinux::ConstructionOptions options;
+                options.m_enableIoUring = driveType == DriveType::LinuxIoUring;
+                drive = AZStd::make_shared<AZ::IO::StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" }, 32, 32, 4_kib, 512,
+                    32, 8, options);
+            }
+            m_streamer = aznew AZ::IO::Streamer(AZStd::thread_desc{}, AZStd::make_unique<AZ::IO::Scheduler>(AZStd::move(drive)));
+            m_buffer = reinterpret_cast<char*>(azmalloc(FileSize * NumFiles, 4_kib));
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_streamer;
+            m_streamer = nullptr;
+            azfree(m_buffer);
+            m_buffer = nullptr;
+            for (const AZStd::string& path : m_paths)
+            {
+                AZ::IO::SystemFile::Delete(path.c_str());
+            }
+            m_paths = {};
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void ReadAllFiles(size_t chunkSize)
+        {
+            const size_t numChunksPerFile = FileSize / chunkSize;
+            AZStd::atomic_size_t remaining{ numChunksPerFile * NumFiles };
+            AZStd::binary_semaphore wait;
+            auto callback = [&remaining, &wait](AZ::IO::FileRequestHandle)
+            {
+                if (--remaining == 0)
+                {
+                    wait.release();
+                }
+            };
+
+            AZStd::vector<AZ::IO::FileRequestPtr> requests;
+            m_streamer->CreateRequestBatch(requests, numChunksPerFile * NumFiles);
+            size_t requestIndex = 0;
+            for (size_t file = 0; file < NumFiles; ++file)
+            {
+                for (size_t chunk = 0; chunk < numChunksPerFile; ++chunk)
+                {
+                    char* output = m_buffer + file * FileSize + chunk * chunkSize;
+                    m_streamer->Read(requests[requestIndex], m_paths[file], output, chunkSize, chunkSize,
+                        AZ::IO::IStreamerTypes::s_noDeadline, AZ::IO::IStreamerTypes::s_priorityMedium, chunk * chunkSize);
+                    m_streamer->SetRequestCompleteCallback(requests[requestIndex], callback);
+                    requestIndex++;
+                }
+            }
+            m_streamer->QueueRequestBatch(AZStd::move(requests));
+            wait.acquire();
+        }
+
+        AZStd::vector<AZStd::string> m_paths;
+        AZ::IO::Streamer* m_streamer{ nullptr };
+        char* m_buffer{ nullptr };
+    };
+
+    BENCHMARK_DEFINE_F(StorageDriveLinuxBenchmarkFixture, ReadFiles)(benchmark::State& state)
+    {
+        const size_t chunkSize = aznumeric_cast<size_t>(state.range(1));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ReadAllFiles(chunkSize);
+        }
+        state.SetBytesProcessed(aznumeric_cast<int64_t>(state.iterations() * FileSize * NumFiles));
+    }
+    BENCHMARK_REGISTER_F(StorageDriveLinuxBenchmarkFixture, ReadFiles)
+        ->ArgNames({ "Drive", "ChunkSize" })
+        ->Args({ 0, 64_kib })
+        ->Args({ 1, 64_kib })
+        ->Args({ 2, 64_kib })
+        ->Args({ 0, 512_kib })
+        ->Args({ 1, 512_kib })
+        ->Args({ 2, 512_kib })
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -79,7 +79,7 @@ namespace AZ::IO
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites, m_readAheadBlocks);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -226,10 +226,12 @@ namespace AZ::IO
             EXPECT_EQ(expectedResult, result);
         }
 
-        void ProcessRead(void* output, const RequestPath& path, u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult)
+        void ProcessRead(void* output, const RequestPath& path, u64 offset, u64 size, IStreamerTypes::RequestStatus expectedResult,
+            bool isSequentialRead = false)
         {
             FileRequest* request = m_context->GetNewInternalRequest();
             request->CreateRead(nullptr, output, size, path, offset, size);
+            request->SetSequentialRead(isSequentialRead);
             RunAndCompleteRequest(request, expectedResult);
         }
 
@@ -246,6 +248,7 @@ namespace AZ::IO
         u32 m_blockSize{ 64 * 1024 };
         u64 m_fakeFileLength{ 5 * m_blockSize };
         u64 m_readBufferLength{ 10 * 1024 * 1024 };
+        u32 m_readAheadBlocks{ 0 };
         bool m_fakeFileFound{ true };
     };
 
@@ -1179,4 +1182,85 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+    // File    |------------------------------------------------|
+    // Request  |----| |----|   |----| ... |----|  |----|
+    // Cache   [   v    ][   x    ][   x    ][   x    ] (4 blocks)
+    // The first block is read twice, after which a larger number of blocks is read once. The blocks that are only read once
+    // should be evicted before the block that was read multiple times.
+    TEST_F(Streamer_BlockCacheGenericTest, ReadFile_ScanAfterRepeatedReads_RepeatedBlockStaysInCache)
+    {
+        using ::testing::_;
+
+        static constexpr u64 scanCount = 8;
+        m_cacheSize = 4 * m_blockSize;
+        m_fakeFileLength = (scanCount + 2) * m_blockSize;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize)).Times(1);
+        ProcessRead(m_buffer, m_path, 256, 512, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 256, 512, IStreamerTypes::RequestStatus::Completed);
+
+        for (u64 i = 1; i <= scanCount; ++i)
+        {
+            EXPECT_CALL(*this, ReadFile(_, _, i * m_blockSize, m_blockSize)).Times(1);
+            ProcessRead(m_buffer, m_path, i * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+        }
+
+        ProcessRead(m_buffer, m_path, 256, 512, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, 512);
+    }
+
+    // File    |------------------------------------------------|
+    // Request   |---|
+    // Cache   [   v    ][   v    ][   x    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheGenericTest, ReadAhead_SequentialRead_NextBlockIsReadAhead)
+    {
+        using ::testing::_;
+
+        m_readAheadBlocks = 1;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize)).Times(1);
+        EXPECT_CALL(*this, ReadFile(_, _, m_blockSize, m_blockSize)).Times(1);
+        ProcessRead(m_buffer, m_path, 256, 512, IStreamerTypes::RequestStatus::Completed, true);
+
+        // The next read is serviced from the block that was read ahead.
+        ProcessRead(m_buffer, m_path, m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(m_blockSize + 256, 512);
+        EXPECT_DOUBLE_EQ(1.0, m_cache->CalculateReadAheadHitRatePercentage());
+    }
+
+    // File    |------------------------------------------------|
+    // Request |--------|
+    // Cache   [   x    ][   v    ][   x    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheGenericTest, ReadAhead_SequentialAlignedRead_MainReadUsesBlockReadAhead)
+    {
+        using ::testing::_;
+
+        m_readAheadBlocks = 1;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize)).Times(1);
+        EXPECT_CALL(*this, ReadFile(_, _, m_blockSize, m_blockSize)).Times(1);
+        ProcessRead(m_buffer, m_path, 0, m_blockSize, IStreamerTypes::RequestStatus::Completed, true);
+
+        ProcessRead(m_buffer, m_path, m_blockSize, m_blockSize, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(m_blockSize, m_blockSize);
+    }
+
+    TEST_F(Streamer_BlockCacheGenericTest, ReadAhead_RandomRead_NothingIsReadAhead)
+    {
+        using ::testing::_;
+
+        m_readAheadBlocks = 1;
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+        ProcessRead(m_buffer, m_path, 256, 512, IStreamerTypes::RequestStatus::Completed, false);
+    }
 } // namespace AZ::IO
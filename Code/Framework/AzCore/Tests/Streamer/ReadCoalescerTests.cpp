@@ -0,0 +1,196 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/ReadCoalescer.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ReadCoalescerTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ReadCoalescer>
+    {
+    public:
+        ReadCoalescer CreateInstance() override
+        {
+            return ReadCoalescer(64_kib, 1_kib, AZCORE_GLOBAL_NEW_ALIGNMENT);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    using ReadCoalescerTestTypes = ::testing::Types<ReadCoalescerTestDescription>;
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_ReadCoalescerConformityTests, StreamStackEntryConformityTests, ReadCoalescerTestTypes);
+
+    class Streamer_ReadCoalescerTest
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        static constexpr u64 MaxReadSize = 64_kib;
+        static constexpr u64 MaxGapSize = 1_kib;
+        static constexpr u64 ReadSize = 4_kib;
+
+        Streamer_ReadCoalescerTest()
+            : m_mock(AZStd::make_shared<StreamStackEntryMock>())
+        {
+        }
+
+        void SetUp() override
+        {
+            using ::testing::_;
+
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_path.InitFromRelativePath("TestPath");
+
+            m_readCoalescer = AZStd::make_unique<ReadCoalescer>(MaxReadSize, MaxGapSize, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            m_readCoalescer->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_));
+            m_readCoalescer->SetContext(m_context);
+        }
+
+        void TearDown() override
+        {
+            m_readCoalescer.reset();
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        FileRequest* QueueRead(void* output, u64 offset)
+        {
+            FileRequest* request = m_context.GetNewInternalRequest();
+            request->CreateRead(nullptr, output, ReadSize, m_path, offset, ReadSize);
+            m_readCoalescer->QueueRequest(request);
+            return request;
+        }
+
+    protected:
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{};
+        StreamerContext m_context;
+        RequestPath m_path;
+        AZStd::unique_ptr<ReadCoalescer> m_readCoalescer;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+    };
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_SingleRead_RequestIsForwarded)
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        FileRequest* readRequest = QueueRead(nullptr, 0);
+
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest)).Times(1);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).WillOnce(Return(false));
+        EXPECT_TRUE(m_readCoalescer->ExecuteRequests());
+
+        m_context.RecycleRequest(readRequest);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_NeighboringReads_ReadsAreCombinedAndOutputsAreFilled)
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        u8 output0[ReadSize];
+        u8 output1[ReadSize];
+        // Queue out of order with a gap between the reads to make sure the offsets into the combined buffer are used.
+        constexpr u64 offset0 = ReadSize + 512;
+        constexpr u64 offset1 = 0;
+        QueueRead(output0, offset0);
+        QueueRead(output1, offset1);
+
+        FileRequest* combinedRead = nullptr;
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([&combinedRead](FileRequest* request) { combinedRead = request; });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).WillOnce(Return(false));
+        EXPECT_TRUE(m_readCoalescer->ExecuteRequests());
+
+        ASSERT_NE(nullptr, combinedRead);
+        auto data = AZStd::get_if<FileRequest::ReadData>(&combinedRead->GetCommand());
+        ASSERT_NE(nullptr, data);
+        EXPECT_EQ(m_path, data->m_path);
+        EXPECT_EQ(offset1, data->m_offset);
+        EXPECT_EQ(offset0 + ReadSize, data->m_size);
+
+        u8* buffer = reinterpret_cast<u8*>(data->m_output);
+        for (u64 i = 0; i < data->m_size; ++i)
+        {
+            buffer[i] = aznumeric_caster(i & 0xff);
+        }
+        combinedRead->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context.MarkRequestAsCompleted(combinedRead);
+        m_context.FinalizeCompletedRequests();
+
+        for (u64 i = 0; i < ReadSize; ++i)
+        {
+            EXPECT_EQ(aznumeric_cast<u8>((offset0 + i) & 0xff), output0[i]);
+            EXPECT_EQ(aznumeric_cast<u8>((offset1 + i) & 0xff), output1[i]);
+        }
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_ReadsFurtherApartThanGapSize_RequestsAreForwarded)
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        FileRequest* readRequest0 = QueueRead(nullptr, 0);
+        FileRequest* readRequest1 = QueueRead(nullptr, ReadSize + MaxGapSize + 1);
+
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest0)).Times(1);
+        EXPECT_CALL(*m_mock, QueueRequest(readRequest1)).Times(1);
+        EXPECT_CALL(*m_mock, ExecuteRequests()).WillOnce(Return(false));
+        EXPECT_TRUE(m_readCoalescer->ExecuteRequests());
+
+        m_context.RecycleRequest(readRequest0);
+        m_context.RecycleRequest(readRequest1);
+    }
+
+    TEST_F(Streamer_ReadCoalescerTest, ExecuteRequests_CombinedReadFails_OriginalReadsFail)
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        u8 output0[ReadSize];
+        u8 output1[ReadSize];
+        FileRequest* readRequest0 = QueueRead(output0, 0);
+        FileRequest* readRequest1 = QueueRead(output1, ReadSize);
+
+        IStreamerTypes::RequestStatus status0 = IStreamerTypes::RequestStatus::Pending;
+        IStreamerTypes::RequestStatus status1 = IStreamerTypes::RequestStatus::Pending;
+        readRequest0->SetCompletionCallback([&status0](FileRequest& request) { status0 = request.GetStatus(); });
+        readRequest1->SetCompletionCallback([&status1](FileRequest& request) { status1 = request.GetStatus(); });
+
+        FileRequest* combinedRead = nullptr;
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([&combinedRead](FileRequest* request) { combinedRead = request; });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).WillOnce(Return(false));
+        m_readCoalescer->ExecuteRequests();
+
+        ASSERT_NE(nullptr, combinedRead);
+        combinedRead->SetStatus(IStreamerTypes::RequestStatus::Failed);
+        m_context.MarkRequestAsCompleted(combinedRead);
+        m_context.FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status0);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status1);
+    }
+} // namespace AZ::IO
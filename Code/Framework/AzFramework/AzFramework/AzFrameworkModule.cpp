@@ -31,6 +31,7 @@
 #include <AzFramework/StreamingInstall/StreamingInstall.h>
 #include <AzFramework/TargetManagement/TargetManagementComponent.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeSystemComponent.h>
 
 namespace AzFramework
 {
@@ -63,6 +64,7 @@ namespace AzFramework
             AzFramework::AzFrameworkConfigurationSystemComponent::CreateDescriptor(),
 
             AzFramework::OctreeSystemComponent::CreateDescriptor(),
+            AzFramework::LooseOctreeSystemComponent::CreateDescriptor(),
         });
     }
 
@@ -70,7 +72,9 @@ namespace AzFramework
     {
         return AZ::ComponentTypeList
         {
-            azrtti_typeid<AzFramework::OctreeSystemComponent>(),
+            bg_visibilityUseLooseOctree
+                ? azrtti_typeid<AzFramework::LooseOctreeSystemComponent>()
+                : azrtti_typeid<AzFramework::OctreeSystemComponent>(),
         };
     }
 }
@@ -45,6 +45,8 @@ namespace AzFramework
             return;
         }
 
+        AzFramework::IVisibilityScene* visScene = visSystem->GetDefaultVisibilityScene();
+
         const bool updateLastCameraState = !ed_visibility_pinCamera || !m_lastCameraState.has_value();
         if (updateLastCameraState)
         {
@@ -56,10 +58,10 @@ namespace AzFramework
         m_octreeDebug.Clear();
         m_visibleEntityIds.clear();
 
-        visSystem->Enumerate(
+        visScene->Enumerate(
             viewFrustum,
             [&viewFrustum, &visibleEntityIdsOut = m_visibleEntityIds,
-             &octreeDebug = m_octreeDebug](const AzFramework::IVisibilitySystem::NodeData& nodeData)
+             &octreeDebug = m_octreeDebug](const AzFramework::IVisibilityScene::NodeData& nodeData)
             {
                 if (ed_visibility_showDebug)
                 {
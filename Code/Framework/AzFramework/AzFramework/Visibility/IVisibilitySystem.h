@@ -19,6 +19,7 @@
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Name/Name.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzFramework
@@ -45,12 +46,13 @@ namespace AzFramework
         TypeFlags m_typeFlags = TYPE_None;
     };
 
-    //! @class IVisibilitySystem
-    //! @brief This is an AZ::Interface<> useful for extremely fast, CPU only, proximity and visibility queries.
-    class IVisibilitySystem
+    //! @class IVisibilityScene
+    //! @brief A spatial hash of VisibilityEntries that is queried independently of any other scene.
+    //! Scenes are owned by the IVisibilitySystem, see IVisibilitySystem::CreateVisibilityScene.
+    class IVisibilityScene
     {
     public:
-        AZ_RTTI(IVisibilitySystem, "{7C6C710F-ACDB-44CD-867D-A2C4B912ECF5}");
+        AZ_RTTI(IVisibilityScene, "{C994715C-855D-416D-AC8E-37AB30792A1D}");
 
         struct NodeData
         {
@@ -59,47 +61,78 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
-        IVisibilitySystem() = default;
-        virtual ~IVisibilitySystem() = default;
+        IVisibilityScene() = default;
+        virtual ~IVisibilityScene() = default;
 
-        //! Insert or update an entry within the visibility system.
+        //! Returns the unique name of this scene.
+        virtual const AZ::Name& GetName() const = 0;
+
+        //! Insert or update an entry within the visibility scene.
         //! This encompasses the following three scenarios:
         //   1. A new entry is added to the underlying spatial hash.
         //   2. A previously added entry moves to a new position within its current node in the spatial hash.
         //   3. A previously added entry moves to a new node in the spatial hash.
         //       (causing it to be removed from its original node and added to its new node)
-        //! @param visibilityEntry data for the object being added to the visibility system
+        //! An entry can only be added to one scene at a time.
+        //! @param visibilityEntry data for the object being added to the visibility scene
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
-        //! Removes an entry from the visibility system.
-        //! @param visibilityEntry data for the object being added to the visibility system
+        //! Removes an entry from the visibility scene.
+        //! @param visibilityEntry data for the object being removed from the visibility scene
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
 
-        //! Intersects an axis aligned bounding box against the visibility system.
+        //! Intersects an axis aligned bounding box against the visibility scene.
         //! @param aabb the axis aligned bounding box to test against
         //! @param callback the callback to invoke when a node is visible
-        //! @return the intersection result of the aabb against the visibility system
         virtual void Enumerate(const AZ::Aabb& aabb, const EnumerateCallback& callback) const = 0;
 
-        //! Intersects a sphere against the visibility system.
+        //! Intersects a sphere against the visibility scene.
         //! @param sphere the sphere to test against
         //! @param callback the callback to invoke when a node is visible
-        //! @return the intersection result of the sphere against the visibility system
         virtual void Enumerate(const AZ::Sphere& sphere, const EnumerateCallback& callback) const = 0;
 
-        //! Intersects a frustum against the visibility system.
+        //! Intersects a frustum against the visibility scene.
         //! @param frustum the frustum to test against
         //! @param callback the callback to invoke when a node is visible
-        //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
-        //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
+        //! Enumerate *all* nodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
 
-        //! Return the number of VisibilityEntries that have been added to the system
+        //! Return the number of VisibilityEntries that have been added to the scene
         virtual uint32_t GetEntryCount() const = 0;
 
+        AZ_DISABLE_COPY_MOVE(IVisibilityScene);
+    };
+
+    //! @class IVisibilitySystem
+    //! @brief This is an AZ::Interface<> useful for extremely fast, CPU only, proximity and visibility queries.
+    //! The system owns a set of independent visibility scenes, so that each world (for example each render scene) only pays
+    //! for culling its own content.  Creating and destroying scenes is not threadsafe, and should be done from the main thread.
+    class IVisibilitySystem
+    {
+    public:
+        AZ_RTTI(IVisibilitySystem, "{7C6C710F-ACDB-44CD-867D-A2C4B912ECF5}");
+
+        IVisibilitySystem() = default;
+        virtual ~IVisibilitySystem() = default;
+
+        //! Returns the scene that always exists for the lifetime of the visibility system, used for entity visibility.
+        virtual IVisibilityScene* GetDefaultVisibilityScene() = 0;
+
+        //! Creates a new, empty visibility scene.
+        //! @param sceneName a unique name for the scene
+        //! @return the new scene, or nullptr if a scene with the same name already exists
+        virtual IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName) = 0;
+
+        //! Destroys a visibility scene created with CreateVisibilityScene.
+        //! All entries must have been removed from the scene beforehand.
+        virtual void DestroyVisibilityScene(IVisibilityScene* visibilityScene) = 0;
+
+        //! Returns the visibility scene with the provided name, or nullptr if there isn't one.
+        virtual IVisibilityScene* FindVisibilityScene(const AZ::Name& sceneName) = 0;
+
         AZ_DISABLE_COPY_MOVE(IVisibilitySystem);
     };
 
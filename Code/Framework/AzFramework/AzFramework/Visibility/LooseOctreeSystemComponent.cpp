@@ -0,0 +1,768 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzFramework/Visibility/LooseOctreeSystemComponent.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(bool,     bg_visibilityUseLooseOctree,          false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, the loose octree is used as the visibility system instead of the octree");
+    AZ_CVAR(float,    bg_looseOctreeMaxWorldExtents,     16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the loose octree, larger entries are kept in the root node");
+    AZ_CVAR(uint32_t, bg_looseOctreeNodeMaxEntries,            64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any loose octree leaf node before forcing a split");
+    AZ_CVAR(uint32_t, bg_looseOctreeNodeMinEntries,            32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a loose octree node resulting from a merge operation");
+    AZ_CVAR(uint32_t, bg_looseOctreeMaxDepth,                  12, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum depth of the loose octree, nodes at this depth are never split");
+
+
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        //! Converts the lane masks for children [0, 3] and [4, 7] into a bitmask with one bit per child.
+        uint32_t ToChildMask(Vec4::FloatArgType lowChildren, Vec4::FloatArgType highChildren)
+        {
+            alignas(16) int32_t lanes[LooseOctreeNode::ChildCount];
+            Vec4::StoreAligned(&lanes[0], Vec4::CastToInt(lowChildren));
+            Vec4::StoreAligned(&lanes[4], Vec4::CastToInt(highChildren));
+
+            uint32_t childMask = 0;
+            for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+            {
+                childMask |= (lanes[child] != 0) ? (1u << child) : 0u;
+            }
+            return childMask;
+        }
+
+        //! Culls child nodes against a frustum, using the same center/projected-radius test as AZ::ShapeIntersection::Overlaps(Frustum, Aabb).
+        //! Since the children are cubes of the same size, the projected radius only depends on the plane, so it's computed once per plane.
+        class FrustumCullPolicy
+        {
+        public:
+            explicit FrustumCullPolicy(const AZ::Frustum& frustum)
+            {
+                for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const AZ::Plane plane = frustum.GetPlane(planeId);
+                    const AZ::Vector3 normal = plane.GetNormal();
+                    m_normalX[planeId] = Vec4::Splat(normal.GetX());
+                    m_normalY[planeId] = Vec4::Splat(normal.GetY());
+                    m_normalZ[planeId] = Vec4::Splat(normal.GetZ());
+                    m_distance[planeId] = Vec4::Splat(plane.GetDistance());
+                    m_radiusScale[planeId] = Vec4::Splat(normal.GetAbs().Dot(AZ::Vector3::CreateOne()));
+                }
+            }
+
+            uint32_t CullChildren(const float* centerX, const float* centerY, const float* centerZ, float halfSize) const
+            {
+                const Vec4::FloatType halfSizes = Vec4::Splat(halfSize);
+                return ToChildMask(
+                    CullGroup(centerX, centerY, centerZ, halfSizes),
+                    CullGroup(centerX + 4, centerY + 4, centerZ + 4, halfSizes));
+            }
+
+        private:
+            Vec4::FloatType CullGroup(const float* centerX, const float* centerY, const float* centerZ, Vec4::FloatArgType halfSizes) const
+            {
+                const Vec4::FloatType x = Vec4::LoadAligned(centerX);
+                const Vec4::FloatType y = Vec4::LoadAligned(centerY);
+                const Vec4::FloatType z = Vec4::LoadAligned(centerZ);
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+
+                Vec4::FloatType visible = Vec4::CastToFloat(Vec4::Splat(static_cast<int32_t>(-1)));
+                for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+                {
+                    // Signed distance from the child center to the plane, plus the projected radius of the child onto the plane normal
+                    Vec4::FloatType distance = Vec4::Madd(halfSizes, m_radiusScale[planeId], m_distance[planeId]);
+                    distance = Vec4::Madd(x, m_normalX[planeId], distance);
+                    distance = Vec4::Madd(y, m_normalY[planeId], distance);
+                    distance = Vec4::Madd(z, m_normalZ[planeId], distance);
+                    visible = Vec4::And(visible, Vec4::CmpGt(distance, zero));
+                }
+                return visible;
+            }
+
+            Vec4::FloatType m_normalX[AZ::Frustum::PlaneId::MAX];
+            Vec4::FloatType m_normalY[AZ::Frustum::PlaneId::MAX];
+            Vec4::FloatType m_normalZ[AZ::Frustum::PlaneId::MAX];
+            Vec4::FloatType m_distance[AZ::Frustum::PlaneId::MAX];
+            Vec4::FloatType m_radiusScale[AZ::Frustum::PlaneId::MAX];
+        };
+
+        //! Culls child nodes against an axis aligned box by comparing the center separation against the combined half extents on each axis.
+        class AabbCullPolicy
+        {
+        public:
+            explicit AabbCullPolicy(const AZ::Aabb& aabb)
+            {
+                const AZ::Vector3 center = aabb.GetCenter();
+                const AZ::Vector3 halfExtents = 0.5f * aabb.GetExtents();
+                m_centerX = Vec4::Splat(center.GetX());
+                m_centerY = Vec4::Splat(center.GetY());
+                m_centerZ = Vec4::Splat(center.GetZ());
+                m_halfExtentX = Vec4::Splat(halfExtents.GetX());
+                m_halfExtentY = Vec4::Splat(halfExtents.GetY());
+                m_halfExtentZ = Vec4::Splat(halfExtents.GetZ());
+            }
+
+            uint32_t CullChildren(const float* centerX, const float* centerY, const float* centerZ, float halfSize) const
+            {
+                const Vec4::FloatType halfSizes = Vec4::Splat(halfSize);
+                return ToChildMask(
+                    CullGroup(centerX, centerY, centerZ, halfSizes),
+                    CullGroup(centerX + 4, centerY + 4, centerZ + 4, halfSizes));
+            }
+
+        private:
+            Vec4::FloatType CullGroup(const float* centerX, const float* centerY, const float* centerZ, Vec4::FloatArgType halfSizes) const
+            {
+                const Vec4::FloatType overlapX = Vec4::CmpLtEq(Vec4::Abs(Vec4::Sub(Vec4::LoadAligned(centerX), m_centerX)), Vec4::Add(halfSizes, m_halfExtentX));
+                const Vec4::FloatType overlapY = Vec4::CmpLtEq(Vec4::Abs(Vec4::Sub(Vec4::LoadAligned(centerY), m_centerY)), Vec4::Add(halfSizes, m_halfExtentY));
+                const Vec4::FloatType overlapZ = Vec4::CmpLtEq(Vec4::Abs(Vec4::Sub(Vec4::LoadAligned(centerZ), m_centerZ)), Vec4::Add(halfSizes, m_halfExtentZ));
+                return Vec4::And(overlapX, Vec4::And(overlapY, overlapZ));
+            }
+
+            Vec4::FloatType m_centerX;
+            Vec4::FloatType m_centerY;
+            Vec4::FloatType m_centerZ;
+            Vec4::FloatType m_halfExtentX;
+            Vec4::FloatType m_halfExtentY;
+            Vec4::FloatType m_halfExtentZ;
+        };
+
+        //! Culls child nodes against a sphere by comparing the squared distance from the sphere center to each child box against the squared radius.
+        class SphereCullPolicy
+        {
+        public:
+            explicit SphereCullPolicy(const AZ::Sphere& sphere)
+            {
+                const AZ::Vector3 center = sphere.GetCenter();
+                m_centerX = Vec4::Splat(center.GetX());
+                m_centerY = Vec4::Splat(center.GetY());
+                m_centerZ = Vec4::Splat(center.GetZ());
+                m_radiusSq = Vec4::Splat(sphere.GetRadius() * sphere.GetRadius());
+            }
+
+            uint32_t CullChildren(const float* centerX, const float* centerY, const float* centerZ, float halfSize) const
+            {
+                const Vec4::FloatType halfSizes = Vec4::Splat(halfSize);
+                return ToChildMask(
+                    CullGroup(centerX, centerY, centerZ, halfSizes),
+                    CullGroup(centerX + 4, centerY + 4, centerZ + 4, halfSizes));
+            }
+
+        private:
+            Vec4::FloatType CullGroup(const float* centerX, const float* centerY, const float* centerZ, Vec4::FloatArgType halfSizes) const
+            {
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+                const Vec4::FloatType deltaX = Vec4::Max(Vec4::Sub(Vec4::Abs(Vec4::Sub(Vec4::LoadAligned(centerX), m_centerX)), halfSizes), zero);
+                const Vec4::FloatType deltaY = Vec4::Max(Vec4::Sub(Vec4::Abs(Vec4::Sub(Vec4::LoadAligned(centerY), m_centerY)), halfSizes), zero);
+                const Vec4::FloatType deltaZ = Vec4::Max(Vec4::Sub(Vec4::Abs(Vec4::Sub(Vec4::LoadAligned(centerZ), m_centerZ)), halfSizes), zero);
+                const Vec4::FloatType distanceSq = Vec4::Madd(deltaX, deltaX, Vec4::Madd(deltaY, deltaY, Vec4::Mul(deltaZ, deltaZ)));
+                return Vec4::CmpLtEq(distanceSq, m_radiusSq);
+            }
+
+            Vec4::FloatType m_centerX;
+            Vec4::FloatType m_centerY;
+            Vec4::FloatType m_centerZ;
+            Vec4::FloatType m_radiusSq;
+        };
+    }
+
+
+    LooseOctreeNode::LooseOctreeNode(const AZ::Vector3& center, float halfSize, uint32_t depth, LooseOctreeNode* parent)
+        : m_bounds(AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(2.0f * halfSize)))
+        , m_center(center)
+        , m_halfSize(halfSize)
+        , m_depth(depth)
+        , m_parent(parent)
+    {
+        ;
+    }
+
+
+    const AZ::Aabb& LooseOctreeNode::GetBounds() const
+    {
+        return m_bounds;
+    }
+
+
+    const AZStd::vector<VisibilityEntry*>& LooseOctreeNode::GetEntries() const
+    {
+        return m_entries;
+    }
+
+
+    LooseOctreeNode* LooseOctreeNode::GetChildren() const
+    {
+        return m_children;
+    }
+
+
+    bool LooseOctreeNode::IsLeaf() const
+    {
+        return m_children == nullptr;
+    }
+
+
+    uint32_t LooseOctreeNode::GetSubtreeEntryCount() const
+    {
+        return m_subtreeEntryCount;
+    }
+
+
+    uint32_t LooseOctreeNode::FindContainingChild(const AZ::Aabb& boundingVolume) const
+    {
+        if (m_children == nullptr)
+        {
+            return ChildCount;
+        }
+
+        // The only child that can contain the volume is the one whose cell contains the volume's center.
+        // The loose half size of a child is the same as the cell half size of its parent.
+        const AZ::Vector3 center = boundingVolume.GetCenter();
+        const uint32_t child = ((center.GetX() >= m_center.GetX()) ? 0x01 : 0)
+                             | ((center.GetY() >= m_center.GetY()) ? 0x02 : 0)
+                             | ((center.GetZ() >= m_center.GetZ()) ? 0x04 : 0);
+
+        const AZ::Vector3 childCenter(m_childCenterX[child], m_childCenterY[child], m_childCenterZ[child]);
+        const AZ::Aabb childBounds = AZ::Aabb::CreateCenterHalfExtents(childCenter, AZ::Vector3(m_halfSize));
+        return childBounds.Contains(boundingVolume) ? child : ChildCount;
+    }
+
+
+    bool LooseOctreeNode::IsBestFit(const AZ::Aabb& boundingVolume) const
+    {
+        // Entries that don't fit in the world bounds are kept in the root node
+        const bool fitsInNode = (m_parent == nullptr) || m_bounds.Contains(boundingVolume);
+        return fitsInNode && (FindContainingChild(boundingVolume) == ChildCount);
+    }
+
+
+    void LooseOctreeNode::InitChildren(LooseOctreeNode* children, uint32_t childBlockIndex)
+    {
+        AZ_Assert(m_children == nullptr, "InitChildren invoked on a loose octree node that already has children");
+        m_children = children;
+        m_childBlockIndex = childBlockIndex;
+
+        const float childHalfSize = m_halfSize * 0.5f;
+        for (uint32_t child = 0; child < ChildCount; ++child)
+        {
+            const AZ::Vector3 childOffset(
+                (child & 0x01) ? childHalfSize : -childHalfSize,
+                (child & 0x02) ? childHalfSize : -childHalfSize,
+                (child & 0x04) ? childHalfSize : -childHalfSize);
+            const AZ::Vector3 childCenter = m_center + childOffset;
+
+            m_children[child] = LooseOctreeNode(childCenter, childHalfSize, m_depth + 1, this);
+            m_childCenterX[child] = childCenter.GetX();
+            m_childCenterY[child] = childCenter.GetY();
+            m_childCenterZ[child] = childCenter.GetZ();
+        }
+    }
+
+
+    void LooseOctreeNode::AddEntry(VisibilityEntry* entry)
+    {
+        entry->m_internalNode = this;
+        entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size());
+        m_entries.push_back(entry);
+        AdjustSubtreeEntryCount(1);
+    }
+
+
+    void LooseOctreeNode::RemoveEntry(VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == this, "Remove invoked for an entry bound to a different LooseOctreeNode");
+        AZ_Assert(m_entries[entry->m_internalNodeIndex] == entry, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry
+        const uint32_t removeIndex = entry->m_internalNodeIndex;
+        entry->m_internalNode = nullptr;
+        entry->m_internalNodeIndex = 0;
+        if (removeIndex < (m_entries.size() - 1))
+        {
+            m_entries[removeIndex] = m_entries.back();
+            m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+        }
+        m_entries.pop_back();
+        AdjustSubtreeEntryCount(-1);
+    }
+
+
+    void LooseOctreeNode::AdjustSubtreeEntryCount(int32_t delta)
+    {
+        for (LooseOctreeNode* node = this; node != nullptr; node = node->m_parent)
+        {
+            node->m_subtreeEntryCount = aznumeric_cast<uint32_t>(static_cast<int32_t>(node->m_subtreeEntryCount) + delta);
+        }
+    }
+
+
+    LooseOctreeScene::LooseOctreeScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+        , m_root(AZ::Vector3::CreateZero(), bg_looseOctreeMaxWorldExtents, 0, nullptr)
+    {
+        ;
+    }
+
+
+    LooseOctreeScene::~LooseOctreeScene()
+    {
+        for (auto page : m_nodeCache)
+        {
+            delete page;
+        }
+        m_nodeCache.clear();
+        m_nodeCache.shrink_to_fit();
+    }
+
+
+    const AZ::Name& LooseOctreeScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        if (entry.m_internalNode != nullptr)
+        {
+            // Because the nodes are loose, a moving entry usually remains within its current node and nothing needs to change
+            LooseOctreeNode* node = static_cast<LooseOctreeNode*>(entry.m_internalNode);
+            if (node->IsBestFit(entry.m_boundingVolume))
+            {
+                return;
+            }
+
+            // The entry is re-inserted straight away, so skip merging to avoid churning nodes for entries that cross node boundaries
+            node->RemoveEntry(&entry);
+            Insert(&entry);
+        }
+        else
+        {
+            Insert(&entry);
+            ++m_entryCount;
+        }
+    }
+
+
+    void LooseOctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        if (entry.m_internalNode)
+        {
+            Remove(&entry);
+            --m_entryCount;
+        }
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(m_root, AabbCullPolicy(aabb), callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(m_root, SphereCullPolicy(sphere), callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(m_root, FrustumCullPolicy(frustum), callback);
+    }
+
+
+    void LooseOctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateNoCullHelper(m_root, callback);
+    }
+
+
+    uint32_t LooseOctreeScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+
+    LooseOctreeNode& LooseOctreeScene::GetRoot()
+    {
+        return m_root;
+    }
+
+
+    uint32_t LooseOctreeScene::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+
+    uint32_t LooseOctreeScene::GetFreeNodeCount() const
+    {
+        // Each entry represents LooseOctreeNode::ChildCount nodes
+        return aznumeric_cast<uint32_t>(m_freeChildBlocks.size() * LooseOctreeNode::ChildCount);
+    }
+
+
+    uint32_t LooseOctreeScene::GetPageCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_nodeCache.size());
+    }
+
+
+    void LooseOctreeScene::DumpStats() const
+    {
+        AZ_TracePrintf("Console", "LooseOctreeScene::Name = %s", m_sceneName.GetCStr());
+        AZ_TracePrintf("Console", "LooseOctreeNode::EntryCount = %u", GetEntryCount());
+        AZ_TracePrintf("Console", "LooseOctreeNode::NodeCount = %u", GetNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeNode::FreeNodeCount = %u", GetFreeNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeNode::PageCount = %u", GetPageCount());
+    }
+
+
+    void LooseOctreeScene::Insert(VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the LooseOctreeScene");
+
+        // Descend to the deepest existing node that fully contains the entry
+        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
+        LooseOctreeNode* node = &m_root;
+        for (uint32_t child = node->FindContainingChild(boundingVolume); child != LooseOctreeNode::ChildCount; child = node->FindContainingChild(boundingVolume))
+        {
+            node = &node->m_children[child];
+        }
+
+        node->AddEntry(entry);
+
+        if (node->IsLeaf() && (node->m_entries.size() > bg_looseOctreeNodeMaxEntries) && (node->m_depth < bg_looseOctreeMaxDepth))
+        {
+            Split(*node);
+        }
+    }
+
+
+    void LooseOctreeScene::Remove(VisibilityEntry* entry)
+    {
+        LooseOctreeNode* node = static_cast<LooseOctreeNode*>(entry->m_internalNode);
+        node->RemoveEntry(entry);
+        TryMerge(node);
+    }
+
+
+    void LooseOctreeScene::Split(LooseOctreeNode& node)
+    {
+        const uint32_t childBlockIndex = AllocateChildNodes();
+        node.InitChildren(GetChildNodesAtIndex(childBlockIndex), childBlockIndex);
+
+        // Push each entry down into the child that contains it, entries that don't fit any child stay in this node.
+        // Subtree counts of this node and its ancestors are unchanged, so the children's counts are maintained directly.
+        AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(node.m_entries));
+        node.m_entries.clear();
+        for (VisibilityEntry* entry : entrySet)
+        {
+            const uint32_t child = node.FindContainingChild(entry->m_boundingVolume);
+            LooseOctreeNode& target = (child != LooseOctreeNode::ChildCount) ? node.m_children[child] : node;
+            entry->m_internalNode = &target;
+            entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(target.m_entries.size());
+            target.m_entries.push_back(entry);
+            if (&target != &node)
+            {
+                ++target.m_subtreeEntryCount;
+            }
+        }
+
+        for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+        {
+            LooseOctreeNode& childNode = node.m_children[child];
+            if ((childNode.m_entries.size() > bg_looseOctreeNodeMaxEntries) && (childNode.m_depth < bg_looseOctreeMaxDepth))
+            {
+                Split(childNode);
+            }
+        }
+    }
+
+
+    void LooseOctreeScene::TryMerge(LooseOctreeNode* node)
+    {
+        // Find the highest ancestor whose whole subtree has become small enough to fit back into a single node
+        LooseOctreeNode* mergeNode = nullptr;
+        for (; (node != nullptr) && (node->m_subtreeEntryCount <= bg_looseOctreeNodeMinEntries); node = node->m_parent)
+        {
+            if (!node->IsLeaf())
+            {
+                mergeNode = node;
+            }
+        }
+
+        if (mergeNode != nullptr)
+        {
+            Merge(*mergeNode);
+        }
+    }
+
+
+    void LooseOctreeScene::Merge(LooseOctreeNode& node)
+    {
+        AZ_Assert(node.m_children != nullptr, "Merge invoked on a loose octree node that does not have children");
+
+        // Collapse the whole subtree and move all of its entries to our own entry set, subtree counts are unchanged
+        for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+        {
+            LooseOctreeNode& childNode = node.m_children[child];
+            if (!childNode.IsLeaf())
+            {
+                Merge(childNode);
+            }
+
+            for (VisibilityEntry* childEntry : childNode.m_entries)
+            {
+                childEntry->m_internalNode = &node;
+                childEntry->m_internalNodeIndex = aznumeric_cast<uint32_t>(node.m_entries.size());
+                node.m_entries.push_back(childEntry);
+            }
+            childNode.m_entries.clear();
+            childNode.m_subtreeEntryCount = 0;
+        }
+
+        ReleaseChildNodes(node.m_childBlockIndex);
+        node.m_childBlockIndex = LooseOctreeNode::InvalidChildBlockIndex;
+        node.m_children = nullptr;
+    }
+
+
+    template <typename CullPolicy>
+    void LooseOctreeScene::EnumerateHelper(const LooseOctreeNode& node, const CullPolicy& cullPolicy, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!node.m_entries.empty())
+        {
+            callback({node.m_bounds, node.m_entries});
+        }
+
+        // Skip culling the children entirely if none of them have any entries
+        if ((node.m_children == nullptr) || (node.m_subtreeEntryCount == node.m_entries.size()))
+        {
+            return;
+        }
+
+        const uint32_t visibleChildren = cullPolicy.CullChildren(node.m_childCenterX, node.m_childCenterY, node.m_childCenterZ, node.m_halfSize);
+        for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+        {
+            const LooseOctreeNode& childNode = node.m_children[child];
+            if ((visibleChildren & (1u << child)) && (childNode.m_subtreeEntryCount > 0))
+            {
+                EnumerateHelper(childNode, cullPolicy, callback);
+            }
+        }
+    }
+
+
+    void LooseOctreeScene::EnumerateNoCullHelper(const LooseOctreeNode& node, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        if (!node.m_entries.empty())
+        {
+            callback({node.m_bounds, node.m_entries});
+        }
+
+        if (node.m_children != nullptr)
+        {
+            for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+            {
+                if (node.m_children[child].m_subtreeEntryCount > 0)
+                {
+                    EnumerateNoCullHelper(node.m_children[child], callback);
+                }
+            }
+        }
+    }
+
+
+    static inline uint32_t CreateChildBlockIndex(uint32_t page, uint32_t offset)
+    {
+        AZ_Assert(page <= 0xFFFF && offset <= 0xFFFF, "Out of range values passed to CreateChildBlockIndex");
+        return (page << 16) | offset;
+    }
+
+
+    static inline void ExtractPageAndOffsetFromIndex(uint32_t index, uint32_t& page, uint32_t& offset)
+    {
+        offset = index & 0x0000FFFF;
+        page = index >> 16;
+    }
+
+
+    uint32_t LooseOctreeScene::AllocateChildNodes()
+    {
+        m_nodeCount += LooseOctreeNode::ChildCount;
+
+        if (!m_freeChildBlocks.empty())
+        {
+            // Take a free block of child nodes from our free list
+            const uint32_t childBlockIndex = m_freeChildBlocks.back();
+            m_freeChildBlocks.pop_back();
+            return childBlockIndex;
+        }
+
+        if (m_nodeCache.empty() || (m_nodeCache.back()->size() >= BlockSize))
+        {
+            // Our last page is already full, so we need to allocate a new page
+            m_nodeCache.push_back(new LooseOctreeNodePage);
+        }
+
+        const uint32_t page = aznumeric_cast<uint32_t>(m_nodeCache.size() - 1);
+        const uint32_t offset = aznumeric_cast<uint32_t>(m_nodeCache[page]->size());
+
+        // We resize_no_construct to prevent fixed_vector from using copy or assignment operators, but this means we have to explicitly construct nodes ourselves
+        m_nodeCache[page]->resize_no_construct(offset + LooseOctreeNode::ChildCount);
+        LooseOctreeNode* childNodes = &(*m_nodeCache[page])[offset];
+        for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+        {
+            new (&childNodes[child]) LooseOctreeNode;
+        }
+
+        return CreateChildBlockIndex(page, offset);
+    }
+
+
+    void LooseOctreeScene::ReleaseChildNodes(uint32_t childBlockIndex)
+    {
+        m_nodeCount -= LooseOctreeNode::ChildCount;
+        m_freeChildBlocks.push_back(childBlockIndex);
+    }
+
+
+    LooseOctreeNode* LooseOctreeScene::GetChildNodesAtIndex(uint32_t childBlockIndex) const
+    {
+        uint32_t page;
+        uint32_t offset;
+        ExtractPageAndOffsetFromIndex(childBlockIndex, page, offset);
+        return &(*m_nodeCache[page])[offset];
+    }
+
+
+    void LooseOctreeSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<LooseOctreeSystemComponent, AZ::Component>()
+                ->Version(1);
+        }
+    }
+
+
+    void LooseOctreeSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("VisibilityService"));
+    }
+
+
+    void LooseOctreeSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("VisibilityService"));
+    }
+
+
+    LooseOctreeSystemComponent::LooseOctreeSystemComponent()
+    {
+        m_defaultScene = aznew LooseOctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_scenes.push_back(m_defaultScene);
+
+        AZ::Interface<IVisibilitySystem>::Register(this);
+        IVisibilitySystemRequestBus::Handler::BusConnect();
+    }
+
+
+    LooseOctreeSystemComponent::~LooseOctreeSystemComponent()
+    {
+        IVisibilitySystemRequestBus::Handler::BusDisconnect();
+        AZ::Interface<IVisibilitySystem>::Unregister(this);
+
+        AZ_Warning("VisibilitySystem", m_scenes.size() == 1, "%zu visibility scenes were not destroyed before the visibility system", m_scenes.size() - 1);
+        for (LooseOctreeScene* scene : m_scenes)
+        {
+            delete scene;
+        }
+        m_scenes.clear();
+        m_defaultScene = nullptr;
+    }
+
+
+    void LooseOctreeSystemComponent::Activate()
+    {
+        ;
+    }
+
+
+    void LooseOctreeSystemComponent::Deactivate()
+    {
+        ;
+    }
+
+
+    IVisibilityScene* LooseOctreeSystemComponent::GetDefaultVisibilityScene()
+    {
+        return m_defaultScene;
+    }
+
+
+    IVisibilityScene* LooseOctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
+    {
+        if (FindVisibilityScene(sceneName) != nullptr)
+        {
+            AZ_Error("LooseOctreeSystemComponent", false, "A visibility scene named %s already exists", sceneName.GetCStr());
+            return nullptr;
+        }
+
+        LooseOctreeScene* scene = aznew LooseOctreeScene(sceneName);
+        m_scenes.push_back(scene);
+        return scene;
+    }
+
+
+    void LooseOctreeSystemComponent::DestroyVisibilityScene(IVisibilityScene* visibilityScene)
+    {
+        AZ_Assert(visibilityScene != m_defaultScene, "The default visibility scene can't be destroyed");
+
+        auto sceneIter = AZStd::find(m_scenes.begin(), m_scenes.end(), visibilityScene);
+        if (sceneIter != m_scenes.end() && visibilityScene != m_defaultScene)
+        {
+            AZ_Assert(visibilityScene->GetEntryCount() == 0, "Visibility scene %s is being destroyed with %u entries still inserted",
+                visibilityScene->GetName().GetCStr(), visibilityScene->GetEntryCount());
+            delete *sceneIter;
+            m_scenes.erase(sceneIter);
+        }
+    }
+
+
+    IVisibilityScene* LooseOctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
+    {
+        for (LooseOctreeScene* scene : m_scenes)
+        {
+            if (scene->GetName() == sceneName)
+            {
+                return scene;
+            }
+        }
+        return nullptr;
+    }
+
+
+    void LooseOctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        for (const LooseOctreeScene* scene : m_scenes)
+        {
+            scene->DumpStats();
+        }
+    }
+}
@@ -0,0 +1,207 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/containers/fixed_vector.h>
+
+namespace AzFramework
+{
+    //! If set to true, AzFramework uses the LooseOctreeSystemComponent as its IVisibilitySystem instead of the OctreeSystemComponent.
+    //! This is read when the required system components are gathered, so it must be set on the command line or in a startup config.
+    AZ_CVAR_EXTERNED(bool, bg_visibilityUseLooseOctree);
+
+    class LooseOctreeScene;
+
+    //! A node within the loose octree.
+    //! Each node has a cubic cell, and its culling bounds are the cell grown to twice its size.  An entry is stored in the deepest node
+    //! whose culling bounds contain it, so entries never straddle siblings and a moving entry usually stays in its current node.
+    class LooseOctreeNode
+        : public VisibilityNode
+    {
+    public:
+        static constexpr uint32_t ChildCount = 8;
+
+        LooseOctreeNode() = default;
+        LooseOctreeNode(const AZ::Vector3& center, float halfSize, uint32_t depth, LooseOctreeNode* parent);
+
+        //! Returns the loose bounds of this node, which contain all of the entries bound to this node and its descendants.
+        const AZ::Aabb& GetBounds() const;
+
+        //! Returns the set of entries bound to this node.
+        const AZStd::vector<VisibilityEntry*>& GetEntries() const;
+
+        //! Returns the array of ChildCount child nodes for this node, or nullptr if this is a leaf node.
+        LooseOctreeNode* GetChildren() const;
+
+        //! Returns true if this is a leaf node.
+        bool IsLeaf() const;
+
+        //! Returns the number of entries bound to this node and all of its descendants.
+        uint32_t GetSubtreeEntryCount() const;
+
+    private:
+
+        //! Returns the index of the child whose loose bounds fully contain the provided volume, or ChildCount if there isn't one.
+        uint32_t FindContainingChild(const AZ::Aabb& boundingVolume) const;
+
+        //! Returns true if the loose bounds of this node fully contain the provided volume, and no child would be a tighter fit.
+        bool IsBestFit(const AZ::Aabb& boundingVolume) const;
+
+        //! Sets up the child cells and the structure-of-arrays child data used for culling.
+        void InitChildren(LooseOctreeNode* children, uint32_t childBlockIndex);
+
+        void AddEntry(VisibilityEntry* entry);
+        void RemoveEntry(VisibilityEntry* entry);
+        void AdjustSubtreeEntryCount(int32_t delta);
+
+        static constexpr uint32_t InvalidChildBlockIndex = 0xFFFFFFFF;
+
+        AZ::Aabb m_bounds = AZ::Aabb::CreateNull(); //< Loose bounds, twice the size of the node's cell.
+        AZ::Vector3 m_center = AZ::Vector3::CreateZero(); //< Center of the node's cell.
+        float m_halfSize = 0.0f; //< Half of the edge length of the node's cell.
+        uint32_t m_depth = 0;
+        uint32_t m_subtreeEntryCount = 0;
+        uint32_t m_childBlockIndex = InvalidChildBlockIndex;
+        LooseOctreeNode* m_parent = nullptr;
+        LooseOctreeNode* m_children = nullptr; //< Pointer to ChildCount contiguous nodes, or nullptr if this is a leaf node.
+        AZStd::vector<VisibilityEntry*> m_entries;
+
+        //! Cell centers of the children, stored as structure-of-arrays so that all of the children can be culled together with SIMD.
+        //! All children share the same loose half size (m_halfSize), so the centers are all that is needed to rebuild their bounds.
+        //! @{
+        alignas(16) float m_childCenterX[ChildCount] = {};
+        alignas(16) float m_childCenterY[ChildCount] = {};
+        alignas(16) float m_childCenterZ[ChildCount] = {};
+        //! @}
+
+        friend class LooseOctreeScene;
+    };
+
+    //! Alternative implementation of the visibility scene interface using a loose octree.
+    //! Because node bounds overlap, an entry's node depends only on its center and size, which keeps InsertOrUpdateEntry cheap for moving
+    //! entries and means no entry ever has to be held in an ancestor because it spans a split plane.  Child nodes are allocated in contiguous
+    //! blocks, and each node stores its children's bounds as structure-of-arrays so that enumeration culls all eight children at once.
+    class LooseOctreeScene
+        : public IVisibilityScene
+    {
+    public:
+
+        AZ_RTTI(LooseOctreeScene, "{66417868-589C-4A9B-B9D6-3B28967B3D33}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(LooseOctreeScene, AZ::SystemAllocator, 0);
+
+        explicit LooseOctreeScene(const AZ::Name& sceneName);
+        virtual ~LooseOctreeScene();
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Returns the loose octree's root node.
+        LooseOctreeNode& GetRoot();
+
+        //! LooseOctreeScene stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetFreeNodeCount() const;
+        uint32_t GetPageCount() const;
+        void DumpStats() const;
+        //! @}
+
+    private:
+
+        void Insert(VisibilityEntry* entry);
+        void Remove(VisibilityEntry* entry);
+        void Split(LooseOctreeNode& node);
+        void TryMerge(LooseOctreeNode* node);
+        void Merge(LooseOctreeNode& node);
+
+        template <typename CullPolicy>
+        void EnumerateHelper(const LooseOctreeNode& node, const CullPolicy& cullPolicy, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateNoCullHelper(const LooseOctreeNode& node, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        uint32_t AllocateChildNodes();
+        void ReleaseChildNodes(uint32_t childBlockIndex);
+        LooseOctreeNode* GetChildNodesAtIndex(uint32_t childBlockIndex) const;
+
+        AZ::Name m_sceneName;
+        LooseOctreeNode m_root; //< The root node for the loose octree.
+
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the loose octree.
+        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the loose octree, at least one for the root node.
+
+        static constexpr uint32_t BlockSize = 8192; //< This represents the number of nodes that can be stored in each page
+        static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
+        static_assert(BlockSize % LooseOctreeNode::ChildCount == 0, "BlockSize must be a multiple of the child count");
+
+        using LooseOctreeNodePage = AZStd::fixed_vector<LooseOctreeNode, BlockSize>;
+        AZStd::vector<LooseOctreeNodePage*> m_nodeCache; //< Array of contiguous memory blocks for all allocated nodes within the tree.
+        AZStd::vector<uint32_t> m_freeChildBlocks; //< Indices of free blocks of LooseOctreeNode::ChildCount contiguous nodes.
+    };
+
+    //! Alternative implementation of the visibility system interface, owning a default LooseOctreeScene plus any additional scenes
+    //! that have been created through the IVisibilitySystem interface.
+    //! Enable it with the bg_visibilityUseLooseOctree cvar.
+    class LooseOctreeSystemComponent
+        : public AZ::Component
+        , public IVisibilitySystemRequestBus::Handler
+    {
+    public:
+
+        AZ_COMPONENT(LooseOctreeSystemComponent, "{5E4F1C60-3F3B-4C0C-9A59-6A0A3A6B7D21}");
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        LooseOctreeSystemComponent();
+        virtual ~LooseOctreeSystemComponent();
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! IVisibilitySystem overrides.
+        //! @{
+        IVisibilityScene* GetDefaultVisibilityScene() override;
+        IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName) override;
+        void DestroyVisibilityScene(IVisibilityScene* visibilityScene) override;
+        IVisibilityScene* FindVisibilityScene(const AZ::Name& sceneName) override;
+        //! @}
+
+        //! Dumps the stats of every scene to the console.
+        void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+
+    private:
+
+        // Bind the DumpStats member function to the console as 'LooseOctreeSystemComponent.DumpStats'
+        AZ_CONSOLEFUNC(LooseOctreeSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump loose octree stats to the console window");
+
+        LooseOctreeScene* m_defaultScene = nullptr;
+        AZStd::vector<LooseOctreeScene*> m_scenes; //< All scenes owned by the system, including the default scene.
+    };
+}
@@ -16,13 +16,14 @@
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
 
 namespace AzFramework
 {
-    class OctreeSystemComponent;
+    class OctreeScene;
 
     //! An internal node within the tree.
     //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
@@ -40,25 +41,25 @@ namespace AzFramework
         OctreeNode& operator=(OctreeNode&& rhs);
 
         //! Inserts a VisibilityEntry into this OctreeNode, potentially triggering a split.
-        void Insert(OctreeSystemComponent& octreeSystemComponent, VisibilityEntry* entry);
+        void Insert(OctreeScene& octreeScene, VisibilityEntry* entry);
 
         //! Updates a VisibilityEntry that is currently bound to this OctreeNode.
         //! The provided entry must be bound to this node, but may no longer be bound to this node upon function exit.
-        void Update(OctreeSystemComponent& octreeSystemComponent, VisibilityEntry* entry);
+        void Update(OctreeScene& octreeScene, VisibilityEntry* entry);
 
         //! Removes a VisibilityEntry from this OctreeNode.
         //! The provided entry must be bound to this node.
-        void Remove(OctreeSystemComponent& octreeSystemComponent, VisibilityEntry* entry);
+        void Remove(OctreeScene& octreeScene, VisibilityEntry* entry);
 
         //! Recursively enumerates any OctreeNodes and their children that intersect the provided bounding volume.
         //! @{
-        void Enumerate(const AZ::Aabb& aabb, const IVisibilitySystem::EnumerateCallback& callback) const;
-        void Enumerate(const AZ::Sphere& sphere, const IVisibilitySystem::EnumerateCallback& callback) const;
-        void Enumerate(const AZ::Frustum& frustum, const IVisibilitySystem::EnumerateCallback& callback) const;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
-        void EnumerateNoCull(const IVisibilitySystem::EnumerateCallback& callback) const;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
@@ -71,13 +72,13 @@ namespace AzFramework
 
     private:
 
-        void TryMerge(OctreeSystemComponent& octreeSystemComponent);
+        void TryMerge(OctreeScene& octreeScene);
 
         template <typename T>
-        void EnumerateHelper(const T& boundingVolume, const IVisibilitySystem::EnumerateCallback& callback) const;
+        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
 
-        void Split(OctreeSystemComponent& octreeSystemComponent);
-        void Merge(OctreeSystemComponent& octreeSystemComponent);
+        void Split(OctreeScene& octreeScene);
+        void Merge(OctreeScene& octreeScene);
 
         // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
         // This gives us a maximum of 65,536 pages and 65,536 nodes per page, for a total of 2^32 - 1 total pages (-1 reserved for the invalid index)
@@ -89,50 +90,41 @@ namespace AzFramework
         AZStd::vector<VisibilityEntry*> m_entries;
     };
 
-    //! Implementation of the visibility system interface.
-    //! This uses a simple adaptive octreeSystemComponent to support partitioning an object set and efficiently running gathers and visibility queries.
-    class OctreeSystemComponent
-        : public AZ::Component
-        , public IVisibilitySystemRequestBus::Handler
+    //! Implementation of the visibility scene interface.
+    //! This uses a simple adaptive octree to support partitioning an object set and efficiently running gathers and visibility queries.
+    class OctreeScene
+        : public IVisibilityScene
     {
     public:
 
-        AZ_COMPONENT(OctreeSystemComponent, "{CD4FF1C5-BAF4-421D-951B-1E05DAEEF67B}");
+        AZ_RTTI(OctreeScene, "{FB4F2557-0FC5-41A8-924C-C17C79A11366}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(OctreeScene, AZ::SystemAllocator, 0);
 
-        static void Reflect(AZ::ReflectContext* context);
-        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
-        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        explicit OctreeScene(const AZ::Name& sceneName);
+        virtual ~OctreeScene();
 
-        OctreeSystemComponent();
-        virtual ~OctreeSystemComponent();
-
-        //! AZ::Component overrides.
-        //! @{
-        void Activate() override;
-        void Deactivate() override;
-        //! @}
-
-        //! IVisibilitySystem overrides.
+        //! IVisibilityScene overrides.
         //! @{
+        const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
         void RemoveEntry(VisibilityEntry& entry) override;
-        void Enumerate(const AZ::Aabb& aabb, const IVisibilitySystem::EnumerateCallback& callback) const override;
-        void Enumerate(const AZ::Sphere& sphere, const IVisibilitySystem::EnumerateCallback& callback) const override;
-        void Enumerate(const AZ::Frustum& frustum, const IVisibilitySystem::EnumerateCallback& callback) const override;
-        void EnumerateNoCull(const IVisibilitySystem::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
 
-        //! Returns the OctreeSystemComponent's root node.
+        //! Returns the OctreeScene's root node.
         OctreeNode& GetRoot();
 
-        //! OctreeSystemComponent stats
+        //! OctreeScene stats
         //! @{
         uint32_t GetNodeCount() const;
         uint32_t GetFreeNodeCount() const;
         uint32_t GetPageCount() const;
         uint32_t GetChildNodeCount() const;
-        void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void DumpStats() const;
         //! @}
 
     private:
@@ -141,13 +133,11 @@ namespace AzFramework
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
 
-        // Bind the DumpStats member function to the console as 'OctreeSystemComponent.DumpStats'
-        AZ_CONSOLEFUNC(OctreeSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump octreeSystemComponent stats to the console window");
-
-        OctreeNode m_root; //< The root node for the octreeSystemComponent.
+        AZ::Name m_sceneName;
+        OctreeNode m_root; //< The root node for the octree.
 
-        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octreeSystemComponent.
-        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the octreeSystemComponent, at least one for the root node.
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the octree.
+        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the octree, at least one for the root node.
 
         static constexpr uint32_t BlockSize = 8192; //< This represents the number of nodes that can be stored in each page
         static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
@@ -158,4 +148,47 @@ namespace AzFramework
 
         friend class OctreeNode; // For access to the node allocator methods
     };
+
+    //! Implementation of the visibility system interface.
+    //! Owns a default OctreeScene plus any additional scenes that have been created through the IVisibilitySystem interface.
+    class OctreeSystemComponent
+        : public AZ::Component
+        , public IVisibilitySystemRequestBus::Handler
+    {
+    public:
+
+        AZ_COMPONENT(OctreeSystemComponent, "{CD4FF1C5-BAF4-421D-951B-1E05DAEEF67B}");
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        OctreeSystemComponent();
+        virtual ~OctreeSystemComponent();
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! IVisibilitySystem overrides.
+        //! @{
+        IVisibilityScene* GetDefaultVisibilityScene() override;
+        IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName) override;
+        void DestroyVisibilityScene(IVisibilityScene* visibilityScene) override;
+        IVisibilityScene* FindVisibilityScene(const AZ::Name& sceneName) override;
+        //! @}
+
+        //! Dumps the stats of every scene to the console.
+        void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+
+    private:
+
+        // Bind the DumpStats member function to the console as 'OctreeSystemComponent.DumpStats'
+        AZ_CONSOLEFUNC(OctreeSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump octreeSystemComponent stats to the console window");
+
+        OctreeScene* m_defaultScene = nullptr;
+        AZStd::vector<OctreeScene*> m_scenes; //< All scenes owned by the system, including the default scene.
+    };
 }
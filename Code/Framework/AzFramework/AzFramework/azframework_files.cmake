@@ -377,6 +377,8 @@ set(FILES
     Visibility/IVisibilitySystem.h
     Visibility/OctreeSystemComponent.h
     Visibility/OctreeSystemComponent.cpp
+    Visibility/LooseOctreeSystemComponent.h
+    Visibility/LooseOctreeSystemComponent.cpp
     Visibility/BoundsBus.h
     Visibility/BoundsBus.cpp
     Visibility/VisibilityDebug.h
@@ -37,6 +37,16 @@ namespace AzNetworking
         //! @return reference to the LHS
         SelfType& operator |=(const SelfType& rhs);
 
+        //! Equality operator.
+        //! @param rhs instance to compare against
+        //! @return boolean true if inputs have the same size and bits, false otherwise
+        bool operator ==(const SelfType& rhs) const;
+
+        //! Inequality operator.
+        //! @param rhs instance to compare against
+        //! @return boolean true if inputs are different, false otherwise
+        bool operator !=(const SelfType& rhs) const;
+
         //! Sets the specified bit to the provided value.
         //! @param index index of the bit to set
         //! @param value value to set the bit to
@@ -37,6 +37,31 @@ namespace AzNetworking
         return *this;
     }
 
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator ==(const SelfType& rhs) const
+    {
+        if (m_count != rhs.m_count)
+        {
+            return false;
+        }
+        // Bits past m_count are always cleared, so only the used elements need to be compared
+        const uint32_t usedElementSize = (GetSize() + BitsetType::ElementTypeBits - 1) / BitsetType::ElementTypeBits;
+        for (uint32_t i = 0; i < usedElementSize; ++i)
+        {
+            if (m_bitset.GetContainer()[i] != rhs.m_bitset.GetContainer()[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     template <AZStd::size_t CAPACITY, typename ElementType>
     inline void FixedSizeVectorBitset<CAPACITY, ElementType>::SetBit(uint32_t index, bool value)
     {
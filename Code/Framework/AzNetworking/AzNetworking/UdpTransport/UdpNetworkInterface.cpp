@@ -154,6 +154,9 @@ namespace AzNetworking
         m_socket->ProcessDeferredPackets();
 #endif
 
+        // Send anything queued since the last update, see net_UdpBatchSends
+        m_socket->FlushSends();
+
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
@@ -306,6 +309,9 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Send anything queued while processing received packets and timeouts
+        m_socket->FlushSends();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
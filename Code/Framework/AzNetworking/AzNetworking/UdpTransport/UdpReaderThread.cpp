@@ -180,7 +180,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = receiveBuffer.GetSize();
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -189,18 +188,36 @@ namespace AzNetworking
                     break;
                 }
 
+                // Receive a batch of packets into MTU sized slots, bounded by the free space in both the buffer and the packet list
+                const uint32_t freeSlots = aznumeric_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit;
+                const uint32_t freePackets = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchSize = AZStd::min(UdpSocket::MaxBatchedPackets, AZStd::min(freeSlots, freePackets));
+                if (batchSize == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchSize * MaxUdpTransmissionUnit);
+
+                UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchedPackets];
+                const int32_t receivedCount = socket->ReceiveBatch(datagrams, dstData, MaxUdpTransmissionUnit, batchSize);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                // Pack the received payloads back to back so the unused tail of each slot is available to the next batch
+                uint32_t bufferSize = bufferHead;
+                for (int32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    const UdpSocket::ReceivedDatagram& datagram = datagrams[i];
+                    uint8_t* packetData = receiveBuffer.GetBuffer() + bufferSize;
+                    memmove(packetData, datagram.m_buffer, datagram.m_receivedBytes);
+                    receivedPackets.push_back(ReceivedPacket(datagram.m_address, packetData, datagram.m_receivedBytes));
+                    bufferSize += datagram.m_receivedBytes;
                 }
-                else
+                receiveBuffer.Resize(bufferSize);
+
+                if (receivedCount < aznumeric_cast<int32_t>(batchSize))
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // Socket has been drained
                     break;
                 }
             }
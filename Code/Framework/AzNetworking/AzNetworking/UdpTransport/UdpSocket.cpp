@@ -24,6 +24,7 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSends, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, outgoing UDP packets are queued and flushed once per network update with a single system call, trading up to a tick of latency for fewer syscalls");
 
     UdpSocket::~UdpSocket()
     {
@@ -104,6 +105,7 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        FlushSends();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -219,42 +221,165 @@ namespace AzNetworking
 
         if (receivedBytes < 0)
         {
-            const int32_t error = GetLastNetworkError();
+            return HandleReceiveError();
+        }
+
+        if (receivedBytes == 0)
+        {
+            return 0;
+        }
+
+        m_recvPackets++;
+        m_recvBytes += receivedBytes;
+        return receivedBytes;
+    }
+
+    int32_t UdpSocket::ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t stride, uint32_t count) const
+    {
+        AZ_Assert(count <= MaxBatchedPackets, "Too many packets requested from a batched receive");
+        AZ_Assert(stride > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHING
+        mmsghdr messages[MaxBatchedPackets];
+        iovec buffers[MaxBatchedPackets];
+        sockaddr_in from[MaxBatchedPackets];
+        memset(messages, 0, sizeof(mmsghdr) * count);
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            buffers[i].iov_base = outData + i * stride;
+            buffers[i].iov_len = stride;
+            messages[i].msg_hdr.msg_name = &from[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
 
-            if (ErrorIsWouldBlock(error)) // Filter would block messages
+        const int32_t receivedCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, 0, nullptr);
+
+        if (receivedCount < 0)
+        {
+            return HandleReceiveError();
+        }
+
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            outDatagrams[i].m_address = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+            outDatagrams[i].m_buffer = outData + i * stride;
+            outDatagrams[i].m_receivedBytes = static_cast<int32_t>(messages[i].msg_len);
+            m_recvPackets++;
+            m_recvBytes += messages[i].msg_len;
+        }
+        return receivedCount;
+#else
+        int32_t receivedCount = 0;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ReceivedDatagram& datagram = outDatagrams[i];
+            datagram.m_buffer = outData + i * stride;
+            datagram.m_receivedBytes = Receive(datagram.m_address, datagram.m_buffer, stride);
+            if (datagram.m_receivedBytes < 0)
             {
-                return 0;
+                // Only surface the error if nothing was received, the next call will report it again
+                return (receivedCount > 0) ? receivedCount : datagram.m_receivedBytes;
             }
-
-            bool ignoreForciblyClosedError = false;
-            if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+            if (datagram.m_receivedBytes == 0)
             {
-                if (ignoreForciblyClosedError)
-                {
-                    return 0;
-                }
-                else
-                {
-                    return SocketOpResultError;
-                }
+                break;
             }
+            ++receivedCount;
+        }
+        return receivedCount;
+#endif
+    }
 
-            AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+    void UdpSocket::FlushSends() const
+    {
+#if AZ_TRAIT_USE_SOCKET_BATCHING
+        if (m_sendQueue.empty())
+        {
+            return;
         }
 
-        if (receivedBytes <= 0)
+        if (!IsOpen())
         {
-            return 0;
+            m_sendQueue.clear();
+            m_sendQueueBuffer.Resize(0);
+            return;
         }
 
-        m_recvPackets++;
-        m_recvBytes += receivedBytes;
-        return receivedBytes;
+        mmsghdr messages[MaxBatchedPackets];
+        iovec buffers[MaxBatchedPackets];
+        sockaddr_in destAddrs[MaxBatchedPackets];
+        memset(messages, 0, sizeof(mmsghdr) * m_sendQueue.size());
+        memset(destAddrs, 0, sizeof(sockaddr_in) * m_sendQueue.size());
+
+        for (uint32_t i = 0; i < m_sendQueue.size(); ++i)
+        {
+            const QueuedSend& queuedSend = m_sendQueue[i];
+            destAddrs[i].sin_family = AF_INET;
+            destAddrs[i].sin_addr.s_addr = queuedSend.m_address.GetAddress(ByteOrder::Network);
+            destAddrs[i].sin_port = queuedSend.m_address.GetPort(ByteOrder::Network);
+            buffers[i].iov_base = m_sendQueueBuffer.GetBuffer() + queuedSend.m_offset;
+            buffers[i].iov_len = queuedSend.m_size;
+            messages[i].msg_hdr.msg_name = &destAddrs[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const uint32_t queuedCount = aznumeric_cast<uint32_t>(m_sendQueue.size());
+        uint32_t sentCount = 0;
+        while (sentCount < queuedCount)
+        {
+            const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, queuedCount - sentCount, 0);
+            if (result > 0)
+            {
+                sentCount += result;
+                continue;
+            }
+
+            const int32_t error = GetLastNetworkError();
+            if (ErrorIsWouldBlock(error)) // Filter would block messages, the remaining packets are dropped as an unbatched send would
+            {
+                break;
+            }
+
+            // Skip the packet that failed and keep going, same as an unbatched send
+            AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            ++sentCount;
+        }
+
+        m_sendQueue.clear();
+        m_sendQueueBuffer.Resize(0);
+#endif
     }
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool dontEncypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+#if AZ_TRAIT_USE_SOCKET_BATCHING
+        if (net_UdpBatchSends && (size <= MaxUdpTransmissionUnit))
+        {
+            if (m_sendQueue.full())
+            {
+                FlushSends();
+            }
+
+            const uint32_t offset = aznumeric_cast<uint32_t>(m_sendQueueBuffer.GetSize());
+            m_sendQueueBuffer.Resize(offset + size);
+            memcpy(m_sendQueueBuffer.GetBuffer() + offset, data, size);
+            m_sendQueue.push_back(QueuedSend{ address, offset, size });
+            return static_cast<int32_t>(size);
+        }
+#endif
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
@@ -262,4 +387,30 @@ namespace AzNetworking
         destAddr.sin_port = address.GetPort(ByteOrder::Network);
         return sendto(static_cast<int32_t>(m_socketFd), reinterpret_cast<const char*>(data), size, 0, (sockaddr*)&destAddr, sizeof(destAddr));
     }
+
+    int32_t UdpSocket::HandleReceiveError() const
+    {
+        const int32_t error = GetLastNetworkError();
+
+        if (ErrorIsWouldBlock(error)) // Filter would block messages
+        {
+            return 0;
+        }
+
+        bool ignoreForciblyClosedError = false;
+        if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+        {
+            if (ignoreForciblyClosedError)
+            {
+                return 0;
+            }
+            else
+            {
+                return SocketOpResultError;
+            }
+        }
+
+        AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+        return 0;
+    }
 }
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Utilities/IpAddress.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
@@ -40,6 +41,17 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of payloads moved by a single call to ReceiveBatch or FlushSends.
+        static constexpr uint32_t MaxBatchedPackets = 64;
+
+        //! A single payload received by ReceiveBatch.
+        struct ReceivedDatagram
+        {
+            IpAddress m_address;
+            uint8_t*  m_buffer = nullptr;
+            int32_t   m_receivedBytes = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -97,6 +109,18 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives up to count payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param outDatagrams on success, the address, location and size of each payload received
+        //! @param outData      address to write the received data to, payload i is written to outData + i * stride
+        //! @param stride       maximum size of a single payload in bytes
+        //! @param count        maximum number of payloads to receive, must not exceed MaxBatchedPackets
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(ReceivedDatagram* outDatagrams, uint8_t* outData, uint32_t stride, uint32_t count) const;
+
+        //! Sends all payloads queued while net_UdpBatchSends is enabled, using a single system call where possible.
+        //! Called by the network interface at least once per update, so queued payloads are delayed by at most a tick.
+        void FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -123,12 +147,27 @@ namespace AzNetworking
 
     private:
 
+        //! Translates the last network error of a failed receive into a Receive return value.
+        int32_t HandleReceiveError() const;
+
         SocketFd m_socketFd = InvalidSocketFd;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
         mutable uint32_t m_recvBytes = 0;
 
+#if AZ_TRAIT_USE_SOCKET_BATCHING
+        struct QueuedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset;
+            uint32_t m_size;
+        };
+
+        mutable AZStd::fixed_vector<QueuedSend, MaxBatchedPackets> m_sendQueue;
+        mutable ByteBuffer<MaxBatchedPackets * MaxUdpTransmissionUnit> m_sendQueueBuffer;
+#endif
+
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
         {
@@ -15,4 +15,32 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.Resize(40);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.Resize(40);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(33, true);
+        EXPECT_TRUE(lhs != rhs);
+        rhs.SetBit(33, true);
+        EXPECT_TRUE(lhs == rhs);
+    }
+
+    TEST(FixedSizeVectorBitset, TestEqualityIgnoresRemovedBits)
+    {
+        AzNetworking::FixedSizeVectorBitset<128> lhs;
+        lhs.Resize(40);
+        lhs.SetBit(39, true);
+        lhs.Resize(20);
+
+        AzNetworking::FixedSizeVectorBitset<128> rhs;
+        rhs.Resize(20);
+        EXPECT_TRUE(lhs == rhs);
+    }
 }
@@ -13,6 +13,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -22,10 +23,51 @@
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
+namespace AzNetworking
+{
+    AZ_CVAR_EXTERNED(bool, net_UdpBatchSends);
+}
+
 namespace UnitTest
 {
     using namespace AzNetworking;
 
+    //! Sends a payload tagged with the given index from sender to the loopback receiver port.
+    static void SendIndexedPacket(const UdpSocket& sender, uint16_t receiverPort, DtlsEndpoint& dtlsEndpoint, uint32_t index, uint32_t size)
+    {
+        uint8_t payload[MaxUdpTransmissionUnit];
+        memset(payload, static_cast<uint8_t>(index), size);
+        sender.Send(IpAddress(127, 0, 0, 1, receiverPort), payload, size, false, dtlsEndpoint, ConnectionQuality());
+    }
+
+    //! Receives with ReceiveBatch until expectedCount packets arrived or the timeout expired, returns the number received.
+    static uint32_t ReceiveIndexedPackets(const UdpSocket& receiver, uint32_t firstIndex, uint32_t expectedCount, uint32_t size)
+    {
+        uint8_t buffer[UdpSocket::MaxBatchedPackets * MaxUdpTransmissionUnit];
+        UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchedPackets];
+
+        constexpr AZ::TimeMs TimeoutMs = AZ::TimeMs{ 1000 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        uint32_t receivedCount = 0;
+        while ((receivedCount < expectedCount) && (AZ::GetElapsedTimeMs() - startTimeMs < TimeoutMs))
+        {
+            const int32_t batchCount = receiver.ReceiveBatch(datagrams, buffer, MaxUdpTransmissionUnit, UdpSocket::MaxBatchedPackets);
+            for (int32_t i = 0; i < batchCount; ++i)
+            {
+                // Loopback preserves ordering, so each packet is tagged with its index
+                EXPECT_EQ(datagrams[i].m_receivedBytes, static_cast<int32_t>(size));
+                EXPECT_EQ(datagrams[i].m_buffer[0], static_cast<uint8_t>(firstIndex + receivedCount));
+                EXPECT_EQ(datagrams[i].m_address.GetAddress(ByteOrder::Host), IpAddress(127, 0, 0, 1, 0).GetAddress(ByteOrder::Host));
+                ++receivedCount;
+            }
+            if (batchCount <= 0)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+        return receivedCount;
+    }
+
     class TestUdpConnectionListener
         : public IConnectionListener
     {
@@ -303,4 +345,157 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST_F(UdpTransportTests, TestReceiveBatch)
+    {
+        constexpr uint16_t ReceiverPort = 12346;
+        constexpr uint32_t PacketCount = UdpSocket::MaxBatchedPackets + 16;
+        constexpr uint32_t PacketSize = 200;
+
+        UdpSocket sender;
+        UdpSocket receiver;
+        EXPECT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        for (uint32_t i = 0; i < PacketCount; ++i)
+        {
+            SendIndexedPacket(sender, ReceiverPort, dtlsEndpoint, i, PacketSize);
+        }
+
+        EXPECT_EQ(ReceiveIndexedPackets(receiver, 0, PacketCount, PacketSize), PacketCount);
+        EXPECT_EQ(receiver.GetRecvPackets(), PacketCount);
+        EXPECT_EQ(receiver.GetRecvBytes(), PacketCount * PacketSize);
+    }
+
+    TEST_F(UdpTransportTests, TestBatchedSends)
+    {
+        constexpr uint16_t ReceiverPort = 12347;
+        constexpr uint32_t PacketCount = UdpSocket::MaxBatchedPackets + 16;
+        constexpr uint32_t PacketSize = 200;
+
+        const bool batchSends = net_UdpBatchSends;
+        net_UdpBatchSends = true;
+
+        UdpSocket sender;
+        UdpSocket receiver;
+        EXPECT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        for (uint32_t i = 0; i < PacketCount; ++i)
+        {
+            SendIndexedPacket(sender, ReceiverPort, dtlsEndpoint, i, PacketSize);
+        }
+        EXPECT_EQ(sender.GetSentPackets(), PacketCount);
+
+#if AZ_TRAIT_USE_SOCKET_BATCHING
+        // Filling the queue flushes it, the remainder waits for the next flush
+        EXPECT_EQ(ReceiveIndexedPackets(receiver, 0, UdpSocket::MaxBatchedPackets, PacketSize), UdpSocket::MaxBatchedPackets);
+        IpAddress address;
+        uint8_t buffer[MaxUdpTransmissionUnit];
+        EXPECT_EQ(receiver.Receive(address, buffer, sizeof(buffer)), 0);
+
+        sender.FlushSends();
+        constexpr uint32_t RemainingCount = PacketCount - UdpSocket::MaxBatchedPackets;
+        EXPECT_EQ(ReceiveIndexedPackets(receiver, UdpSocket::MaxBatchedPackets, RemainingCount, PacketSize), RemainingCount);
+#else
+        sender.FlushSends();
+        EXPECT_EQ(ReceiveIndexedPackets(receiver, 0, PacketCount, PacketSize), PacketCount);
+#endif
+
+        net_UdpBatchSends = batchSends;
+    }
+}
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    //! Measures the cost of moving packets across the loopback interface, with and without batched system calls.
+    class BM_UdpLoopback
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t ReceiverPort = 12348;
+        static constexpr uint32_t PacketsPerIteration = 256;
+        static constexpr uint32_t PacketSize = 512;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_batchSends = net_UdpBatchSends;
+            m_sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            memset(m_payload, 0xAB, sizeof(m_payload));
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_receiver.Close();
+            m_sender.Close();
+            net_UdpBatchSends = m_batchSends;
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        UdpSocket m_sender;
+        UdpSocket m_receiver;
+        DtlsEndpoint m_dtlsEndpoint;
+        bool m_batchSends = false;
+        uint8_t m_payload[PacketSize];
+        uint8_t m_receiveBuffer[UdpSocket::MaxBatchedPackets * MaxUdpTransmissionUnit];
+        UdpSocket::ReceivedDatagram m_datagrams[UdpSocket::MaxBatchedPackets];
+    };
+
+    // Arg 0 selects per packet system calls, arg 1 selects batched sends and receives
+    BENCHMARK_DEFINE_F(BM_UdpLoopback, SendReceive)(benchmark::State& state)
+    {
+        const bool batched = (state.range(0) != 0);
+        net_UdpBatchSends = batched;
+
+        const IpAddress receiverAddress(127, 0, 0, 1, ReceiverPort);
+        const ConnectionQuality connectionQuality;
+        int64_t receivedPackets = 0;
+
+        for (auto _ : state)
+        {
+            for (uint32_t i = 0; i < PacketsPerIteration; ++i)
+            {
+                m_sender.Send(receiverAddress, m_payload, PacketSize, false, m_dtlsEndpoint, connectionQuality);
+            }
+            m_sender.FlushSends();
+
+            // Loopback doesn't drop packets at this rate, but bail out after a bounded number of empty reads to be safe
+            uint32_t receivedCount = 0;
+            for (uint32_t emptyReads = 0; (receivedCount < PacketsPerIteration) && (emptyReads < 1000);)
+            {
+                int32_t result = 0;
+                if (batched)
+                {
+                    result = m_receiver.ReceiveBatch(m_datagrams, m_receiveBuffer, MaxUdpTransmissionUnit, UdpSocket::MaxBatchedPackets);
+                }
+                else
+                {
+                    IpAddress address;
+                    result = (m_receiver.Receive(address, m_receiveBuffer, MaxUdpTransmissionUnit) > 0) ? 1 : 0;
+                }
+
+                if (result > 0)
+                {
+                    receivedCount += result;
+                }
+                else
+                {
+                    ++emptyReads;
+                }
+            }
+            receivedPackets += receivedCount;
+        }
+
+        state.SetItemsProcessed(receivedPackets);
+        state.counters["CpuPerPacket"] = benchmark::Counter(aznumeric_cast<double>(receivedPackets), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    }
+    BENCHMARK_REGISTER_F(BM_UdpLoopback, SendReceive)->Arg(0)->Arg(1);
 }
+#endif
@@ -0,0 +1,261 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Visibility/LooseOctreeSystemComponent.h>
+#include <random>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    class LooseOctreeTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            AZ::NameDictionary::Create();
+
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_console->GetCvarValue("bg_looseOctreeNodeMaxEntries", m_savedMaxEntries);
+            m_console->GetCvarValue("bg_looseOctreeNodeMinEntries", m_savedMinEntries);
+            m_console->GetCvarValue("bg_looseOctreeMaxWorldExtents", m_savedBounds);
+
+            // Use small nodes so that a modest number of entries exercises splitting and merging
+            m_console->PerformCommand("bg_looseOctreeNodeMaxEntries 4");
+            m_console->PerformCommand("bg_looseOctreeNodeMinEntries 2");
+            m_console->PerformCommand("bg_looseOctreeMaxWorldExtents 64"); // Create a -64,-64,-64 to 64,64,64 world cell
+
+            m_looseOctreeSystemComponent = new LooseOctreeSystemComponent;
+            m_looseOctreeScene = azrtti_cast<LooseOctreeScene*>(m_looseOctreeSystemComponent->CreateVisibilityScene(AZ::Name("LooseOctreeUnitTestScene")));
+        }
+
+        void TearDown() override
+        {
+            // Restore looseOctreeSystemComponent cvars for any future tests or benchmarks that might get executed
+            AZStd::string commandString;
+            commandString.format("bg_looseOctreeNodeMaxEntries %u", m_savedMaxEntries);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_looseOctreeNodeMinEntries %u", m_savedMinEntries);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_looseOctreeMaxWorldExtents %f", m_savedBounds);
+            m_console->PerformCommand(commandString.c_str());
+
+            m_looseOctreeSystemComponent->DestroyVisibilityScene(m_looseOctreeScene);
+            delete m_looseOctreeSystemComponent;
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            AZ::NameDictionary::Destroy();
+            AllocatorsFixture::TearDown();
+        }
+
+        //! Fills the entry array with random boxes, some of which extend outside the world bounds.
+        void CreateRandomEntries(AZStd::vector<VisibilityEntry>& entries, uint32_t entryCount)
+        {
+            entries.resize(entryCount);
+            for (VisibilityEntry& entry : entries)
+            {
+                entry.m_boundingVolume = CreateRandomBox();
+            }
+        }
+
+        AZ::Aabb CreateRandomBox()
+        {
+            const AZ::Vector3 center(m_positionDistribution(m_rng), m_positionDistribution(m_rng), m_positionDistribution(m_rng));
+            const AZ::Vector3 halfExtents(m_sizeDistribution(m_rng), m_sizeDistribution(m_rng), m_sizeDistribution(m_rng));
+            return AZ::Aabb::CreateCenterHalfExtents(center, halfExtents);
+        }
+
+        //! Verifies that enumeration returns every entry overlapping the bounds, and never returns an entry twice.
+        template <typename BoundsType>
+        void ValidateEnumerate(const BoundsType& bounds, const AZStd::vector<VisibilityEntry>& entries)
+        {
+            const LooseOctreeNode* root = &m_looseOctreeScene->GetRoot();
+            AZStd::unordered_set<const VisibilityEntry*> enumeratedEntries;
+            m_looseOctreeScene->Enumerate(bounds, [root, &enumeratedEntries](const IVisibilityScene::NodeData& nodeData)
+            {
+                for (const VisibilityEntry* entry : nodeData.m_entries)
+                {
+                    // Only the root may hold entries that extend outside of its bounds
+                    EXPECT_TRUE(nodeData.m_bounds.Contains(entry->m_boundingVolume) || entry->m_internalNode == root);
+                    EXPECT_TRUE(enumeratedEntries.insert(entry).second);
+                }
+            });
+
+            for (const VisibilityEntry& entry : entries)
+            {
+                if (AZ::ShapeIntersection::Overlaps(bounds, entry.m_boundingVolume))
+                {
+                    EXPECT_TRUE(enumeratedEntries.find(&entry) != enumeratedEntries.end());
+                }
+            }
+        }
+
+        LooseOctreeSystemComponent* m_looseOctreeSystemComponent = nullptr;
+        LooseOctreeScene* m_looseOctreeScene = nullptr;
+        uint32_t m_savedMaxEntries = 0;
+        uint32_t m_savedMinEntries = 0;
+        float m_savedBounds = 0.0f;
+        AZ::Console* m_console = nullptr;
+
+        std::mt19937_64 m_rng{ 1 };
+        std::uniform_real_distribution<float> m_positionDistribution{ -72.0f, 72.0f };
+        std::uniform_real_distribution<float> m_sizeDistribution{ 0.1f, 8.0f };
+    };
+
+    TEST_F(LooseOctreeTests, InsertDeleteSingleEntry)
+    {
+        VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry.m_internalNodeIndex == 0);
+        EXPECT_TRUE(m_looseOctreeScene->GetEntryCount() == 1);
+        EXPECT_TRUE(m_looseOctreeScene->GetRoot().GetSubtreeEntryCount() == 1);
+
+        m_looseOctreeScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        EXPECT_TRUE(m_looseOctreeScene->GetEntryCount() == 0);
+        EXPECT_TRUE(m_looseOctreeScene->GetRoot().GetSubtreeEntryCount() == 0);
+    }
+
+    TEST_F(LooseOctreeTests, InsertDeleteSplitMerge)
+    {
+        // Small entries spread over all eight octants force the root to split
+        AZStd::vector<VisibilityEntry> entries(LooseOctreeNode::ChildCount);
+        for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+        {
+            const AZ::Vector3 center(
+                (child & 0x01) ? 32.0f : -32.0f,
+                (child & 0x02) ? 32.0f : -32.0f,
+                (child & 0x04) ? 32.0f : -32.0f);
+            entries[child].m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(1.0f));
+            m_looseOctreeScene->InsertOrUpdateEntry(entries[child]);
+        }
+
+        EXPECT_FALSE(m_looseOctreeScene->GetRoot().IsLeaf());
+        EXPECT_TRUE(m_looseOctreeScene->GetNodeCount() == 1 + LooseOctreeNode::ChildCount);
+        EXPECT_TRUE(m_looseOctreeScene->GetRoot().GetEntries().empty());
+        for (uint32_t child = 0; child < LooseOctreeNode::ChildCount; ++child)
+        {
+            EXPECT_TRUE(entries[child].m_internalNode == &m_looseOctreeScene->GetRoot().GetChildren()[child]);
+        }
+
+        // Removing entries until the subtree reaches the minimum entry count merges the children back into the root
+        for (uint32_t child = 0; child < LooseOctreeNode::ChildCount - 2; ++child)
+        {
+            m_looseOctreeScene->RemoveEntry(entries[child]);
+        }
+
+        EXPECT_TRUE(m_looseOctreeScene->GetRoot().IsLeaf());
+        EXPECT_TRUE(m_looseOctreeScene->GetNodeCount() == 1);
+        EXPECT_TRUE(m_looseOctreeScene->GetFreeNodeCount() == LooseOctreeNode::ChildCount);
+        EXPECT_TRUE(m_looseOctreeScene->GetRoot().GetEntries().size() == 2);
+
+        m_looseOctreeScene->RemoveEntry(entries[LooseOctreeNode::ChildCount - 2]);
+        m_looseOctreeScene->RemoveEntry(entries[LooseOctreeNode::ChildCount - 1]);
+        EXPECT_TRUE(m_looseOctreeScene->GetEntryCount() == 0);
+    }
+
+    TEST_F(LooseOctreeTests, UpdateWithinLooseBoundsKeepsNode)
+    {
+        AZStd::vector<VisibilityEntry> entries;
+        CreateRandomEntries(entries, 256);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        // Small moves of a small entry deep in the tree are absorbed by the loose bounds of its node
+        VisibilityEntry movingEntry;
+        movingEntry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(20.0f, 20.0f, 20.0f), AZ::Vector3(0.25f));
+        m_looseOctreeScene->InsertOrUpdateEntry(movingEntry);
+        const VisibilityNode* node = movingEntry.m_internalNode;
+        const LooseOctreeNode* looseNode = static_cast<const LooseOctreeNode*>(node);
+        EXPECT_FALSE(looseNode == &m_looseOctreeScene->GetRoot());
+
+        movingEntry.m_boundingVolume.Translate(AZ::Vector3(0.2f, -0.2f, 0.1f));
+        m_looseOctreeScene->InsertOrUpdateEntry(movingEntry);
+        EXPECT_TRUE(movingEntry.m_internalNode == node);
+        EXPECT_TRUE(m_looseOctreeScene->GetEntryCount() == 257);
+
+        m_looseOctreeScene->RemoveEntry(movingEntry);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+        EXPECT_TRUE(m_looseOctreeScene->GetEntryCount() == 0);
+        EXPECT_TRUE(m_looseOctreeScene->GetNodeCount() == 1);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateMatchesBruteForceWithMovingEntries)
+    {
+        constexpr uint32_t EntryCount = 1000;
+        constexpr uint32_t StepCount = 10;
+
+        AZStd::vector<VisibilityEntry> entries;
+        CreateRandomEntries(entries, EntryCount);
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        const AZ::Transform frustumTransform = AZ::Transform::CreateLookAt(AZ::Vector3(-80.0f, -70.0f, -60.0f), AZ::Vector3::CreateZero());
+        const AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 150.0f));
+
+        for (uint32_t step = 0; step < StepCount; ++step)
+        {
+            // Move half of the entries to new random locations each step, and churn a few by removing and re-inserting them
+            for (uint32_t i = step % 2; i < EntryCount; i += 2)
+            {
+                entries[i].m_boundingVolume = CreateRandomBox();
+                m_looseOctreeScene->InsertOrUpdateEntry(entries[i]);
+            }
+            for (uint32_t i = step; i < EntryCount; i += 97)
+            {
+                m_looseOctreeScene->RemoveEntry(entries[i]);
+                m_looseOctreeScene->InsertOrUpdateEntry(entries[i]);
+            }
+            EXPECT_TRUE(m_looseOctreeScene->GetEntryCount() == EntryCount);
+            EXPECT_TRUE(m_looseOctreeScene->GetRoot().GetSubtreeEntryCount() == EntryCount);
+
+            ValidateEnumerate(AZ::Aabb::CreateCenterHalfExtents(CreateRandomBox().GetCenter(), AZ::Vector3(24.0f)), entries);
+            ValidateEnumerate(AZ::Sphere(CreateRandomBox().GetCenter(), 20.0f), entries);
+            ValidateEnumerate(frustum, entries);
+        }
+
+        uint32_t enumeratedCount = 0;
+        m_looseOctreeScene->EnumerateNoCull([&enumeratedCount](const IVisibilityScene::NodeData& nodeData)
+        {
+            enumeratedCount += aznumeric_cast<uint32_t>(nodeData.m_entries.size());
+        });
+        EXPECT_TRUE(enumeratedCount == EntryCount);
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+        EXPECT_TRUE(m_looseOctreeScene->GetEntryCount() == 0);
+        EXPECT_TRUE(m_looseOctreeScene->GetNodeCount() == 1);
+    }
+}
@@ -11,7 +11,9 @@
 */
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Name/NameDictionary.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
 
@@ -33,7 +35,15 @@ namespace Benchmark
                 m_ownsSystemAllocator = true;
             }
 
+            // Create the NameDictionary if not available, visibility scenes are identified by name
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+                m_ownsNameDictionary = true;
+            }
+
             m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
+            m_octreeScene = m_octreeSystemComponent->GetDefaultVisibilityScene();
             m_dataArray.resize(1000000);
             m_queryDataArray.resize(1000);
 
@@ -80,6 +90,11 @@ namespace Benchmark
             m_queryDataArray.clear();
             m_queryDataArray.shrink_to_fit();
 
+            if (m_ownsNameDictionary)
+            {
+                AZ::NameDictionary::Destroy();
+            }
+
             // Destroy system allocator only if it was created by this environment
             if (m_ownsSystemAllocator)
             {
@@ -89,19 +104,17 @@ namespace Benchmark
 
         void InsertEntries(uint32_t entryCount)
         {
-            AzFramework::IVisibilitySystem* visSystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
             for (uint32_t i = 0; i < entryCount; ++i)
             {
-                visSystem->InsertOrUpdateEntry(m_dataArray[i]);
+                m_octreeScene->InsertOrUpdateEntry(m_dataArray[i]);
             }
         }
 
         void RemoveEntries(uint32_t entryCount)
         {
-            AzFramework::IVisibilitySystem* visSystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
             for (uint32_t i = 0; i < entryCount; ++i)
             {
-                visSystem->RemoveEntry(m_dataArray[i]);
+                m_octreeScene->RemoveEntry(m_dataArray[i]);
             }
         }
 
@@ -113,9 +126,11 @@ namespace Benchmark
         };
 
         bool m_ownsSystemAllocator = false;
+        bool m_ownsNameDictionary = false;
         AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
         AZStd::vector<QueryData> m_queryDataArray;
         AzFramework::OctreeSystemComponent* m_octreeSystemComponent;
+        AzFramework::IVisibilityScene* m_octreeScene;
     };
 
     BENCHMARK_F(BM_Octree, InsertDelete1000)(benchmark::State& state)
@@ -166,7 +181,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.aabb, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -180,7 +195,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.aabb, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -194,7 +209,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.aabb, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -208,7 +223,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.aabb, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -222,7 +237,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.sphere, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -236,7 +251,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.sphere, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -250,7 +265,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.sphere, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -264,7 +279,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.sphere, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -278,7 +293,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.frustum, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -292,7 +307,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.frustum, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -306,7 +321,7 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.frustum, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
@@ -320,11 +335,195 @@ namespace Benchmark
         {
             for (auto& queryData : m_queryDataArray)
             {
-                m_octreeSystemComponent->Enumerate(queryData.frustum, [](const AzFramework::IVisibilitySystem::NodeData&) {});
+                m_octreeScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
             }
         }
         RemoveEntries(EntryCount);
     }
+
+    //! Models a game scene, a large number of static entries plus a smaller set of entries that move every frame.
+    //! Templated on the visibility system component so that each backend is measured against the exact same scene.
+    template <typename VisibilitySystemComponent>
+    class BM_VisibilityDynamicScene
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr uint32_t StaticEntryCount = 1000000;
+        static constexpr uint32_t DynamicEntryCount = 50000;
+        static constexpr uint32_t QueryCount = 100;
+        static constexpr float WorldSize = 8000.0f;
+
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            // Create the SystemAllocator if not available
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+                m_ownsSystemAllocator = true;
+            }
+
+            // Create the NameDictionary if not available, visibility scenes are identified by name
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+                m_ownsNameDictionary = true;
+            }
+
+            m_visibilitySystemComponent = new VisibilitySystemComponent;
+            m_visibilityScene = m_visibilitySystemComponent->GetDefaultVisibilityScene();
+            m_entries.resize(StaticEntryCount + DynamicEntryCount);
+            m_velocities.resize(DynamicEntryCount);
+            m_frustums.resize(QueryCount);
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif;
+
+            for (AzFramework::VisibilityEntry& entry : m_entries)
+            {
+                AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * WorldSize;
+                AZ::Vector3 aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 50.0f + aabbMin;
+                entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMax);
+            }
+
+            for (AZ::Vector3& velocity : m_velocities)
+            {
+                velocity = (AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 2.0f - AZ::Vector3::CreateOne()) * 10.0f;
+            }
+
+            for (AZ::Frustum& frustum : m_frustums)
+            {
+                AZ::Vector3 frustumCenter = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * WorldSize;
+                AZ::Quaternion quaternion = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetNormalized(), unif(rng));
+                frustum = AZ::Frustum(AZ::ViewFrustumAttributes(
+                    AZ::Transform::CreateFromQuaternionAndTranslation(quaternion, frustumCenter), 1.0f,
+                    2.0f * atanf(0.5f), 0.1f, 1000.0f));
+            }
+
+            for (AzFramework::VisibilityEntry& entry : m_entries)
+            {
+                m_visibilityScene->InsertOrUpdateEntry(entry);
+            }
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            for (AzFramework::VisibilityEntry& entry : m_entries)
+            {
+                m_visibilityScene->RemoveEntry(entry);
+            }
+            delete m_visibilitySystemComponent;
+
+            m_entries.clear();
+            m_entries.shrink_to_fit();
+            m_velocities.clear();
+            m_velocities.shrink_to_fit();
+            m_frustums.clear();
+            m_frustums.shrink_to_fit();
+
+            if (m_ownsNameDictionary)
+            {
+                AZ::NameDictionary::Destroy();
+            }
+
+            // Destroy system allocator only if it was created by this environment
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+        //! Moves each dynamic entry one step, bouncing it off the edges of the world.
+        void MoveDynamicEntries()
+        {
+            for (uint32_t i = 0; i < DynamicEntryCount; ++i)
+            {
+                AzFramework::VisibilityEntry& entry = m_entries[StaticEntryCount + i];
+                AZ::Vector3& velocity = m_velocities[i];
+                const AZ::Vector3 center = entry.m_boundingVolume.GetCenter() + velocity;
+                const AZ::Vector3 outOfBounds = AZ::Vector3::CreateSelectCmpGreater(AZ::Vector3::CreateZero(), center, AZ::Vector3::CreateOne(), AZ::Vector3::CreateZero())
+                    + AZ::Vector3::CreateSelectCmpGreater(center, AZ::Vector3(WorldSize), AZ::Vector3::CreateOne(), AZ::Vector3::CreateZero());
+                velocity *= AZ::Vector3::CreateOne() - 2.0f * outOfBounds;
+                entry.m_boundingVolume.Translate(velocity);
+                m_visibilityScene->InsertOrUpdateEntry(entry);
+            }
+        }
+
+        //! Enumerates all the frustums, returning the number of visible entries so the work can't be optimized away.
+        size_t EnumerateFrustums() const
+        {
+            size_t visibleEntryCount = 0;
+            for (const AZ::Frustum& frustum : m_frustums)
+            {
+                m_visibilityScene->Enumerate(frustum, [&visibleEntryCount](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    visibleEntryCount += nodeData.m_entries.size();
+                });
+            }
+            return visibleEntryCount;
+        }
+
+        bool m_ownsSystemAllocator = false;
+        bool m_ownsNameDictionary = false;
+        AZStd::vector<AzFramework::VisibilityEntry> m_entries; //< Static entries first, followed by the dynamic entries.
+        AZStd::vector<AZ::Vector3> m_velocities;
+        AZStd::vector<AZ::Frustum> m_frustums;
+        VisibilitySystemComponent* m_visibilitySystemComponent = nullptr;
+        AzFramework::IVisibilityScene* m_visibilityScene = nullptr;
+    };
+
+    using BM_OctreeDynamicScene = BM_VisibilityDynamicScene<AzFramework::OctreeSystemComponent>;
+    using BM_LooseOctreeDynamicScene = BM_VisibilityDynamicScene<AzFramework::LooseOctreeSystemComponent>;
+
+    BENCHMARK_F(BM_OctreeDynamicScene, UpdateDynamicEntries)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            MoveDynamicEntries();
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctreeDynamicScene, UpdateDynamicEntries)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            MoveDynamicEntries();
+        }
+    }
+
+    BENCHMARK_F(BM_OctreeDynamicScene, EnumerateFrustum)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(EnumerateFrustums());
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctreeDynamicScene, EnumerateFrustum)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(EnumerateFrustums());
+        }
+    }
+
+    BENCHMARK_F(BM_OctreeDynamicScene, UpdateAndEnumerateFrustum)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            MoveDynamicEntries();
+            benchmark::DoNotOptimize(EnumerateFrustums());
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctreeDynamicScene, UpdateAndEnumerateFrustum)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            MoveDynamicEntries();
+            benchmark::DoNotOptimize(EnumerateFrustums());
+        }
+    }
 }
 
 #endif
@@ -30,6 +30,7 @@ set(FILES
     NetworkContext.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    LooseOctreeTests.cpp
     Slices.cpp
     Script.cpp
     AssetCatalog.cpp
@@ -12,4 +12,5 @@
 #pragma once
 
 #define ASSETPROCESSOR_TRAIT_LEGACY_RC_RELATIVE_PATH "/rc"
-#define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM true
\ No newline at end of file
+#define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM true
+#define ASSETPROCESSOR_TRAIT_NATIVE_DIRECTORY_SCAN 1
\ No newline at end of file
@@ -10,5 +10,6 @@
 #
 
 set(FILES
+    native/AssetManager/assetScannerWorker_linux.cpp
     native/FileWatcher/FileWatcher_linux.cpp
 )
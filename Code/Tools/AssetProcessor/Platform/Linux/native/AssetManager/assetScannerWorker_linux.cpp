@@ -0,0 +1,158 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include <native/AssetManager/assetScannerWorker.h>
+#include <QFile>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        // The record layout the kernel fills in for getdents64, which older glibc versions don't declare.
+        struct LinuxDirent64
+        {
+            AZ::u64 d_ino;
+            AZ::s64 d_off;
+            unsigned short d_reclen;
+            unsigned char d_type;
+            char d_name[1];
+        };
+
+        // Closes the folder's descriptor however ReadDirectory returns.
+        struct ScopedFileDescriptor
+        {
+            explicit ScopedFileDescriptor(int fileDescriptor)
+                : m_fileDescriptor(fileDescriptor)
+            {
+            }
+            ~ScopedFileDescriptor()
+            {
+                if (m_fileDescriptor >= 0)
+                {
+                    close(m_fileDescriptor);
+                }
+            }
+            int m_fileDescriptor;
+        };
+
+        // Reads the type, size, inode and modification time of a folder entry, following symlinks the way QFileInfo does.
+        bool StatEntry(int folderDescriptor, const char* name, bool& isDirectory, bool& isFile, AZ::u64& fileSize, AZ::u64& inode, AZ::s64& modTimeMS)
+        {
+#if defined(STATX_BASIC_STATS)
+            // statx lets us ask for only the fields we need and tells network file systems not to sync for them
+            struct statx statxBuffer;
+            if (statx(folderDescriptor, name, AT_STATX_DONT_SYNC, STATX_TYPE | STATX_SIZE | STATX_INO | STATX_MTIME, &statxBuffer) == 0)
+            {
+                isDirectory = S_ISDIR(statxBuffer.stx_mode);
+                isFile = S_ISREG(statxBuffer.stx_mode);
+                fileSize = statxBuffer.stx_size;
+                inode = statxBuffer.stx_ino;
+                modTimeMS = static_cast<AZ::s64>(statxBuffer.stx_mtime.tv_sec) * 1000 + statxBuffer.stx_mtime.tv_nsec / 1000000;
+                return true;
+            }
+            if (errno != ENOSYS)
+            {
+                return false;
+            }
+            // the kernel is older than the C library, fall through to fstatat
+#endif
+            struct stat statBuffer;
+            if (fstatat(folderDescriptor, name, &statBuffer, 0) != 0)
+            {
+                return false;
+            }
+            isDirectory = S_ISDIR(statBuffer.st_mode);
+            isFile = S_ISREG(statBuffer.st_mode);
+            fileSize = statBuffer.st_size;
+            inode = statBuffer.st_ino;
+            modTimeMS = static_cast<AZ::s64>(statBuffer.st_mtim.tv_sec) * 1000 + statBuffer.st_mtim.tv_nsec / 1000000;
+            return true;
+        }
+    }
+
+    // Reads the folder with getdents64 and statx relative to the folder's descriptor, which avoids the path
+    // resolution and the extra stat calls that QDir makes for every entry.
+    bool AssetScannerWorker::ReadDirectory(const QString& folderPath, bool includeSubFolders, AZStd::vector<DirectoryEntry>& entries)
+    {
+        const QByteArray encodedFolderPath = QFile::encodeName(folderPath);
+        ScopedFileDescriptor folder(open(encodedFolderPath.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+        if (folder.m_fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        const QString pathPrefix = folderPath.endsWith(QLatin1Char('/')) ? folderPath : folderPath + QLatin1Char('/');
+
+        alignas(LinuxDirent64) char buffer[32 * 1024];
+        for (;;)
+        {
+            const long bytesRead = syscall(SYS_getdents64, folder.m_fileDescriptor, buffer, sizeof(buffer));
+            if (bytesRead < 0)
+            {
+                return false;
+            }
+            if (bytesRead == 0)
+            {
+                return true;
+            }
+
+            for (long offset = 0; offset < bytesRead;)
+            {
+                const LinuxDirent64* record = reinterpret_cast<const LinuxDirent64*>(buffer + offset);
+                offset += record->d_reclen;
+
+                // QDir leaves out hidden entries, along with . and ..
+                const char* name = record->d_name;
+                if (name[0] == '.')
+                {
+                    continue;
+                }
+                // the type is free when the file system fills it in, so skip subfolders without a stat when they aren't wanted
+                if (!includeSubFolders && record->d_type == DT_DIR)
+                {
+                    continue;
+                }
+
+                bool isDirectory = false;
+                bool isFile = false;
+                AZ::u64 fileSize = 0;
+                AZ::u64 inode = 0;
+                AZ::s64 modTimeMS = 0;
+                if (!StatEntry(folder.m_fileDescriptor, name, isDirectory, isFile, fileSize, inode, modTimeMS))
+                {
+                    // deleted since the folder was read, or a broken symlink, neither of which QDir reports either
+                    continue;
+                }
+                if ((!isDirectory && !isFile) || (isDirectory && !includeSubFolders))
+                {
+                    continue;
+                }
+
+                DirectoryEntry entry;
+                entry.m_absolutePath = pathPrefix + QFile::decodeName(name);
+                entry.m_modTime = QDateTime::fromMSecsSinceEpoch(modTimeMS);
+                entry.m_fileSize = isDirectory ? 0 : fileSize;
+                entry.m_fileIdentifier = inode;
+                entry.m_isDirectory = isDirectory;
+                entries.push_back(AZStd::move(entry));
+            }
+        }
+    }
+} // end namespace AssetProcessor
@@ -12,4 +12,5 @@
 #pragma once
 
 #define ASSETPROCESSOR_TRAIT_LEGACY_RC_RELATIVE_PATH "/rc.exe"
-#define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM false
\ No newline at end of file
+#define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM false
+#define ASSETPROCESSOR_TRAIT_NATIVE_DIRECTORY_SCAN 0
\ No newline at end of file
@@ -80,6 +80,8 @@ set(FILES
     native/utilities/AssetBuilderInfo.h
     native/utilities/AssetServerHandler.cpp
     native/utilities/AssetServerHandler.h
+    native/utilities/LocalBuildCache.cpp
+    native/utilities/LocalBuildCache.h
     native/utilities/AssetUtilEBusHelper.h
     native/utilities/assetUtils.cpp
     native/utilities/assetUtils.h
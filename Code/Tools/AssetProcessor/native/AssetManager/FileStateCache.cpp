@@ -14,10 +14,18 @@
 #include "native/utilities/assetUtils.h"
 #include <AssetProcessor_Traits_Platform.h>
 
+#include <QDataStream>
 #include <QDir>
+#include <QSaveFile>
 
 namespace AssetProcessor
 {
+    namespace
+    {
+        // "APFJ", followed by the version which must be bumped whenever the layout of an entry changes
+        constexpr quint32 s_journalMagic = 0x4150464A;
+        constexpr quint32 s_journalVersion = 1;
+    }
 
     bool FileStateCache::GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const
     {
@@ -72,7 +80,14 @@ namespace AssetProcessor
         LockGuardType scopeLock(m_mapMutex);
         for (const AssetFileInfo& info : infoSet)
         {
-            m_fileInfoMap[PathToKey(info.m_filePath)] = FileStateInfo(info);
+            QString key = PathToKey(info.m_filePath);
+            FileStateInfo& fileInfo = m_fileInfoMap[key];
+            fileInfo = FileStateInfo(info);
+
+            if (!m_journalEntries.isEmpty())
+            {
+                ApplyJournalEntry(key, fileInfo);
+            }
         }
     }
 
@@ -129,14 +144,139 @@ namespace AssetProcessor
         InvalidateHash(absolutePath);
     }
 
+    bool FileStateCache::LoadJournal(const QString& journalPath)
+    {
+        QFile journalFile(journalPath);
+        if (!journalFile.open(QIODevice::ReadOnly))
+        {
+            // there is no journal on the first run
+            return false;
+        }
+
+        QDataStream stream(&journalFile);
+        stream.setVersion(QDataStream::Qt_5_0);
+
+        quint32 magic = 0;
+        quint32 version = 0;
+        quint64 entryCount = 0;
+        stream >> magic >> version >> entryCount;
+        if (stream.status() != QDataStream::Ok || magic != s_journalMagic || version != s_journalVersion)
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Ignoring file state journal %s, it was written by a different version.\n", journalPath.toUtf8().constData());
+            return false;
+        }
+
+        QHash<QString, JournalEntry> journalEntries;
+        for (quint64 entryIndex = 0; entryIndex < entryCount && stream.status() == QDataStream::Ok; ++entryIndex)
+        {
+            QString absolutePath;
+            JournalEntry entry;
+            quint64 fileIdentifier = 0;
+            quint64 fileSize = 0;
+            quint64 hash = 0;
+            stream >> absolutePath >> fileIdentifier >> fileSize >> entry.m_modTimeMS >> hash;
+            entry.m_fileIdentifier = fileIdentifier;
+            entry.m_fileSize = fileSize;
+            entry.m_hash = hash;
+            journalEntries.insert(PathToKey(absolutePath), entry);
+        }
+
+        if (stream.status() != QDataStream::Ok)
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "File state journal %s is truncated or corrupt, file hashes will be recomputed.", journalPath.toUtf8().constData());
+            return false;
+        }
+
+        LockGuardType scopeLock(m_mapMutex);
+        m_journalEntries = AZStd::move(journalEntries);
+
+        // anything the scanner already reported is validated now, the rest as it comes in
+        for (auto itr = m_fileInfoMap.begin(); itr != m_fileInfoMap.end() && !m_journalEntries.isEmpty(); ++itr)
+        {
+            ApplyJournalEntry(itr.key(), itr.value());
+        }
+
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Loaded %llu entries from the file state journal.\n", static_cast<unsigned long long>(entryCount));
+        return true;
+    }
+
+    bool FileStateCache::SaveJournal(const QString& journalPath) const
+    {
+        LockGuardType scopeLock(m_mapMutex);
+
+        // written to a temporary file first so a crash part way through leaves the previous journal in place
+        QSaveFile journalFile(journalPath);
+        if (!journalFile.open(QIODevice::WriteOnly))
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to write file state journal %s.", journalPath.toUtf8().constData());
+            return false;
+        }
+
+        // only the files whose hash is known are worth saving, the rest would be hashed next time regardless
+        quint64 entryCount = 0;
+        for (auto hashItr = m_fileHashMap.begin(); hashItr != m_fileHashMap.end(); ++hashItr)
+        {
+            entryCount += m_fileInfoMap.contains(hashItr.key()) ? 1 : 0;
+        }
+
+        QDataStream stream(&journalFile);
+        stream.setVersion(QDataStream::Qt_5_0);
+        stream << s_journalMagic << s_journalVersion << entryCount;
+
+        for (auto hashItr = m_fileHashMap.begin(); hashItr != m_fileHashMap.end(); ++hashItr)
+        {
+            auto fileInfoItr = m_fileInfoMap.find(hashItr.key());
+            if (fileInfoItr == m_fileInfoMap.end())
+            {
+                continue;
+            }
+
+            const FileStateInfo& fileInfo = fileInfoItr.value();
+            stream << fileInfo.m_absolutePath << quint64(fileInfo.m_fileIdentifier) << quint64(fileInfo.m_fileSize)
+                << fileInfo.m_modTime.toMSecsSinceEpoch() << quint64(hashItr.value());
+        }
+
+        if (stream.status() != QDataStream::Ok || !journalFile.commit())
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Unable to write file state journal %s.", journalPath.toUtf8().constData());
+            return false;
+        }
+        return true;
+    }
+
+    void FileStateCache::ApplyJournalEntry(const QString& key, const FileStateInfo& fileInfo)
+    {
+        auto journalItr = m_journalEntries.find(key);
+        if (journalItr == m_journalEntries.end())
+        {
+            return;
+        }
+
+        const JournalEntry& entry = journalItr.value();
+
+        // the file identifier catches files replaced by another with the same size and modtime, when both sides know it
+        const bool sameFileIdentifier = entry.m_fileIdentifier == 0 || fileInfo.m_fileIdentifier == 0 || entry.m_fileIdentifier == fileInfo.m_fileIdentifier;
+
+        if (!fileInfo.m_isDirectory && sameFileIdentifier && entry.m_fileSize == fileInfo.m_fileSize && entry.m_modTimeMS == fileInfo.m_modTime.toMSecsSinceEpoch())
+        {
+            m_fileHashMap[key] = entry.m_hash;
+        }
+
+        // either way the entry is used up, the file's state is known first hand from now on
+        m_journalEntries.erase(journalItr);
+    }
+
     void FileStateCache::InvalidateHash(const QString& absolutePath)
     {
-        auto fileHashItr = m_fileHashMap.find(PathToKey(absolutePath));
+        QString key = PathToKey(absolutePath);
+        auto fileHashItr = m_fileHashMap.find(key);
 
         if (fileHashItr != m_fileHashMap.end())
         {
             m_fileHashMap.erase(fileHashItr);
         }
+
+        m_journalEntries.remove(key);
     }
 
     //////////////////////////////////////////////////////////////////////////
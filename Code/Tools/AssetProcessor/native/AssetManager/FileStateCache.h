@@ -21,6 +21,9 @@
 
 namespace AssetProcessor
 {
+    //! Name of the file in the project cache that FileStateCache saves its file hashes to between runs
+    const char FileStateJournalFile[] = "filestatejournal.bin";
+
     struct FileStateInfo
     {
         FileStateInfo() = default;
@@ -29,6 +32,7 @@ namespace AssetProcessor
 
         explicit FileStateInfo(const AssetFileInfo& assetFileInfo)
             : m_absolutePath(assetFileInfo.m_filePath), m_fileSize(assetFileInfo.m_fileSize), m_isDirectory(assetFileInfo.m_isDirectory), m_modTime(assetFileInfo.m_modTime)
+            , m_fileIdentifier(assetFileInfo.m_fileIdentifier)
         {
 
         }
@@ -39,6 +43,7 @@ namespace AssetProcessor
         QDateTime m_modTime{};
         AZ::u64 m_fileSize{};
         bool m_isDirectory{};
+        AZ::u64 m_fileIdentifier{}; // the file system's id for the file (its inode) when known, 0 otherwise
     };
 
     struct IFileStateRequests
@@ -84,6 +89,12 @@ namespace AssetProcessor
 
         /// Removes a file from the cache
         virtual void RemoveFile(const QString& /*absolutePath*/) {}
+
+        /// Loads the file hashes saved by SaveJournal.  They're only trusted for files the scanner later reports unchanged
+        virtual bool LoadJournal(const QString& /*journalPath*/) { return false; }
+
+        /// Saves the hashes of the files in the cache along with what identifies their current contents
+        virtual bool SaveJournal(const QString& /*journalPath*/) const { return false; }
     };
 
     /// Caches file state information retrieved by the file scanner and file watcher
@@ -104,8 +115,23 @@ namespace AssetProcessor
         void UpdateFile(const QString& absolutePath) override;
         void RemoveFile(const QString& absolutePath) override;
 
+        bool LoadJournal(const QString& journalPath) override;
+        bool SaveJournal(const QString& journalPath) const override;
+
     private:
 
+        /// What the journal recorded about a file when its hash was saved
+        struct JournalEntry
+        {
+            AZ::u64 m_fileIdentifier = 0;
+            AZ::u64 m_fileSize = 0;
+            qint64 m_modTimeMS = 0;
+            FileHash m_hash = 0;
+        };
+
+        /// Moves the journal's hash for the file into the hash map if the file is unchanged since the journal was saved
+        void ApplyJournalEntry(const QString& key, const FileStateInfo& fileInfo);
+
         /// Invalidates the hash for a file so it will be re-computed next time it's requested
         void InvalidateHash(const QString& absolutePath);
 
@@ -123,6 +149,9 @@ namespace AssetProcessor
         
         QHash<QString, FileHash> m_fileHashMap;
 
+        /// Entries loaded from the journal which the scanner hasn't reported yet
+        QHash<QString, JournalEntry> m_journalEntries;
+
         using LockGuardType = AZStd::lock_guard<decltype(m_mapMutex)>;
     };
 
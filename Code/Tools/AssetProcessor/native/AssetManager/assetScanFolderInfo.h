@@ -123,8 +123,8 @@ namespace AssetProcessor
     struct AssetFileInfo
     {
         AssetFileInfo() = default;
-        AssetFileInfo(QString filePath, QDateTime modTime, AZ::u64 fileSize, const ScanFolderInfo* scanFolder, bool isDirectory)
-            : m_filePath(filePath), m_modTime(modTime), m_fileSize(fileSize), m_scanFolder(scanFolder), m_isDirectory(isDirectory) {}
+        AssetFileInfo(QString filePath, QDateTime modTime, AZ::u64 fileSize, const ScanFolderInfo* scanFolder, bool isDirectory, AZ::u64 fileIdentifier = 0)
+            : m_filePath(filePath), m_modTime(modTime), m_fileSize(fileSize), m_scanFolder(scanFolder), m_isDirectory(isDirectory), m_fileIdentifier(fileIdentifier) {}
 
         bool operator==(const AssetFileInfo& rhs) const
         {
@@ -140,6 +140,7 @@ namespace AssetProcessor
         AZ::u64 m_fileSize{};
         const ScanFolderInfo* m_scanFolder{};
         bool m_isDirectory{};
+        AZ::u64 m_fileIdentifier{}; // the file system's id for the file (its inode) when the scanner could read it, 0 otherwise
     };
 
     inline uint qHash(const AssetFileInfo& item)
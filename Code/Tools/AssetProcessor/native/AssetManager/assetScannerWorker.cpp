@@ -12,7 +12,11 @@
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AssetProcessor_Traits_Platform.h>
 #include <QDir>
+#include <QElapsedTimer>
 
 using namespace AssetProcessor;
 
@@ -29,6 +33,9 @@ void AssetScannerWorker::StartScan()
 
     m_fileList.clear();
     m_folderList.clear();
+    m_excludedList.clear();
+    m_scannedFileCount = 0;
+    m_scannedFolderCount = 0;
     m_doScan = true;
 
     AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Scanning file system for changes...\n");
@@ -36,20 +43,54 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
+    QElapsedTimer scanTimer;
+    scanTimer.start();
+
+    const unsigned int threadCount = AZStd::clamp(AZStd::thread::hardware_concurrency(), 1u, s_maxScanThreads);
+    m_threadQueues.clear();
+    for (unsigned int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        m_threadQueues.emplace_back(AZStd::make_unique<ScanThreadQueue>());
+    }
+
+    // deal the scan folders out to the scan threads, they'll balance the subfolders between themselves as they go
+    m_pendingFolderCount = 0;
     for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
     {
         const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        AddFolder(idx % threadCount, PendingFolder{ QDir(scanFolderInfo.ScanPath()).absolutePath(), &scanFolderInfo, scanFolderInfo.RecurseSubFolders() });
+    }
+
+    AZStd::thread_desc threadDesc;
+    threadDesc.m_name = "AssetScanner";
+    AZStd::vector<AZStd::thread> scanThreads;
+    scanThreads.reserve(threadCount);
+    for (unsigned int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        scanThreads.emplace_back([this, threadIndex]() { RunScanThread(threadIndex); }, &threadDesc);
+    }
+
+    // the processor can start working through the first files while the rest of the tree is still being read
+    while (m_pendingFolderCount > 0 && m_doScan)
+    {
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(s_emitIntervalMS));
+        if (m_doScan)
+        {
+            EmitFiles();
+        }
     }
 
-    // we want not to emit any signals until we're finished scanning
-    // so that we don't interleave directory tree walking (IO access to the file table)
-    // with file access (IO access to file data) caused by sending signals to other classes.
+    for (AZStd::thread& scanThread : scanThreads)
+    {
+        scanThread.join();
+    }
+    m_threadQueues.clear();
 
     if (!m_doScan)
     {
         m_fileList.clear();
         m_folderList.clear();
+        m_excludedList.clear();
         Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Stopped);
         return;
     }
@@ -58,7 +99,9 @@ void AssetScannerWorker::StartScan()
         EmitFiles();
     }
 
-    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "File system scan done.\n");
+    const double scanSeconds = AZStd::GetMax(static_cast<double>(scanTimer.elapsed()) / 1000.0, 0.001);
+    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "File system scan done.  Found %lld files in %lld folders in %.2f seconds (%.0f files/sec) using %u threads.\n",
+        static_cast<long long>(m_scannedFileCount), static_cast<long long>(m_scannedFolderCount), scanSeconds, static_cast<double>(m_scannedFileCount) / scanSeconds, threadCount);
 
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Completed);
 }
@@ -71,72 +114,177 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::RunScanThread(size_t threadIndex)
 {
-    if (!m_doScan)
+    AZStd::vector<DirectoryEntry> entries;
+    ScanResults results;
+
+    while (m_doScan)
     {
-        return;
+        PendingFolder folder;
+        if (!TakeFolder(threadIndex, folder))
+        {
+            if (m_pendingFolderCount == 0)
+            {
+                break;
+            }
+            // the other threads are still reading folders which may have subfolders to share
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            continue;
+        }
+
+        ScanFolder(threadIndex, folder, entries, results);
+
+        // only retire the folder after its subfolders were queued, so the count can't reach zero early
+        --m_pendingFolderCount;
     }
 
-    QDir dir(scanFolderInfo.ScanPath());
+    SubmitResults(results);
+}
 
-    QFileInfoList entries;
+bool AssetScannerWorker::TakeFolder(size_t threadIndex, PendingFolder& folder)
+{
+    {
+        ScanThreadQueue& ownQueue = *m_threadQueues[threadIndex];
+        AZStd::lock_guard<AZStd::mutex> lock(ownQueue.m_mutex);
+        if (!ownQueue.m_folders.empty())
+        {
+            // newest first, so each thread walks its own part of the tree depth first
+            folder = AZStd::move(ownQueue.m_folders.back());
+            ownQueue.m_folders.pop_back();
+            return true;
+        }
+    }
 
-    //Only scan sub folders if recurseSubFolders flag is set
-    if (!scanFolderInfo.RecurseSubFolders())
+    for (size_t offset = 1; offset < m_threadQueues.size(); ++offset)
     {
-        entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
+        ScanThreadQueue& otherQueue = *m_threadQueues[(threadIndex + offset) % m_threadQueues.size()];
+        AZStd::lock_guard<AZStd::mutex> lock(otherQueue.m_mutex);
+        if (!otherQueue.m_folders.empty())
+        {
+            // steal the oldest folder, it's the one closest to the root and so likely to hold the most work
+            folder = AZStd::move(otherQueue.m_folders.front());
+            otherQueue.m_folders.pop_front();
+            return true;
+        }
     }
-    else
+
+    return false;
+}
+
+void AssetScannerWorker::AddFolder(size_t threadIndex, PendingFolder folder)
+{
+    ++m_pendingFolderCount;
+    ScanThreadQueue& queue = *m_threadQueues[threadIndex];
+    AZStd::lock_guard<AZStd::mutex> lock(queue.m_mutex);
+    queue.m_folders.push_back(AZStd::move(folder));
+}
+
+void AssetScannerWorker::ScanFolder(size_t threadIndex, const PendingFolder& folder, AZStd::vector<DirectoryEntry>& entries, ScanResults& results)
+{
+    entries.clear();
+    //Only scan sub folders if recurseSubFolders flag is set
+    if (!ReadDirectory(folder.m_path, folder.m_recurseSubFolders, entries))
     {
-        entries = dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files);
+        return;
     }
 
-    for (const QFileInfo& entry : entries)
+    for (DirectoryEntry& entry : entries)
     {
         if (!m_doScan) // scan was cancelled!
         {
             return;
         }
 
-        QString absPath = entry.absoluteFilePath();
-        const bool isDirectory = entry.isDir();
-        QDateTime modTime = entry.lastModified();
-        AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
+        AssetFileInfo assetFileInfo(entry.m_absolutePath, entry.m_modTime, entry.m_isDirectory ? 0 : entry.m_fileSize, folder.m_rootScanFolder, entry.m_isDirectory, entry.m_fileIdentifier);
 
         // Filtering out excluded files
-        if (m_platformConfiguration->IsFileExcluded(absPath))
+        if (m_platformConfiguration->IsFileExcluded(entry.m_absolutePath))
         {
-            m_excludedList.insert(AZStd::move(assetFileInfo));
-            continue;
+            results.m_excluded.insert(AZStd::move(assetFileInfo));
         }
-
-        if (isDirectory)
+        else if (entry.m_isDirectory)
         {
             //Entry is a directory
-            m_folderList.insert(AZStd::move(assetFileInfo));
-            ScanFolderInfo tempScanFolderInfo(absPath, "", "", "", false, true);
-            ScanForSourceFiles(tempScanFolderInfo, rootScanFolder);
+            results.m_folders.insert(AZStd::move(assetFileInfo));
+            ++m_scannedFolderCount;
+            AddFolder(threadIndex, PendingFolder{ AZStd::move(entry.m_absolutePath), folder.m_rootScanFolder, true });
         }
         else
         {
             //Entry is a file
-            m_fileList.insert(AZStd::move(assetFileInfo));
+            results.m_files.insert(AZStd::move(assetFileInfo));
+            ++m_scannedFileCount;
         }
     }
+
+    if (results.m_files.size() + results.m_folders.size() + results.m_excluded.size() >= s_resultBatchSize)
+    {
+        SubmitResults(results);
+    }
+}
+
+void AssetScannerWorker::SubmitResults(ScanResults& results)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_resultsMutex);
+    m_fileList.unite(results.m_files);
+    m_folderList.unite(results.m_folders);
+    m_excludedList.unite(results.m_excluded);
+    results.m_files.clear();
+    results.m_folders.clear();
+    results.m_excluded.clear();
 }
 
 void AssetScannerWorker::EmitFiles()
 {
+    QSet<AssetFileInfo> fileList;
+    QSet<AssetFileInfo> folderList;
+    QSet<AssetFileInfo> excludedList;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_resultsMutex);
+        fileList.swap(m_fileList);
+        folderList.swap(m_folderList);
+        excludedList.swap(m_excludedList);
+    }
+
     //Loop over all source asset files and send them up the chain:
-    Q_EMIT FilesFound(m_fileList);
-    m_fileList.clear();
-    Q_EMIT FoldersFound(m_folderList);
-    m_folderList.clear();
-    Q_EMIT ExcludedFound(m_excludedList);
-    m_excludedList.clear();
-    
+    if (!fileList.isEmpty())
+    {
+        Q_EMIT FilesFound(fileList);
+    }
+    if (!folderList.isEmpty())
+    {
+        Q_EMIT FoldersFound(folderList);
+    }
+    if (!excludedList.isEmpty())
+    {
+        Q_EMIT ExcludedFound(excludedList);
+    }
 }
 
+#if !ASSETPROCESSOR_TRAIT_NATIVE_DIRECTORY_SCAN
+bool AssetScannerWorker::ReadDirectory(const QString& folderPath, bool includeSubFolders, AZStd::vector<DirectoryEntry>& entries)
+{
+    QDir dir(folderPath);
+    if (!dir.exists())
+    {
+        return false;
+    }
+
+    const QFileInfoList fileInfos = includeSubFolders
+        ? dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot | QDir::Files)
+        : dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
 
+    entries.reserve(entries.size() + fileInfos.size());
+    for (const QFileInfo& fileInfo : fileInfos)
+    {
+        DirectoryEntry entry;
+        entry.m_absolutePath = fileInfo.absoluteFilePath();
+        entry.m_modTime = fileInfo.lastModified();
+        entry.m_isDirectory = fileInfo.isDir();
+        entry.m_fileSize = entry.m_isDirectory ? 0 : fileInfo.size();
+        entries.push_back(AZStd::move(entry));
+    }
+    return true;
+}
+#endif // !ASSETPROCESSOR_TRAIT_NATIVE_DIRECTORY_SCAN
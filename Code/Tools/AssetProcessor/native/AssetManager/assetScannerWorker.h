@@ -15,6 +15,12 @@
 #if !defined(Q_MOC_RUN)
 #include "native/assetprocessor.h"
 #include "assetScanFolderInfo.h"
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <QDateTime>
 #include <QString>
 #include <QSet>
 #include <QObject>
@@ -28,6 +34,8 @@ namespace AssetProcessor
      * and finding file of interest files.
      * Its created on the main thread and then moved to the worker thread
      * so it should contain no QObject-based classes at construction time (it can make them later)
+     * The folders are read by a pool of scan threads which steal subfolders from each other,
+     * and what they find is emitted in batches from the worker thread while the scan is still running.
      */
     class AssetScannerWorker
         : public QObject
@@ -47,13 +55,64 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        //! A file or folder read from disk by ReadDirectory.
+        struct DirectoryEntry
+        {
+            QString m_absolutePath;
+            QDateTime m_modTime;
+            AZ::u64 m_fileSize = 0;
+            AZ::u64 m_fileIdentifier = 0; // 0 when the platform reader doesn't provide one
+            bool m_isDirectory = false;
+        };
+
+        //! A folder waiting to be read by one of the scan threads.
+        struct PendingFolder
+        {
+            QString m_path;
+            const ScanFolderInfo* m_rootScanFolder = nullptr; // the actual scan folder we started with, which is either this folder or a parent of it
+            bool m_recurseSubFolders = true;
+        };
+
+        //! The folders owned by one scan thread. The owner takes from the back and the other threads steal from the front.
+        struct ScanThreadQueue
+        {
+            AZStd::mutex m_mutex;
+            AZStd::deque<PendingFolder> m_folders;
+        };
+
+        //! What a scan thread found since it last handed its results over.
+        struct ScanResults
+        {
+            QSet<AssetFileInfo> m_files;
+            QSet<AssetFileInfo> m_folders;
+            QSet<AssetFileInfo> m_excluded;
+        };
+
+        //! Reads the non-hidden files, and the subfolders when includeSubFolders is set, of a single folder.
+        //! This has a native implementation per platform where one is available and falls back to QDir otherwise.
+        static bool ReadDirectory(const QString& folderPath, bool includeSubFolders, AZStd::vector<DirectoryEntry>& entries);
+
+        void RunScanThread(size_t threadIndex);
+        bool TakeFolder(size_t threadIndex, PendingFolder& folder);
+        void AddFolder(size_t threadIndex, PendingFolder folder);
+        void ScanFolder(size_t threadIndex, const PendingFolder& folder, AZStd::vector<DirectoryEntry>& entries, ScanResults& results);
+        void SubmitResults(ScanResults& results);
         void EmitFiles();
 
     private:
-        volatile bool m_doScan = true;
+        //! Number of files and folders a scan thread collects before handing them to the worker thread.
+        static constexpr int s_resultBatchSize = 4096;
+        //! How often the worker thread emits what the scan threads have found so far.
+        static constexpr int s_emitIntervalMS = 250;
+        static constexpr unsigned int s_maxScanThreads = 16;
+
+        AZStd::atomic_bool m_doScan{ true };
+        AZStd::vector<AZStd::unique_ptr<ScanThreadQueue>> m_threadQueues;
+        AZStd::atomic<AZ::s64> m_pendingFolderCount{ 0 }; // folders queued or being read; the scan is done once this reaches zero
+        AZStd::atomic<AZ::s64> m_scannedFileCount{ 0 };
+        AZStd::atomic<AZ::s64> m_scannedFolderCount{ 0 };
+
+        AZStd::mutex m_resultsMutex; // guards the three lists below, which the scan threads fill and the worker thread emits
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
@@ -520,7 +520,19 @@ namespace AssetProcessor
                 if (!JobCancelListener.IsCancelled())
                 {
                     bool runProcessJob = true;
-                    if (m_jobDetails.m_checkServer)
+                    bool retrievedFromLocalBuildCache = false;
+                    if (!AssetUtilities::InServerMode())
+                    {
+                        // a local hit is cheaper than going to the server, so the local build cache is checked first
+                        AssetProcessor::LocalBuildCacheBus::BroadcastResult(retrievedFromLocalBuildCache, &AssetProcessor::LocalBuildCacheBusTraits::RetrieveJobResult, builderParams);
+                        if (retrievedFromLocalBuildCache)
+                        {
+                            retrievedFromLocalBuildCache = AfterRetrievingJobResult(builderParams, jobLogTraceListener, result);
+                        }
+                        runProcessJob = !retrievedFromLocalBuildCache;
+                    }
+
+                    if (runProcessJob && m_jobDetails.m_checkServer)
                     {
                         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
                         builderParams.m_serverKey = QString("%1_%2_%3_%4").arg(fileInfo.completeBaseName(), builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(), builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str()).arg(builderParams.m_rcJob->GetOriginalFingerprint());
@@ -577,6 +589,23 @@ namespace AssetProcessor
                         // sending process job command to the builder
                         builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
                     }
+
+                    if (!retrievedFromLocalBuildCache && result.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success && AssetProcessor::LocalBuildCacheBus::HasHandlers())
+                    {
+                        bool operationResult = false;
+                        auto beforeStoreResult = BeforeStoringJobResult(builderParams, result);
+                        if (beforeStoreResult.IsSuccess())
+                        {
+                            AssetProcessor::LocalBuildCacheBus::BroadcastResult(operationResult, &AssetProcessor::LocalBuildCacheBusTraits::StoreJobResult, builderParams, beforeStoreResult.GetValue());
+                        }
+
+                        if (!operationResult)
+                        {
+                            AZ_TracePrintf(AssetProcessor::DebugChannel, "Unable to save job (%s, %s, %s) with fingerprint (%u) to the local build cache.\n",
+                                builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+                        }
+                    }
                 }
             }
 
@@ -25,6 +25,7 @@ namespace UnitTests
     void FileStateCacheTests::TearDown()
     {
         m_fileStateCache = nullptr;
+        AssetUtilities::SetUseFileHashOverride(false, false);
     }
 
     void FileStateCacheTests::CheckForFile(QString path, bool shouldExist)
@@ -168,4 +169,66 @@ namespace UnitTests
         CheckForFile(R"(c:\some\test\file.txt)", true);
         CheckForFile(R"(c:/some/test/file.txt)", true);
     }
+
+    TEST_F(FileStateCacheTests, JournalForUnchangedFile_ReusesHashWithoutReadingFile)
+    {
+        AssetUtilities::SetUseFileHashOverride(true, true);
+
+        QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
+        QString journalPath = m_temporarySourceDir.absoluteFilePath(FileStateJournalFile);
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "journal test contents"));
+
+        QSet<AssetFileInfo> infoSet;
+        QFileInfo testFileInfo(testPath);
+        infoSet.insert(AssetFileInfo(testPath, testFileInfo.lastModified(), testFileInfo.size(), nullptr, false));
+        m_fileStateCache->AddInfoSet(infoSet);
+
+        IFileStateRequests::FileHash originalHash = 0;
+        ASSERT_TRUE(m_fileStateCache->GetHash(testPath, &originalHash));
+        ASSERT_NE(originalHash, 0);
+        ASSERT_TRUE(m_fileStateCache->SaveJournal(journalPath));
+
+        // the file is gone, so the only way to get the hash back is from the journal
+        ASSERT_TRUE(QFile::remove(testPath));
+
+        m_fileStateCache = nullptr;
+        m_fileStateCache = AZStd::make_unique<FileStateCache>();
+        ASSERT_TRUE(m_fileStateCache->LoadJournal(journalPath));
+        m_fileStateCache->AddInfoSet(infoSet);
+
+        IFileStateRequests::FileHash journalHash = 0;
+        ASSERT_TRUE(m_fileStateCache->GetHash(testPath, &journalHash));
+        EXPECT_EQ(journalHash, originalHash);
+    }
+
+    TEST_F(FileStateCacheTests, JournalForChangedFile_RecomputesHash)
+    {
+        AssetUtilities::SetUseFileHashOverride(true, true);
+
+        QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
+        QString journalPath = m_temporarySourceDir.absoluteFilePath(FileStateJournalFile);
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "journal test contents"));
+
+        m_fileStateCache->AddFile(testPath);
+
+        IFileStateRequests::FileHash originalHash = 0;
+        ASSERT_TRUE(m_fileStateCache->GetHash(testPath, &originalHash));
+        ASSERT_TRUE(m_fileStateCache->SaveJournal(journalPath));
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "journal test contents which have changed"));
+
+        m_fileStateCache = nullptr;
+        m_fileStateCache = AZStd::make_unique<FileStateCache>();
+        ASSERT_TRUE(m_fileStateCache->LoadJournal(journalPath));
+
+        QSet<AssetFileInfo> infoSet;
+        QFileInfo testFileInfo(testPath);
+        infoSet.insert(AssetFileInfo(testPath, testFileInfo.lastModified(), testFileInfo.size(), nullptr, false));
+        m_fileStateCache->AddInfoSet(infoSet);
+
+        IFileStateRequests::FileHash newHash = 0;
+        ASSERT_TRUE(m_fileStateCache->GetHash(testPath, &newHash));
+        EXPECT_NE(newHash, originalHash);
+        EXPECT_EQ(newHash, AssetUtilities::GetFileHash(testPath.toUtf8().constData(), true));
+    }
 }
@@ -158,4 +158,39 @@ namespace AssetProcessor
         EXPECT_FALSE(m_files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
         EXPECT_EQ(m_folders.size(), 0);
     }
+
+    TEST_F(AssetScannerTest, AssetScannerFindsAllFilesInManyFoldersTest)
+    {
+        using namespace UnitTestUtils;
+        QDir tempDir(m_tempDir.path());
+
+        // enough folders and files for the scan threads to share the tree and to emit more than one batch
+        QSet<QString> expectedFiles;
+        QSet<QString> expectedFolders;
+        for (int folderIndex = 0; folderIndex < 64; ++folderIndex)
+        {
+            QString folderPath = tempDir.filePath(QString("subfolder1/folder%1").arg(folderIndex));
+            QString nestedFolderPath = folderPath + "/nested";
+            expectedFolders << folderPath << nestedFolderPath;
+            for (int fileIndex = 0; fileIndex < 40; ++fileIndex)
+            {
+                expectedFiles << QString("%1/file%2.txt").arg(folderPath).arg(fileIndex);
+                expectedFiles << QString("%1/file%2.txt").arg(nestedFolderPath).arg(fileIndex);
+            }
+        }
+        for (const QString& expect : expectedFiles)
+        {
+            ASSERT_TRUE(CreateDummyFile(expect));
+        }
+
+        m_assetScanner.get()->StartScan();
+
+        ASSERT_TRUE(BlockUntilScanComplete(30000));
+
+        // the 4 files made by SetUp are found as well
+        EXPECT_EQ(m_files.size(), expectedFiles.size() + 4);
+        EXPECT_TRUE(m_files.contains(expectedFiles));
+        EXPECT_TRUE(m_folders.contains(expectedFolders));
+        EXPECT_TRUE(m_folders.contains(tempDir.filePath("subfolder2/aaa")));
+    }
 }
@@ -0,0 +1,164 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include "native/tests/AssetProcessorTest.h"
+#include "native/unittests/UnitTestRunner.h"
+#include <native/utilities/LocalBuildCache.h>
+
+#include <AzCore/std/parallel/thread.h>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class LocalBuildCacheTest
+        : public AssetProcessorTest
+    {
+    public:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            ASSERT_TRUE(m_tempDir.isValid());
+            m_storeFolder = QDir(m_tempDir.path()).absoluteFilePath("store");
+        }
+
+        //! Makes a folder holding the given files, each containing its own name and the given contents
+        QString CreateJobFolder(const QString& folderName, const QStringList& fileNames, const QString& contents)
+        {
+            QDir jobDir(QDir(m_tempDir.path()).absoluteFilePath(folderName));
+            for (const QString& fileName : fileNames)
+            {
+                EXPECT_TRUE(UnitTestUtils::CreateDummyFile(jobDir.absoluteFilePath(fileName), fileName + contents));
+            }
+            return jobDir.absolutePath();
+        }
+
+        static QString ReadFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                return QString();
+            }
+            return QString::fromUtf8(file.readAll());
+        }
+
+        static QString MakeKey(AZ::u32 fingerprint)
+        {
+            return LocalBuildCache::ComputeCacheKey(AZ::Uuid("{52F0D4A9-86D6-4A43-8A1C-3E6F1D0C2B6A}"), 1, "pc", "Compile Stuff", "subfolder/test.txt", fingerprint);
+        }
+
+        QTemporaryDir m_tempDir;
+        QString m_storeFolder;
+    };
+
+    TEST_F(LocalBuildCacheTest, ComputeCacheKey_SameInputs_SameKey)
+    {
+        EXPECT_EQ(MakeKey(1234), MakeKey(1234));
+        EXPECT_EQ(MakeKey(1234).length(), 40);
+    }
+
+    TEST_F(LocalBuildCacheTest, ComputeCacheKey_DifferentInputs_DifferentKey)
+    {
+        const AZ::Uuid builderId("{52F0D4A9-86D6-4A43-8A1C-3E6F1D0C2B6A}");
+        const QString key = MakeKey(1234);
+
+        EXPECT_NE(key, MakeKey(1235));
+        EXPECT_NE(key, LocalBuildCache::ComputeCacheKey(builderId, 2, "pc", "Compile Stuff", "subfolder/test.txt", 1234));
+        EXPECT_NE(key, LocalBuildCache::ComputeCacheKey(builderId, 1, "android", "Compile Stuff", "subfolder/test.txt", 1234));
+        EXPECT_NE(key, LocalBuildCache::ComputeCacheKey(builderId, 1, "pc", "Compile Other Stuff", "subfolder/test.txt", 1234));
+        EXPECT_NE(key, LocalBuildCache::ComputeCacheKey(builderId, 1, "pc", "Compile Stuff", "subfolder/test2.txt", 1234));
+        EXPECT_NE(key, LocalBuildCache::ComputeCacheKey(AZ::Uuid::CreateRandom(), 1, "pc", "Compile Stuff", "subfolder/test.txt", 1234));
+    }
+
+    TEST_F(LocalBuildCacheTest, StoreAndRetrieve_RestoresAllFiles)
+    {
+        LocalBuildCache localBuildCache(m_storeFolder, 1024 * 1024);
+
+        const QString jobFolder = CreateJobFolder("job", { "product.bin", "subfolder/product2.bin" }, "_job");
+        const QString sourceFolder = CreateJobFolder("source", { "copied.txt" }, "_source");
+        const QString key = MakeKey(1);
+
+        ASSERT_TRUE(localBuildCache.Store(key, jobFolder, sourceFolder, { "copied.txt" }));
+        EXPECT_TRUE(localBuildCache.Contains(key));
+        EXPECT_GT(localBuildCache.GetTotalSize(), 0u);
+
+        const QString retrieveFolder = QDir(m_tempDir.path()).absoluteFilePath("retrieved");
+        ASSERT_TRUE(localBuildCache.Retrieve(key, retrieveFolder));
+
+        QDir retrieveDir(retrieveFolder);
+        EXPECT_EQ(ReadFile(retrieveDir.absoluteFilePath("product.bin")), QString("product.bin_job"));
+        EXPECT_EQ(ReadFile(retrieveDir.absoluteFilePath("subfolder/product2.bin")), QString("subfolder/product2.bin_job"));
+        EXPECT_EQ(ReadFile(retrieveDir.absoluteFilePath("copied.txt")), QString("copied.txt_source"));
+    }
+
+    TEST_F(LocalBuildCacheTest, Retrieve_MissingKey_Fails)
+    {
+        LocalBuildCache localBuildCache(m_storeFolder, 1024 * 1024);
+
+        const QString retrieveFolder = QDir(m_tempDir.path()).absoluteFilePath("retrieved");
+        EXPECT_FALSE(localBuildCache.Retrieve(MakeKey(1), retrieveFolder));
+        EXPECT_FALSE(QDir(retrieveFolder).exists());
+    }
+
+    TEST_F(LocalBuildCacheTest, Store_OverSizeLimit_EvictsLeastRecentlyUsed)
+    {
+        // each job is 32 bytes, so the store holds two of them
+        const QString contents(21, 'x');
+        const QString jobFolderA = CreateJobFolder("jobA", { "product.bin" }, contents);
+        const QString jobFolderB = CreateJobFolder("jobB", { "product.bin" }, contents);
+        const QString jobFolderC = CreateJobFolder("jobC", { "product.bin" }, contents);
+        LocalBuildCache localBuildCache(m_storeFolder, 80);
+
+        ASSERT_TRUE(localBuildCache.Store(MakeKey(1), jobFolderA, jobFolderA, {}));
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+        ASSERT_TRUE(localBuildCache.Store(MakeKey(2), jobFolderB, jobFolderB, {}));
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+
+        // using A makes B the least recently used
+        ASSERT_TRUE(localBuildCache.Retrieve(MakeKey(1), QDir(m_tempDir.path()).absoluteFilePath("retrieved")));
+        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
+
+        ASSERT_TRUE(localBuildCache.Store(MakeKey(3), jobFolderC, jobFolderC, {}));
+
+        EXPECT_TRUE(localBuildCache.Contains(MakeKey(1)));
+        EXPECT_FALSE(localBuildCache.Contains(MakeKey(2)));
+        EXPECT_TRUE(localBuildCache.Contains(MakeKey(3)));
+        EXPECT_EQ(localBuildCache.GetTotalSize(), 64u);
+    }
+
+    TEST_F(LocalBuildCacheTest, Construct_ExistingStore_LoadsEntries)
+    {
+        const QString jobFolder = CreateJobFolder("job", { "product.bin" }, "_job");
+        AZ::u64 totalSize = 0;
+        {
+            LocalBuildCache localBuildCache(m_storeFolder, 1024 * 1024);
+            ASSERT_TRUE(localBuildCache.Store(MakeKey(1), jobFolder, jobFolder, {}));
+            totalSize = localBuildCache.GetTotalSize();
+        }
+
+        // a store left half written by a crash is cleaned up rather than loaded
+        const QString key = MakeKey(2);
+        const QString stagingFolder = QString("%1/%2/%3.1234.staging").arg(m_storeFolder, key.left(2), key);
+        ASSERT_TRUE(QDir().mkpath(stagingFolder));
+
+        LocalBuildCache localBuildCache(m_storeFolder, 1024 * 1024);
+        EXPECT_TRUE(localBuildCache.Contains(MakeKey(1)));
+        EXPECT_FALSE(localBuildCache.Contains(key));
+        EXPECT_EQ(localBuildCache.GetTotalSize(), totalSize);
+        EXPECT_FALSE(QDir(stagingFolder).exists());
+
+        const QString retrieveFolder = QDir(m_tempDir.path()).absoluteFilePath("retrieved");
+        ASSERT_TRUE(localBuildCache.Retrieve(MakeKey(1), retrieveFolder));
+        EXPECT_EQ(ReadFile(QDir(retrieveFolder).absoluteFilePath("product.bin")), QString("product.bin_job"));
+    }
+} // namespace AssetProcessor
@@ -25,6 +25,7 @@
 #include <native/FileProcessor/FileProcessor.h>
 #include <native/utilities/ApplicationServer.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/LocalBuildCache.h>
 #include <native/InternalBuilders/SettingsRegistryBuilder.h>
 #include <AzToolsFramework/Application/Ticker.h>
 #include <AzToolsFramework/ToolsFileUtils/ToolsFileUtils.h>
@@ -673,6 +674,22 @@ void ApplicationManagerBase::InitFileStateCache()
     }
 
     m_fileStateCache = AZStd::make_unique<AssetProcessor::FileStateCache>();
+
+    // hashes saved by the last run are reused for the files the scanner finds unchanged, instead of reading them again
+    QDir cacheRoot;
+    if (AssetUtilities::ComputeProjectCacheRoot(cacheRoot))
+    {
+        m_fileStateCache->LoadJournal(cacheRoot.absoluteFilePath(AssetProcessor::FileStateJournalFile));
+    }
+}
+
+void ApplicationManagerBase::ShutDownFileStateCache()
+{
+    QDir cacheRoot;
+    if (m_fileStateCache && AssetUtilities::ComputeProjectCacheRoot(cacheRoot))
+    {
+        m_fileStateCache->SaveJournal(cacheRoot.absoluteFilePath(AssetProcessor::FileStateJournalFile));
+    }
 }
 
 ApplicationManager::BeforeRunStatus ApplicationManagerBase::BeforeRun()
@@ -751,10 +768,12 @@ void ApplicationManagerBase::Destroy()
 
     DestroyControlRequestHandler();
     DestroyConnectionManager();
+    DestroyLocalBuildCache();
     DestroyAssetServerHandler();
     DestroyRCController();
     DestroyAssetScanner();
     DestroyFileMonitor();
+    ShutDownFileStateCache();
     ShutDownAssetDatabase();
     DestroyPlatformConfiguration();
     DestroyApplicationServer();
@@ -1170,6 +1189,48 @@ void ApplicationManagerBase::DestroyAssetServerHandler()
     m_assetServerHandler = nullptr;
 }
 
+void ApplicationManagerBase::InitLocalBuildCache()
+{
+    const AzFramework::CommandLine* commandLine = nullptr;
+    AzFramework::ApplicationRequests::Bus::BroadcastResult(commandLine, &AzFramework::ApplicationRequests::GetCommandLine);
+
+    // the local build cache is opt in, by passing the folder to keep it in, eg --localBuildCache=D:/APBuildCache
+    if (!commandLine || !commandLine->HasSwitch("localBuildCache"))
+    {
+        return;
+    }
+
+    QString storeFolder = commandLine->GetSwitchValue("localBuildCache", 0).c_str();
+    if (storeFolder.isEmpty())
+    {
+        AZ_Warning(AssetProcessor::ConsoleChannel, false, "No folder was given for --localBuildCache, the local build cache is disabled.");
+        return;
+    }
+
+    AZ::u64 maxSizeMB = 10 * 1024;
+    if (commandLine->HasSwitch("localBuildCacheMaxSizeMB"))
+    {
+        bool isNumber = false;
+        AZ::u64 value = QString(commandLine->GetSwitchValue("localBuildCacheMaxSizeMB", 0).c_str()).toULongLong(&isNumber);
+        if (isNumber && value > 0)
+        {
+            maxSizeMB = value;
+        }
+        else
+        {
+            AZ_Warning(AssetProcessor::ConsoleChannel, false, "Invalid value for --localBuildCacheMaxSizeMB, using the default of %llu MB.", static_cast<unsigned long long>(maxSizeMB));
+        }
+    }
+
+    m_localBuildCache = new AssetProcessor::LocalBuildCache(storeFolder, maxSizeMB * 1024 * 1024);
+}
+
+void ApplicationManagerBase::DestroyLocalBuildCache()
+{
+    delete m_localBuildCache;
+    m_localBuildCache = nullptr;
+}
+
 // IMPLEMENTATION OF -------------- AzToolsFramework::AssetDatabase::AssetDatabaseRequests::Bus::Listener
 bool ApplicationManagerBase::GetAssetDatabaseLocation(AZStd::string& location)
 {
@@ -1246,6 +1307,7 @@ bool ApplicationManagerBase::Activate()
     InitFileMonitor();
     InitAssetScanner();
     InitAssetServerHandler();
+    InitLocalBuildCache();
     InitRCController();
 
     InitConnectionManager();
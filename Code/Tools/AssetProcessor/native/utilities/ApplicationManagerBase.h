@@ -44,6 +44,7 @@ namespace AssetProcessor
     class FileStateBase;
     class FileStateCache;
     class InternalAssetBuilderInfo;
+    class LocalBuildCache;
     class PlatformConfiguration;
     class RCController;
     class SettingsRegistryBuilder;
@@ -150,6 +151,7 @@ protected:
     void DestroyConnectionManager();
     void InitAssetRequestHandler(AssetProcessor::AssetRequestHandler* assetRequestHandler);
     void InitFileStateCache();
+    void ShutDownFileStateCache();
     void CreateQtApplication() override;
 
     bool InitializeInternalBuilders();
@@ -160,6 +162,8 @@ protected:
     void ShutDownAssetDatabase();
     void InitAssetServerHandler();
     void DestroyAssetServerHandler();
+    void InitLocalBuildCache();
+    void DestroyLocalBuildCache();
     void InitFileProcessor();
     void ShutDownFileProcessor();
     virtual void InitSourceControl() = 0;
@@ -210,6 +214,7 @@ protected:
     AssetProcessor::AssetRequestHandler* m_assetRequestHandler = nullptr;
     AssetProcessor::BuilderManager* m_builderManager = nullptr;
     AssetProcessor::AssetServerHandler* m_assetServerHandler = nullptr;
+    AssetProcessor::LocalBuildCache* m_localBuildCache = nullptr;
     ControlRequestHandler* m_controlRequestHandler = nullptr;
 
     AZStd::unique_ptr<AssetProcessor::FileStateBase> m_fileStateCache;
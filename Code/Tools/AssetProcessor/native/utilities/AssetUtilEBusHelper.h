@@ -252,4 +252,24 @@ namespace AssetProcessor
     };
 
     using AssetServerBus = AZ::EBus<AssetServerBusTraits>;
+
+    // This EBUS is used to reuse job results kept in a build cache on this machine.
+    class LocalBuildCacheBusTraits
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        typedef AZStd::recursive_mutex MutexType;
+        static const bool LocklessDispatch = true;
+        //! StoreJobResult should keep all the files in the temp folder provided by the builderParams, along with the
+        //! outputProducts which are source files copied directly to the Cache, under a key derived from the job's fingerprint.
+        //! This will return true if the job's results are in the build cache afterwards, otherwise return false.
+        virtual bool StoreJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList) = 0;
+        //! RetrieveJobResult should put the files stored for the job's key into the temporary directory provided by the builderParams.
+        //! This will return true if there was an entry for the job and all of its files were retrieved, otherwise return false.
+        virtual bool RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams) = 0;
+    };
+
+    using LocalBuildCacheBus = AZ::EBus<LocalBuildCacheBusTraits>;
 } // namespace AssetProcessor
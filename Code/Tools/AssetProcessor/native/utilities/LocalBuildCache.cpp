@@ -0,0 +1,336 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include <native/utilities/LocalBuildCache.h>
+#include <native/resourcecompiler/rcjob.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/sort.h>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+
+#if defined(AZ_PLATFORM_LINUX)
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#endif
+
+#if !defined(AZ_PLATFORM_WINDOWS)
+#include <unistd.h>
+#endif
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        // each entry folder holds the stored files under FilesFolderName, and a file recording the entry's size whose modtime is when it was last used
+        const char FilesFolderName[] = "files";
+        const char EntryInfoFileName[] = "entryinfo";
+        const char StagingSuffix[] = ".staging";
+
+        // The store is trimmed to this fraction of its limit, so it isn't trimmed again by the very next job.
+        constexpr double EvictionLowWaterMark = 0.9;
+
+        //! Makes destinationPath a file sharing sourcePath's data: a copy on write clone where the file system supports it,
+        //! otherwise a hard link, and a plain copy when neither works (eg the store is on a different volume)
+        bool LinkOrCopyFile(const QString& sourcePath, const QString& destinationPath)
+        {
+            const QByteArray encodedSourcePath = QFile::encodeName(sourcePath);
+            const QByteArray encodedDestinationPath = QFile::encodeName(destinationPath);
+
+#if defined(AZ_PLATFORM_LINUX)
+            int sourceDescriptor = open(encodedSourcePath.constData(), O_RDONLY | O_CLOEXEC);
+            if (sourceDescriptor >= 0)
+            {
+                bool cloned = false;
+                int destinationDescriptor = open(encodedDestinationPath.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+                if (destinationDescriptor >= 0)
+                {
+                    cloned = ioctl(destinationDescriptor, FICLONE, sourceDescriptor) == 0;
+                    close(destinationDescriptor);
+                    if (!cloned)
+                    {
+                        unlink(encodedDestinationPath.constData());
+                    }
+                }
+                close(sourceDescriptor);
+                if (cloned)
+                {
+                    return true;
+                }
+            }
+#endif
+
+#if defined(AZ_PLATFORM_WINDOWS)
+            if (CreateHardLinkW(reinterpret_cast<LPCWSTR>(QDir::toNativeSeparators(destinationPath).utf16()), reinterpret_cast<LPCWSTR>(QDir::toNativeSeparators(sourcePath).utf16()), nullptr))
+            {
+                return true;
+            }
+#else
+            if (link(encodedSourcePath.constData(), encodedDestinationPath.constData()) == 0)
+            {
+                return true;
+            }
+#endif
+            return QFile::copy(sourcePath, destinationPath);
+        }
+
+        //! Links or copies every file under sourceFolder to the same relative path under destinationFolder, adding their sizes to totalSize
+        bool LinkOrCopyFolder(const QString& sourceFolder, const QString& destinationFolder, AZ::u64& totalSize)
+        {
+            QDir sourceDir(sourceFolder);
+            QDir destinationDir(destinationFolder);
+            QDirIterator fileIterator(sourceFolder, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+            while (fileIterator.hasNext())
+            {
+                const QString sourcePath = fileIterator.next();
+                const QString destinationPath = destinationDir.absoluteFilePath(sourceDir.relativeFilePath(sourcePath));
+
+                // a retrieve may land on files left behind by an earlier attempt at the same job
+                QFile::remove(destinationPath);
+                if (!QDir().mkpath(QFileInfo(destinationPath).absolutePath()) || !LinkOrCopyFile(sourcePath, destinationPath))
+                {
+                    AZ_Warning(AssetProcessor::DebugChannel, false, "Local build cache failed to link %s to %s", sourcePath.toUtf8().constData(), destinationPath.toUtf8().constData());
+                    return false;
+                }
+                totalSize += fileIterator.fileInfo().size();
+            }
+            return true;
+        }
+
+        bool WriteEntryInfo(const QString& entryFolder, AZ::u64 size)
+        {
+            QFile entryInfoFile(QDir(entryFolder).absoluteFilePath(EntryInfoFileName));
+            if (!entryInfoFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            {
+                return false;
+            }
+            return entryInfoFile.write(QByteArray::number(static_cast<qulonglong>(size))) > 0;
+        }
+    }
+
+    LocalBuildCache::LocalBuildCache(const QString& storeFolder, AZ::u64 maxSizeBytes)
+        : m_storeFolder(QDir(storeFolder).absolutePath())
+        , m_maxSizeBytes(maxSizeBytes)
+    {
+        QDir().mkpath(m_storeFolder);
+        LoadIndex();
+        LocalBuildCacheBus::Handler::BusConnect();
+    }
+
+    LocalBuildCache::~LocalBuildCache()
+    {
+        LocalBuildCacheBus::Handler::BusDisconnect();
+    }
+
+    QString LocalBuildCache::ComputeCacheKey(const AZ::Uuid& builderId, int builderVersion, const QString& platform, const QString& jobKey, const QString& sourceName, AZ::u32 fingerprint)
+    {
+        AZStd::string keyString = AZStd::string::format("%s:%d:%s:%s:%s:%u", builderId.ToString<AZStd::string>().c_str(), builderVersion,
+            platform.toUtf8().constData(), jobKey.toUtf8().constData(), sourceName.toUtf8().constData(), fingerprint);
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(keyString.data(), keyString.size());
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        return QString::asprintf("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
+    QString LocalBuildCache::ComputeCacheKey(const AssetProcessor::BuilderParams& builderParams)
+    {
+        return ComputeCacheKey(builderParams.m_assetBuilderDesc.m_busId, builderParams.m_assetBuilderDesc.m_version,
+            builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str(), builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(),
+            builderParams.m_rcJob->GetJobEntry().m_databaseSourceName, builderParams.m_rcJob->GetOriginalFingerprint());
+    }
+
+    QString LocalBuildCache::GetEntryFolder(const QString& key) const
+    {
+        // fanned out by the first byte of the key so no single folder ends up with every entry
+        return QString("%1/%2/%3").arg(m_storeFolder, key.left(2), key);
+    }
+
+    bool LocalBuildCache::Store(const QString& key, const QString& tempFolder, const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFileList)
+    {
+        if (Contains(key))
+        {
+            // already stored, by another job with the same inputs or by an earlier run
+            return true;
+        }
+
+        // the files are staged next to the entry and renamed into place, so Retrieve never sees a half written entry
+        const QString entryFolder = GetEntryFolder(key);
+        const QString stagingFolder = entryFolder + "." + AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str() + StagingSuffix;
+        const QString stagingFilesFolder = QDir(stagingFolder).absoluteFilePath(FilesFolderName);
+
+        AZ::u64 entrySize = 0;
+        bool success = QDir().mkpath(stagingFilesFolder) && LinkOrCopyFolder(tempFolder, stagingFilesFolder, entrySize);
+
+        // products which are source files copied straight into the Cache aren't in the temp folder.
+        // they're copied rather than linked since they can be edited in place.
+        for (auto sourceFileIter = sourceFileList.begin(); success && sourceFileIter != sourceFileList.end(); ++sourceFileIter)
+        {
+            QString relativePath = QString(sourceFileIter->c_str());
+            while (relativePath.startsWith('/') || relativePath.startsWith('\\'))
+            {
+                relativePath.remove(0, 1);
+            }
+            const QString sourcePath = QDir(sourceFolder).absoluteFilePath(relativePath);
+            const QString destinationPath = QDir(stagingFilesFolder).absoluteFilePath(relativePath);
+            success = QDir().mkpath(QFileInfo(destinationPath).absolutePath()) && QFile::copy(sourcePath, destinationPath);
+            entrySize += success ? QFileInfo(destinationPath).size() : 0;
+        }
+
+        success = success && WriteEntryInfo(stagingFolder, entrySize);
+        success = success && QDir().rename(stagingFolder, entryFolder);
+        if (!success)
+        {
+            QDir(stagingFolder).removeRecursively();
+            // losing a race with another job storing the same results is fine
+            return QFileInfo(QDir(entryFolder).absoluteFilePath(EntryInfoFileName)).exists();
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_indexMutex);
+        EntryInfo& entryInfo = m_entries[key];
+        m_totalSize = m_totalSize - entryInfo.m_size + entrySize;
+        entryInfo.m_size = entrySize;
+        entryInfo.m_lastUsedMS = QDateTime::currentMSecsSinceEpoch();
+
+        if (m_totalSize > m_maxSizeBytes)
+        {
+            EvictLeastRecentlyUsed();
+        }
+        return true;
+    }
+
+    bool LocalBuildCache::Retrieve(const QString& key, const QString& tempFolder)
+    {
+        if (!Contains(key))
+        {
+            return false;
+        }
+
+        const QString entryFolder = GetEntryFolder(key);
+        AZ::u64 retrievedSize = 0;
+        if (!LinkOrCopyFolder(QDir(entryFolder).absoluteFilePath(FilesFolderName), tempFolder, retrievedSize))
+        {
+            // most likely evicted by another job part way through, the job will be built instead
+            return false;
+        }
+
+        const QDateTime now = QDateTime::currentDateTime();
+        QFile entryInfoFile(QDir(entryFolder).absoluteFilePath(EntryInfoFileName));
+        if (entryInfoFile.open(QIODevice::ReadWrite))
+        {
+            entryInfoFile.setFileTime(now, QFileDevice::FileModificationTime);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_indexMutex);
+        auto entryItr = m_entries.find(key);
+        if (entryItr != m_entries.end())
+        {
+            entryItr.value().m_lastUsedMS = now.toMSecsSinceEpoch();
+        }
+        return true;
+    }
+
+    bool LocalBuildCache::Contains(const QString& key) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_indexMutex);
+        return m_entries.contains(key);
+    }
+
+    AZ::u64 LocalBuildCache::GetTotalSize() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_indexMutex);
+        return m_totalSize;
+    }
+
+    bool LocalBuildCache::StoreJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList)
+    {
+        const QString sourceFolder = QFileInfo(builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath()).absolutePath();
+        return Store(ComputeCacheKey(builderParams), builderParams.GetTempJobDirectory().c_str(), sourceFolder, sourceFileList);
+    }
+
+    bool LocalBuildCache::RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams)
+    {
+        const QString key = ComputeCacheKey(builderParams);
+        if (!Retrieve(key, builderParams.GetTempJobDirectory().c_str()))
+        {
+            return false;
+        }
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Retrieved job (%s, %s, %s) with fingerprint (%u) from the local build cache.\n",
+            builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+            builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+        return true;
+    }
+
+    void LocalBuildCache::LoadIndex()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_indexMutex);
+        m_entries.clear();
+        m_totalSize = 0;
+
+        for (const QFileInfo& fanOutFolder : QDir(m_storeFolder).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+        {
+            for (const QFileInfo& entryFolder : QDir(fanOutFolder.absoluteFilePath()).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+            {
+                QFile entryInfoFile(QDir(entryFolder.absoluteFilePath()).absoluteFilePath(EntryInfoFileName));
+                if (entryFolder.fileName().endsWith(StagingSuffix) || !entryInfoFile.open(QIODevice::ReadOnly))
+                {
+                    // left behind by a store which didn't finish
+                    QDir(entryFolder.absoluteFilePath()).removeRecursively();
+                    continue;
+                }
+
+                EntryInfo entryInfo;
+                entryInfo.m_size = entryInfoFile.readAll().toULongLong();
+                entryInfo.m_lastUsedMS = QFileInfo(entryInfoFile).lastModified().toMSecsSinceEpoch();
+                m_entries.insert(entryFolder.fileName(), entryInfo);
+                m_totalSize += entryInfo.m_size;
+            }
+        }
+
+        if (m_totalSize > m_maxSizeBytes)
+        {
+            EvictLeastRecentlyUsed();
+        }
+
+        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Local build cache %s holds %d job results (%llu MB).\n",
+            m_storeFolder.toUtf8().constData(), m_entries.size(), static_cast<unsigned long long>(m_totalSize / (1024 * 1024)));
+    }
+
+    void LocalBuildCache::EvictLeastRecentlyUsed()
+    {
+        AZStd::vector<AZStd::pair<qint64, QString>> entriesByLastUse;
+        entriesByLastUse.reserve(m_entries.size());
+        for (auto entryItr = m_entries.begin(); entryItr != m_entries.end(); ++entryItr)
+        {
+            entriesByLastUse.emplace_back(entryItr.value().m_lastUsedMS, entryItr.key());
+        }
+        AZStd::sort(entriesByLastUse.begin(), entriesByLastUse.end());
+
+        const AZ::u64 targetSize = static_cast<AZ::u64>(m_maxSizeBytes * EvictionLowWaterMark);
+        for (const auto& entry : entriesByLastUse)
+        {
+            if (m_totalSize <= targetSize)
+            {
+                break;
+            }
+
+            QDir(GetEntryFolder(entry.second)).removeRecursively();
+            m_totalSize -= m_entries.take(entry.second).m_size;
+        }
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,72 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <native/utilities/AssetUtilEBusHelper.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <QHash>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! LocalBuildCache keeps the results of jobs in a folder on this machine, addressed by a key derived from the job's fingerprint,
+    //! so a job whose inputs were built before (on another branch, or before the Cache folder was deleted) is restored instead of rebuilt.
+    //! Files are shared with the job's temp folder by reflink or hard link where the file system allows it, and the least recently
+    //! used entries are evicted once the store grows past its size limit.
+    class LocalBuildCache
+        : public LocalBuildCacheBus::Handler
+    {
+    public:
+        LocalBuildCache(const QString& storeFolder, AZ::u64 maxSizeBytes);
+        virtual ~LocalBuildCache();
+
+        //! Computes the key a job's results are stored under from everything which determines what its builder outputs.
+        //! The fingerprint already covers the source, its dependencies and the builder version, the rest tells apart the jobs sharing a source.
+        static QString ComputeCacheKey(const AZ::Uuid& builderId, int builderVersion, const QString& platform, const QString& jobKey, const QString& sourceName, AZ::u32 fingerprint);
+
+        //! Stores the files in tempFolder, along with the sourceFileList files (relative to sourceFolder), under key.
+        bool Store(const QString& key, const QString& tempFolder, const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFileList);
+        //! Puts the files stored under key into tempFolder.  Returns false if there's no entry for the key.
+        bool Retrieve(const QString& key, const QString& tempFolder);
+
+        bool Contains(const QString& key) const;
+        AZ::u64 GetTotalSize() const;
+
+        //////////////////////////////////////////////////////////////////////////
+        // LocalBuildCacheBus::Handler overrides
+        bool StoreJobResult(const AssetProcessor::BuilderParams& builderParams, AZStd::vector<AZStd::string>& sourceFileList) override;
+        bool RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams) override;
+        //////////////////////////////////////////////////////////////////////////
+
+    protected:
+        struct EntryInfo
+        {
+            AZ::u64 m_size = 0;
+            qint64 m_lastUsedMS = 0;
+        };
+
+        QString GetEntryFolder(const QString& key) const;
+        static QString ComputeCacheKey(const AssetProcessor::BuilderParams& builderParams);
+
+        //! Rebuilds the index from the entries already in the store, and removes entries left half written by a crash.
+        void LoadIndex();
+        //! Removes the least recently used entries until the store is below its size limit.  m_indexMutex must be held.
+        void EvictLeastRecentlyUsed();
+
+        QString m_storeFolder;
+        AZ::u64 m_maxSizeBytes = 0;
+
+        mutable AZStd::mutex m_indexMutex;
+        QHash<QString, EntryInfo> m_entries;
+        AZ::u64 m_totalSize = 0;
+    };
+} //namespace AssetProcessor
@@ -0,0 +1,158 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Culls a batch of cullables against a view frustum and computes their lod screen coverage at the same time.
+        //! The bounding spheres of the batch are stored as structure-of-arrays, so all the lanes are tested against each frustum plane
+        //! with a single SIMD operation. Cullables that straddle a plane still get the exact oriented-bounding-box test.
+        class CullableBatch
+        {
+        public:
+            using Vec4 = Simd::Vec4;
+            static constexpr uint32_t BatchSize = static_cast<uint32_t>(Vec4::ElementCount);
+
+            CullableBatch(const Frustum& frustum, const View& view)
+                : m_frustum(frustum)
+            {
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Plane plane = frustum.GetPlane(planeId);
+                    m_planeNormalX[planeId] = Vec4::Splat(plane.GetNormal().GetX());
+                    m_planeNormalY[planeId] = Vec4::Splat(plane.GetNormal().GetY());
+                    m_planeNormalZ[planeId] = Vec4::Splat(plane.GetNormal().GetZ());
+                    m_planeDistance[planeId] = Vec4::Splat(plane.GetDistance());
+                }
+
+                //See AddLodDataToView() and ModelLodUtils::ApproxScreenPercentage() for the derivation of the screen coverage
+                const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+                const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
+                m_yScale = Vec4::Splat(viewToClip.GetElement(1, 1));
+                m_isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                m_cameraX = Vec4::Splat(cameraPos.GetX());
+                m_cameraY = Vec4::Splat(cameraPos.GetY());
+                m_cameraZ = Vec4::Splat(cameraPos.GetZ());
+            }
+
+            bool IsEmpty() const
+            {
+                return m_count == 0;
+            }
+
+            bool IsFull() const
+            {
+                return m_count == BatchSize;
+            }
+
+            void Add(const Cullable& cullable)
+            {
+                AZ_Assert(!IsFull(), "CullableBatch is full, it must be processed before adding more cullables");
+                const Vector3 center = cullable.m_cullData.m_boundingSphere.GetCenter();
+                m_centerX[m_count] = center.GetX();
+                m_centerY[m_count] = center.GetY();
+                m_centerZ[m_count] = center.GetZ();
+                m_radius[m_count] = cullable.m_cullData.m_boundingSphere.GetRadius();
+                m_lodSelectionRadius[m_count] = cullable.m_lodData.m_lodSelectionRadius;
+                m_cullables[m_count] = &cullable;
+                ++m_count;
+            }
+
+            //! Calls visibleFunction(const Cullable&, float approxScreenPercentage) for every visible cullable in the batch, then empties the batch.
+            //! If testFrustum is false all the cullables are considered visible and only the screen coverage is computed.
+            template<typename VisibleFunction>
+            void Process(bool testFrustum, VisibleFunction&& visibleFunction)
+            {
+                const Vec4::FloatType x = Vec4::LoadAligned(m_centerX);
+                const Vec4::FloatType y = Vec4::LoadAligned(m_centerY);
+                const Vec4::FloatType z = Vec4::LoadAligned(m_centerZ);
+
+                alignas(16) int32_t exterior[BatchSize] = {};
+                alignas(16) int32_t interior[BatchSize] = {};
+                if (testFrustum)
+                {
+                    //Same classification as Frustum::IntersectSphere(), evaluated for all the lanes at once
+                    const Vec4::FloatType radius = Vec4::LoadAligned(m_radius);
+                    const Vec4::FloatType zero = Vec4::ZeroFloat();
+                    Vec4::FloatType exteriorMask = zero;
+                    Vec4::FloatType interiorMask = Vec4::CastToFloat(Vec4::Splat(static_cast<int32_t>(-1)));
+                    for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                    {
+                        Vec4::FloatType distance = Vec4::Madd(x, m_planeNormalX[planeId], m_planeDistance[planeId]);
+                        distance = Vec4::Madd(y, m_planeNormalY[planeId], distance);
+                        distance = Vec4::Madd(z, m_planeNormalZ[planeId], distance);
+                        exteriorMask = Vec4::Or(exteriorMask, Vec4::CmpLt(Vec4::Add(distance, radius), zero));
+                        interiorMask = Vec4::And(interiorMask, Vec4::CmpGtEq(distance, radius));
+                    }
+                    Vec4::StoreAligned(exterior, Vec4::CastToInt(exteriorMask));
+                    Vec4::StoreAligned(interior, Vec4::CastToInt(interiorMask));
+                }
+
+                Vec4::FloatType coverage = Vec4::Mul(m_yScale, Vec4::LoadAligned(m_lodSelectionRadius));
+                if (m_isPerspective)
+                {
+                    const Vec4::FloatType toCenterX = Vec4::Sub(m_cameraX, x);
+                    const Vec4::FloatType toCenterY = Vec4::Sub(m_cameraY, y);
+                    const Vec4::FloatType toCenterZ = Vec4::Sub(m_cameraZ, z);
+                    const Vec4::FloatType lengthSq = Vec4::Madd(toCenterX, toCenterX, Vec4::Madd(toCenterY, toCenterY, Vec4::Mul(toCenterZ, toCenterZ)));
+                    coverage = Vec4::Div(coverage, Vec4::Sqrt(lengthSq));
+                }
+                alignas(16) float approxScreenPercentage[BatchSize];
+                Vec4::StoreAligned(approxScreenPercentage, Vec4::Min(coverage, Vec4::Splat(1.0f)));
+
+                for (uint32_t lane = 0; lane < m_count; ++lane)
+                {
+                    if (testFrustum)
+                    {
+                        if (exterior[lane] != 0 ||
+                            (interior[lane] == 0 && !ShapeIntersection::Overlaps(m_frustum, m_cullables[lane]->m_cullData.m_boundingObb)))
+                        {
+                            continue;
+                        }
+                    }
+                    visibleFunction(*m_cullables[lane], approxScreenPercentage[lane]);
+                }
+                m_count = 0;
+            }
+
+        private:
+            const Frustum& m_frustum;
+            Vec4::FloatType m_planeNormalX[Frustum::PlaneId::MAX];
+            Vec4::FloatType m_planeNormalY[Frustum::PlaneId::MAX];
+            Vec4::FloatType m_planeNormalZ[Frustum::PlaneId::MAX];
+            Vec4::FloatType m_planeDistance[Frustum::PlaneId::MAX];
+            Vec4::FloatType m_yScale;
+            Vec4::FloatType m_cameraX;
+            Vec4::FloatType m_cameraY;
+            Vec4::FloatType m_cameraZ;
+            bool m_isPerspective = true;
+
+            uint32_t m_count = 0;
+            const Cullable* m_cullables[BatchSize] = {};
+            alignas(16) float m_centerX[BatchSize] = {};
+            alignas(16) float m_centerY[BatchSize] = {};
+            alignas(16) float m_centerZ[BatchSize] = {};
+            alignas(16) float m_radius[BatchSize] = {};
+            alignas(16) float m_lodSelectionRadius[BatchSize] = {};
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -70,8 +70,6 @@ namespace AZ
                 //! Will hide this object if any of the hideFlags match the View's usage flags. Useful to hide objects from certain Views.
                 //! Set to all 0's if you don't want to hide the object from any Views.
                 RPI::View::UsageFlags m_hideFlags = RPI::View::UsageNone;
-
-                class RPI::Scene* m_scene = nullptr;  //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
             };
             CullData m_cullData;
 
@@ -156,15 +154,27 @@ namespace AZ
                 void Reset()
                 {
                     m_numJobs = 0;
+                    m_numTestedCullables = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_cullTimeMicroseconds = 0;
+                }
+
+                //! Returns the culling throughput for this view, in cullables tested per microsecond of cull job time.
+                //! Job times are summed over all the worker threads, so this measures the cost per cullable rather than the latency of the view.
+                float GetCullablesPerMicrosecond() const
+                {
+                    const uint64_t cullTimeMicroseconds = m_cullTimeMicroseconds;
+                    return cullTimeMicroseconds > 0 ? static_cast<float>(m_numTestedCullables) / static_cast<float>(cullTimeMicroseconds) : 0.0f;
                 }
 
                 AZ::Name m_name;
                 AZ::Matrix4x4 m_cameraViewToWorld;
                 AZStd::atomic_uint32_t m_numJobs = 0;
+                AZStd::atomic_uint32_t m_numTestedCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                AZStd::atomic_uint64_t m_cullTimeMicroseconds = 0;
             };
 
             CullingDebugContext() = default;
@@ -197,6 +207,13 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Adds the DrawPackets of the lod(s) matching an already computed screen coverage (see ModelLodUtils::ApproxScreenPercentage()) to the view.
+        //! Used by the culling jobs, which compute the screen coverage of several cullables at once.
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view);
+
+        //! Returns true if the lod at lodIndex is selected for the given screen coverage, or if it's the lod override of lodData.
+        bool IsLodSelected(const Cullable::LodData& lodData, size_t lodIndex, float approxScreenPercentage);
+
         //! Centralized manager for culling-related processing.
         //! There is one CullingSystem owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingSystem via their parent Scene.
@@ -238,18 +255,26 @@ namespace AZ
             //! Returns the number of cullables that have been added to the CullingSystem
             uint32_t GetNumCullables() const;
 
+            //! Returns the visibility scene owned by this CullingSystem, which only contains the parent Scene's cullables.
+            //! Is nullptr while the CullingSystem is not active.
+            AzFramework::IVisibilityScene* GetVisibilityScene() const
+            {
+                return m_visibilityScene;
+            }
+
             CullingDebugContext& GetDebugContext()
             {
                 return m_debugCtx;
             }
 
             static const size_t WorkListCapacity = 5;
-            using WorkListType = AZStd::fixed_vector<AzFramework::IVisibilitySystem::NodeData, WorkListCapacity>;
+            using WorkListType = AZStd::fixed_vector<AzFramework::IVisibilityScene::NodeData, WorkListCapacity>;
 
         protected:
             size_t CountObjectsInScene();
 
             const Scene* m_parentScene = nullptr;
+            AzFramework::IVisibilityScene* m_visibilityScene = nullptr;
 
             CullingDebugContext m_debugCtx;
 
@@ -13,6 +13,7 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/CullableBatch.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -239,21 +240,23 @@ namespace AZ
 
         void CullingSystem::RegisterOrUpdateCullable(Cullable& cullable)
         {
+            AZ_Assert(m_visibilityScene, "RegisterOrUpdateCullable invoked on a CullingSystem that isn't active");
             m_cullDataConcurrencyCheck.soft_lock();
-            AZ::Interface<AzFramework::IVisibilitySystem>::Get()->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
+            m_visibilityScene->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
             m_cullDataConcurrencyCheck.soft_unlock();
         }
 
         void CullingSystem::UnregisterCullable(Cullable& cullable)
         {
+            AZ_Assert(m_visibilityScene, "UnregisterCullable invoked on a CullingSystem that isn't active");
             m_cullDataConcurrencyCheck.soft_lock();
-            AZ::Interface<AzFramework::IVisibilitySystem>::Get()->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
+            m_visibilityScene->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
             m_cullDataConcurrencyCheck.soft_unlock();
         }
 
         uint32_t CullingSystem::GetNumCullables() const
         {
-            return AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetEntryCount();
+            return m_visibilityScene ? m_visibilityScene->GetEntryCount() : 0;
         }
 
         class AddObjectsToViewJob final
@@ -285,69 +288,59 @@ namespace AZ
             {
                 AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
 
+                Debug::Timer cullTimer;
+                cullTimer.Stamp();
+
                 const View::UsageFlags viewFlags = m_view->GetUsageFlags();
                 const RHI::DrawListMask drawListMask = m_view->GetDrawListMask();
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
+                uint32_t numTestedCullables = 0;
+
+                CullableBatch batch(m_frustum, *m_view);
+                auto addVisibleCullable = [this, &numDrawPackets, &numVisibleCullables](const Cullable& c, float approxScreenPercentage)
+                {
+                    numDrawPackets += AddLodDataToView(c.m_cullData.m_boundingSphere.GetCenter(), c.m_lodData, approxScreenPercentage, *m_view);
+                    ++numVisibleCullables;
+                };
 
-                for (const AzFramework::IVisibilitySystem::NodeData& nodeData : m_worklist)
+                for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
                 {
                     //If a node is entirely contained within the frustum, then we can skip the fine grained culling.
                     bool nodeIsContainedInFrustum = ShapeIntersection::Contains(m_frustum, nodeData.m_bounds);
+                    const bool testFrustum = !nodeIsContainedInFrustum && m_debugCtx->m_enableFrustumCulling;
 
 #ifdef AZ_CULL_PROFILE_VERBOSE
                     AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "process node (view: %s, skip fine cull: %d",
-                        m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
+                        m_view->GetName().GetCStr(), testFrustum ? 0 : 1);
 #endif
 
-                    if (nodeIsContainedInFrustum || !m_debugCtx->m_enableFrustumCulling)
+                    //Gather the cullables into batches, which are culled (unless the whole node is visible) and lod-selected together
+                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
                     {
-                        //Add all objects within this node to the view, without any extra culling
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                         {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                            ++numTestedCullables;
+                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                            if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                                c->m_cullData.m_hideFlags & viewFlags)
                             {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != m_scene)       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                {
-                                    continue;
-                                }
-                                numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_view);
-                                ++numVisibleCullables;
+                                continue;
                             }
-                        }
-                    }
-                    else
-                    {
-                        //Do fine-grained culling before adding objects to the view
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
-                        {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                            {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != m_scene)       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                {
-                                    continue;
-                                }
 
-                                IntersectResult res = ShapeIntersection::Classify(m_frustum, c->m_cullData.m_boundingSphere);
-                                if (res == IntersectResult::Exterior)
-                                {
-                                    continue;
-                                }
-                                else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_frustum, c->m_cullData.m_boundingObb))
-                                {
-                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_view);
-                                    ++numVisibleCullables;
-                                }
+                            batch.Add(*c);
+                            if (batch.IsFull())
+                            {
+                                batch.Process(testFrustum, addVisibleCullable);
                             }
                         }
                     }
 
+                    if (!batch.IsEmpty())
+                    {
+                        batch.Process(testFrustum, addVisibleCullable);
+                    }
+
                     if (m_debugCtx->m_debugDraw && (m_view->GetName() == m_debugCtx->m_currentViewSelectionName))
                     {
                         AZ_PROFILE_SCOPE(Debug::ProfileCategory::AzRender, "debug draw culling");
@@ -408,6 +401,8 @@ namespace AZ
                     //no need for mutex here since these are all atomics
                     cullStats.m_numVisibleDrawPackets += numDrawPackets;
                     cullStats.m_numVisibleCullables += numVisibleCullables;
+                    cullStats.m_numTestedCullables += numTestedCullables;
+                    cullStats.m_cullTimeMicroseconds += static_cast<uint64_t>(cullTimer.GetDeltaTimeInTicks() * 1000000 / AZStd::GetTimeTicksPerSecond());
                     ++cullStats.m_numJobs;
                 }
             }
@@ -445,7 +440,8 @@ namespace AZ
             }
 
             WorkListType worklist;
-            auto nodeVisitorLambda = [this, &scene, &view, &parentJob, &frustum, &worklist](const AzFramework::IVisibilitySystem::NodeData& nodeData) -> void
+            size_t worklistEntryCount = 0;
+            auto nodeVisitorLambda = [this, &scene, &view, &parentJob, &frustum, &worklist, &worklistEntryCount](const AzFramework::IVisibilityScene::NodeData& nodeData) -> void
             {
                 AZ_PROFILE_SCOPE(Debug::ProfileCategory::AzRender, "nodeVisitorLambda()");
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
@@ -453,13 +449,16 @@ namespace AZ
 
                 //Queue up a small list of work items (NodeData*) which will be pushed to a worker job (AddObjectsToViewJob) once the queue is full.
                 //This reduces the number of jobs in flight, reducing job-system overhead.
+                //The queue is also flushed once it holds r_CullWorkPerBatch entries, so that a few crowded nodes don't all end up in one job.
+                worklistEntryCount += nodeData.m_entries.size();
                 worklist.emplace_back(AZStd::move(nodeData));
 
-                if (worklist.size() == worklist.capacity())
+                if (worklist.size() == worklist.capacity() || worklistEntryCount >= r_CullWorkPerBatch)
                 {
                     //Kick off a job to process the (full) worklist
                     AddObjectsToViewJob* job = aznew AddObjectsToViewJob(m_debugCtx, scene, view, frustum, worklist); //pool allocated (cheap), auto-deletes when job finishes
                     worklist.clear();
+                    worklistEntryCount = 0;
                     parentJob.SetContinuation(job);
                     job->Start();
                 }
@@ -467,11 +466,11 @@ namespace AZ
 
             if (m_debugCtx.m_enableFrustumCulling)
             {
-                AZ::Interface<AzFramework::IVisibilitySystem>::Get()->Enumerate(frustum, nodeVisitorLambda);
+                m_visibilityScene->Enumerate(frustum, nodeVisitorLambda);
             }
             else
             {
-                AZ::Interface<AzFramework::IVisibilitySystem>::Get()->EnumerateNoCull(nodeVisitorLambda);
+                m_visibilityScene->EnumerateNoCull(nodeVisitorLambda);
             }
 
             if (worklist.size() > 0)
@@ -499,6 +498,11 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            return AddLodDataToView(pos, lodData, approxScreenPercentage, view);
+        }
+
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, float approxScreenPercentage, RPI::View& view)
+        {
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -513,29 +517,38 @@ namespace AZ
                 }
             };
 
-            if (lodData.m_lodOverride == Cullable::NoLodOverride)
+            for (size_t lodIndex = 0; lodIndex < lodData.m_lods.size(); ++lodIndex)
             {
-                for (const Cullable::LodData::Lod& lod : lodData.m_lods)
+                if (IsLodSelected(lodData, lodIndex, approxScreenPercentage))
                 {
-                    //Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
-                    if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
-                    {
-                        addLodToDrawPacket(lod);
-                    }
+                    addLodToDrawPacket(lodData.m_lods[lodIndex]);
                 }
             }
-            else if(lodData.m_lodOverride < lodData.m_lods.size())
+
+            return numVisibleDrawPackets;
+        }
+
+        bool IsLodSelected(const Cullable::LodData& lodData, size_t lodIndex, float approxScreenPercentage)
+        {
+            if (lodData.m_lodOverride != Cullable::NoLodOverride)
             {
-                addLodToDrawPacket(lodData.m_lods.at(lodData.m_lodOverride));
+                return lodIndex == lodData.m_lodOverride;
             }
 
-            return numVisibleDrawPackets;
+            //Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
+            const Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
+            return approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax;
         }
 
         void CullingSystem::Activate(const Scene* parentScene)
         {
             m_parentScene = parentScene;
 
+            // Each render scene culls against its own visibility scene, so culling cost only scales with that scene's content
+            const AZStd::string visibilitySceneName = AZStd::string::format("RenderCullScene[%s]", m_parentScene->GetId().ToString<AZStd::string>().c_str());
+            m_visibilityScene = AZ::Interface<AzFramework::IVisibilitySystem>::Get()->CreateVisibilityScene(AZ::Name(visibilitySceneName));
+            AZ_Assert(m_visibilityScene, "Failed to create the visibility scene %s", visibilitySceneName.c_str());
+
 #ifdef AZ_CULL_DEBUG_ENABLED
             AZ_Assert(CountObjectsInScene() == 0, "The culling system should start with 0 entries in this scene.");
 #endif
@@ -546,6 +559,12 @@ namespace AZ
 #ifdef AZ_CULL_DEBUG_ENABLED
             AZ_Assert(CountObjectsInScene() == 0, "All culling entries must be removed from the scene before shutdown.");
 #endif
+
+            if (AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get(); visibilitySystem && m_visibilityScene)
+            {
+                visibilitySystem->DestroyVisibilityScene(m_visibilityScene);
+            }
+            m_visibilityScene = nullptr;
         }
 
         void CullingSystem::BeginCulling(const AZStd::vector<ViewPtr>& views)
@@ -597,18 +616,14 @@ namespace AZ
         size_t CullingSystem::CountObjectsInScene()
         {
             size_t numObjects = 0;
-            AZ::Interface<AzFramework::IVisibilitySystem>::Get()->EnumerateNoCull(
-                [this, &numObjects](const AzFramework::IVisibilitySystem::NodeData& nodeData)
+            m_visibilityScene->EnumerateNoCull(
+                [&numObjects](const AzFramework::IVisibilityScene::NodeData& nodeData)
                 {
                     for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
                     {
                         if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                         {
-                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-                            if (c->m_cullData.m_scene == m_parentScene)       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                            {
-                                ++numObjects;
-                            }
+                            ++numObjects;
                         }
                     }
                 }
@@ -105,6 +105,11 @@ namespace AZ
             m_pipelines.clear();
             AZ::RPI::PassSystemInterface::Get()->ProcessQueuedChanges();
 
+            // Release the culling system's visibility scene if the scene was never deactivated
+            if (m_activated)
+            {
+                m_cullingSystem->Deactivate();
+            }
             delete m_cullingSystem;
         }
 
@@ -0,0 +1,196 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <Atom/RPI.Public/CullableBatch.h>
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class CullingTests
+        : public RPITestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            RPITestFixture::SetUp();
+
+            m_cameraPosition = Vector3(3.0f, -2.0f, 5.0f);
+            m_view = View::CreateView(AZ::Name("TestView"), View::UsageCamera);
+            m_view->SetWorldToViewMatrix(Matrix4x4::CreateTranslation(-m_cameraPosition));
+            m_view->SetViewToClipMatrix(Matrix4x4::CreateProjection(Constants::HalfPi, 1.5f, 0.1f, 100.0f));
+            m_frustum = Frustum::CreateFromMatrixColumnMajor(m_view->GetWorldToClipMatrix());
+        }
+
+        void TearDown() override
+        {
+            m_cullables = {};
+            m_view = nullptr;
+            RPITestFixture::TearDown();
+        }
+
+        //! Creates cullables around the camera with random sizes, so they are inside, outside and straddling the frustum.
+        //! Every obb is either the bounding box of its sphere, or far away from the frustum so that only cullables
+        //! that are entirely inside the frustum pass the batched test.
+        void CreateCullables(size_t count, bool obbsOverlapSpheres)
+        {
+            SimpleLcgRandom random(count);
+            m_cullables.resize(count);
+            for (Cullable& cullable : m_cullables)
+            {
+                const Vector3 offset = Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()) * 240.0f - Vector3(120.0f);
+                const Vector3 center = m_cameraPosition + offset;
+                const float radius = 0.5f + random.GetRandomFloat() * 20.0f;
+                cullable.m_cullData.m_boundingSphere = Sphere(center, radius);
+                cullable.m_cullData.m_boundingObb = obbsOverlapSpheres
+                    ? Obb::CreateFromPositionRotationAndHalfLengths(center, Quaternion::CreateIdentity(), Vector3(radius))
+                    : Obb::CreateFromPositionRotationAndHalfLengths(Vector3(1.0e6f), Quaternion::CreateIdentity(), Vector3(1.0f));
+                cullable.m_lodData.m_lodSelectionRadius = radius * 0.5f;
+                cullable.m_lodData.m_lods = { { 0.25f, 1.0f, {} }, { 0.05f, 0.25f, {} }, { 0.0f, 0.05f, {} } };
+            }
+        }
+
+        //! Runs the cullables through a CullableBatch the same way the culling jobs do, including a partial batch at the end.
+        //! Returns the screen coverage of every visible cullable, and -1 for culled ones.
+        AZStd::vector<float> ProcessCullables(bool testFrustum)
+        {
+            AZStd::vector<float> screenCoverages(m_cullables.size(), -1.0f);
+            auto visibleFunction = [this, &screenCoverages](const Cullable& cullable, float approxScreenPercentage)
+            {
+                const size_t index = static_cast<size_t>(&cullable - m_cullables.data());
+                EXPECT_EQ(-1.0f, screenCoverages[index]);
+                screenCoverages[index] = approxScreenPercentage;
+            };
+
+            CullableBatch batch(m_frustum, *m_view);
+            for (const Cullable& cullable : m_cullables)
+            {
+                batch.Add(cullable);
+                if (batch.IsFull())
+                {
+                    batch.Process(testFrustum, visibleFunction);
+                }
+            }
+            if (!batch.IsEmpty())
+            {
+                batch.Process(testFrustum, visibleFunction);
+            }
+            EXPECT_TRUE(batch.IsEmpty());
+            return screenCoverages;
+        }
+
+        float GetScalarScreenCoverage(const Cullable& cullable) const
+        {
+            const Matrix4x4& viewToClip = m_view->GetViewToClipMatrix();
+            return ModelLodUtils::ApproxScreenPercentage(
+                cullable.m_cullData.m_boundingSphere.GetCenter(), cullable.m_lodData.m_lodSelectionRadius,
+                m_view->GetViewToWorldMatrix().GetTranslation(), viewToClip.GetElement(1, 1), viewToClip.GetElement(3, 3) == 0.0f);
+        }
+
+        // Cullable counts with a partial batch of 1 to 3 cullables at the end, and enough cullables for every classification.
+        static constexpr size_t CullableCounts[] = { 1, 2, 3, 4, 5, 6, 7, 201, 202, 203 };
+
+        Vector3 m_cameraPosition;
+        ViewPtr m_view;
+        Frustum m_frustum;
+        AZStd::vector<Cullable> m_cullables;
+    };
+
+    TEST_F(CullingTests, CullableBatch_ObbsOutsideFrustum_OnlyInteriorSpheresAreVisible)
+    {
+        for (size_t count : CullableCounts)
+        {
+            CreateCullables(count, false);
+            const AZStd::vector<float> screenCoverages = ProcessCullables(true);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const IntersectResult expected = m_frustum.IntersectSphere(m_cullables[i].m_cullData.m_boundingSphere);
+                EXPECT_EQ(expected == IntersectResult::Interior, screenCoverages[i] >= 0.0f) << "cullable " << i << " of " << count;
+            }
+        }
+    }
+
+    TEST_F(CullingTests, CullableBatch_ObbsAroundSpheres_InteriorAndOverlappingSpheresAreVisible)
+    {
+        size_t numResults[3] = {};
+        for (size_t count : CullableCounts)
+        {
+            CreateCullables(count, true);
+            const AZStd::vector<float> screenCoverages = ProcessCullables(true);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const IntersectResult expected = m_frustum.IntersectSphere(m_cullables[i].m_cullData.m_boundingSphere);
+                EXPECT_EQ(expected != IntersectResult::Exterior, screenCoverages[i] >= 0.0f) << "cullable " << i << " of " << count;
+                ++numResults[static_cast<int>(expected)];
+            }
+        }
+
+        // Make sure the random cullables covered inside, outside and straddling spheres.
+        EXPECT_GT(numResults[static_cast<int>(IntersectResult::Interior)], 0u);
+        EXPECT_GT(numResults[static_cast<int>(IntersectResult::Exterior)], 0u);
+        EXPECT_GT(numResults[static_cast<int>(IntersectResult::Overlaps)], 0u);
+    }
+
+    TEST_F(CullingTests, CullableBatch_FrustumTestDisabled_AllCullablesAreVisible)
+    {
+        for (size_t count : CullableCounts)
+        {
+            CreateCullables(count, false);
+            const AZStd::vector<float> screenCoverages = ProcessCullables(false);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_GE(screenCoverages[i], 0.0f) << "cullable " << i << " of " << count;
+            }
+        }
+    }
+
+    TEST_F(CullingTests, CullableBatch_ScreenCoverage_SelectsSameLodsAsScalarPath)
+    {
+        for (size_t count : CullableCounts)
+        {
+            CreateCullables(count, false);
+            const AZStd::vector<float> screenCoverages = ProcessCullables(false);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Cullable& cullable = m_cullables[i];
+                const float scalarScreenCoverage = GetScalarScreenCoverage(cullable);
+                EXPECT_NEAR(scalarScreenCoverage, screenCoverages[i], 1.0e-5f);
+                for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
+                {
+                    EXPECT_EQ(IsLodSelected(cullable.m_lodData, lodIndex, scalarScreenCoverage), IsLodSelected(cullable.m_lodData, lodIndex, screenCoverages[i]))
+                        << "cullable " << i << " of " << count << ", lod " << lodIndex;
+                }
+            }
+        }
+    }
+
+    TEST_F(CullingTests, IsLodSelected_LodOverride_OnlyOverrideIsSelected)
+    {
+        Cullable::LodData lodData;
+        lodData.m_lods = { { 0.25f, 1.0f, {} }, { 0.0f, 0.25f, {} } };
+        EXPECT_TRUE(IsLodSelected(lodData, 0, 0.5f));
+        EXPECT_FALSE(IsLodSelected(lodData, 1, 0.5f));
+
+        lodData.m_lodOverride = 1;
+        EXPECT_FALSE(IsLodSelected(lodData, 0, 0.5f));
+        EXPECT_TRUE(IsLodSelected(lodData, 1, 0.5f));
+    }
+}
@@ -11,6 +11,7 @@
 
 set(FILES
     Include/Atom/RPI.Public/Base.h
+    Include/Atom/RPI.Public/CullableBatch.h
     Include/Atom/RPI.Public/Culling.h
     Include/Atom/RPI.Public/FeatureProcessor.h
     Include/Atom/RPI.Public/FeatureProcessorFactory.h
@@ -64,6 +64,8 @@ namespace AZ
                 uint32_t totalVisibleCullables = 0;
                 uint32_t totalVisibleDrawPackets = 0;
                 uint32_t totalCullJobs = 0;
+                uint32_t totalTestedCullables = 0;
+                uint64_t totalCullTimeMicroseconds = 0;
                 size_t numViews = 0;
 
                 auto& perViewCullStats = debugCtx.LockAndGetAllCullStats();
@@ -87,12 +89,13 @@ namespace AZ
                 for (CullStatsType* cullStats : cullStatsSorted)
                 {
                     // create formatted display strings
-                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs",
+                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs, %.1f cullables/us",
                         cullStats->m_name.GetCStr(),
                         static_cast<uint32_t>(cullStats->m_numVisibleCullables),
                         static_cast<uint32_t>(debugCtx.m_numCullablesInScene),
                         static_cast<uint32_t>(cullStats->m_numVisibleDrawPackets),
-                        static_cast<uint32_t>(cullStats->m_numJobs)
+                        static_cast<uint32_t>(cullStats->m_numJobs),
+                        cullStats->GetCullablesPerMicrosecond()
                     ));
 
                     // collect totals
@@ -100,9 +103,11 @@ namespace AZ
                     totalVisibleCullables += cullStats->m_numVisibleCullables;
                     totalVisibleDrawPackets += cullStats->m_numVisibleDrawPackets;
                     totalCullJobs += cullStats->m_numJobs;
+                    totalTestedCullables += cullStats->m_numTestedCullables;
+                    totalCullTimeMicroseconds += cullStats->m_cullTimeMicroseconds;
                 }
 
-                if (ImGui::BeginChild("Totals", ImVec2(0, 120.0f), true, ImGuiWindowFlags_None))
+                if (ImGui::BeginChild("Totals", ImVec2(0, 140.0f), true, ImGuiWindowFlags_None))
                 {
                     ImGui::Text("Totals:");
                     ImGui::Separator();
@@ -110,6 +115,9 @@ namespace AZ
                     ImGui::Text("   %u Cull Jobs", totalCullJobs);
                     ImGui::Text("   %d/%d Visible Cullables", totalVisibleCullables, totalCullables);
                     ImGui::Text("   %d Submitted DrawPackets", totalVisibleDrawPackets);
+                    ImGui::Text("   %.1f Cullables/us (%u tested in %llu us of cull jobs)",
+                        totalCullTimeMicroseconds > 0 ? static_cast<float>(totalTestedCullables) / static_cast<float>(totalCullTimeMicroseconds) : 0.0f,
+                        totalTestedCullables, static_cast<unsigned long long>(totalCullTimeMicroseconds));
                 }                
                 ImGui::EndChild();
 
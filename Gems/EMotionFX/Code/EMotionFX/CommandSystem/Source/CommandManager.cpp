@@ -86,6 +86,7 @@ namespace CommandSystem
         RegisterCommand(new CommandImportMotion());
         RegisterCommand(new CommandRemoveMotion());
         RegisterCommand(new CommandScaleMotionData());
+        RegisterCommand(new CommandCompressMotionData());
         RegisterCommand(new CommandPlayMotion());
         RegisterCommand(new CommandAdjustMotionInstance());
         RegisterCommand(new CommandAdjustDefaultPlayBackInfo());
@@ -24,6 +24,7 @@
 #include <EMotionFX/Source/AnimGraphInstance.h>
 #include <EMotionFX/Source/ActorManager.h>
 #include <EMotionFX/Source/EventManager.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
 #include <EMotionFX/Exporters/ExporterLib/Exporter/ExporterFileProcessor.h>
 #include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
 
@@ -1176,6 +1177,134 @@ namespace CommandSystem
 
 
 
+    //--------------------------------------------------------------------------------
+    // CommandCompressMotionData
+    //--------------------------------------------------------------------------------
+
+    // constructor
+    CommandCompressMotionData::CommandCompressMotionData(MCore::Command* orgCommand)
+        : MCore::Command("CompressMotionData", orgCommand)
+    {
+        mMotionID       = MCORE_INVALIDINDEX32;
+        mOldDirtyFlag   = false;
+    }
+
+
+    // destructor
+    CommandCompressMotionData::~CommandCompressMotionData()
+    {
+    }
+
+
+    // execute
+    bool CommandCompressMotionData::Execute(const MCore::CommandLine& parameters, AZStd::string& outResult)
+    {
+        EMotionFX::Motion* motion;
+        if (parameters.CheckIfHasParameter("id"))
+        {
+            uint32 motionID = parameters.GetValueAsInt("id", MCORE_INVALIDINDEX32);
+
+            motion = EMotionFX::GetMotionManager().FindMotionByID(motionID);
+            if (motion == nullptr)
+            {
+                outResult = AZStd::string::format("Cannot get the motion, with ID %d.", motionID);
+                return false;
+            }
+        }
+        else
+        {
+            SelectionList& selection = GetCommandManager()->GetCurrentSelection();
+            if (selection.GetNumSelectedMotions() == 0)
+            {
+                outResult = "No motion has been selected, please select one first.";
+                return false;
+            }
+
+            // get the first selected motion
+            motion = selection.GetMotion(0);
+        }
+
+        EMotionFX::MotionData* motionData = motion->GetMotionData();
+        if (motionData == nullptr)
+        {
+            outResult = AZStd::string::format("Motion '%s' has no motion data to compress.", motion->GetName());
+            return false;
+        }
+
+        const float sampleRate = parameters.GetValueAsFloat("sampleRate", this);
+        if (sampleRate <= 0.0f)
+        {
+            outResult = "The sample rate has to be larger than zero.";
+            return false;
+        }
+
+        EMotionFX::MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = parameters.GetValueAsFloat("maxPosError", this);
+        settings.m_maxRotError = parameters.GetValueAsFloat("maxRotError", this);
+        settings.m_maxScaleError = parameters.GetValueAsFloat("maxScaleError", this);
+        settings.m_maxMorphError = parameters.GetValueAsFloat("maxMorphError", this);
+        settings.m_maxFloatError = parameters.GetValueAsFloat("maxFloatError", this);
+
+        EMotionFX::CompressedMotionData* compressedData = aznew EMotionFX::CompressedMotionData();
+        compressedData->InitFromMotionData(motionData, sampleRate, settings);
+
+        const EMotionFX::MotionData::SaveSettings saveSettings;
+        outResult = AZStd::string::format("Compressed motion '%s' from %zu to %zu bytes.", motion->GetName(),
+            motionData->CalcStreamSaveSizeInBytes(saveSettings), compressedData->CalcStreamSaveSizeInBytes(saveSettings));
+
+        // keep the old motion data around, so that we can restore it on undo
+        mMotionID = motion->GetID();
+        mOldMotionData.reset(motionData);
+        motion->SetMotionData(compressedData, /*delOldFromMem=*/false);
+
+        mOldDirtyFlag = motion->GetDirtyFlag();
+        motion->SetDirtyFlag(true);
+        return true;
+    }
+
+
+    // undo the command
+    bool CommandCompressMotionData::Undo(const MCore::CommandLine& parameters, AZStd::string& outResult)
+    {
+        MCORE_UNUSED(parameters);
+
+        EMotionFX::Motion* motion = EMotionFX::GetMotionManager().FindMotionByID(mMotionID);
+        if (motion == nullptr)
+        {
+            outResult = AZStd::string::format("Cannot get the motion, with ID %d.", mMotionID);
+            return false;
+        }
+
+        motion->SetMotionData(mOldMotionData.release(), /*delOldFromMem=*/true);
+        motion->SetDirtyFlag(mOldDirtyFlag);
+        return true;
+    }
+
+
+    // init the syntax of the command
+    void CommandCompressMotionData::InitSyntax()
+    {
+        const EMotionFX::MotionData::OptimizeSettings defaultSettings;
+
+        GetSyntax().ReserveParameters(7);
+        GetSyntax().AddParameter("id",              "The identification number of the motion we want to compress.",                  MCore::CommandSyntax::PARAMTYPE_INT,        "-1");
+        GetSyntax().AddParameter("sampleRate",      "The number of samples per second the motion is sampled at before compressing.", MCore::CommandSyntax::PARAMTYPE_FLOAT,      "30.0");
+        GetSyntax().AddParameter("maxPosError",     "The maximum position error, in units.",                                         MCore::CommandSyntax::PARAMTYPE_FLOAT,      AZStd::to_string(defaultSettings.m_maxPosError).c_str());
+        GetSyntax().AddParameter("maxRotError",     "The maximum rotation error, per quaternion component.",                         MCore::CommandSyntax::PARAMTYPE_FLOAT,      AZStd::to_string(defaultSettings.m_maxRotError).c_str());
+        GetSyntax().AddParameter("maxScaleError",   "The maximum scale error.",                                                      MCore::CommandSyntax::PARAMTYPE_FLOAT,      AZStd::to_string(defaultSettings.m_maxScaleError).c_str());
+        GetSyntax().AddParameter("maxMorphError",   "The maximum morph target weight error.",                                        MCore::CommandSyntax::PARAMTYPE_FLOAT,      AZStd::to_string(defaultSettings.m_maxMorphError).c_str());
+        GetSyntax().AddParameter("maxFloatError",   "The maximum float channel error.",                                              MCore::CommandSyntax::PARAMTYPE_FLOAT,      AZStd::to_string(defaultSettings.m_maxFloatError).c_str());
+    }
+
+
+    // get the description
+    const char* CommandCompressMotionData::GetDescription() const
+    {
+        return "This command converts the motion data of a motion into compressed motion data, which stores keyframe reduced and quantized tracks within the given error bounds.";
+    }
+
+
+
     //--------------------------------------------------------------------------------
     // Helper Functions
     //--------------------------------------------------------------------------------
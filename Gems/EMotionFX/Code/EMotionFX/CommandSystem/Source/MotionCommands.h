@@ -15,6 +15,7 @@
 #include "CommandSystemConfig.h"
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <MCore/Source/Command.h>
 #include <MCore/Source/CommandGroup.h>
 #include <MCore/Source/Endian.h>
@@ -103,6 +104,15 @@ namespace CommandSystem
     MCORE_DEFINECOMMAND_END
 
 
+    // Compress motion data, replacing the motion data of a motion with a CompressedMotionData.
+    MCORE_DEFINECOMMAND_START(CommandCompressMotionData, "Compress motion data", true)
+    public:
+        AZStd::unique_ptr<EMotionFX::MotionData> mOldMotionData;
+        uint32          mMotionID;
+        bool            mOldDirtyFlag;
+    MCORE_DEFINECOMMAND_END
+
+
     //////////////////////////////////////////////////////////////////////////////////////////////////////////
     // EMotionFX::Motion* Playback
     //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1392 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        constexpr float s_numQuantizationSteps = 65535.0f;
+        constexpr float s_losslessMaxError = 0.0001f;   // Matches the error NonUniformMotionData uses to remove redundant keys.
+        constexpr float s_ignoredMaxError = 0.00001f;   // Matches the error NonUniformMotionData uses for joints on the ignore list.
+
+        // Interpolate between two quantized keys.
+        void DequantizeLerp(const AZ::u16* valuesA, const AZ::u16* valuesB, const float* rangeMin, const float* rangeScale, AZ::u32 numComponents, float t, float* result)
+        {
+            for (AZ::u32 c = 0; c < numComponents; ++c)
+            {
+                const float a = rangeMin[c] + static_cast<float>(valuesA[c]) * rangeScale[c];
+                const float b = rangeMin[c] + static_cast<float>(valuesB[c]) * rangeScale[c];
+                result[c] = a + (b - a) * t;
+            }
+        }
+
+        void NormalizeRotation(float* value)
+        {
+            const float lengthSq = value[0] * value[0] + value[1] * value[1] + value[2] * value[2] + value[3] * value[3];
+            if (lengthSq > AZ::Constants::FloatEpsilon)
+            {
+                const float invLength = 1.0f / AZ::Sqrt(lengthSq);
+                for (AZ::u32 c = 0; c < 4; ++c)
+                {
+                    value[c] *= invLength;
+                }
+            }
+        }
+
+        // The largest per component difference, rotations treat q and -q as the same value.
+        float CalcError(const float* a, const float* b, AZ::u32 numComponents, bool isRotation)
+        {
+            float error = 0.0f;
+            float negatedError = 0.0f;
+            for (AZ::u32 c = 0; c < numComponents; ++c)
+            {
+                error = AZ::GetMax(error, AZ::GetAbs(a[c] - b[c]));
+                negatedError = AZ::GetMax(negatedError, AZ::GetAbs(a[c] + b[c]));
+            }
+            return isRotation ? AZ::GetMin(error, negatedError) : error;
+        }
+
+        bool IsInList(const AZStd::vector<size_t>& list, size_t index)
+        {
+            return AZStd::find(list.begin(), list.end(), index) != list.end();
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetFbxSettingsName() const
+    {
+        return "Compressed Keyframes (smallest, slightly slower)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+
+        // Only remove the keys that are redundant, Optimize() can reduce the tracks further within the remaining error budget.
+        OptimizeSettings settings;
+        settings.m_maxPosError = s_losslessMaxError;
+        settings.m_maxRotError = s_losslessMaxError;
+        settings.m_maxScaleError = s_losslessMaxError;
+        settings.m_maxMorphError = s_losslessMaxError;
+        settings.m_maxFloatError = s_losslessMaxError;
+        InitFromMotionData(motionData, keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate, settings);
+    }
+
+    void CompressedMotionData::InitFromMotionData(const MotionData* motionData, float sampleRate, const OptimizeSettings& settings)
+    {
+        AZ_Assert(motionData && motionData != this, "Expected a valid motion data to compress.");
+        AZ_Assert(sampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+
+        // Calculate the number of samples, lowering the sample rate when the motion is too long to index all samples with 16 bits.
+        const float duration = motionData->GetDuration();
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(duration, sampleRate, numSamples, sampleSpacing);
+        if (numSamples > s_maxNumSamples)
+        {
+            AZ_Warning("EMotionFX", false, "Motion of %.1f seconds is too long to compress at %.1f samples per second, lowering the sample rate.", duration, sampleRate);
+            sampleRate = static_cast<float>(s_maxNumSamples - 2) / duration;
+            MotionData::CalculateSampleInformation(duration, sampleRate, numSamples, sampleSpacing);
+        }
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        MotionData::SetSampleRate(sampleRate);
+        m_numSamples = numSamples;
+
+        AZStd::vector<float> samples;
+        float staticValue[4];
+
+        // Joints.
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            const bool isIgnored = IsInList(settings.m_jointIgnoreList, i);
+            const Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+            JointTracks& jointTracks = m_jointTracks[i];
+
+            if (motionData->IsJointPositionAnimated(i))
+            {
+                samples.resize(m_numSamples * 3);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    motionData->SampleJointPosition(s * sampleSpacing, i).StoreToFloat3(&samples[s * 3]);
+                }
+                staticTransform.mPosition.StoreToFloat3(staticValue);
+                CompressTrack(samples, 3, false, staticValue, isIgnored ? s_ignoredMaxError : settings.m_maxPosError, jointTracks.m_position, m_keySampleIndices, m_keyValues);
+            }
+
+            if (motionData->IsJointRotationAnimated(i))
+            {
+                // Keep successive samples in the same hemisphere, so that interpolating the components takes the shortest path.
+                samples.resize(m_numSamples * 4);
+                AZ::Quaternion previousRotation = AZ::Quaternion::CreateIdentity();
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    AZ::Quaternion rotation = motionData->SampleJointRotation(s * sampleSpacing, i).GetNormalized();
+                    if (s > 0 && rotation.Dot(previousRotation) < 0.0f)
+                    {
+                        rotation = -rotation;
+                    }
+                    rotation.StoreToFloat4(&samples[s * 4]);
+                    previousRotation = rotation;
+                }
+                staticTransform.mRotation.StoreToFloat4(staticValue);
+                CompressTrack(samples, 4, true, staticValue, isIgnored ? s_ignoredMaxError : settings.m_maxRotError, jointTracks.m_rotation, m_keySampleIndices, m_keyValues);
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (motionData->IsJointScaleAnimated(i))
+            {
+                samples.resize(m_numSamples * 3);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    motionData->SampleJointScale(s * sampleSpacing, i).StoreToFloat3(&samples[s * 3]);
+                }
+                staticTransform.mScale.StoreToFloat3(staticValue);
+                CompressTrack(samples, 3, false, staticValue, isIgnored ? s_ignoredMaxError : settings.m_maxScaleError, jointTracks.m_scale, m_keySampleIndices, m_keyValues);
+            }
+#endif
+        }
+
+        // Morphs.
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            if (!motionData->IsMorphAnimated(i))
+            {
+                continue;
+            }
+
+            samples.resize(m_numSamples);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                samples[s] = motionData->SampleMorph(s * sampleSpacing, i);
+            }
+            const float maxError = IsInList(settings.m_morphIgnoreList, i) ? s_ignoredMaxError : settings.m_maxMorphError;
+            CompressTrack(samples, 1, false, &m_staticMorphData[i].m_staticValue, maxError, m_morphTracks[i], m_keySampleIndices, m_keyValues);
+        }
+
+        // Floats.
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            if (!motionData->IsFloatAnimated(i))
+            {
+                continue;
+            }
+
+            samples.resize(m_numSamples);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                samples[s] = motionData->SampleFloat(s * sampleSpacing, i);
+            }
+            const float maxError = IsInList(settings.m_floatIgnoreList, i) ? s_ignoredMaxError : settings.m_maxFloatError;
+            CompressTrack(samples, 1, false, &m_staticFloatData[i].m_staticValue, maxError, m_floatTracks[i], m_keySampleIndices, m_keyValues);
+        }
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        // The tracks are refitted to their own reconstruction, so each track can only use what is left of its error budget.
+        // Tracks that are on an ignore list, or that have no budget left, are copied as they are.
+        AZStd::vector<AZ::u16> keySampleIndices;
+        AZStd::vector<AZ::u16> keyValues;
+        keySampleIndices.reserve(m_keySampleIndices.size());
+        keyValues.reserve(m_keyValues.size());
+        AZStd::vector<float> samples;
+
+        auto optimizeTrack = [&](Track& track, AZ::u32 numComponents, bool isRotation, const float* staticValue, float maxError)
+        {
+            const Track sourceTrack = track;
+            const float remainingError = maxError - sourceTrack.m_maxError;
+            if (sourceTrack.m_numKeys == 0 || remainingError <= 0.0f)
+            {
+                CopyTrack(sourceTrack, numComponents, track, keySampleIndices, keyValues);
+                return;
+            }
+
+            DecompressTrack(sourceTrack, numComponents, isRotation, samples);
+            CompressTrack(samples, numComponents, isRotation, staticValue, remainingError, track, keySampleIndices, keyValues);
+            track.m_maxError += sourceTrack.m_maxError;
+        };
+
+        float staticValue[4];
+
+        // Joints.
+        for (size_t i = 0; i < m_jointTracks.size(); ++i)
+        {
+            const bool isIgnored = IsInList(settings.m_jointIgnoreList, i);
+            const Transform& staticTransform = m_staticJointData[i].m_staticTransform;
+            JointTracks& jointTracks = m_jointTracks[i];
+
+            staticTransform.mPosition.StoreToFloat3(staticValue);
+            optimizeTrack(jointTracks.m_position, 3, false, staticValue, isIgnored ? 0.0f : settings.m_maxPosError);
+            staticTransform.mRotation.StoreToFloat4(staticValue);
+            optimizeTrack(jointTracks.m_rotation, 4, true, staticValue, isIgnored ? 0.0f : settings.m_maxRotError);
+#ifndef EMFX_SCALE_DISABLED
+            staticTransform.mScale.StoreToFloat3(staticValue);
+            optimizeTrack(jointTracks.m_scale, 3, false, staticValue, isIgnored ? 0.0f : settings.m_maxScaleError);
+#endif
+        }
+
+        // Morphs.
+        for (size_t i = 0; i < m_morphTracks.size(); ++i)
+        {
+            const float maxError = IsInList(settings.m_morphIgnoreList, i) ? 0.0f : settings.m_maxMorphError;
+            optimizeTrack(m_morphTracks[i], 1, false, &m_staticMorphData[i].m_staticValue, maxError);
+        }
+
+        // Floats.
+        for (size_t i = 0; i < m_floatTracks.size(); ++i)
+        {
+            const float maxError = IsInList(settings.m_floatIgnoreList, i) ? 0.0f : settings.m_maxFloatError;
+            optimizeTrack(m_floatTracks[i], 1, false, &m_staticFloatData[i].m_staticValue, maxError);
+        }
+
+        m_keySampleIndices = AZStd::move(keySampleIndices);
+        m_keyValues = AZStd::move(keyValues);
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedMotionData::CompressTrack(const AZStd::vector<float>& samples, AZ::u32 numComponents, bool isRotation, const float* staticValue, float maxError,
+        Track& outTrack, AZStd::vector<AZ::u16>& keySampleIndices, AZStd::vector<AZ::u16>& keyValues)
+    {
+        AZ_Assert(numComponents >= 1 && numComponents <= 4, "Expected between one and four components per sample.");
+        outTrack = Track();
+        const size_t numSamples = samples.size() / numComponents;
+        AZ_Assert(numSamples <= s_maxNumSamples, "Too many samples to index with 16 bits.");
+
+        // Tracks that never leave the static value don't need any keys.
+        float staticError = 0.0f;
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            staticError = AZ::GetMax(staticError, CalcError(&samples[s * numComponents], staticValue, numComponents, isRotation));
+        }
+        if (numSamples < 2 || staticError <= maxError)
+        {
+            outTrack.m_maxError = staticError;
+            return;
+        }
+
+        // Quantize all samples within the value range of the track, so that the fit accounts for the quantization error as well.
+        for (AZ::u32 c = 0; c < numComponents; ++c)
+        {
+            float minValue = samples[c];
+            float maxValue = samples[c];
+            for (size_t s = 1; s < numSamples; ++s)
+            {
+                minValue = AZ::GetMin(minValue, samples[s * numComponents + c]);
+                maxValue = AZ::GetMax(maxValue, samples[s * numComponents + c]);
+            }
+            outTrack.m_rangeMin[c] = minValue;
+            outTrack.m_rangeScale[c] = (maxValue - minValue) / s_numQuantizationSteps;
+        }
+
+        AZStd::vector<AZ::u16> quantized(samples.size());
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            const AZ::u32 c = static_cast<AZ::u32>(i % numComponents);
+            const float rangeScale = outTrack.m_rangeScale[c];
+            const float steps = (rangeScale > 0.0f) ? (samples[i] - outTrack.m_rangeMin[c]) / rangeScale : 0.0f;
+            quantized[i] = static_cast<AZ::u16>(AZ::GetClamp(steps + 0.5f, 0.0f, s_numQuantizationSteps));
+        }
+
+        // Returns the error of the worst sample in the given range, when reconstructed by interpolating between the quantized samples at keyA and keyB.
+        auto calcSegmentError = [&](size_t keyA, size_t keyB, size_t firstSample, size_t lastSample, float errorLimit) -> float
+        {
+            float segmentError = 0.0f;
+            float value[4];
+            const float invSpan = 1.0f / static_cast<float>(keyB - keyA);
+            for (size_t s = firstSample; s <= lastSample; ++s)
+            {
+                const float t = static_cast<float>(s - keyA) * invSpan;
+                DequantizeLerp(&quantized[keyA * numComponents], &quantized[keyB * numComponents], outTrack.m_rangeMin, outTrack.m_rangeScale, numComponents, t, value);
+                if (isRotation)
+                {
+                    NormalizeRotation(value);
+                }
+                segmentError = AZ::GetMax(segmentError, CalcError(value, &samples[s * numComponents], numComponents, isRotation));
+                if (segmentError > errorLimit)
+                {
+                    break;
+                }
+            }
+            return segmentError;
+        };
+
+        auto addKey = [&](size_t sampleIndex)
+        {
+            keySampleIndices.emplace_back(static_cast<AZ::u16>(sampleIndex));
+            keyValues.insert(keyValues.end(), quantized.begin() + sampleIndex * numComponents, quantized.begin() + (sampleIndex + 1) * numComponents);
+        };
+
+        // Greedily extend each segment for as long as all samples it skips stay within the error bound.
+        outTrack.m_firstKey = static_cast<AZ::u32>(keySampleIndices.size());
+        outTrack.m_firstValue = static_cast<AZ::u32>(keyValues.size());
+        addKey(0);
+        size_t keyA = 0;
+        while (keyA < numSamples - 1)
+        {
+            const size_t lastCandidate = AZ::GetMin(numSamples - 1, keyA + s_maxKeySpacing);
+            size_t keyB = keyA + 1;
+            while (keyB < lastCandidate && calcSegmentError(keyA, keyB + 1, keyA + 1, keyB, maxError) <= maxError)
+            {
+                ++keyB;
+            }
+
+            // Include the quantization error of the keys themselves in the error of the track.
+            outTrack.m_maxError = AZ::GetMax(outTrack.m_maxError, calcSegmentError(keyA, keyB, keyA, keyB, AZStd::numeric_limits<float>::max()));
+            addKey(keyB);
+            keyA = keyB;
+        }
+        outTrack.m_numKeys = static_cast<AZ::u32>(keySampleIndices.size() - outTrack.m_firstKey);
+    }
+
+    void CompressedMotionData::CopyTrack(const Track& track, AZ::u32 numComponents, Track& outTrack, AZStd::vector<AZ::u16>& keySampleIndices, AZStd::vector<AZ::u16>& keyValues) const
+    {
+        outTrack = track;
+        outTrack.m_firstKey = static_cast<AZ::u32>(keySampleIndices.size());
+        outTrack.m_firstValue = static_cast<AZ::u32>(keyValues.size());
+        keySampleIndices.insert(keySampleIndices.end(), m_keySampleIndices.begin() + track.m_firstKey, m_keySampleIndices.begin() + track.m_firstKey + track.m_numKeys);
+        keyValues.insert(keyValues.end(), m_keyValues.begin() + track.m_firstValue, m_keyValues.begin() + track.m_firstValue + track.m_numKeys * numComponents);
+    }
+
+    void CompressedMotionData::DecompressTrack(const Track& track, AZ::u32 numComponents, bool isRotation, AZStd::vector<float>& outSamples) const
+    {
+        outSamples.resize(m_numSamples * numComponents);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            float* value = &outSamples[s * numComponents];
+            SampleTrack(track, numComponents, static_cast<float>(s), value);
+            if (isRotation)
+            {
+                NormalizeRotation(value);
+            }
+        }
+    }
+
+    void CompressedMotionData::SampleTrack(const Track& track, AZ::u32 numComponents, float samplePosition, float* result) const
+    {
+        AZ_Assert(track.m_numKeys > 0, "Expected an animated track.");
+        const AZ::u16* sampleIndices = m_keySampleIndices.data() + track.m_firstKey;
+        const AZ::u16* values = m_keyValues.data() + track.m_firstValue;
+        if (track.m_numKeys == 1)
+        {
+            DequantizeLerp(values, values, track.m_rangeMin, track.m_rangeScale, numComponents, 0.0f, result);
+            return;
+        }
+
+        // The first and last key are always on the first and last sample, so only the keys in between have to be searched.
+        const AZ::u16* keyB = AZStd::upper_bound(sampleIndices + 1, sampleIndices + track.m_numKeys - 1, samplePosition,
+            [](float position, AZ::u16 sampleIndex) { return position < static_cast<float>(sampleIndex); });
+        const size_t indexB = keyB - sampleIndices;
+        const size_t indexA = indexB - 1;
+        const float sampleA = static_cast<float>(sampleIndices[indexA]);
+        const float sampleB = static_cast<float>(sampleIndices[indexB]);
+        const float t = AZ::GetClamp((samplePosition - sampleA) / (sampleB - sampleA), 0.0f, 1.0f);
+        DequantizeLerp(values + indexA * numComponents, values + indexB * numComponents, track.m_rangeMin, track.m_rangeScale, numComponents, t, result);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleVector3Track(const Track& track, float samplePosition) const
+    {
+        float value[3];
+        SampleTrack(track, 3, samplePosition, value);
+        return AZ::Vector3::CreateFromFloat3(value);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleRotationTrack(const Track& track, float samplePosition) const
+    {
+        float value[4];
+        SampleTrack(track, 4, samplePosition, value);
+        return AZ::Quaternion::CreateFromFloat4(value).GetNormalized();
+    }
+
+    float CompressedMotionData::SampleFloatTrack(const Track& track, float samplePosition) const
+    {
+        float value;
+        SampleTrack(track, 1, samplePosition, &value);
+        return value;
+    }
+
+    float CompressedMotionData::CalcSamplePosition(float sampleTime) const
+    {
+        if (m_numSamples < 2)
+        {
+            return 0.0f;
+        }
+        return AZ::GetClamp(sampleTime * m_sampleRate, 0.0f, static_cast<float>(m_numSamples - 1));
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const AZ::u32 transformDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && transformDataIndex == InvalidIndex32)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const bool inPlace = (settings.m_inPlace && skeleton->GetNode(jointSkeletonIndex)->GetIsRootNode());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (transformDataIndex != InvalidIndex32 && !inPlace)
+        {
+            result = SampleJointTransform(settings.m_sampleTime, transformDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.mAxis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).mSourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.mFlags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const SampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // All tracks share the same sample grid, so the sample position only has to be calculated once.
+        const float samplePosition = CalcSamplePosition(settings.m_sampleTime);
+
+        const AZStd::vector<AZ::u32>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const AZ::u32 numNodes = actorInstance->GetNumEnabledNodes();
+        for (AZ::u32 i = 0; i < numNodes; ++i)
+        {
+            const AZ::u32 skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            // Sample the interpolated data.
+            Transform result;
+            const AZ::u32 jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex32 && !inPlace)
+            {
+                const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+                const JointTracks& jointTracks = m_jointTracks[jointDataIndex];
+                result.mPosition = (jointTracks.m_position.m_numKeys > 0) ? SampleVector3Track(jointTracks.m_position, samplePosition) : staticTransform.mPosition;
+                result.mRotation = (jointTracks.m_rotation.m_numKeys > 0) ? SampleRotationTrack(jointTracks.m_rotation, samplePosition) : staticTransform.mRotation;
+#ifndef EMFX_SCALE_DISABLED
+                result.mScale = (jointTracks.m_scale.m_numKeys > 0) ? SampleVector3Track(jointTracks.m_scale, samplePosition) : staticTransform.mScale;
+#endif
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex32)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const AZ::u32 numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (AZ::u32 i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const Track& track = m_morphTracks[realIndex];
+                outputPose->SetMorphWeight(i, (track.m_numKeys > 0) ? SampleFloatTrack(track, samplePosition) : m_staticMorphData[realIndex].m_staticValue);
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const Track& track = m_morphTracks[morphDataIndex];
+        return (track.m_numKeys > 0) ? SampleFloatTrack(track, CalcSamplePosition(sampleTime)) : m_staticMorphData[morphDataIndex].m_staticValue;
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const Track& track = m_floatTracks[floatDataIndex];
+        return (track.m_numKeys > 0) ? SampleFloatTrack(track, CalcSamplePosition(sampleTime)) : m_staticFloatData[floatDataIndex].m_staticValue;
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const Track& track = m_jointTracks[jointDataIndex].m_position;
+        return (track.m_numKeys > 0) ? SampleVector3Track(track, CalcSamplePosition(sampleTime)) : m_staticJointData[jointDataIndex].m_staticTransform.mPosition;
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const Track& track = m_jointTracks[jointDataIndex].m_rotation;
+        return (track.m_numKeys > 0) ? SampleRotationTrack(track, CalcSamplePosition(sampleTime)) : m_staticJointData[jointDataIndex].m_staticTransform.mRotation;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const Track& track = m_jointTracks[jointDataIndex].m_scale;
+        return (track.m_numKeys > 0) ? SampleVector3Track(track, CalcSamplePosition(sampleTime)) : m_staticJointData[jointDataIndex].m_staticTransform.mScale;
+    }
+#endif
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        const float samplePosition = CalcSamplePosition(sampleTime);
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+        const JointTracks& jointTracks = m_jointTracks[jointDataIndex];
+
+        return Transform
+        (
+            (jointTracks.m_position.m_numKeys > 0) ? SampleVector3Track(jointTracks.m_position, samplePosition) : staticTransform.mPosition,
+            (jointTracks.m_rotation.m_numKeys > 0) ? SampleRotationTrack(jointTracks.m_rotation, samplePosition) : staticTransform.mRotation
+
+#ifndef EMFX_SCALE_DISABLED
+            ,(jointTracks.m_scale.m_numKeys > 0) ? SampleVector3Track(jointTracks.m_scale, samplePosition) : staticTransform.mScale
+#endif
+        );
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointTracks.resize(numJoints);
+        m_morphTracks.resize(numMorphs);
+        m_floatTracks.resize(numFloats);
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointTracks.size(), "Expected the size of the jointTracks vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointTracks.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphTracks.size(), "Expected the size of the morphTracks vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphTracks.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatTracks.size(), "Expected the size of the floatTracks vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatTracks.emplace_back();
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointTracks.erase(m_jointTracks.begin() + jointDataIndex);
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphTracks.erase(m_morphTracks.begin() + morphDataIndex);
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatTracks.erase(m_floatTracks.begin() + floatDataIndex);
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointTracks.clear();
+        m_jointTracks.shrink_to_fit();
+        m_morphTracks.clear();
+        m_morphTracks.shrink_to_fit();
+        m_floatTracks.clear();
+        m_floatTracks.shrink_to_fit();
+        m_keySampleIndices.clear();
+        m_keySampleIndices.shrink_to_fit();
+        m_keyValues.clear();
+        m_keyValues.shrink_to_fit();
+
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Scaling the value range scales all keys of the track.
+        for (JointTracks& jointTracks : m_jointTracks)
+        {
+            Track& track = jointTracks.m_position;
+            for (AZ::u32 c = 0; c < 3; ++c)
+            {
+                track.m_rangeMin[c] *= scaleFactor;
+                track.m_rangeScale[c] *= scaleFactor;
+            }
+            track.m_maxError *= AZ::GetAbs(scaleFactor);
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0 && m_sampleRate > 0.0f) ? static_cast<float>(m_numSamples - 1) / m_sampleRate : 0.0f;
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointTracks& jointTracks : m_jointTracks)
+        {
+            jointTracks = JointTracks();
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (Track& track : m_morphTracks)
+        {
+            track = Track();
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (Track& track : m_floatTracks)
+        {
+            track = Track();
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_position = Track();
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_rotation = Track();
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex].m_scale = Track();
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        m_jointTracks[jointDataIndex] = JointTracks();
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphTracks[morphDataIndex] = Track();
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatTracks[floatDataIndex] = Track();
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_position.m_numKeys > 0;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_rotation.m_numKeys > 0;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_scale.m_numKeys > 0;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex);
+#else
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex);
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphTracks[morphDataIndex].m_numKeys > 0;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatTracks[floatDataIndex].m_numKeys > 0;
+    }
+
+    float CompressedMotionData::GetJointPositionMaxError(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_position.m_maxError;
+    }
+
+    float CompressedMotionData::GetJointRotationMaxError(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_rotation.m_maxError;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    float CompressedMotionData::GetJointScaleMaxError(size_t jointDataIndex) const
+    {
+        return m_jointTracks[jointDataIndex].m_scale.m_maxError;
+    }
+#endif
+
+    float CompressedMotionData::GetMorphMaxError(size_t morphDataIndex) const
+    {
+        return m_morphTracks[morphDataIndex].m_maxError;
+    }
+
+    float CompressedMotionData::GetFloatMaxError(size_t floatDataIndex) const
+    {
+        return m_floatTracks[floatDataIndex].m_maxError;
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    size_t CompressedMotionData::CalcNumKeys() const
+    {
+        size_t numKeys = 0;
+        for (const JointTracks& jointTracks : m_jointTracks)
+        {
+            numKeys += jointTracks.m_position.m_numKeys + jointTracks.m_rotation.m_numKeys;
+#ifndef EMFX_SCALE_DISABLED
+            numKeys += jointTracks.m_scale.m_numKeys;
+#endif
+        }
+        for (const Track& track : m_morphTracks)
+        {
+            numKeys += track.m_numKeys;
+        }
+        for (const Track& track : m_floatTracks)
+        {
+            numKeys += track.m_numKeys;
+        }
+        return numKeys;
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        float m_sampleRate = 30.0f;
+        float m_duration = 0.0f;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+    };
+
+    struct File_CompressedMotionData_Track
+    {
+        AZ::u32 m_numKeys = 0;          // Zero when the track is not animated.
+        float m_maxError = 0.0f;        // The largest per component difference with the source samples.
+        float m_rangeMin[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float m_rangeScale[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        // Followed by:
+        // AZ::u16[m_numKeys]                 : The sample index of each key.
+        // AZ::u16[m_numKeys * numComponents] : The quantized values of each key, where numComponents is 3 for positions and scales, 4 for rotations and 1 for floats.
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+
+        // Followed by:
+        // string : The name of the joint.
+        // File_CompressedMotionData_Track : The position track.
+        // File_CompressedMotionData_Track : The rotation track.
+        // File_CompressedMotionData_Track : The scale track (always written, also when scale is disabled).
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+
+        // Followed by:
+        // string : The name of the channel.
+        // File_CompressedMotionData_Track : The track.
+    };
+    //---------------------------------------------------------------------------------------
+
+    size_t CompressedMotionData::CalcTrackSaveSizeInBytes(const Track& track, AZ::u32 numComponents) const
+    {
+        return sizeof(File_CompressedMotionData_Track) + track.m_numKeys * sizeof(AZ::u16) * (1 + numComponents);
+    }
+
+    bool CompressedMotionData::SaveTrack(MCore::Stream* stream, const Track& track, AZ::u32 numComponents, MCore::Endian::EEndianType targetEndianType) const
+    {
+        File_CompressedMotionData_Track trackChunk;
+        trackChunk.m_numKeys = track.m_numKeys;
+        trackChunk.m_maxError = track.m_maxError;
+        for (AZ::u32 c = 0; c < 4; ++c)
+        {
+            trackChunk.m_rangeMin[c] = track.m_rangeMin[c];
+            trackChunk.m_rangeScale[c] = track.m_rangeScale[c];
+            ExporterLib::ConvertFloat(&trackChunk.m_rangeMin[c], targetEndianType);
+            ExporterLib::ConvertFloat(&trackChunk.m_rangeScale[c], targetEndianType);
+        }
+        ExporterLib::ConvertUnsignedInt(&trackChunk.m_numKeys, targetEndianType);
+        ExporterLib::ConvertFloat(&trackChunk.m_maxError, targetEndianType);
+        if (stream->Write(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+        {
+            return false;
+        }
+
+        if (track.m_numKeys == 0)
+        {
+            return true;
+        }
+
+        // Write the key sample indices followed by the key values, each in a single write.
+        AZStd::vector<AZ::u16> keyData(m_keySampleIndices.begin() + track.m_firstKey, m_keySampleIndices.begin() + track.m_firstKey + track.m_numKeys);
+        keyData.insert(keyData.end(), m_keyValues.begin() + track.m_firstValue, m_keyValues.begin() + track.m_firstValue + track.m_numKeys * numComponents);
+        for (AZ::u16& value : keyData)
+        {
+            ExporterLib::ConvertUnsignedShort(&value, targetEndianType);
+        }
+        return stream->Write(keyData.data(), keyData.size() * sizeof(AZ::u16)) != 0;
+    }
+
+    bool CompressedMotionData::ReadTrack(MCore::Stream* stream, Track& track, AZ::u32 numComponents, MCore::Endian::EEndianType sourceEndianType)
+    {
+        File_CompressedMotionData_Track trackChunk;
+        if (stream->Read(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+        {
+            return false;
+        }
+        MCore::Endian::ConvertUnsignedInt32(&trackChunk.m_numKeys, sourceEndianType);
+        MCore::Endian::ConvertFloat(&trackChunk.m_maxError, sourceEndianType);
+        MCore::Endian::ConvertFloat(trackChunk.m_rangeMin, sourceEndianType, 4);
+        MCore::Endian::ConvertFloat(trackChunk.m_rangeScale, sourceEndianType, 4);
+
+        if (trackChunk.m_numKeys > m_numSamples)
+        {
+            AZ_Error("EMotionFX", false, "Compressed motion track has more keys (%u) than samples (%zu).", trackChunk.m_numKeys, m_numSamples);
+            return false;
+        }
+
+        track = Track();
+        track.m_firstKey = static_cast<AZ::u32>(m_keySampleIndices.size());
+        track.m_firstValue = static_cast<AZ::u32>(m_keyValues.size());
+        track.m_numKeys = trackChunk.m_numKeys;
+        track.m_maxError = trackChunk.m_maxError;
+        for (AZ::u32 c = 0; c < 4; ++c)
+        {
+            track.m_rangeMin[c] = trackChunk.m_rangeMin[c];
+            track.m_rangeScale[c] = trackChunk.m_rangeScale[c];
+        }
+
+        if (track.m_numKeys == 0)
+        {
+            return true;
+        }
+
+        m_keySampleIndices.resize(track.m_firstKey + track.m_numKeys);
+        AZ::u16* sampleIndices = m_keySampleIndices.data() + track.m_firstKey;
+        if (stream->Read(sampleIndices, track.m_numKeys * sizeof(AZ::u16)) == 0)
+        {
+            return false;
+        }
+        MCore::Endian::ConvertUnsignedInt16(sampleIndices, sourceEndianType, track.m_numKeys);
+
+        const AZ::u32 numValues = track.m_numKeys * numComponents;
+        m_keyValues.resize(track.m_firstValue + numValues);
+        AZ::u16* values = m_keyValues.data() + track.m_firstValue;
+        if (stream->Read(values, numValues * sizeof(AZ::u16)) == 0)
+        {
+            return false;
+        }
+        MCore::Endian::ConvertUnsignedInt16(values, sourceEndianType, numValues);
+
+        // Sampling relies on the keys being sorted and on the first and last key being on the first and last sample.
+        if (sampleIndices[0] != 0 || sampleIndices[track.m_numKeys - 1] != m_numSamples - 1 || !AZStd::is_sorted(sampleIndices, sampleIndices + track.m_numKeys))
+        {
+            AZ_Error("EMotionFX", false, "Compressed motion track has invalid key sample indices.");
+            return false;
+        }
+
+        return true;
+    }
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        // Add the joints to the size.
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            const JointTracks& jointTracks = m_jointTracks[i];
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+            numBytes += CalcTrackSaveSizeInBytes(jointTracks.m_position, 3);
+            numBytes += CalcTrackSaveSizeInBytes(jointTracks.m_rotation, 4);
+#ifndef EMFX_SCALE_DISABLED
+            numBytes += CalcTrackSaveSizeInBytes(jointTracks.m_scale, 3);
+#else
+            numBytes += CalcTrackSaveSizeInBytes(Track(), 3);
+#endif
+        }
+
+        // Add the morphs channels to the size.
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += CalcTrackSaveSizeInBytes(m_morphTracks[i], 1);
+        }
+
+        // Add the float channels to the size.
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += CalcTrackSaveSizeInBytes(m_floatTracks[i], 1);
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_sampleRate = GetSampleRate();
+        info.m_duration = GetDuration();
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_duration, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, MCore::Compressed16BitQuaternion(GetJointStaticRotation(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, MCore::Compressed16BitQuaternion(GetJointBindPoseRotation(i)));
+#ifndef EMFX_SCALE_DISABLED
+            ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+#endif
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                MCore::LogDetailedInfo("   + Position Keys: %u (max error %f)", m_jointTracks[i].m_position.m_numKeys, m_jointTracks[i].m_position.m_maxError);
+                MCore::LogDetailedInfo("   + Rotation Keys: %u (max error %f)", m_jointTracks[i].m_rotation.m_numKeys, m_jointTracks[i].m_rotation.m_maxError);
+#ifndef EMFX_SCALE_DISABLED
+                MCore::LogDetailedInfo("   + Scale Keys:    %u (max error %f)", m_jointTracks[i].m_scale.m_numKeys, m_jointTracks[i].m_scale.m_maxError);
+#endif
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+
+            const JointTracks& jointTracks = m_jointTracks[i];
+#ifndef EMFX_SCALE_DISABLED
+            const Track& scaleTrack = jointTracks.m_scale;
+#else
+            const Track scaleTrack;
+#endif
+            if (!SaveTrack(stream, jointTracks.m_position, 3, targetEndianType) ||
+                !SaveTrack(stream, jointTracks.m_rotation, 4, targetEndianType) ||
+                !SaveTrack(stream, scaleTrack, 3, targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph and float channels.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (GetMorphName(i).empty())
+            {
+                MCore::LogError("Cannot save morph channel with empty name.");
+                return false;
+            }
+
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = GetMorphStaticValue(i);
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetMorphName(i), stream, targetEndianType);
+            if (!SaveTrack(stream, m_morphTracks[i], 1, targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (GetFloatName(i).empty())
+            {
+                MCore::LogError("Cannot save float channel with empty name.");
+                return false;
+            }
+
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = GetFloatStaticValue(i);
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetFloatName(i), stream, targetEndianType);
+            if (!SaveTrack(stream, m_floatTracks[i], 1, targetEndianType))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_duration, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        if (info.m_numSamples > s_maxNumSamples)
+        {
+            AZ_Error("EMotionFX", false, "Compressed motion data has too many samples (%u).", info.m_numSamples);
+            return false;
+        }
+
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        MotionData::SetSampleRate(info.m_sampleRate);
+        m_numSamples = info.m_numSamples;
+        m_duration = info.m_duration;
+
+        // Read all joints.
+        AZStd::string name;
+        for (size_t i = 0; i < info.m_numJoints; ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.mX, jointInfo.m_staticPos.mY, jointInfo.m_staticPos.mZ);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.mX, jointInfo.m_staticScale.mY, jointInfo.m_staticScale.mZ);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.mX, jointInfo.m_staticRot.mY, jointInfo.m_staticRot.mZ, jointInfo.m_staticRot.mW);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.mX, jointInfo.m_bindPosePos.mY, jointInfo.m_bindPosePos.mZ);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.mX, jointInfo.m_bindPoseScale.mY, jointInfo.m_bindPoseScale.mZ);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.mX, jointInfo.m_bindPoseRot.mY, jointInfo.m_bindPoseRot.mZ, jointInfo.m_bindPoseRot.mW);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            // Update the values.
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            JointTracks& jointTracks = m_jointTracks[i];
+            if (!ReadTrack(stream, jointTracks.m_position, 3, sourceEndianType) ||
+                !ReadTrack(stream, jointTracks.m_rotation, 4, sourceEndianType))
+            {
+                return false;
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (!ReadTrack(stream, jointTracks.m_scale, 3, sourceEndianType))
+            {
+                return false;
+            }
+#else
+            // Scale isn't supported, read the track and clear it again.
+            Track scaleTrack;
+            if (!ReadTrack(stream, scaleTrack, 3, sourceEndianType))
+            {
+                return false;
+            }
+#endif
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - NumPosKeys   = %u", jointTracks.m_position.m_numKeys);
+                MCore::LogDetailedInfo("    - NumRotKeys   = %u", jointTracks.m_rotation.m_numKeys);
+            }
+        }
+
+        // Read the morphs and floats.
+        for (size_t i = 0; i < info.m_numMorphs; ++i)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, floatInfo.m_staticValue);
+            if (!ReadTrack(stream, m_morphTracks[i], 1, sourceEndianType))
+            {
+                return false;
+            }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + Morph: '%s'", name.c_str());
+                MCore::LogDetailedInfo("       + NumKeys      = %u", m_morphTracks[i].m_numKeys);
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+        }
+
+        for (size_t i = 0; i < info.m_numFloats; ++i)
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, floatInfo.m_staticValue);
+            if (!ReadTrack(stream, m_floatTracks[i], 1, sourceEndianType))
+            {
+                return false;
+            }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + Float: '%s'", name.c_str());
+                MCore::LogDetailedInfo("       + NumKeys      = %u", m_floatTracks[i].m_numKeys);
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+        }
+
+#ifdef EMFX_SCALE_DISABLED
+        // Drop the keys of the scale tracks that were read above, by rebuilding the key arrays from the remaining tracks.
+        OptimizeSettings copySettings;
+        copySettings.m_maxPosError = copySettings.m_maxRotError = copySettings.m_maxMorphError = copySettings.m_maxFloatError = 0.0f;
+        Optimize(copySettings);
+#endif
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
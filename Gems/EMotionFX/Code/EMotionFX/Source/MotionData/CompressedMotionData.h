@@ -0,0 +1,156 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    // Motion data that stores each animated channel as a keyframe reduced, quantized track.
+    // The source motion is sampled at a uniform sample rate, after which each track only keeps the keys that are needed to reproduce all of
+    // the source samples within the track's error bound using linear interpolation. Key times are stored as 16 bit indices into the uniform
+    // sample grid and key values are quantized to 16 bits per component, relative to the value range of their track.
+    // The keys of all tracks share two contiguous arrays, ordered by joint, so that sampling a pose walks through memory in a single pass.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{70681895-D7A4-4C2E-9D7D-9890C3562EFA}", MotionData)
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetFbxSettingsName() const override;
+
+        // Compress any other type of motion data, by sampling it at the given sample rate and reducing each track within the errors of the settings.
+        void InitFromMotionData(const MotionData* motionData, float sampleRate, const OptimizeSettings& settings);
+
+        // Overloaded.
+        Transform SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const override;
+        void SamplePose(const SampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        // Clearing a track only marks it as not animated, the memory of its keys is reclaimed the next time the tracks are rebuilt.
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+        // The largest difference between the source samples and the compressed track, measured per component like MotionData::OptimizeSettings.
+        float GetJointPositionMaxError(size_t jointDataIndex) const;
+        float GetJointRotationMaxError(size_t jointDataIndex) const;
+        float GetMorphMaxError(size_t morphDataIndex) const;
+        float GetFloatMaxError(size_t floatDataIndex) const;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+        float GetJointScaleMaxError(size_t jointDataIndex) const;
+#endif
+
+        size_t GetNumSamples() const;
+        size_t CalcNumKeys() const;
+        void UpdateDuration() override;
+
+    private:
+        static constexpr size_t s_maxNumSamples = 65536;    // Key times are stored as 16 bit sample indices.
+        static constexpr AZ::u32 s_maxKeySpacing = 256;     // Limits the number of samples a single fitted segment can span, to bound compression time.
+
+        struct EMFX_API Track
+        {
+            AZ::u32 m_firstKey = 0;         // Index of the first key in m_keySampleIndices.
+            AZ::u32 m_firstValue = 0;       // Index of the first component of the first key in m_keyValues.
+            AZ::u32 m_numKeys = 0;          // Zero when the track is not animated.
+            float m_maxError = 0.0f;        // The largest per component difference with the source samples.
+            float m_rangeMin[4] = { 0.0f, 0.0f, 0.0f, 0.0f };   // Per component value that a quantized value of 0 maps to.
+            float m_rangeScale[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // Per component size of a single quantization step.
+        };
+
+        struct EMFX_API JointTracks
+        {
+            Track m_position;
+            Track m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+            Track m_scale;
+#endif
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        // Fit a track to uniformly spaced samples (numComponents floats per sample), appending its keys to the given arrays.
+        // The track is left unanimated when all samples are within maxError of the static value.
+        static void CompressTrack(const AZStd::vector<float>& samples, AZ::u32 numComponents, bool isRotation, const float* staticValue, float maxError,
+            Track& outTrack, AZStd::vector<AZ::u16>& keySampleIndices, AZStd::vector<AZ::u16>& keyValues);
+        void CopyTrack(const Track& track, AZ::u32 numComponents, Track& outTrack, AZStd::vector<AZ::u16>& keySampleIndices, AZStd::vector<AZ::u16>& keyValues) const;
+        void DecompressTrack(const Track& track, AZ::u32 numComponents, bool isRotation, AZStd::vector<float>& outSamples) const;
+        void SampleTrack(const Track& track, AZ::u32 numComponents, float samplePosition, float* result) const;
+        AZ::Vector3 SampleVector3Track(const Track& track, float samplePosition) const;
+        AZ::Quaternion SampleRotationTrack(const Track& track, float samplePosition) const;
+        float SampleFloatTrack(const Track& track, float samplePosition) const;
+        float CalcSamplePosition(float sampleTime) const;
+
+        bool SaveTrack(MCore::Stream* stream, const Track& track, AZ::u32 numComponents, MCore::Endian::EEndianType targetEndianType) const;
+        bool ReadTrack(MCore::Stream* stream, Track& track, AZ::u32 numComponents, MCore::Endian::EEndianType sourceEndianType);
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+        size_t CalcTrackSaveSizeInBytes(const Track& track, AZ::u32 numComponents) const;
+
+        AZStd::vector<JointTracks> m_jointTracks;
+        AZStd::vector<Track> m_morphTracks;
+        AZStd::vector<Track> m_floatTracks;
+        AZStd::vector<AZ::u16> m_keySampleIndices;  // The sample index of every key, for all tracks.
+        AZStd::vector<AZ::u16> m_keyValues;         // The quantized components of every key, for all tracks.
+        size_t m_numSamples = 0;
+    };
+} // namespace EMotionFX
@@ -24,6 +24,8 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/containers/unordered_set.h>
 
 
 namespace EMotionFX
@@ -36,6 +38,8 @@ namespace EMotionFX
     {
         mSteps.SetMemoryCategory(EMFX_MEMCATEGORY_UPDATESCHEDULERS);
         mCleanTimer     = 0.0f; // time passed since last schedule cleanup, in seconds
+        mNumJobGraphRoots = 0;
+        mJobGraphDirty  = false;
         mSteps.Reserve(1000);
     }
 
@@ -58,6 +62,9 @@ namespace EMotionFX
     {
         Lock();
         mSteps.Clear();
+        mJobGraph.clear();
+        mNumJobGraphRoots = 0;
+        mJobGraphDirty = false;
         Unlock();
     }
 
@@ -89,6 +96,8 @@ namespace EMotionFX
             AZ_Printf("EMotionFX", "STEP %.3d - %d", i, mSteps[i].mActorInstances.size());
         }
 
+        AZ_Printf("EMotionFX", "JOB GRAPH - %d nodes, %d roots", mJobGraph.size(), mNumJobGraphRoots);
+
         AZ_Printf("EMotionFX", "---------");
     }
 
@@ -116,8 +125,7 @@ namespace EMotionFX
     {
         MCore::LockGuardRecursive guard(mMutex);
 
-        uint32 numSteps = mSteps.GetLength();
-        if (numSteps == 0)
+        if (mSteps.GetLength() == 0)
         {
             return;
         }
@@ -128,7 +136,6 @@ namespace EMotionFX
         {
             mCleanTimer = 0.0f;
             RemoveEmptySteps();
-            numSteps = mSteps.GetLength();
         }
 
         //-----------------------------------------------------------
@@ -152,67 +159,157 @@ namespace EMotionFX
         mNumVisible.SetValue(0);
         mNumSampled.SetValue(0);
 
-        for (uint32 s = 0; s < numSteps; ++s)
+        if (mJobGraphDirty)
         {
-            const ScheduleStep& currentStep = mSteps[s];
+            RebuildJobGraph();
+        }
 
-            // skip empty steps
-            const size_t numStepEntries = currentStep.mActorInstances.size();
-            if (numStepEntries == 0)
-            {
-                continue;
-            }
+        if (mNumJobGraphRoots == 0)
+        {
+            return;
+        }
 
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;           
-            for (uint32 c = 0; c < numStepEntries; ++c)
+        // Start the root nodes in batches, so that we don't create a job per actor instance when there are many of them.
+        // The attachments of the root nodes get started from within the jobs, as soon as the pose they depend on is ready.
+        const uint32 numJobsPerWorkerThread = 4;
+        const uint32 numWorkerThreads = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        const uint32 batchSize = AZ::GetMax<uint32>(1, mNumJobGraphRoots / AZ::GetMax<uint32>(1, numWorkerThreads * numJobsPerWorkerThread));
+
+        AZ::JobCompletion jobCompletion;
+        for (uint32 firstRoot = 0; firstRoot < mNumJobGraphRoots; firstRoot += batchSize)
+        {
+            const uint32 endRoot = AZ::GetMin(firstRoot + batchSize, mNumJobGraphRoots);
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, firstRoot, endRoot](AZ::Job& thisJob)
             {
-                ActorInstance* actorInstance = currentStep.mActorInstances[c];
-                if (actorInstance->GetIsEnabled() == false)
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
+                for (uint32 i = firstRoot; i < endRoot; ++i)
                 {
-                    continue;
+                    ExecuteJobGraphNode(thisJob, i, timePassedInSeconds);
                 }
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
 
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+
+    void MultiThreadScheduler::ExecuteJobGraphNode(AZ::Job& job, uint32 nodeIndex, float timePassedInSeconds)
+    {
+        // Walk down the attachment chain on the calling thread, only forking jobs for the additional attachments.
+        for (;;)
+        {
+            const JobGraphNode& node = mJobGraph[nodeIndex];
+            if (node.mActorInstance->GetIsEnabled())
+            {
+                UpdateActorInstance(node.mActorInstance, timePassedInSeconds);
+            }
+
+            if (node.mNumChildren == 0)
+            {
+                return;
+            }
+
+            const uint32 lastChild = node.mFirstChild + node.mNumChildren - 1;
+            for (uint32 child = node.mFirstChild; child < lastChild; ++child)
+            {
                 AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
+                AZ::Job* childJob = AZ::CreateJobFunction([this, timePassedInSeconds, child](AZ::Job& thisJob)
                 {
-                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
-
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
-
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
-                    {
-                        mNumVisible.Increment();
-                    }
-
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
-
-                        if (isVisible)
-                        {
-                            mNumSampled.Increment();
-                        }
-                    }
-
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::AttachmentUpdateJob");
+                    ExecuteJobGraphNode(thisJob, child, timePassedInSeconds);
                 }, true, jobContext);
 
-                job->SetDependent(&jobCompletion);               
-                job->Start();
+                job.StartAsChild(childJob);
+            }
+
+            nodeIndex = lastChild;
+        }
+    }
+
+
+    void MultiThreadScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+        actorInstance->SetThreadIndex(threadIndex);
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            mNumVisible.Increment();
+        }
 
-                mNumUpdated.Increment();
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                mNumSampled.Increment();
             }
+        }
 
-            jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
+        // update the actor instance
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+        mNumUpdated.Increment();
+    }
+
+
+    void MultiThreadScheduler::RebuildJobGraph()
+    {
+        mJobGraph.clear();
+        mNumJobGraphRoots = 0;
+        mJobGraphDirty = false;
+
+        AZStd::unordered_set<const ActorInstance*> scheduledActorInstances;
+        const uint32 numSteps = mSteps.GetLength();
+        for (uint32 s = 0; s < numSteps; ++s)
+        {
+            scheduledActorInstances.insert(mSteps[s].mActorInstances.begin(), mSteps[s].mActorInstances.end());
+        }
+        mJobGraph.reserve(scheduledActorInstances.size());
+
+        // The root nodes are the actor instances that are not attached to any other scheduled actor instance.
+        for (uint32 s = 0; s < numSteps; ++s)
+        {
+            for (ActorInstance* actorInstance : mSteps[s].mActorInstances)
+            {
+                const ActorInstance* attachedTo = actorInstance->GetAttachedTo();
+                if (!attachedTo || scheduledActorInstances.find(attachedTo) == scheduledActorInstances.end())
+                {
+                    mJobGraph.push_back({ actorInstance, 0, 0 });
+                }
+            }
+        }
+        mNumJobGraphRoots = static_cast<uint32>(mJobGraph.size());
+
+        // Append the attachments of each node in breadth first order, so that the attachments of a node are stored next to each other.
+        for (size_t i = 0; i < mJobGraph.size(); ++i)
+        {
+            ActorInstance* actorInstance = mJobGraph[i].mActorInstance;
+            const uint32 firstChild = static_cast<uint32>(mJobGraph.size());
+            const uint32 numAttachments = actorInstance->GetNumAttachments();
+            for (uint32 a = 0; a < numAttachments; ++a)
+            {
+                ActorInstance* attachment = actorInstance->GetAttachment(a)->GetAttachmentActorInstance();
+                if (attachment && attachment->GetAttachedTo() == actorInstance && scheduledActorInstances.find(attachment) != scheduledActorInstances.end())
+                {
+                    mJobGraph.push_back({ attachment, 0, 0 });
+                }
+            }
+
+            mJobGraph[i].mFirstChild = firstChild;
+            mJobGraph[i].mNumChildren = static_cast<uint32>(mJobGraph.size()) - firstChild;
+        }
+
+        AZ_Assert(mJobGraph.size() == scheduledActorInstances.size(), "Expected each scheduled actor instance to be part of the job graph exactly once.");
     }
 
 
@@ -257,6 +354,7 @@ namespace EMotionFX
     {
         MCore::LockGuardRecursive guard(mMutex);
         AZ_Assert(!HasActorInstanceInSteps(instance), "Expected the actor instance not being part of another step already.");
+        mJobGraphDirty = true;
 
         // find the first free location that doesn't conflict
         uint32 outStep = startStep;
@@ -315,6 +413,8 @@ namespace EMotionFX
             // and if so, reconstruct the dependencies of this step
             if (step.mActorInstances.size() < numActorInstancesPreRemove)
             {
+                mJobGraphDirty = true;
+
                 // clear the dependencies (but don't delete the memory)
                 step.mDependencies.Clear(false);
 
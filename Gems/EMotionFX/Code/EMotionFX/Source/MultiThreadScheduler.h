@@ -17,6 +17,12 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Job;
+}
 
 namespace EMotionFX
 {
@@ -29,6 +35,8 @@ namespace EMotionFX
      * The multi processor scheduler.
      * This class can manage the actor instances in such a way that multiple actor instances can be processed at the same time
      * without getting any conflicts with shared memory.
+     * The update is executed as a graph of jobs. Attachments depend on the pose of the actor instance they are attached to, so the jobs
+     * of the attachments get started as soon as their parent has been updated, rather than waiting for all actor instances at the same depth.
      * If however you wish to let EMotion FX only use one single CPU, or if the target system ahs only one CPU, it is recommended
      * to use the SingleThreadScheduler class instead, as that will be faster in that specific case.
      * Significant performance gains can be achieved by using this scheduler on multi-processor or multi-core systems though.
@@ -66,6 +74,18 @@ namespace EMotionFX
             }
         };
 
+        /**
+         * A node in the job graph that gets executed by the update.
+         * Each node updates a single actor instance, after which the nodes of its attachments get executed.
+         * The attachment nodes of a node are stored next to each other, and all root nodes are stored at the start of the graph.
+         */
+        struct EMFX_API JobGraphNode
+        {
+            ActorInstance*  mActorInstance;     /**< The actor instance to update. */
+            uint32          mFirstChild;        /**< The index of the first attachment node. */
+            uint32          mNumChildren;       /**< The number of attachment nodes that depend on this node. */
+        };
+
         /**
          * The constructor.
          */
@@ -134,13 +154,45 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(uint32 index) const { return mSteps[index]; }
         uint32 GetNumScheduleSteps() const { return mSteps.GetLength(); }
 
+        /**
+         * Get the job graph, as it was built by the last call to Execute.
+         * @result The nodes of the job graph, starting with the root nodes.
+         */
+        const AZStd::vector<JobGraphNode>& GetJobGraph() const { return mJobGraph; }
+        uint32 GetNumJobGraphRoots() const { return mNumJobGraphRoots; }
+
     protected:
         MCore::Array< ScheduleStep >    mSteps;         /**< An array of update steps, that together form the schedule. */
+        AZStd::vector<JobGraphNode>     mJobGraph;      /**< The job graph that is built from the schedule, and executed during the update. */
+        uint32                          mNumJobGraphRoots; /**< The number of nodes at the start of the job graph that do not depend on any other node. */
+        bool                            mJobGraphDirty; /**< Set when the schedule changed and the job graph has to be rebuilt. */
         float                           mCleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
         MCore::MutexRecursive           mMutex;
 
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
+        /**
+         * Rebuild the job graph from the actor instances in the schedule steps.
+         * Actor instances that are attached to an actor instance that is not part of the schedule become root nodes.
+         */
+        void RebuildJobGraph();
+
+        /**
+         * Update the actor instance of a job graph node, after which the attachment nodes get executed.
+         * All but the last attachment are started as child jobs of the given job, while the last one continues on the calling thread.
+         * @param job The currently executing job, which will wait for the attachment jobs to complete.
+         * @param nodeIndex The index of the node in the job graph.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteJobGraphNode(AZ::Job& job, uint32 nodeIndex, float timePassedInSeconds);
+
+        /**
+         * Update the transformations of a single actor instance and the scheduler statistics.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds);
+
         /**
          * The constructor.
          */
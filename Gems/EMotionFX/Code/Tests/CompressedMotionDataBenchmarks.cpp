@@ -0,0 +1,140 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+
+namespace EMotionFX
+{
+    //! Compares compressing a motion and sampling it with the compressed, uniform and non-uniform motion data.
+    class BM_CompressedMotionData
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr float SampleRate = 30.0f;
+        static constexpr size_t NumSamples = 30 * 60 + 1;
+        static constexpr size_t NumSampleTimes = 997;
+
+        enum MotionDataType : int64_t
+        {
+            NonUniform,
+            Uniform,
+            Compressed
+        };
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            Allocators::Create();
+
+            m_sourceData = aznew NonUniformMotionData();
+            m_sourceData->Resize(1, 0, 0);
+            m_sourceData->AllocateJointPositionSamples(0, NumSamples);
+            m_sourceData->AllocateJointRotationSamples(0, NumSamples);
+            for (size_t i = 0; i < NumSamples; ++i)
+            {
+                const float time = static_cast<float>(i) / SampleRate;
+                const float angle = sinf(time * 3.0f);
+                m_sourceData->SetJointPositionSample(0, i, { time, AZ::Vector3(sinf(time), cosf(time * 2.0f), time * 0.5f) });
+                m_sourceData->SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(angle) * AZ::Quaternion::CreateRotationX(angle * 0.5f) });
+            }
+            m_sourceData->UpdateDuration();
+
+            m_uniformData = aznew UniformMotionData();
+            m_uniformData->InitFromNonUniformData(m_sourceData, false, SampleRate);
+            m_compressedData = aznew CompressedMotionData();
+            m_compressedData->InitFromMotionData(m_sourceData, SampleRate, MotionData::OptimizeSettings());
+
+            // spread the sample times over the whole motion, in an order that doesn't just step through the keys
+            const float duration = m_sourceData->GetDuration();
+            m_sampleTimes.resize(NumSampleTimes);
+            for (size_t i = 0; i < NumSampleTimes; ++i)
+            {
+                m_sampleTimes[i] = duration * (static_cast<float>((i * 613) % NumSampleTimes) / static_cast<float>(NumSampleTimes - 1));
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_sampleTimes = {};
+            delete m_compressedData;
+            delete m_uniformData;
+            delete m_sourceData;
+            m_compressedData = nullptr;
+            m_uniformData = nullptr;
+            m_sourceData = nullptr;
+
+            Allocators::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        const MotionData* GetMotionData(int64_t type) const
+        {
+            switch (type)
+            {
+            case Uniform:
+                return m_uniformData;
+            case Compressed:
+                return m_compressedData;
+            default:
+                return m_sourceData;
+            }
+        }
+
+    protected:
+        NonUniformMotionData* m_sourceData = nullptr;
+        UniformMotionData* m_uniformData = nullptr;
+        CompressedMotionData* m_compressedData = nullptr;
+        AZStd::vector<float> m_sampleTimes;
+    };
+
+    BENCHMARK_DEFINE_F(BM_CompressedMotionData, SampleJointTransform)(benchmark::State& state)
+    {
+        const MotionData* motionData = GetMotionData(state.range(0));
+        for (auto _ : state)
+        {
+            for (float time : m_sampleTimes)
+            {
+                benchmark::DoNotOptimize(motionData->SampleJointTransform(time, 0));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * m_sampleTimes.size());
+    }
+
+    BENCHMARK_DEFINE_F(BM_CompressedMotionData, Compress)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            CompressedMotionData compressedData;
+            compressedData.InitFromMotionData(m_sourceData, SampleRate, MotionData::OptimizeSettings());
+            benchmark::DoNotOptimize(compressedData.CalcNumKeys());
+        }
+    }
+
+    BENCHMARK_REGISTER_F(BM_CompressedMotionData, SampleJointTransform)
+        ->Arg(BM_CompressedMotionData::NonUniform)
+        ->Arg(BM_CompressedMotionData::Uniform)
+        ->Arg(BM_CompressedMotionData::Compressed)
+        ->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_CompressedMotionData, Compress)->Unit(benchmark::kMillisecond);
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
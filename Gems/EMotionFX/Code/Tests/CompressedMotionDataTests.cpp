@@ -0,0 +1,224 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp()
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+        }
+
+        void TearDown()
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+        // Build a motion with an animated joint, a joint that is not animated, a linear morph ramp and a noisy float curve.
+        void FillSourceMotionData(NonUniformMotionData& motionData, size_t numSamples, float sampleRate)
+        {
+            motionData.Resize(2, 1, 1);
+            motionData.AllocateJointPositionSamples(0, numSamples);
+            motionData.AllocateJointRotationSamples(0, numSamples);
+            motionData.AllocateMorphSamples(0, numSamples);
+            motionData.AllocateFloatSamples(0, numSamples);
+            for (size_t i = 0; i < numSamples; ++i)
+            {
+                const float time = static_cast<float>(i) / sampleRate;
+                const float angle = sinf(time * 3.0f);
+                motionData.SetJointPositionSample(0, i, { time, AZ::Vector3(sinf(time), cosf(time * 2.0f), time * 0.5f) });
+                motionData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(angle) * AZ::Quaternion::CreateRotationX(angle * 0.5f) });
+                motionData.SetMorphSample(0, i, { time, time / ((numSamples - 1) / sampleRate) });
+                motionData.SetFloatSample(0, i, { time, sinf(time * 20.0f) * 0.25f });
+            }
+            motionData.UpdateDuration();
+        }
+
+        void ExpectWithinError(const AZ::Vector3& a, const AZ::Vector3& b, float maxError)
+        {
+            EXPECT_LE(AZ::GetAbs(a.GetX() - b.GetX()), maxError);
+            EXPECT_LE(AZ::GetAbs(a.GetY() - b.GetY()), maxError);
+            EXPECT_LE(AZ::GetAbs(a.GetZ() - b.GetZ()), maxError);
+        }
+
+        void ExpectWithinError(const AZ::Quaternion& a, const AZ::Quaternion& b, float maxError)
+        {
+            const AZ::Quaternion closest = (a.Dot(b) < 0.0f) ? -b : b;
+            EXPECT_LE(AZ::GetAbs(a.GetX() - closest.GetX()), maxError);
+            EXPECT_LE(AZ::GetAbs(a.GetY() - closest.GetY()), maxError);
+            EXPECT_LE(AZ::GetAbs(a.GetZ() - closest.GetZ()), maxError);
+            EXPECT_LE(AZ::GetAbs(a.GetW() - closest.GetW()), maxError);
+        }
+
+        // Allow for the rounding of the float math on top of the error that the compressor measured.
+        static constexpr float s_tolerance = 0.0001f;
+        static constexpr float s_sampleRate = 30.0f;
+        static constexpr size_t s_numSamples = 151;
+    };
+
+    TEST_F(CompressedMotionDataTests, ZeroInit)
+    {
+        CompressedMotionData motionData;
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 0.0f);
+        EXPECT_EQ(motionData.GetNumJoints(), 0);
+        EXPECT_EQ(motionData.GetNumMorphs(), 0);
+        EXPECT_EQ(motionData.GetNumFloats(), 0);
+        EXPECT_EQ(motionData.GetNumSamples(), 0);
+        EXPECT_EQ(motionData.CalcNumKeys(), 0);
+    }
+
+    TEST_F(CompressedMotionDataTests, CompressWithinError)
+    {
+        NonUniformMotionData sourceData;
+        FillSourceMotionData(sourceData, s_numSamples, s_sampleRate);
+
+        MotionData::OptimizeSettings settings;
+        CompressedMotionData motionData;
+        motionData.InitFromMotionData(&sourceData, s_sampleRate, settings);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), sourceData.GetDuration());
+        EXPECT_EQ(motionData.GetNumSamples(), s_numSamples);
+        EXPECT_EQ(motionData.GetNumJoints(), 2);
+        EXPECT_EQ(motionData.GetNumMorphs(), 1);
+        EXPECT_EQ(motionData.GetNumFloats(), 1);
+
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_FALSE(motionData.IsJointAnimated(1));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_TRUE(motionData.IsFloatAnimated(0));
+
+        // The compressor never exceeds the requested error.
+        EXPECT_LE(motionData.GetJointPositionMaxError(0), settings.m_maxPosError);
+        EXPECT_LE(motionData.GetJointRotationMaxError(0), settings.m_maxRotError);
+        EXPECT_LE(motionData.GetMorphMaxError(0), settings.m_maxMorphError);
+        EXPECT_LE(motionData.GetFloatMaxError(0), settings.m_maxFloatError);
+
+        // The smooth curves need far fewer keys than the source samples.
+        EXPECT_LT(motionData.CalcNumKeys(), s_numSamples * 4 / 2);
+
+        for (size_t i = 0; i < s_numSamples; ++i)
+        {
+            const float time = static_cast<float>(i) / s_sampleRate;
+            ExpectWithinError(motionData.SampleJointPosition(time, 0), sourceData.SampleJointPosition(time, 0), motionData.GetJointPositionMaxError(0) + s_tolerance);
+            ExpectWithinError(motionData.SampleJointRotation(time, 0), sourceData.SampleJointRotation(time, 0), motionData.GetJointRotationMaxError(0) + s_tolerance);
+            EXPECT_LE(AZ::GetAbs(motionData.SampleMorph(time, 0) - sourceData.SampleMorph(time, 0)), motionData.GetMorphMaxError(0) + s_tolerance);
+            EXPECT_LE(AZ::GetAbs(motionData.SampleFloat(time, 0) - sourceData.SampleFloat(time, 0)), motionData.GetFloatMaxError(0) + s_tolerance);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, Optimize)
+    {
+        NonUniformMotionData sourceData;
+        FillSourceMotionData(sourceData, s_numSamples, s_sampleRate);
+
+        MotionData::OptimizeSettings settings;
+        CompressedMotionData motionData;
+        motionData.InitFromMotionData(&sourceData, s_sampleRate, settings);
+        const size_t numKeys = motionData.CalcNumKeys();
+
+        // Loosen the errors, which should only ever remove keys and keep the accumulated error within the new bounds.
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.05f;
+        settings.m_maxMorphError = 0.01f;
+        settings.m_maxFloatError = 0.01f;
+        motionData.Optimize(settings);
+        EXPECT_LT(motionData.CalcNumKeys(), numKeys);
+        EXPECT_LE(motionData.GetJointPositionMaxError(0), settings.m_maxPosError);
+        EXPECT_LE(motionData.GetJointRotationMaxError(0), settings.m_maxRotError);
+        EXPECT_LE(motionData.GetFloatMaxError(0), settings.m_maxFloatError);
+
+        for (size_t i = 0; i < s_numSamples; ++i)
+        {
+            const float time = static_cast<float>(i) / s_sampleRate;
+            ExpectWithinError(motionData.SampleJointPosition(time, 0), sourceData.SampleJointPosition(time, 0), settings.m_maxPosError + s_tolerance);
+            EXPECT_LE(AZ::GetAbs(motionData.SampleFloat(time, 0) - sourceData.SampleFloat(time, 0)), settings.m_maxFloatError + s_tolerance);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        NonUniformMotionData sourceData;
+        FillSourceMotionData(sourceData, s_numSamples, s_sampleRate);
+
+        CompressedMotionData motionData;
+        motionData.InitFromMotionData(&sourceData, s_sampleRate, MotionData::OptimizeSettings());
+
+        MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        file.Seek(0);
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        EXPECT_EQ(loadedData.GetNumJoints(), motionData.GetNumJoints());
+        EXPECT_STREQ(loadedData.GetJointName(0).c_str(), motionData.GetJointName(0).c_str());
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.CalcNumKeys(), motionData.CalcNumKeys());
+        EXPECT_FLOAT_EQ(loadedData.GetDuration(), motionData.GetDuration());
+
+        for (size_t i = 0; i < s_numSamples; ++i)
+        {
+            const float time = static_cast<float>(i) / s_sampleRate;
+            EXPECT_THAT(loadedData.SampleJointPosition(time, 0), IsClose(motionData.SampleJointPosition(time, 0)));
+            EXPECT_THAT(loadedData.SampleJointRotation(time, 0), IsClose(motionData.SampleJointRotation(time, 0)));
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+            EXPECT_FLOAT_EQ(loadedData.SampleFloat(time, 0), motionData.SampleFloat(time, 0));
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, CompressedIsSmallerThanUniformWithinError)
+    {
+        // A minute of animation, long enough for the per track overhead not to matter.
+        const size_t numSamples = 30 * 60 + 1;
+        NonUniformMotionData sourceData;
+        FillSourceMotionData(sourceData, numSamples, s_sampleRate);
+
+        UniformMotionData uniformData;
+        uniformData.InitFromNonUniformData(&sourceData, false, s_sampleRate);
+        MotionData::OptimizeSettings settings;
+        CompressedMotionData compressedData;
+        compressedData.InitFromMotionData(&sourceData, s_sampleRate, settings);
+
+        const MotionData::SaveSettings saveSettings;
+        EXPECT_LT(compressedData.CalcStreamSaveSizeInBytes(saveSettings), uniformData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        for (size_t i = 0; i < numSamples; ++i)
+        {
+            const float time = static_cast<float>(i) / s_sampleRate;
+            const Transform sourceTransform = sourceData.SampleJointTransform(time, 0);
+            const Transform compressedTransform = compressedData.SampleJointTransform(time, 0);
+            ExpectWithinError(compressedTransform.mPosition, sourceTransform.mPosition, settings.m_maxPosError + s_tolerance);
+            ExpectWithinError(compressedTransform.mRotation, sourceTransform.mRotation, settings.m_maxRotError + s_tolerance);
+        }
+    }
+} // namespace EMotionFX
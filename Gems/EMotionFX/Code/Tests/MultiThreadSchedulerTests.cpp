@@ -13,6 +13,7 @@
 #include <EMotionFX/Source/Actor.h>
 #include <EMotionFX/Source/ActorInstance.h>
 #include <EMotionFX/Source/ActorUpdateScheduler.h>
+#include <EMotionFX/Source/AttachmentNode.h>
 #include <EMotionFX/Source/MultiThreadScheduler.h>
 #include <Tests/SystemComponentFixture.h>
 #include <Tests/TestAssetCode/JackActor.h>
@@ -46,4 +47,51 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, JobGraphFollowsAttachments)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+        MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* root = ActorInstance::Create(actor.get());
+        ActorInstance* childA = ActorInstance::Create(actor.get());
+        ActorInstance* childB = ActorInstance::Create(actor.get());
+        ActorInstance* grandChild = ActorInstance::Create(actor.get());
+        ActorInstance* otherRoot = ActorInstance::Create(actor.get());
+        root->AddAttachment(AttachmentNode::Create(root, 0, childA));
+        root->AddAttachment(AttachmentNode::Create(root, 0, childB));
+        childA->AddAttachment(AttachmentNode::Create(childA, 0, grandChild));
+
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 5);
+
+        // Each actor instance is updated by exactly one node, and attachments only depend on the actor instance they are attached to.
+        const AZStd::vector<MultiThreadScheduler::JobGraphNode>& jobGraph = scheduler->GetJobGraph();
+        ASSERT_EQ(jobGraph.size(), 5);
+        EXPECT_EQ(scheduler->GetNumJobGraphRoots(), 2);
+        for (const MultiThreadScheduler::JobGraphNode& node : jobGraph)
+        {
+            for (uint32 i = 0; i < node.mNumChildren; ++i)
+            {
+                EXPECT_EQ(jobGraph[node.mFirstChild + i].mActorInstance->GetAttachedTo(), node.mActorInstance);
+            }
+
+            const uint32 expectedNumChildren = (node.mActorInstance == root) ? 2 : (node.mActorInstance == childA) ? 1 : 0;
+            EXPECT_EQ(node.mNumChildren, expectedNumChildren);
+        }
+
+        // Detaching an actor instance turns it into a root of the graph.
+        childA->RemoveAttachment(grandChild);
+        scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(scheduler->GetJobGraph().size(), 5);
+        EXPECT_EQ(scheduler->GetNumJobGraphRoots(), 3);
+
+        otherRoot->Destroy();
+        grandChild->Destroy();
+        childB->Destroy();
+        childA->Destroy();
+        root->Destroy();
+    }
 } // namespace EMotionFX
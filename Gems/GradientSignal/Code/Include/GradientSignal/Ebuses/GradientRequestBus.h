@@ -14,6 +14,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -53,6 +54,35 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them.  This has the same thread-safety requirements as GetValue.
+        * Sampling in batches lets a gradient pay for the bus dispatch, its locks and any per-query setup once per list instead of once
+        * per position.  The default implementation calls GetValue for every position so that existing gradients keep working,
+        * gradients should override it with a batched implementation.
+        * @param positions The positions to generate values for
+        * @param outValues The output values, must be the same size as positions
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            AssertGetValuesSizesMatch(positions, outValues);
+
+            GradientSampleParams sampleParams;
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                sampleParams.m_position = positions[index];
+                outValues[index] = GetValue(sampleParams);
+            }
+        }
+
+        /**
+        * Asserts that the lists passed to GetValues are the same size.  Every GetValues implementation should call this first.
+        */
+        static void AssertGetValuesSizesMatch([[maybe_unused]] const AZStd::vector<AZ::Vector3>& positions, [[maybe_unused]] const AZStd::vector<float>& outValues)
+        {
+            AZ_Assert(positions.size() == outValues.size(), "The position list size (%zu) doesn't match the output value list size (%zu).",
+                positions.size(), outValues.size());
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -19,6 +19,8 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Util.h>
@@ -37,6 +39,9 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Samples the gradient for a list of positions with a single bus call, outValues must be the same size as positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -150,4 +155,72 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        GradientRequests::AssertGetValuesSizesMatch(positions, outValues);
+
+        // Gradients without a handler leave the output untouched, so start from the same default GetValue returns.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            return;
+        }
+
+        //apply transform if set
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        const bool useTransform = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        if (useTransform)
+        {
+            const AZ::Transform transform =
+                AZ::Transform::CreateTranslation(m_translate) *
+                AZ::ConvertEulerDegreesToTransform(m_rotate) *
+                AZ::Transform::CreateScale(m_scale);
+
+            transformedPositions.reserve(positions.size());
+            for (const AZ::Vector3& position : positions)
+            {
+                transformedPositions.push_back(transform.TransformPoint(position));
+            }
+        }
+
+        {
+            // Block other threads from accessing the surface data bus while we are in GetValues (which may call into the SurfaceData bus).
+            // See GetValue for why this needs to be locked before checking / setting "isRequestInProgress".
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, useTransform ? transformedPositions : positions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        const bool useLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+        for (float& output : outValues)
+        {
+            if (m_invertInput)
+            {
+                output = 1.0f - output;
+            }
+
+            //apply levels if set
+            if (useLevels)
+            {
+                output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+
+            output *= m_opacity;
+        }
+    }
 }
@@ -233,38 +233,67 @@ namespace GradientSignal
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
-        const AZ::Vector3& coordinate = sampleParams.m_position;
+        const float pointsPerUnit = GetPointsPerUnit();
+        const AZ::Vector3 scaledCoordinate = sampleParams.m_position * pointsPerUnit;
 
+        GradientSampleParams adjustedSampleParams = sampleParams;
+        adjustedSampleParams.m_position = GetFlooredCoordinate(scaledCoordinate, pointsPerUnit);
+        float value = m_configuration.m_gradientSampler.GetValue(adjustedSampleParams);
+
+        return value > GetDitherValue(scaledCoordinate) ? 1.0f : 0.0f;
+    }
+
+    void DitherGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AssertGetValuesSizesMatch(positions, outValues);
+
+        const float pointsPerUnit = GetPointsPerUnit();
+
+        AZStd::vector<AZ::Vector3> flooredCoordinates;
+        flooredCoordinates.reserve(positions.size());
+        for (const AZ::Vector3& position : positions)
+        {
+            flooredCoordinates.push_back(GetFlooredCoordinate(position * pointsPerUnit, pointsPerUnit));
+        }
+
+        m_configuration.m_gradientSampler.GetValues(flooredCoordinates, outValues);
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            outValues[index] = outValues[index] > GetDitherValue(positions[index] * pointsPerUnit) ? 1.0f : 0.0f;
+        }
+    }
+
+    float DitherGradientComponent::GetPointsPerUnit() const
+    {
         float pointsPerUnit = m_configuration.m_pointsPerUnit;
         if (m_configuration.m_useSystemPointsPerUnit)
         {
             SectorDataRequestBus::Broadcast(&SectorDataRequestBus::Events::GetPointsPerMeter, pointsPerUnit);
         }
-        pointsPerUnit = AZ::GetMax(pointsPerUnit, 0.0001f);
+        return AZ::GetMax(pointsPerUnit, 0.0001f);
+    }
 
-        auto scaledCoordinate = coordinate * pointsPerUnit;
+    AZ::Vector3 DitherGradientComponent::GetFlooredCoordinate(const AZ::Vector3& scaledCoordinate, float pointsPerUnit)
+    {
         auto x = std::floor(scaledCoordinate.GetX()) / pointsPerUnit;
         auto y = std::floor(scaledCoordinate.GetY()) / pointsPerUnit;
         auto z = std::floor(scaledCoordinate.GetZ()) / pointsPerUnit;
-        AZ::Vector3 flooredCoordinate(x, y, z);
-
-        GradientSampleParams adjustedSampleParams = sampleParams;
-        adjustedSampleParams.m_position = flooredCoordinate;
-        float value = m_configuration.m_gradientSampler.GetValue(adjustedSampleParams);
+        return AZ::Vector3(x, y, z);
+    }
 
-        float d = 0.0f;
+    float DitherGradientComponent::GetDitherValue(const AZ::Vector3& scaledCoordinate) const
+    {
         switch (m_configuration.m_patternType)
         {
         default:
         case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_4x4:
-            d = GetDitherValue4x4((scaledCoordinate) + m_configuration.m_patternOffset);
-            break;
+            return GetDitherValue4x4((scaledCoordinate) + m_configuration.m_patternOffset);
         case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_8x8:
-            d = GetDitherValue8x8((scaledCoordinate) + m_configuration.m_patternOffset);
-            break;
+            return GetDitherValue8x8((scaledCoordinate) + m_configuration.m_patternOffset);
         }
-
-        return value > d ? 1.0f : 0.0f;
     }
 
     bool DitherGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
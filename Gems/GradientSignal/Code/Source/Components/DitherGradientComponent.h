@@ -81,6 +81,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
         //////////////////////////////////////////////////////////////////////////
@@ -106,6 +107,10 @@ namespace GradientSignal
         GradientSampler& GetGradientSampler() override;
 
     private:
+        float GetPointsPerUnit() const;
+        static AZ::Vector3 GetFlooredCoordinate(const AZ::Vector3& scaledCoordinate, float pointsPerUnit);
+        float GetDitherValue(const AZ::Vector3& scaledCoordinate) const;
+
         DitherGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
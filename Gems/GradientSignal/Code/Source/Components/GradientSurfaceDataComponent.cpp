@@ -268,6 +268,74 @@ namespace GradientSignal
         }
     }
 
+    void GradientSurfaceDataComponent::ModifySurfacePointBuffer(SurfaceData::SurfacePointBuffer& surfacePoints, const AZStd::vector<AZ::u32>& pointIndices) const
+    {
+        if (m_configuration.m_modifierTags.empty())
+        {
+            return;
+        }
+
+        // See ModifySurfacePoints for why the shape bounds are copied out of the mutex.
+        bool validShapeBounds = false;
+        AZ::Aabb shapeConstraintBounds;
+        if (m_validShapeBounds)
+        {
+            AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+            shapeConstraintBounds = m_cachedShapeConstraintBounds;
+            validShapeBounds = m_cachedShapeConstraintBounds.IsValid();
+        }
+
+        // Gather the points that pass the shape check, then sample the gradient for all of them in a single batch.
+        // These are locals because the gradient sampling can make nested surface queries that end up back in this method.
+        AZStd::vector<AZ::u32> sampledPointIndices;
+        AZStd::vector<AZ::Vector3> sampledPositions;
+        sampledPointIndices.reserve(pointIndices.size());
+        sampledPositions.reserve(pointIndices.size());
+
+        const AZ::EntityId entityId = GetEntityId();
+        for (AZ::u32 pointIndex : pointIndices)
+        {
+            if (surfacePoints.GetEntityId(pointIndex) != entityId)
+            {
+                const AZ::Vector3& position = surfacePoints.GetPosition(pointIndex);
+                bool inBounds = true;
+                if (validShapeBounds)
+                {
+                    inBounds = false;
+                    if (shapeConstraintBounds.Contains(position))
+                    {
+                        LmbrCentral::ShapeComponentRequestsBus::EventResult(inBounds, m_configuration.m_shapeConstraintEntityId,
+                                                                            &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, position);
+                    }
+                }
+
+                if (inBounds)
+                {
+                    sampledPointIndices.push_back(pointIndex);
+                    sampledPositions.push_back(position);
+                }
+            }
+        }
+
+        if (sampledPositions.empty())
+        {
+            return;
+        }
+
+        AZStd::vector<float> values(sampledPositions.size());
+        m_gradientSampler.GetValues(sampledPositions, values);
+
+        for (size_t index = 0; index < sampledPointIndices.size(); index++)
+        {
+            const float value = values[index];
+            if (value >= m_configuration.m_thresholdMin &&
+                value <= m_configuration.m_thresholdMax)
+            {
+                surfacePoints.AddMaskValues(sampledPointIndices[index], m_configuration.m_modifierTags, value);
+            }
+        }
+    }
+
     void GradientSurfaceDataComponent::OnCompositionChanged()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -77,6 +77,7 @@ namespace GradientSignal
         ////////////////////////////////////////////////////////////////////////
         // SurfaceData::SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfaceData::SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointBuffer(SurfaceData::SurfacePointBuffer& surfacePoints, const AZStd::vector<AZ::u32>& pointIndices) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // LmbrCentral::DependencyNotificationBus
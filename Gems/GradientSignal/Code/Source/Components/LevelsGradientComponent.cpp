@@ -194,6 +194,24 @@ namespace GradientSignal
         return output;
     }
 
+    void LevelsGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        for (float& output : outValues)
+        {
+            output = GetLevels(
+                output,
+                m_configuration.m_inputMid,
+                m_configuration.m_inputMin,
+                m_configuration.m_inputMax,
+                m_configuration.m_outputMin,
+                m_configuration.m_outputMax);
+        }
+    }
+
     bool LevelsGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
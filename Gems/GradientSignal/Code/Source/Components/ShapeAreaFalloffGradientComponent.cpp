@@ -17,6 +17,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
 
 namespace GradientSignal
 {
@@ -181,6 +182,34 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_falloffWidth, 0.0f, distance);
     }
 
+    void ShapeAreaFalloffGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AssertGetValuesSizesMatch(positions, outValues);
+
+        // Points are treated as being at distance 0 (inside the shape) when there is no shape, the same as GetValue.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        // Look up the shape and take its bus lock once for the whole list, then query the distances directly.
+        LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(m_configuration.m_shapeEntityId,
+            [&positions, &outValues](LmbrCentral::ShapeComponentRequests* shapeRequests)
+            {
+                for (size_t index = 0; index < positions.size(); index++)
+                {
+                    outValues[index] = shapeRequests->DistanceFromPoint(positions[index]);
+                }
+                return false;
+            });
+
+        const float falloffWidth = m_configuration.m_falloffWidth;
+        for (float& output : outValues)
+        {
+            // See GetValue for the special case of 0 falloff.
+            output = (falloffWidth == 0.0f) ? ((output > 0.0f) ? 0.0f : 1.0f) : GetRatio(falloffWidth, 0.0f, output);
+        }
+    }
+
     AZ::EntityId ShapeAreaFalloffGradientComponent::GetShapeEntityId() const
     {
         return m_configuration.m_shapeEntityId;
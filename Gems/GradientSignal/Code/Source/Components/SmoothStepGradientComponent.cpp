@@ -183,6 +183,16 @@ namespace GradientSignal
         return output;
     }
 
+    void SmoothStepGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        for (float& output : outValues)
+        {
+            output = m_configuration.m_smoothStep.GetSmoothedValue(AZ::GetClamp(output, 0.0f, 1.0f));
+        }
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -224,6 +224,30 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, position.GetZ());
     }
 
+    void SurfaceAltitudeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AssertGetValuesSizesMatch(positions, outValues);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        // Query the surface data for the whole list at once so that providers are filtered once instead of once per position.
+        SurfaceData::SurfacePointListPerPosition pointLists;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList,
+            positions, m_configuration.m_surfaceTagsToSample, pointLists);
+
+        for (size_t index = 0; index < outValues.size(); index++)
+        {
+            if ((index >= pointLists.size()) || pointLists[index].second.empty())
+            {
+                outValues[index] = 0.0f;
+                continue;
+            }
+
+            const AZ::Vector3& position = pointLists[index].second.front().m_position;
+            outValues[index] = GetRatio(m_configuration.m_altitudeMin, m_configuration.m_altitudeMax, position.GetZ());
+        }
+    }
+
     void SurfaceAltitudeGradientComponent::OnCompositionChanged()
     {
         m_dirty = true;
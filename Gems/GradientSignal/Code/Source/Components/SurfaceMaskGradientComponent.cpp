@@ -17,6 +17,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
 
 namespace GradientSignal
 {
@@ -190,6 +191,37 @@ namespace GradientSignal
         return result;
     }
 
+    void SurfaceMaskGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AssertGetValuesSizesMatch(positions, outValues);
+
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_configuration.m_surfaceTagList.empty())
+        {
+            return;
+        }
+
+        SurfaceData::SurfacePointListPerPosition pointLists;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList,
+            positions, m_configuration.m_surfaceTagList, pointLists);
+
+        const size_t count = AZ::GetMin(outValues.size(), pointLists.size());
+        for (size_t index = 0; index < count; index++)
+        {
+            float& result = outValues[index];
+            for (const auto& point : pointLists[index].second)
+            {
+                for (const auto& maskPair : point.m_masks)
+                {
+                    result = AZ::GetMax(AZ::GetClamp(maskPair.second, 0.0f, 1.0f), result);
+                }
+            }
+        }
+    }
+
     size_t SurfaceMaskGradientComponent::GetNumTags() const
     {
         return m_configuration.GetNumTags();
@@ -216,6 +216,25 @@ namespace GradientSignal
         SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
             sampleParams.m_position, m_configuration.m_surfaceTagsToSample, points);
 
+        return GetSlopeRatio(points);
+    }
+
+    void SurfaceSlopeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AssertGetValuesSizesMatch(positions, outValues);
+
+        SurfaceData::SurfacePointListPerPosition pointLists;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(&SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList,
+            positions, m_configuration.m_surfaceTagsToSample, pointLists);
+
+        for (size_t index = 0; index < outValues.size(); index++)
+        {
+            outValues[index] = (index < pointLists.size()) ? GetSlopeRatio(pointLists[index].second) : 0.0f;
+        }
+    }
+
+    float SurfaceSlopeGradientComponent::GetSlopeRatio(const SurfaceData::SurfacePointList& points) const
+    {
         if (points.empty())
         {
             return 0.0f;
@@ -95,6 +95,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -125,6 +126,9 @@ namespace GradientSignal
         void SetFallOffMidpoint(float midpoint) override;
 
     private:
+        //! Converts the slope of the first surface point into the configured 0-1 range, or 0 if there are no points.
+        float GetSlopeRatio(const SurfaceData::SurfacePointList& points) const;
+
         SurfaceSlopeGradientConfig m_configuration;
     };
 }
\ No newline at end of file
@@ -540,6 +540,47 @@ namespace UnitTest
         }
     }
 
+    TEST_F(GradientSignalImageTestsFixture, ImageGradientComponent_GetValuesMatchesGetValue)
+    {
+        // Verify that the batched image sampling matches sampling one position at a time, for positions between pixels,
+        // positions that get tiled, and positions that fall outside of the shape bounds.
+
+        const GradientSignal::WrappingType wrappingTypes[] =
+        {
+            GradientSignal::WrappingType::None,
+            GradientSignal::WrappingType::ClampToZero,
+            GradientSignal::WrappingType::Repeat,
+        };
+
+        for (auto wrappingType : wrappingTypes)
+        {
+            auto entity = CreateEntity();
+
+            GradientSignal::ImageGradientConfig config;
+            config.m_imageAsset = CreateImageAsset(16, 16, 1234);
+            config.m_tilingX = 1.5f;
+            config.m_tilingY = 2.0f;
+            CreateComponent<GradientSignal::ImageGradientComponent>(entity.get(), config);
+
+            GradientSignal::GradientTransformConfig gradientTransformConfig;
+            gradientTransformConfig.m_wrappingType = wrappingType;
+            CreateComponent<GradientSignal::GradientTransformComponent>(entity.get(), gradientTransformConfig);
+
+            CreateComponent<MockShapeComponent>(entity.get());
+            MockShapeComponentHandler mockShapeHandler(entity->GetId());
+            mockShapeHandler.m_GetLocalBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(8.0f));
+            mockShapeHandler.m_GetEncompassingAabb = mockShapeHandler.m_GetLocalBounds;
+
+            MockTransformHandler mockTransformHandler;
+            mockTransformHandler.m_GetLocalTMOutput = AZ::Transform::CreateTranslation(AZ::Vector3(4.0f));
+            mockTransformHandler.m_GetWorldTMOutput = AZ::Transform::CreateTranslation(AZ::Vector3(4.0f));
+            mockTransformHandler.BusConnect(entity->GetId());
+
+            ActivateEntity(entity.get());
+
+            TestGetValuesMatchesGetValue(entity->GetId(), CreateGridPositions(20, AZ::Vector3(-1.3f, -1.3f, 0.0f), 0.55f));
+        }
+    }
 }
 
 
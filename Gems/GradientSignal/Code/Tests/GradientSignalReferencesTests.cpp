@@ -890,5 +890,164 @@ namespace UnitTest
                                           GradientSignal::SurfaceSlopeGradientConfig::RampType::SMOOTH_STEP, 0.5f, 0.6f, 0.1f);
     }
 
-}
+    TEST_F(GradientSignalReferencesTestsFixture, MixedGradientComponent_GetValuesMatchesGetValue)
+    {
+        // Verify that the batched mixing, which samples each layer once for the whole list, matches mixing one position at a
+        // time for every operation, including layers that use opacity, input inversion and levels, and disabled layers.
+
+        constexpr int dataSize = 4;
+        AZStd::vector<float> layer1Data =
+        {
+            0.0f, 0.1f, 0.2f, 0.3f,
+            0.4f, 0.5f, 0.6f, 0.7f,
+            0.8f, 0.9f, 1.0f, 0.25f,
+            0.35f, 0.45f, 0.55f, 0.65f,
+        };
+        AZStd::vector<float> layer2Data =
+        {
+            1.0f, 0.8f, 0.6f, 0.4f,
+            0.2f, 0.0f, 0.9f, 0.7f,
+            0.5f, 0.3f, 0.1f, 0.15f,
+            0.75f, 0.05f, 0.95f, 0.85f,
+        };
+
+        const GradientSignal::MixedGradientLayer::MixingOperation operations[] =
+        {
+            GradientSignal::MixedGradientLayer::MixingOperation::Initialize,
+            GradientSignal::MixedGradientLayer::MixingOperation::Multiply,
+            GradientSignal::MixedGradientLayer::MixingOperation::Add,
+            GradientSignal::MixedGradientLayer::MixingOperation::Subtract,
+            GradientSignal::MixedGradientLayer::MixingOperation::Min,
+            GradientSignal::MixedGradientLayer::MixingOperation::Max,
+            GradientSignal::MixedGradientLayer::MixingOperation::Average,
+            GradientSignal::MixedGradientLayer::MixingOperation::Normal,
+            GradientSignal::MixedGradientLayer::MixingOperation::Overlay,
+        };
+
+        auto mockLayer1 = CreateEntity();
+        MockGradientArrayRequestsBus mockLayer1GradientRequestsBus(mockLayer1->GetId(), layer1Data, dataSize);
+
+        auto mockLayer2 = CreateEntity();
+        MockGradientArrayRequestsBus mockLayer2GradientRequestsBus(mockLayer2->GetId(), layer2Data, dataSize);
+
+        for (auto operation : operations)
+        {
+            GradientSignal::MixedGradientConfig config;
+
+            GradientSignal::MixedGradientLayer layer;
+            layer.m_enabled = true;
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Initialize;
+            layer.m_gradientSampler.m_gradientId = mockLayer1->GetId();
+            config.m_layers.push_back(layer);
+
+            layer.m_operation = operation;
+            layer.m_gradientSampler.m_gradientId = mockLayer2->GetId();
+            layer.m_gradientSampler.m_opacity = 0.7f;
+            config.m_layers.push_back(layer);
+
+            layer.m_gradientSampler.m_gradientId = mockLayer1->GetId();
+            layer.m_gradientSampler.m_opacity = 1.0f;
+            layer.m_gradientSampler.m_invertInput = true;
+            layer.m_gradientSampler.m_enableLevels = true;
+            layer.m_gradientSampler.m_inputMid = 0.6f;
+            config.m_layers.push_back(layer);
+
+            layer.m_enabled = false;
+            layer.m_operation = GradientSignal::MixedGradientLayer::MixingOperation::Initialize;
+            layer.m_gradientSampler.m_gradientId = mockLayer2->GetId();
+            config.m_layers.push_back(layer);
+
+            auto entity = CreateEntity();
+            CreateComponent<GradientSignal::MixedGradientComponent>(entity.get(), config);
+            ActivateEntity(entity.get());
+
+            // The mock layers only have data at integer positions inside of the data grid.
+            TestGetValuesMatchesGetValue(entity->GetId(), CreateGridPositions(dataSize, AZ::Vector3::CreateZero(), 1.0f));
+        }
+    }
+
+    TEST_F(GradientSignalReferencesTestsFixture, SurfaceAltitudeGradientComponent_GetValuesMatchesGetValue)
+    {
+        // Verify that the batched surface queries give the same altitude values as querying one position at a time, both with
+        // and without a pinned shape, and for positions that don't have any surface points.
+
+        constexpr int dataSize = 4;
+
+        auto entityShape = CreateEntity();
+        CreateComponent<MockShapeComponent>(entityShape.get());
+        MockShapeComponentHandler mockShapeComponentHandler(entityShape->GetId());
+        mockShapeComponentHandler.m_GetEncompassingAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-2.0f), AZ::Vector3(12.0f));
+
+        // Set a different altitude for every point in the grid.  The positions just past the edges of the grid don't have any points.
+        MockSurfaceDataSystem mockSurfaceDataSystem;
+        for (int y = 0; y < dataSize; ++y)
+        {
+            for (int x = 0; x < dataSize; ++x)
+            {
+                const float altitude = (y * dataSize + x) * 0.75f;
+                mockSurfaceDataSystem.m_GetSurfacePoints[AZStd::make_pair(static_cast<float>(x), static_cast<float>(y))] =
+                    { { entityShape->GetId(), AZ::Vector3(static_cast<float>(x), static_cast<float>(y), altitude), AZ::Vector3::CreateAxisZ() } };
+            }
+        }
+
+        const AZ::EntityId shapeEntityIds[] = { entityShape->GetId(), AZ::EntityId() };
+        for (const auto& shapeEntityId : shapeEntityIds)
+        {
+            GradientSignal::SurfaceAltitudeGradientConfig config;
+            config.m_shapeEntityId = shapeEntityId;
+            config.m_altitudeMin = 1.0f;
+            config.m_altitudeMax = 9.0f;
+
+            auto entity = CreateEntity();
+            CreateComponent<GradientSignal::SurfaceAltitudeGradientComponent>(entity.get(), config);
+            ActivateEntity(entity.get());
+
+            TestGetValuesMatchesGetValue(entity->GetId(), CreateGridPositions(dataSize + 1, AZ::Vector3::CreateZero(), 1.0f));
+        }
+    }
+
+    TEST_F(GradientSignalReferencesTestsFixture, SurfaceSlopeGradientComponent_GetValuesMatchesGetValue)
+    {
+        // Verify that the batched surface queries give the same slope values as querying one position at a time for every
+        // ramp type, and for positions that don't have any surface points.
+
+        constexpr int dataSize = 4;
+
+        // Give every point in the grid a different slope.  The positions just past the edges of the grid don't have any points.
+        MockSurfaceDataSystem mockSurfaceDataSystem;
+        SurfaceData::SurfacePoint point;
+        for (int y = 0; y < dataSize; ++y)
+        {
+            for (int x = 0; x < dataSize; ++x)
+            {
+                const float angle = AZ::DegToRad((y * dataSize + x) * 5.5f);
+                point.m_normal = AZ::Vector3(sinf(angle), 0.0f, cosf(angle));
+                mockSurfaceDataSystem.m_GetSurfacePoints[AZStd::make_pair(static_cast<float>(x), static_cast<float>(y))] = { { point } };
+            }
+        }
+
+        const GradientSignal::SurfaceSlopeGradientConfig::RampType rampTypes[] =
+        {
+            GradientSignal::SurfaceSlopeGradientConfig::RampType::LINEAR_RAMP_DOWN,
+            GradientSignal::SurfaceSlopeGradientConfig::RampType::LINEAR_RAMP_UP,
+            GradientSignal::SurfaceSlopeGradientConfig::RampType::SMOOTH_STEP,
+        };
 
+        for (auto rampType : rampTypes)
+        {
+            GradientSignal::SurfaceSlopeGradientConfig config;
+            config.m_slopeMin = 10.0f;
+            config.m_slopeMax = 70.0f;
+            config.m_rampType = rampType;
+            config.m_smoothStep.m_falloffMidpoint = 0.5f;
+            config.m_smoothStep.m_falloffRange = 0.6f;
+            config.m_smoothStep.m_falloffStrength = 0.1f;
+
+            auto entity = CreateEntity();
+            CreateComponent<GradientSignal::SurfaceSlopeGradientComponent>(entity.get(), config);
+            ActivateEntity(entity.get());
+
+            TestGetValuesMatchesGetValue(entity->GetId(), CreateGridPositions(dataSize + 1, AZ::Vector3::CreateZero(), 1.0f));
+        }
+    }
+}
@@ -29,6 +29,24 @@ namespace UnitTest
     struct GradientSignalTestGeneratorFixture
         : public GradientSignalTest
     {
+        // Adds a gradient transform to the entity that uses a translation, rotation, non-uniform scale and frequency zoom, with
+        // shape bounds that don't cover the whole test area, so that every part of the batched transform gets exercised.
+        void CreateNonTrivialGradientTransform(AZ::Entity* entity, GradientSignal::WrappingType wrappingType)
+        {
+            GradientSignal::GradientTransformConfig gradientTransformConfig;
+            gradientTransformConfig.m_advancedMode = true;
+            gradientTransformConfig.m_overrideTranslate = true;
+            gradientTransformConfig.m_translate = AZ::Vector3(3.0f, -5.0f, 0.0f);
+            gradientTransformConfig.m_overrideRotate = true;
+            gradientTransformConfig.m_rotate = AZ::Vector3(0.0f, 0.0f, 30.0f);
+            gradientTransformConfig.m_overrideScale = true;
+            gradientTransformConfig.m_scale = AZ::Vector3(2.0f, 0.5f, 1.0f);
+            gradientTransformConfig.m_frequencyZoom = 1.5f;
+            gradientTransformConfig.m_wrappingType = wrappingType;
+            CreateComponent<GradientSignal::GradientTransformComponent>(entity, gradientTransformConfig);
+            CreateComponent<MockShapeComponent>(entity);
+        }
+
         void TestLevelsGradientComponent(int dataSize, const AZStd::vector<float>& inputData, const AZStd::vector<float>& expectedOutput,
                                          float inputMin, float inputMid, float inputMax, float outputMin, float outputMax)
         {
@@ -219,6 +237,50 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinGradientComponent_GetValuesMatchesGetValue)
+    {
+        // Verify that the batched Perlin sampling, including the batched gradient transform, matches sampling one position at a time.
+
+        GradientSignal::PerlinGradientConfig config;
+        config.m_randomSeed = 7878;
+        config.m_octave = 4;
+        config.m_amplitude = 3.0f;
+        config.m_frequency = 1.13f;
+
+        auto entity = CreateEntity();
+        CreateComponent<GradientSignal::PerlinGradientComponent>(entity.get(), config);
+        CreateNonTrivialGradientTransform(entity.get(), GradientSignal::WrappingType::Mirror);
+
+        MockShapeComponentHandler mockShapeHandler(entity->GetId());
+        mockShapeHandler.m_GetLocalBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-4.0f), AZ::Vector3(4.0f));
+        mockShapeHandler.m_GetEncompassingAabb = mockShapeHandler.m_GetLocalBounds;
+
+        ActivateEntity(entity.get());
+
+        TestGetValuesMatchesGetValue(entity->GetId(), CreateGridPositions(24, AZ::Vector3(-8.0f, -8.0f, 0.0f), 0.7f));
+    }
+
+    TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GetValuesMatchesGetValue)
+    {
+        // Verify that the batched Random sampling, including the batched gradient transform and the positions that it rejects,
+        // matches sampling one position at a time.
+
+        GradientSignal::RandomGradientConfig config;
+        config.m_randomSeed = 5656;
+
+        auto entity = CreateEntity();
+        CreateComponent<GradientSignal::RandomGradientComponent>(entity.get(), config);
+        CreateNonTrivialGradientTransform(entity.get(), GradientSignal::WrappingType::ClampToZero);
+
+        MockShapeComponentHandler mockShapeHandler(entity->GetId());
+        mockShapeHandler.m_GetLocalBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-4.0f), AZ::Vector3(4.0f));
+        mockShapeHandler.m_GetEncompassingAabb = mockShapeHandler.m_GetLocalBounds;
+
+        ActivateEntity(entity.get());
+
+        TestGetValuesMatchesGetValue(entity->GetId(), CreateGridPositions(24, AZ::Vector3(-8.0f, -8.0f, 0.0f), 0.7f));
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, LevelsGradientComponent_DefaultValues)
     {
         // Verify that with the default config values, our outputs equal our inputs.
@@ -68,6 +68,59 @@ namespace UnitTest
                     EXPECT_NEAR(actualValue, expectedValue, 0.01f);
                 }
             }
+
+            // The batched query needs to produce the same results as querying each position individually.
+            AZStd::vector<AZ::Vector3> positions;
+            positions.reserve(size * size);
+            for (int y = 0; y < size; ++y)
+            {
+                for (int x = 0; x < size; ++x)
+                {
+                    positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+                }
+            }
+
+            AZStd::vector<float> actualValues(positions.size());
+            gradientSampler.GetValues(positions, actualValues);
+
+            for (int index = 0; index < size * size; ++index)
+            {
+                EXPECT_NEAR(actualValues[index], expectedOutput[index], 0.01f);
+            }
+        }
+
+        // Builds a size x size grid of positions starting at origin, with stepSize between neighboring positions.
+        AZStd::vector<AZ::Vector3> CreateGridPositions(int size, const AZ::Vector3& origin, float stepSize)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            positions.reserve(size * size);
+            for (int y = 0; y < size; ++y)
+            {
+                for (int x = 0; x < size; ++x)
+                {
+                    positions.emplace_back(origin + AZ::Vector3(x * stepSize, y * stepSize, 0.0f));
+                }
+            }
+            return positions;
+        }
+
+        // Verifies that a gradient's own GetValues implementation produces the same value as its GetValue for every position.
+        // The gradient bus is called directly instead of going through a GradientSampler so that the component's batched
+        // implementation is the one being compared.
+        void TestGetValuesMatchesGetValue(AZ::EntityId gradientEntityId, const AZStd::vector<AZ::Vector3>& positions)
+        {
+            // Both paths start from different values outside of the 0-1 gradient range, so a position that doesn't get
+            // written by one of them shows up as a mismatch.
+            AZStd::vector<float> batchedValues(positions.size(), -1.0f);
+            GradientSignal::GradientRequestBus::Event(gradientEntityId, &GradientSignal::GradientRequestBus::Events::GetValues, positions, batchedValues);
+
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                float expectedValue = -2.0f;
+                GradientSignal::GradientRequestBus::EventResult(expectedValue, gradientEntityId, &GradientSignal::GradientRequestBus::Events::GetValue,
+                    GradientSignal::GradientSampleParams(positions[index]));
+                EXPECT_NEAR(batchedValues[index], expectedValue, 0.0001f);
+            }
         }
 
         AZStd::unique_ptr<AZ::Entity> CreateEntity()
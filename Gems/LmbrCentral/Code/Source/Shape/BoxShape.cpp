@@ -151,6 +151,54 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outIsInside[index] = aabb.Contains(points[index]);
+            }
+            return;
+        }
+
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outIsInside[index] = obb.Contains(points[index]);
+        }
+    }
+
+    void BoxShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            const AZ::Aabb& aabb = m_intersectionDataCache.m_aabb;
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = aabb.GetDistanceSq(points[index]);
+            }
+            return;
+        }
+
+        const AZ::Obb& obb = m_intersectionDataCache.m_obb;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = obb.GetDistanceSq(points[index]);
+        }
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
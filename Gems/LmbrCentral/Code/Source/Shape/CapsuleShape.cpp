@@ -179,6 +179,51 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void CapsuleShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        const AZ::Vector3 basePlaneCenterPoint = m_intersectionDataCache.m_basePlaneCenterPoint;
+        const AZ::Vector3 topPlaneCenterPoint = m_intersectionDataCache.m_topPlaneCenterPoint;
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        const float internalHeightSquared = powf(m_intersectionDataCache.m_internalHeight, 2.0f);
+        const bool isSphere = m_intersectionDataCache.m_isSphere;
+
+        // Same tests as IsPointInside, bottom sphere, top sphere and then the cylinder between them
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3& point = points[index];
+            outIsInside[index] = AZ::Intersect::PointSphere(basePlaneCenterPoint, radiusSquared, point) ||
+                (!isSphere &&
+                    (AZ::Intersect::PointSphere(topPlaneCenterPoint, radiusSquared, point) ||
+                     AZ::Intersect::PointCylinder(basePlaneCenterPoint, axisVector, internalHeightSquared, radiusSquared, point)));
+        }
+    }
+
+    void CapsuleShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        const Lineseg lineSeg(
+            AZVec3ToLYVec3(m_intersectionDataCache.m_basePlaneCenterPoint),
+            AZVec3ToLYVec3(m_intersectionDataCache.m_topPlaneCenterPoint));
+        const float radius = m_intersectionDataCache.m_radius;
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            float t = 0.0f;
+            const float distance = Distance::Point_Lineseg(AZVec3ToLYVec3(points[index]), lineSeg, t) - radius;
+            outDistancesSquared[index] = powf(AZStd::max(distance, 0.0f), 2.0f);
+        }
+    }
+
     bool CapsuleShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
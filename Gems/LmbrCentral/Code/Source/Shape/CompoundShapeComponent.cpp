@@ -13,6 +13,7 @@
 #include "LmbrCentral_precompiled.h"
 #include "CompoundShapeComponent.h"
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
 #include "Cry_GeoOverlap.h"
 
 
@@ -133,6 +134,45 @@ namespace LmbrCentral
         return smallestDistanceSquared;
     }
 
+    void CompoundShapeComponent::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        AZStd::fill(outIsInside.begin(), outIsInside.end(), false);
+
+        // Each child tests the whole batch at once, a point is inside the compound shape if it's inside any child
+        AZStd::vector<bool> childIsInside(points.size());
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            AZStd::fill(childIsInside.begin(), childIsInside.end(), false);
+            ShapeComponentRequestsBus::Event(childEntity, &ShapeComponentRequests::IsPointInsideBatch, points, childIsInside);
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outIsInside[index] = outIsInside[index] || childIsInside[index];
+            }
+        }
+    }
+
+    void CompoundShapeComponent::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        AZStd::fill(outDistancesSquared.begin(), outDistancesSquared.end(), FLT_MAX);
+
+        AZStd::vector<float> childDistancesSquared(points.size());
+        for (AZ::EntityId childEntity : m_configuration.GetChildEntities())
+        {
+            AZStd::fill(childDistancesSquared.begin(), childDistancesSquared.end(), FLT_MAX);
+            ShapeComponentRequestsBus::Event(childEntity, &ShapeComponentRequests::DistanceSquaredBatch, points, childDistancesSquared);
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = AZ::GetMin(outDistancesSquared[index], childDistancesSquared[index]);
+            }
+        }
+    }
+
     bool CompoundShapeComponent::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         bool intersection = false;
@@ -255,6 +255,48 @@ namespace LmbrCentral
             m_intersectionDataCache.m_radius);
     }
 
+    void CylinderShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        const AZ::Vector3 baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+        const AZ::Vector3 axisVector = m_intersectionDataCache.m_axisVector;
+        const float heightSquared = powf(m_intersectionDataCache.m_height, 2.0f);
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outIsInside[index] = AZ::Intersect::PointCylinder(baseCenterPoint, axisVector, heightSquared, radiusSquared, points[index]);
+        }
+    }
+
+    void CylinderShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        const AZ::Vector3 baseCenterPoint = m_intersectionDataCache.m_baseCenterPoint;
+        if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
+        {
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = (baseCenterPoint - points[index]).GetLengthSq();
+            }
+            return;
+        }
+
+        const AZ::Vector3 topCenterPoint = baseCenterPoint + m_intersectionDataCache.m_axisVector;
+        const float radius = m_intersectionDataCache.m_radius;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = Distance::Point_CylinderSq(points[index], baseCenterPoint, topCenterPoint, radius);
+        }
+    }
+
     bool CylinderShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
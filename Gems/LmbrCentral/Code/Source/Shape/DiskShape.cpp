@@ -19,6 +19,7 @@
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <LmbrCentral/Shape/DiskShapeComponentBus.h>
 #include <Shape/ShapeDisplay.h>
 
@@ -153,6 +154,39 @@ namespace LmbrCentral
         return closestPoint.GetDistanceSq(point);
     }
 
+    void DiskShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        AZStd::fill(outIsInside.begin(), outIsInside.end(), false); // 2D object cannot have points that are strictly inside in 3d space.
+    }
+
+    void DiskShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_diskShapeConfig);
+
+        const AZ::Vector3 center = m_currentTransform.GetTranslation();
+        const AZ::Plane plane = AZ::Plane::CreateFromNormalAndPoint(m_intersectionDataCache.m_normal, center);
+        const float radius = m_intersectionDataCache.m_radius;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3& point = points[index];
+            AZ::Vector3 closestPointToPlane;
+            AZ::Intersect::ClosestPointPlane(point, plane, closestPointToPlane);
+
+            AZ::Vector3 centerToClosestPoint = closestPointToPlane - center;
+            if (centerToClosestPoint.GetLengthSq() > radius * radius)
+            {
+                centerToClosestPoint.SetLength(radius);
+            }
+            outDistancesSquared[index] = (center + centerToClosestPoint).GetDistanceSq(point);
+        }
+    }
+
     bool DiskShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_diskShapeConfig);
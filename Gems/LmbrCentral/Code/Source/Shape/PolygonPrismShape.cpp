@@ -152,6 +152,109 @@ namespace LmbrCentral
             vertices, height, polygonPrismMeshOut.m_lines);
     }
 
+    /// Squared distance below which the ray of the 'crossing test' touches a polygon edge.
+    static constexpr float PolygonEdgeEpsilon = 0.0001f;
+    /// Length of the ray of the 'crossing test', cast from the point along the x axis.
+    static constexpr float PolygonProjectRayLength = 1000.0f;
+    /// Margin added around each edge of the edge grid, larger than the distance at which an edge is touched
+    /// (the square root of PolygonEdgeEpsilon) so no edge that can be crossed is culled.
+    static constexpr float EdgeGridMargin = 0.02f;
+    /// Upper limit on the number of cells of the edge grid, the grid has one cell per vertex up to this limit.
+    static constexpr size_t MaxEdgeGridCells = 256;
+
+    /// Returns if the ray of the 'crossing test' crosses the polygon edge starting at the vertex with the given index.
+    /// Counts touching the start of an edge only if the edge is going up (y-axis), so a crossing
+    /// through a vertex isn't counted twice.
+    static bool IsPolygonEdgeCrossed(
+        const AZStd::vector<AZ::Vector2>& vertices, size_t edgeIndex,
+        const AZ::Vector3& localPointFlattened, const AZ::Vector3& localEndFlattened)
+    {
+        const AZ::Vector3 segmentStart = AZ::Vector2ToVector3(vertices[edgeIndex]);
+        const AZ::Vector3 segmentEnd = AZ::Vector2ToVector3(vertices[(edgeIndex + 1) % vertices.size()]);
+
+        AZ::Vector3 closestPosRay, closestPosSegment;
+        float rayProportion, segmentProportion;
+        AZ::Intersect::ClosestSegmentSegment(localPointFlattened, localEndFlattened, segmentStart, segmentEnd, rayProportion, segmentProportion, closestPosRay, closestPosSegment);
+        const float delta = (closestPosRay - closestPosSegment).GetLengthSq();
+
+        // have we crossed/touched a line on the polygon
+        if (delta >= PolygonEdgeEpsilon)
+        {
+            return false;
+        }
+
+        if (AZ::IsClose(segmentProportion, 0.0f, AZ::Constants::FloatEpsilon))
+        {
+            const AZ::Vector3 highestVertex = segmentStart.GetY() > segmentEnd.GetY() ? segmentStart : segmentEnd;
+            return (highestVertex - localPointFlattened).Dot(AZ::Vector3::CreateAxisY()) > 0.0f;
+        }
+
+        return true;
+    }
+
+    /// Returns the squared distance from a point in the local space of a polygon prism to its walls, the point must
+    /// be outside of the polygon when flattened.
+    static float DistanceSquaredFromPolygonPrismWalls(
+        const AZStd::vector<AZ::Vector2>& vertices, float height, const AZ::Vector3& localPoint)
+    {
+        const AZ::Vector3 localPointFlattened = AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.0f);
+        const size_t vertexCount = vertices.size();
+
+        // find closest segment
+        AZ::Vector3 closestPos;
+        float minDistanceSq = std::numeric_limits<float>::max();
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            const AZ::Vector3 segmentStart = AZ::Vector2ToVector3(vertices[i]);
+            const AZ::Vector3 segmentEnd = AZ::Vector2ToVector3(vertices[(i + 1) % vertexCount]);
+
+            AZ::Vector3 position;
+            float proportion;
+            AZ::Intersect::ClosestPointSegment(localPointFlattened, segmentStart, segmentEnd, proportion, position);
+
+            const float distanceSq = (position - localPointFlattened).GetLengthSq();
+            if (distanceSq < minDistanceSq)
+            {
+                minDistanceSq = distanceSq;
+                closestPos = position;
+            }
+        }
+
+        // constrain closest pos to [0, height] of volume
+        closestPos += AZ::Vector3(0.0f, 0.0f, AZ::GetClamp<float>(localPoint.GetZ(), 0.0f, height));
+
+        // return distanceSq from closest pos on prism
+        return (closestPos - localPoint).GetLengthSq();
+    }
+
+    /// Returns the squared distance from a point in the local space of a polygon prism to the prism,
+    /// given whether the point is inside the polygon when flattened.
+    static float DistanceSquaredFromPolygonPrism(
+        const AZStd::vector<AZ::Vector2>& vertices, float height, const AZ::Vector3& localPoint, bool isInsidePolygon)
+    {
+        if (isInsidePolygon)
+        {
+            if (localPoint.GetZ() < 0.0f)
+            {
+                // if it's inside the 2d polygon but below the volume
+                const float distance = std::fabs(localPoint.GetZ());
+                return distance * distance;
+            }
+
+            if (localPoint.GetZ() > height)
+            {
+                // if it's inside the 2d polygon but above the volume
+                const float distance = localPoint.GetZ() - height;
+                return distance * distance;
+            }
+
+            // if it's fully contained, return 0
+            return 0.0f;
+        }
+
+        return DistanceSquaredFromPolygonPrismWalls(vertices, height, localPoint);
+    }
+
     PolygonPrismShape::PolygonPrismShape()
         : m_polygonPrism(AZStd::make_shared<AZ::PolygonPrism>()) {}
 
@@ -333,21 +436,40 @@ namespace LmbrCentral
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism);
 
-        // initial early aabb rejection test
-        // note: will implicitly do height test too
-        if (!GetEncompassingAabb().Contains(point))
+        return m_intersectionDataCache.IsPointInside(*m_polygonPrism, point);
+    }
+
+    float PolygonPrismShape::DistanceSquaredFromPoint(const AZ::Vector3& point)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism);
+
+        return m_intersectionDataCache.DistanceSquaredFromPoint(*m_polygonPrism, point);
+    }
+
+    void PolygonPrismShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism);
+
+        for (size_t index = 0; index < points.size(); ++index)
         {
-            return false;
+            outIsInside[index] = m_intersectionDataCache.IsPointInside(*m_polygonPrism, points[index]);
         }
-
-        return PolygonPrismUtil::IsPointInside(*m_polygonPrism, point, m_currentTransform);
     }
 
-    float PolygonPrismShape::DistanceSquaredFromPoint(const AZ::Vector3& point)
+    void PolygonPrismShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
     {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism);
 
-        return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = m_intersectionDataCache.DistanceSquaredFromPoint(*m_polygonPrism, points[index]);
+        }
     }
 
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
@@ -365,6 +487,140 @@ namespace LmbrCentral
         GenerateSolidPolygonPrismMesh(
             polygonPrism.m_vertexContainer.GetVertices(),
             polygonPrism.GetHeight(), m_triangles);
+
+        m_worldFromLocalUniformScale = currentTransform;
+        const float entityScale = m_worldFromLocalUniformScale.ExtractScale().GetMaxElement();
+        m_worldFromLocalUniformScale *= AZ::Transform::CreateScale(AZ::Vector3(entityScale));
+        m_localFromWorldUniformScale = m_worldFromLocalUniformScale.GetInverse();
+
+        BuildEdgeGrid(polygonPrism.m_vertexContainer.GetVertices());
+    }
+
+    void PolygonPrismShape::PolygonPrismIntersectionDataCache::BuildEdgeGrid(const AZStd::vector<AZ::Vector2>& vertices)
+    {
+        m_edgeGridCellOffsets.clear();
+        m_edgeGridEdges.clear();
+
+        const size_t vertexCount = vertices.size();
+        if (vertexCount == 0)
+        {
+            return;
+        }
+
+        float minY = vertices[0].GetY();
+        float maxY = minY;
+        for (const AZ::Vector2& vertex : vertices)
+        {
+            minY = AZ::GetMin(minY, vertex.GetY());
+            maxY = AZ::GetMax(maxY, vertex.GetY());
+        }
+
+        const size_t cellCount = AZ::GetClamp<size_t>(vertexCount, 1, MaxEdgeGridCells);
+        m_edgeGridMinY = minY - EdgeGridMargin;
+        m_edgeGridInvCellHeight = static_cast<float>(cellCount) / ((maxY + EdgeGridMargin) - m_edgeGridMinY);
+
+        // Each edge is added to every cell its y range, grown by the margin, overlaps
+        auto getCellRange = [this, &vertices, vertexCount, cellCount](size_t edgeIndex, size_t& firstCell, size_t& lastCell)
+        {
+            const float startY = vertices[edgeIndex].GetY();
+            const float endY = vertices[(edgeIndex + 1) % vertexCount].GetY();
+            const float first = (AZ::GetMin(startY, endY) - EdgeGridMargin - m_edgeGridMinY) * m_edgeGridInvCellHeight;
+            const float last = (AZ::GetMax(startY, endY) + EdgeGridMargin - m_edgeGridMinY) * m_edgeGridInvCellHeight;
+            firstCell = AZ::GetMin(static_cast<size_t>(AZ::GetMax(first, 0.0f)), cellCount - 1);
+            lastCell = AZ::GetMin(static_cast<size_t>(AZ::GetMax(last, 0.0f)), cellCount - 1);
+        };
+
+        // Count the edges of each cell first, so the edges can be stored contiguously per cell
+        m_edgeGridCellOffsets.resize(cellCount + 1, 0);
+        for (size_t edgeIndex = 0; edgeIndex < vertexCount; ++edgeIndex)
+        {
+            size_t firstCell, lastCell;
+            getCellRange(edgeIndex, firstCell, lastCell);
+            for (size_t cell = firstCell; cell <= lastCell; ++cell)
+            {
+                ++m_edgeGridCellOffsets[cell + 1];
+            }
+        }
+        for (size_t cell = 0; cell < cellCount; ++cell)
+        {
+            m_edgeGridCellOffsets[cell + 1] += m_edgeGridCellOffsets[cell];
+        }
+
+        m_edgeGridEdges.resize(m_edgeGridCellOffsets[cellCount]);
+        AZStd::vector<AZ::u32> cellInsertPositions(m_edgeGridCellOffsets.begin(), m_edgeGridCellOffsets.end() - 1);
+        for (size_t edgeIndex = 0; edgeIndex < vertexCount; ++edgeIndex)
+        {
+            size_t firstCell, lastCell;
+            getCellRange(edgeIndex, firstCell, lastCell);
+            for (size_t cell = firstCell; cell <= lastCell; ++cell)
+            {
+                m_edgeGridEdges[cellInsertPositions[cell]++] = static_cast<AZ::u32>(edgeIndex);
+            }
+        }
+    }
+
+    bool PolygonPrismShape::PolygonPrismIntersectionDataCache::IsPointInsidePolygon(
+        const AZStd::vector<AZ::Vector2>& vertices, const AZ::Vector3& localPointFlattened) const
+    {
+        if (m_edgeGridCellOffsets.empty())
+        {
+            return false;
+        }
+
+        // Points outside of the grid are too far above or below the polygon to cross any of its edges
+        const size_t cellCount = m_edgeGridCellOffsets.size() - 1;
+        const float cellPosition = (localPointFlattened.GetY() - m_edgeGridMinY) * m_edgeGridInvCellHeight;
+        if (!(cellPosition >= 0.0f) || cellPosition >= static_cast<float>(cellCount))
+        {
+            return false;
+        }
+
+        const size_t cell = static_cast<size_t>(cellPosition);
+        const AZ::Vector3 localEndFlattened = localPointFlattened + AZ::Vector3::CreateAxisX() * PolygonProjectRayLength;
+
+        // use 'crossing test' algorithm to decide if the point lies within the volume or not
+        // (odd number of intersections - inside, even number of intersections - outside)
+        size_t intersections = 0;
+        for (AZ::u32 i = m_edgeGridCellOffsets[cell]; i < m_edgeGridCellOffsets[cell + 1]; ++i)
+        {
+            if (IsPolygonEdgeCrossed(vertices, m_edgeGridEdges[i], localPointFlattened, localEndFlattened))
+            {
+                intersections++;
+            }
+        }
+
+        // odd inside, even outside - bitwise AND to convert to bool
+        return intersections & 1;
+    }
+
+    bool PolygonPrismShape::PolygonPrismIntersectionDataCache::IsPointInside(
+        const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point) const
+    {
+        // initial early aabb rejection test
+        // note: will implicitly do height test too
+        if (!m_aabb.Contains(point))
+        {
+            return false;
+        }
+
+        // ensure the point is not above or below the prism (in its local space)
+        const AZ::Vector3 localPoint = m_localFromWorldUniformScale.TransformPoint(point);
+        if (localPoint.GetZ() < 0.0f || localPoint.GetZ() > polygonPrism.GetHeight())
+        {
+            return false;
+        }
+
+        return IsPointInsidePolygon(
+            polygonPrism.m_vertexContainer.GetVertices(), AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.0f));
+    }
+
+    float PolygonPrismShape::PolygonPrismIntersectionDataCache::DistanceSquaredFromPoint(
+        const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point) const
+    {
+        const AZStd::vector<AZ::Vector2>& vertices = polygonPrism.m_vertexContainer.GetVertices();
+        const AZ::Vector3 localPoint = m_localFromWorldUniformScale.TransformPoint(point);
+        const bool isInsidePolygon = IsPointInsidePolygon(vertices, AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.0f));
+        return DistanceSquaredFromPolygonPrism(vertices, polygonPrism.GetHeight(), localPoint, isInsidePolygon);
     }
 
     void DrawPolygonPrismShape(
@@ -431,11 +687,6 @@ namespace LmbrCentral
 
         bool IsPointInside(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& worldFromLocal)
         {
-            using namespace PolygonPrismUtil;
-
-            const float epsilon = 0.0001f;
-            const float projectRayLength = 1000.0f;
-
             const AZStd::vector<AZ::Vector2>& vertices = polygonPrism.m_vertexContainer.GetVertices();
             const size_t vertexCount = vertices.size();
 
@@ -453,40 +704,16 @@ namespace LmbrCentral
             }
 
             const AZ::Vector3 localPointFlattened = AZ::Vector3(localPoint.GetX(), localPoint.GetY(), 0.0f);
-            const AZ::Vector3 localEndFlattened = localPointFlattened + AZ::Vector3::CreateAxisX() * projectRayLength;
+            const AZ::Vector3 localEndFlattened = localPointFlattened + AZ::Vector3::CreateAxisX() * PolygonProjectRayLength;
 
             size_t intersections = 0;
             // use 'crossing test' algorithm to decide if the point lies within the volume or not
             // (odd number of intersections - inside, even number of intersections - outside)
             for (size_t i = 0; i < vertexCount; ++i)
             {
-                const AZ::Vector3 segmentStart = AZ::Vector2ToVector3(vertices[i]);
-                const AZ::Vector3 segmentEnd = AZ::Vector2ToVector3(vertices[(i + 1) % vertexCount]);
-
-                AZ::Vector3 closestPosRay, closestPosSegment;
-                float rayProportion, segmentProportion;
-                AZ::Intersect::ClosestSegmentSegment(localPointFlattened, localEndFlattened, segmentStart, segmentEnd, rayProportion, segmentProportion, closestPosRay, closestPosSegment);
-                const float delta = (closestPosRay - closestPosSegment).GetLengthSq();
-
-                // have we crossed/touched a line on the polygon
-                if (delta < epsilon)
+                if (IsPolygonEdgeCrossed(vertices, i, localPointFlattened, localEndFlattened))
                 {
-                    const AZ::Vector3 highestVertex = segmentStart.GetY() > segmentEnd.GetY() ? segmentStart : segmentEnd;
-
-                    const float threshold = (highestVertex - point).Dot(AZ::Vector3::CreateAxisY());
-                    if (AZ::IsClose(segmentProportion, 0.0f, AZ::Constants::FloatEpsilon))
-                    {
-                        // if at beginning of segment, only count intersection if segment is going up (y-axis)
-                        // (prevent counting segments twice when intersecting at vertex)
-                        if (threshold > 0.0f)
-                        {
-                            intersections++;
-                        }
-                    }
-                    else
-                    {
-                        intersections++;
-                    }
+                    intersections++;
                 }
             }
 
@@ -496,8 +723,6 @@ namespace LmbrCentral
 
         float DistanceSquaredFromPoint(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point, const AZ::Transform& worldFromLocal)
         {
-            const float height = polygonPrism.GetHeight();
-
             AZ::Transform worldFromLocalUniformScale = worldFromLocal;
             const float entityScale = worldFromLocalUniformScale.ExtractScale().GetMaxElement();
             worldFromLocalUniformScale *= AZ::Transform::CreateScale(AZ::Vector3(entityScale));
@@ -507,54 +732,9 @@ namespace LmbrCentral
             const AZ::Vector3 worldPointFlattened = worldFromLocalUniformScale.TransformPoint(localPointFlattened);
 
             // first test if the point is contained within the polygon (flatten)
-            if (IsPointInside(polygonPrism, worldPointFlattened, worldFromLocalUniformScale))
-            {
-                if (localPoint.GetZ() < 0.0f)
-                {
-                    // if it's inside the 2d polygon but below the volume
-                    const float distance = std::fabs(localPoint.GetZ());
-                    return distance * distance;
-                }
-
-                if (localPoint.GetZ() > height)
-                {
-                    // if it's inside the 2d polygon but above the volume
-                    const float distance = localPoint.GetZ() - height;
-                    return distance * distance;
-                }
-
-                // if it's fully contained, return 0
-                return 0.0f;
-            }
-
-            const AZStd::vector<AZ::Vector2>& vertices = polygonPrism.m_vertexContainer.GetVertices();
-            const size_t vertexCount = vertices.size();
-
-            // find closest segment
-            AZ::Vector3 closestPos;
-            float minDistanceSq = std::numeric_limits<float>::max();
-            for (size_t i = 0; i < vertexCount; ++i)
-            {
-                const AZ::Vector3 segmentStart = AZ::Vector2ToVector3(vertices[i]);
-                const AZ::Vector3 segmentEnd = AZ::Vector2ToVector3(vertices[(i + 1) % vertexCount]);
-
-                AZ::Vector3 position;
-                float proportion;
-                AZ::Intersect::ClosestPointSegment(localPointFlattened, segmentStart, segmentEnd, proportion, position);
-
-                const float distanceSq = (position - localPointFlattened).GetLengthSq();
-                if (distanceSq < minDistanceSq)
-                {
-                    minDistanceSq = distanceSq;
-                    closestPos = position;
-                }
-            }
-
-            // constrain closest pos to [0, height] of volume
-            closestPos += AZ::Vector3(0.0f, 0.0f, AZ::GetClamp<float>(localPoint.GetZ(), 0.0f, height));
-
-            // return distanceSq from closest pos on prism
-            return (closestPos - localPoint).GetLengthSq();
+            const bool isInsidePolygon = IsPointInside(polygonPrism, worldPointFlattened, worldFromLocalUniformScale);
+            return DistanceSquaredFromPolygonPrism(
+                polygonPrism.m_vertexContainer.GetVertices(), polygonPrism.GetHeight(), localPoint, isInsidePolygon);
         }
 
         bool IntersectRay(
@@ -65,6 +65,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside) override;
+        void DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
 
         // PolygonShapeShapeComponentRequestBus::Handler
@@ -97,10 +99,26 @@ namespace LmbrCentral
                 const AZ::PolygonPrism& polygonPrism,
                 const AZ::Vector3& currentNonUniformScale) override;
 
+            /// Buckets the polygon edges into horizontal bands, so the 'crossing test' only visits the edges near a point.
+            void BuildEdgeGrid(const AZStd::vector<AZ::Vector2>& vertices);
+
+            /// Return if a point in world space is contained within the polygon prism shape.
+            bool IsPointInside(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point) const;
+            /// Return if a point in the local space of the polygon prism, flattened to z = 0, is contained within its polygon.
+            bool IsPointInsidePolygon(const AZStd::vector<AZ::Vector2>& vertices, const AZ::Vector3& localPointFlattened) const;
+            /// Return distance squared from point in world space from the polygon prism shape.
+            float DistanceSquaredFromPoint(const AZ::PolygonPrism& polygonPrism, const AZ::Vector3& point) const;
+
             friend PolygonPrismShape;
 
             AZ::Aabb m_aabb; ///< Aabb of polygon prism shape.
             AZStd::vector<AZ::Vector3> m_triangles; ///< Triangles comprising the polygon prism shape (for intersection testing).
+            AZ::Transform m_worldFromLocalUniformScale; ///< World transform of the polygon prism with its largest scale applied uniformly.
+            AZ::Transform m_localFromWorldUniformScale; ///< Inverse of m_worldFromLocalUniformScale.
+            float m_edgeGridMinY = 0.0f; ///< Local y position of the bottom of the edge grid.
+            float m_edgeGridInvCellHeight = 0.0f; ///< Inverse of the height of a cell of the edge grid.
+            AZStd::vector<AZ::u32> m_edgeGridCellOffsets; ///< Start of the edges of each cell in m_edgeGridEdges, plus the end of the last cell.
+            AZStd::vector<AZ::u32> m_edgeGridEdges; ///< Indices of the edges overlapping each cell, stored contiguously per cell.
         };
 
         AZ::PolygonPrismPtr m_polygonPrism; ///< Reference to the underlying polygon prism data.
@@ -19,6 +19,7 @@
 #include <AzCore/Math/Obb.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <LmbrCentral/Shape/QuadShapeComponentBus.h>
 #include <Shape/ShapeDisplay.h>
 
@@ -171,7 +172,7 @@ namespace LmbrCentral
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_quadShapeConfig, m_currentNonUniformScale);
 
         // translate and rotate the point into the space of the quad.
-        AZ::Vector3 tPoint = m_currentTransform.GetRotation().GetInverseFull().TransformVector(point - m_currentTransform.GetTranslation());
+        AZ::Vector3 tPoint = m_intersectionDataCache.m_inverseQuaternion.TransformVector(point - m_intersectionDataCache.m_position);
 
         float halfWidth = m_intersectionDataCache.m_scaledWidth * 0.5f;
         float halfHeight = m_intersectionDataCache.m_scaledHeight * 0.5f;
@@ -184,6 +185,36 @@ namespace LmbrCentral
         return xDist * xDist + yDist * yDist + zDist * zDist;
     }
 
+    void QuadShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        AZStd::fill(outIsInside.begin(), outIsInside.end(), false); // 2D object cannot have points that are strictly inside in 3d space.
+    }
+
+    void QuadShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_quadShapeConfig, m_currentNonUniformScale);
+
+        const AZ::Quaternion inverseQuaternion = m_intersectionDataCache.m_inverseQuaternion;
+        const AZ::Vector3 position = m_intersectionDataCache.m_position;
+        const float halfWidth = m_intersectionDataCache.m_scaledWidth * 0.5f;
+        const float halfHeight = m_intersectionDataCache.m_scaledHeight * 0.5f;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3 tPoint = inverseQuaternion.TransformVector(points[index] - position);
+
+            const float xDist = AZ::GetMax<float>(AZ::GetMax<float>(-halfWidth - tPoint.GetX(), 0.0f), tPoint.GetX() - halfWidth);
+            const float yDist = AZ::GetMax<float>(AZ::GetMax<float>(-halfHeight - tPoint.GetY(), 0.0f), tPoint.GetY() - halfHeight);
+            const float zDist = tPoint.GetZ();
+            outDistancesSquared[index] = xDist * xDist + yDist * yDist + zDist * zDist;
+        }
+    }
+
     bool QuadShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         auto corners = m_quadShapeConfig.GetCorners();
@@ -205,6 +236,7 @@ namespace LmbrCentral
     {
         m_position = currentTransform.GetTranslation();
         m_quaternion = currentTransform.GetRotation();
+        m_inverseQuaternion = m_quaternion.GetInverseFull();
         m_scaledWidth = configuration.m_width * currentTransform.GetScale().GetX() * currentNonUniformScale.GetX();
         m_scaledHeight = configuration.m_height * currentTransform.GetScale().GetY() * currentNonUniformScale.GetY();
     }
@@ -50,6 +50,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point)  override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside) override;
+        void DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
 
         //! QuadShapeComponentRequestBus overrides...
@@ -90,6 +92,7 @@ namespace LmbrCentral
 
             AZ::Vector3 m_position; //! Position of the center of the quad.
             AZ::Quaternion m_quaternion; //! quaternion of the quad.
+            AZ::Quaternion m_inverseQuaternion; //! Inverse of the quaternion of the quad, rotates points into the space of the quad.
             float m_scaledWidth = 1.0f; //! Width of the quad (including entity scale and non-uniform scale).
             float m_scaledHeight = 1.0f; //! Height of the quad (including entity scale and non-uniform scale).
         };
@@ -123,6 +123,37 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void SphereShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        const AZ::Vector3 position = m_intersectionDataCache.m_position;
+        const float radiusSquared = powf(m_intersectionDataCache.m_radius, 2.0f);
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outIsInside[index] = AZ::Intersect::PointSphere(position, radiusSquared, points[index]);
+        }
+    }
+
+    void SphereShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        const AZ::Vector3 position = m_intersectionDataCache.m_position;
+        const float radius = m_intersectionDataCache.m_radius;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const float distance = (position - points[index]).GetLength() - radius;
+            outDistancesSquared[index] = powf(AZStd::max(distance, 0.0f), 2.0f);
+        }
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
@@ -14,6 +14,7 @@
 #include "TubeShape.h"
 
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
 #include <Shape/ShapeGeometryUtil.h>
 
 #if LMBR_CENTRAL_EDITOR
@@ -264,6 +265,66 @@ namespace LmbrCentral
         return powf((sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * maxScale.GetMaxElement(), 2.0f);
     }
 
+    void TubeShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outIsInside.size());
+
+        if (m_spline == nullptr)
+        {
+            AZStd::fill(outIsInside.begin(), outIsInside.end(), false);
+            return;
+        }
+
+        // The transform into the space of the spline is the same for every point
+        AZ::Transform worldFromLocalNormalized = m_currentTransform;
+        const AZ::Vector3 scale = AZ::Vector3(worldFromLocalNormalized.ExtractScale().GetMaxElement());
+        const AZ::Transform localFromWorldNormalized = worldFromLocalNormalized.GetInverse();
+        const AZ::Vector3 scaleReciprocal = scale.GetReciprocal();
+        const float radiusSq = powf(m_radius, 2.0f);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3 localPoint = localFromWorldNormalized.TransformPoint(points[index]) * scaleReciprocal;
+
+            const auto address = m_spline->GetNearestAddressPosition(localPoint).m_splineAddress;
+            const float variableRadiusSq =
+                powf(m_variableRadius.GetElementInterpolated(address, Lerpf), 2.0f);
+
+            outIsInside[index] = (m_spline->GetPosition(address) - localPoint).GetLengthSq() < (radiusSq + variableRadiusSq) *
+                scale.GetMaxElement();
+        }
+    }
+
+    void TubeShape::DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+            points.size(), outDistancesSquared.size());
+
+        if (m_spline == nullptr)
+        {
+            AZStd::fill(outDistancesSquared.begin(), outDistancesSquared.end(), FLT_MAX);
+            return;
+        }
+
+        AZ::Transform worldFromLocalNormalized = m_currentTransform;
+        const AZ::Vector3 maxScale = AZ::Vector3(worldFromLocalNormalized.ExtractScale().GetMaxElement());
+        const AZ::Transform localFromWorldNormalized = worldFromLocalNormalized.GetInverse();
+        const AZ::Vector3 maxScaleReciprocal = maxScale.GetReciprocal();
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            const AZ::Vector3 localPoint = localFromWorldNormalized.TransformPoint(points[index]) * maxScaleReciprocal;
+
+            const auto splineQueryResult = m_spline->GetNearestAddressPosition(localPoint);
+            const float variableRadius =
+                m_variableRadius.GetElementInterpolated(splineQueryResult.m_splineAddress, Lerpf);
+
+            outDistancesSquared[index] =
+                powf((sqrtf(splineQueryResult.m_distanceSq) - (m_radius + variableRadius)) * maxScale.GetMaxElement(), 2.0f);
+        }
+    }
+
     bool TubeShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         AZ::Transform transformUniformScale = m_currentTransform;
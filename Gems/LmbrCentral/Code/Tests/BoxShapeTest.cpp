@@ -657,4 +657,41 @@ namespace UnitTest
         EXPECT_THAT(debugDrawAabb.GetMin(), IsClose(shapeAabb.GetMin()));
         EXPECT_THAT(debugDrawAabb.GetMax(), IsClose(shapeAabb.GetMax()));
     }
+
+    TEST_F(BoxShapeTest, BatchQueriesMatchSinglePointQueries)
+    {
+        // rotate to end up with an OBB
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationY(AZ::Constants::QuarterPi), AZ::Vector3(5.0f, 5.0f, 5.0f));
+
+        AZ::Entity entity;
+        CreateDefaultBox(transform, entity);
+
+        AZ::SimpleLcgRandom rng;
+        AZStd::vector<AZ::Vector3> points(1000);
+        for (AZ::Vector3& point : points)
+        {
+            point = AZ::Vector3(rng.GetRandomFloat(), rng.GetRandomFloat(), rng.GetRandomFloat()) * 20.0f - AZ::Vector3(5.0f);
+        }
+
+        AZStd::vector<bool> isInside(points.size());
+        AZStd::vector<float> distancesSquared(points.size());
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch, points, isInside);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredBatch, points, distancesSquared);
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            bool inside = false;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                inside, entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInside, points[i]);
+            EXPECT_EQ(isInside[i], inside);
+
+            float distanceSquared = 0.0f;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                distanceSquared, entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[i]);
+            EXPECT_NEAR(distancesSquared[i], distanceSquared, 1e-4f);
+        }
+    }
 }
@@ -605,6 +605,132 @@ namespace UnitTest
         sourceShape.Deactivate();
     }
 
+    // Generates a regular grid of points covering the given aabb, with the given number of points along each axis
+    static AZStd::vector<AZ::Vector3> GenerateGridOfPoints(const AZ::Aabb& aabb, size_t pointsPerAxis)
+    {
+        AZStd::vector<AZ::Vector3> points;
+        points.reserve(pointsPerAxis * pointsPerAxis * pointsPerAxis);
+        const AZ::Vector3 step = aabb.GetExtents() / static_cast<float>(pointsPerAxis - 1);
+        for (size_t x = 0; x < pointsPerAxis; ++x)
+        {
+            for (size_t y = 0; y < pointsPerAxis; ++y)
+            {
+                for (size_t z = 0; z < pointsPerAxis; ++z)
+                {
+                    points.push_back(aabb.GetMin() + step * AZ::Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
+                }
+            }
+        }
+        return points;
+    }
+
+    TEST_F(PolygonPrismShapeTest, PolygonShapeComponent_BatchQueriesMatchPolygonPrismUtil)
+    {
+        // concave polygon with several edges sharing the same y values, to exercise the vertex cases of the crossing test
+        const AZStd::vector<AZ::Vector2> vertices =
+        {
+            AZ::Vector2(0.0f, 0.0f),
+            AZ::Vector2(4.0f, 3.0f),
+            AZ::Vector2(8.0f, 0.0f),
+            AZ::Vector2(8.0f, 8.0f),
+            AZ::Vector2(4.0f, 5.0f),
+            AZ::Vector2(0.0f, 8.0f),
+            AZ::Vector2(2.0f, 4.0f)
+        };
+        const AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(
+            AZ::Quaternion::CreateRotationZ(AZ::DegToRad(30.0f)), AZ::Vector3(2.0f, -3.0f, 1.0f)) *
+            AZ::Transform::CreateScale(AZ::Vector3(1.5f));
+        const float height = 4.0f;
+
+        AZ::Entity entity;
+        CreatePolygonPrism(transform, height, vertices, entity);
+
+        AZ::Aabb aabb = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(
+            aabb, entity.GetId(), &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+        aabb.Expand(AZ::Vector3(2.0f));
+        const AZStd::vector<AZ::Vector3> points = GenerateGridOfPoints(aabb, 17);
+
+        AZStd::vector<bool> isInside(points.size());
+        AZStd::vector<float> distancesSquared(points.size());
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch, points, isInside);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredBatch, points, distancesSquared);
+
+        AZ::PolygonPrismPtr polygonPrism;
+        LmbrCentral::PolygonPrismShapeComponentRequestBus::EventResult(
+            polygonPrism, entity.GetId(), &LmbrCentral::PolygonPrismShapeComponentRequests::GetPolygonPrism);
+        ASSERT_TRUE(polygonPrism);
+
+        size_t insideCount = 0;
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            EXPECT_EQ(isInside[i], LmbrCentral::PolygonPrismUtil::IsPointInside(*polygonPrism, points[i], transform));
+            EXPECT_NEAR(distancesSquared[i],
+                LmbrCentral::PolygonPrismUtil::DistanceSquaredFromPoint(*polygonPrism, points[i], transform), 1e-3f);
+
+            bool singleInside = false;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                singleInside, entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInside, points[i]);
+            EXPECT_EQ(isInside[i], singleInside);
+
+            insideCount += isInside[i] ? 1 : 0;
+        }
+
+        // make sure the grid of points covers both sides of the shape
+        EXPECT_GT(insideCount, 0);
+        EXPECT_LT(insideCount, points.size());
+    }
+
+    TEST_F(PolygonPrismShapeTest, PolygonShapeComponent_BatchQueriesUpdateWhenVerticesChange)
+    {
+        AZ::Entity entity;
+        CreatePolygonPrism(
+            AZ::Transform::CreateIdentity(), 10.0f,
+            AZStd::vector<AZ::Vector2>(
+            {
+                AZ::Vector2(0.0f, 0.0f),
+                AZ::Vector2(0.0f, 10.0f),
+                AZ::Vector2(10.0f, 10.0f),
+                AZ::Vector2(10.0f, 0.0f)
+            }),
+            entity);
+
+        const AZStd::vector<AZ::Vector3> points = { AZ::Vector3(5.0f, 5.0f, 5.0f), AZ::Vector3(15.0f, 5.0f, 5.0f) };
+        AZStd::vector<bool> isInside(points.size());
+        AZStd::vector<float> distancesSquared(points.size());
+
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch, points, isInside);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredBatch, points, distancesSquared);
+        EXPECT_TRUE(isInside[0]);
+        EXPECT_FALSE(isInside[1]);
+        EXPECT_NEAR(distancesSquared[0], 0.0f, 1e-4f);
+        EXPECT_NEAR(distancesSquared[1], 25.0f, 1e-4f);
+
+        // move the polygon so the first point is outside and the second point is inside
+        LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(
+            entity.GetId(), &LmbrCentral::PolygonPrismShapeComponentRequests::SetVertices,
+            AZStd::vector<AZ::Vector2>(
+            {
+                AZ::Vector2(10.0f, 0.0f),
+                AZ::Vector2(10.0f, 10.0f),
+                AZ::Vector2(20.0f, 10.0f),
+                AZ::Vector2(20.0f, 0.0f)
+            }));
+
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch, points, isInside);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entity.GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredBatch, points, distancesSquared);
+        EXPECT_FALSE(isInside[0]);
+        EXPECT_TRUE(isInside[1]);
+        EXPECT_NEAR(distancesSquared[0], 25.0f, 1e-4f);
+        EXPECT_NEAR(distancesSquared[1], 0.0f, 1e-4f);
+    }
+
     TEST_F(AllocatorsFixture, PolygonPrismFilledMeshClearedWithLessThanThreeVertices)
     {
         // given
@@ -0,0 +1,186 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include "LmbrCentral_precompiled.h"
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <Shape/BoxShapeComponent.h>
+#include <Shape/PolygonPrismShapeComponent.h>
+
+namespace Benchmark
+{
+    //! Compares querying shapes one point at a time over the ShapeComponentRequestsBus with the batched queries.
+    class BM_ShapeQueries
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PointCount = 4096;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+
+            m_transformComponentDescriptor = AZStd::unique_ptr<AZ::ComponentDescriptor>(AzFramework::TransformComponent::CreateDescriptor());
+            m_transformComponentDescriptor->Reflect(m_serializeContext.get());
+            m_boxShapeComponentDescriptor = AZStd::unique_ptr<AZ::ComponentDescriptor>(LmbrCentral::BoxShapeComponent::CreateDescriptor());
+            m_boxShapeComponentDescriptor->Reflect(m_serializeContext.get());
+            m_polygonPrismShapeComponentDescriptor = AZStd::unique_ptr<AZ::ComponentDescriptor>(LmbrCentral::PolygonPrismShapeComponent::CreateDescriptor());
+            m_polygonPrismShapeComponentDescriptor->Reflect(m_serializeContext.get());
+
+            m_entity = AZStd::make_unique<AZ::Entity>();
+
+            // scatter the points over an area a bit larger than the shapes so both sides of the shapes are tested
+            AZ::SimpleLcgRandom rng;
+            m_points.resize(PointCount);
+            for (AZ::Vector3& point : m_points)
+            {
+                point = AZ::Vector3(rng.GetRandomFloat(), rng.GetRandomFloat(), rng.GetRandomFloat()) * 24.0f - AZ::Vector3(12.0f);
+            }
+            m_isInside.resize(PointCount);
+            m_distancesSquared.resize(PointCount);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_entity.reset();
+            m_points = {};
+            m_isInside = {};
+            m_distancesSquared = {};
+            m_polygonPrismShapeComponentDescriptor.reset();
+            m_boxShapeComponentDescriptor.reset();
+            m_transformComponentDescriptor.reset();
+            m_serializeContext.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void CreateBox()
+        {
+            m_entity->CreateComponent<LmbrCentral::BoxShapeComponent>();
+            m_entity->CreateComponent<AzFramework::TransformComponent>();
+            m_entity->Init();
+            m_entity->Activate();
+
+            AZ::TransformBus::Event(m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTM,
+                AZ::Transform::CreateRotationZ(AZ::Constants::QuarterPi));
+            LmbrCentral::BoxShapeComponentRequestsBus::Event(m_entity->GetId(),
+                &LmbrCentral::BoxShapeComponentRequestsBus::Events::SetBoxDimensions, AZ::Vector3(10.0f));
+        }
+
+        //! Creates a star shaped polygon prism, so it's concave and its edges span a wide range of directions.
+        void CreatePolygonPrism(size_t vertexCount)
+        {
+            m_entity->CreateComponent<LmbrCentral::PolygonPrismShapeComponent>();
+            m_entity->CreateComponent<AzFramework::TransformComponent>();
+            m_entity->Init();
+            m_entity->Activate();
+
+            AZStd::vector<AZ::Vector2> vertices(vertexCount);
+            for (size_t i = 0; i < vertexCount; ++i)
+            {
+                const float angle = AZ::Constants::TwoPi * static_cast<float>(i) / static_cast<float>(vertexCount);
+                const float radius = (i % 2 == 0) ? 10.0f : 6.0f;
+                vertices[i] = AZ::Vector2(radius * cosf(angle), radius * sinf(angle));
+            }
+
+            AZ::TransformBus::Event(m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTM,
+                AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, -5.0f)));
+            LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(m_entity->GetId(),
+                &LmbrCentral::PolygonPrismShapeComponentRequests::SetHeight, 10.0f);
+            LmbrCentral::PolygonPrismShapeComponentRequestBus::Event(m_entity->GetId(),
+                &LmbrCentral::PolygonPrismShapeComponentRequests::SetVertices, vertices);
+        }
+
+        void QueryPerPoint(::benchmark::State& state)
+        {
+            for (auto _ : state)
+            {
+                for (size_t i = 0; i < PointCount; ++i)
+                {
+                    bool inside = false;
+                    LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                        inside, m_entity->GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInside, m_points[i]);
+                    m_isInside[i] = inside;
+
+                    float distanceSquared = 0.0f;
+                    LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                        distanceSquared, m_entity->GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, m_points[i]);
+                    m_distancesSquared[i] = distanceSquared;
+                }
+                benchmark::DoNotOptimize(m_distancesSquared.data());
+            }
+            state.SetItemsProcessed(state.iterations() * PointCount);
+        }
+
+        void QueryBatch(::benchmark::State& state)
+        {
+            for (auto _ : state)
+            {
+                LmbrCentral::ShapeComponentRequestsBus::Event(
+                    m_entity->GetId(), &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch, m_points, m_isInside);
+                LmbrCentral::ShapeComponentRequestsBus::Event(
+                    m_entity->GetId(), &LmbrCentral::ShapeComponentRequests::DistanceSquaredBatch, m_points, m_distancesSquared);
+                benchmark::DoNotOptimize(m_distancesSquared.data());
+            }
+            state.SetItemsProcessed(state.iterations() * PointCount);
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_transformComponentDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_boxShapeComponentDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_polygonPrismShapeComponentDescriptor;
+        AZStd::unique_ptr<AZ::Entity> m_entity;
+        AZStd::vector<AZ::Vector3> m_points;
+        AZStd::vector<bool> m_isInside;
+        AZStd::vector<float> m_distancesSquared;
+    };
+
+    BENCHMARK_DEFINE_F(BM_ShapeQueries, BoxPerPoint)(benchmark::State& state)
+    {
+        CreateBox();
+        QueryPerPoint(state);
+    }
+
+    BENCHMARK_DEFINE_F(BM_ShapeQueries, BoxBatch)(benchmark::State& state)
+    {
+        CreateBox();
+        QueryBatch(state);
+    }
+
+    // Arg 0 is the number of vertices of the polygon prism
+    BENCHMARK_DEFINE_F(BM_ShapeQueries, PolygonPrismPerPoint)(benchmark::State& state)
+    {
+        CreatePolygonPrism(static_cast<size_t>(state.range(0)));
+        QueryPerPoint(state);
+    }
+
+    BENCHMARK_DEFINE_F(BM_ShapeQueries, PolygonPrismBatch)(benchmark::State& state)
+    {
+        CreatePolygonPrism(static_cast<size_t>(state.range(0)));
+        QueryBatch(state);
+    }
+
+    BENCHMARK_REGISTER_F(BM_ShapeQueries, BoxPerPoint)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_ShapeQueries, BoxBatch)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_ShapeQueries, PolygonPrismPerPoint)->Arg(8)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_ShapeQueries, PolygonPrismBatch)->Arg(8)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -16,6 +16,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -148,6 +149,36 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) = 0;
 
+        /// @brief Checks a list of points against the shape. Testing in batches pays for the bus dispatch and
+        /// the intersection cache update once per list instead of once per point. The default implementation
+        /// calls IsPointInside for every point, shapes override it with a batched implementation.
+        /// @param points The points to be tested
+        /// @param outIsInside Whether each point is inside the shape, must be the same size as points
+        virtual void IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+        {
+            AZ_Assert(points.size() == outIsInside.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+                points.size(), outIsInside.size());
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outIsInside[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min squared distance of each point in a list from the shape, see IsPointInsideBatch.
+        /// @param points The points to calculate square distances from
+        /// @param outDistancesSquared The square distance of each point from the shape, must be the same size as points
+        virtual void DistanceSquaredBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+        {
+            AZ_Assert(points.size() == outDistancesSquared.size(), "The point list size (%zu) doesn't match the output list size (%zu).",
+                points.size(), outDistancesSquared.size());
+
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/)
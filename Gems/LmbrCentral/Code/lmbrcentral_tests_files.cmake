@@ -22,6 +22,7 @@ set(FILES
     Tests/LmbrCentralReflectionTest.h
     Tests/LmbrCentralReflectionTest.cpp
     Tests/LmbrCentralTest.cpp
+    Tests/ShapeBenchmarks.cpp
     Tests/ShapeGeometryUtilTest.cpp
     Tests/ShapeTestUtils.cpp
     Tests/ShapeTestUtils.h
@@ -13,6 +13,7 @@
 #include <Source/Components/NetBindComponent.h>
 #include <Source/Components/MultiplayerComponent.h>
 #include <Source/Components/MultiplayerController.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
 #include <Source/NetworkEntity/INetworkEntityManager.h>
 #include <Source/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Source/NetworkEntity/NetworkEntityUpdateMessage.h>
@@ -32,7 +33,8 @@ namespace Multiplayer
         if (serializeContext)
         {
             serializeContext->Class<NetBindComponent, AZ::Component>()
-                ->Version(1);
+                ->Version(1)
+                ->Field("ReplicationPriority", &NetBindComponent::m_replicationPriority);
 
             AZ::EditContext* editContext = serializeContext->GetEditContext();
             if (editContext)
@@ -43,6 +45,8 @@ namespace Multiplayer
                     ->Attribute(AZ::Edit::Attributes::Icon, "Editor/Icons/Components/NetBind.png")
                     ->Attribute(AZ::Edit::Attributes::ViewportIcon, "Editor/Icons/Components/Viewport/NetBind.png")
                     ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC_CE("Game"))
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &NetBindComponent::m_replicationPriority, "Replication priority", "Relative importance of this entity when replication bandwidth is limited")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
                     ;
             }
         }
@@ -122,6 +126,16 @@ namespace Multiplayer
         return m_netEntityId;
     }
 
+    float NetBindComponent::GetReplicationPriority() const
+    {
+        return m_replicationPriority;
+    }
+
+    void NetBindComponent::SetReplicationPriority(float replicationPriority)
+    {
+        m_replicationPriority = replicationPriority;
+    }
+
     const PrefabEntityId& NetBindComponent::GetPrefabEntityId() const
     {
         return m_prefabEntityId;
@@ -257,6 +271,9 @@ namespace Multiplayer
 
     void NetBindComponent::MarkDirty()
     {
+        // Updates other connections already serialized this tick no longer hold the current property values
+        GetNetworkEntityManager()->GetEntityUpdateCache()->InvalidateEntity(GetNetEntityId());
+
         if (!m_handleMarkedDirty.IsConnected())
         {
             GetNetworkEntityManager()->AddEntityMarkedDirtyHandler(m_handleMarkedDirty);
@@ -62,6 +62,13 @@ namespace Multiplayer
         ConstNetworkEntityHandle GetEntityHandle() const;
         NetworkEntityHandle GetEntityHandle();
 
+        //! Relative importance of this entity when replication bandwidth is limited, 1.0 by default.
+        //! Replication windows scale their own priority (distance, time since the last update) by this value.
+        //! @{
+        float GetReplicationPriority() const;
+        void SetReplicationPriority(float replicationPriority);
+        //! @}
+
         MultiplayerComponentInputVector AllocateComponentInputs();
         bool IsProcessingInput() const;
         void CreateInput(NetworkInput& networkInput, float deltaTime);
@@ -143,6 +150,7 @@ namespace Multiplayer
         NetworkEntityHandle   m_netEntityHandle;
         NetEntityRole         m_netEntityRole   = NetEntityRole::InvalidRole;
         NetEntityId           m_netEntityId     = InvalidNetEntityId;
+        float                 m_replicationPriority = 1.0f;
 
         bool                  m_isProcessingInput    = false;
         bool                  m_isMigrationDataValid = false;
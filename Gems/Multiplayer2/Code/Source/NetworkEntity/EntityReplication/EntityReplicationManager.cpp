@@ -12,6 +12,7 @@
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Source/NetworkEntity/EntityReplication/IReplicationWindow.h>
@@ -29,6 +30,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/sort.h>
 
 namespace Multiplayer
 {
@@ -93,6 +95,9 @@ namespace Multiplayer
     void EntityReplicationManager::SendUpdates(AZ::TimeMs serverGameTimeMs)
     {
         m_frameTimeMs = AZ::GetElapsedTimeMs();
+
+        // Updates serialized for other connections during this tick can be reused by this connection
+        GetNetworkEntityManager()->GetEntityUpdateCache()->BeginTick(serverGameTimeMs);
         SendEntityUpdates(serverGameTimeMs);
 
         SendEntityRpcs(m_deferredRpcMessagesReliable, true);
@@ -176,13 +181,11 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList autonomousReplicators;
         autonomousReplicators.reserve(m_replicatorsPendingSend.size());
-        EntityReplicatorList proxyReplicators;
-        proxyReplicators.reserve(m_replicatorsPendingSend.size());
+        PrioritizedReplicatorList proxyCandidates;
+        proxyCandidates.reserve(m_replicatorsPendingSend.size());
 
-        uint32_t elementsAdded = 0;
-        for (auto iter = m_replicatorsPendingSend.begin(); 
-            iter != m_replicatorsPendingSend.end()
-            && elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount();)
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             EntityReplicator* replicator = GetEntityReplicator(*iter);
             bool clearPendingSend = true;
@@ -192,12 +195,15 @@ namespace Multiplayer
                 PropertyPublisher* propPublisher = replicator->GetPropertyPublisher();
                 if (propPublisher)
                 {
+                    const bool isAutonomous = (replicator->GetRemoteNetworkRole() == NetEntityRole::ClientAutonomous);
+
                     // don't have too many replicators pending creation outstanding at a time
                     bool canSend = true;
                     if (!propPublisher->IsRemoteReplicatorEstablished())
                     {
                         // If we have our maximum set of entities pending creation, and this entity isn't in that set, then skip it
-                        if ((m_remoteEntitiesPendingCreation.size() >= m_maxRemoteEntitiesPendingCreationCount) && (m_remoteEntitiesPendingCreation.find(entityId) == m_remoteEntitiesPendingCreation.end()))
+                        // Proxies are checked again once they have been prioritized, since only the ones that fit the send budget go out
+                        if (isAutonomous && !CanCreateRemoteEntity(entityId))
                         {
                             canSend = false; // don't send this
                             clearPendingSend = false;  // there might be outstanding data here, but we won't check, so we shouldn't clear it
@@ -211,24 +217,25 @@ namespace Multiplayer
                     if (canSend && propPublisher->RequiresSerialization())
                     {
                         clearPendingSend = false;
-                        if (!propPublisher->IsRemoteReplicatorEstablished())
-                        {
-                            m_remoteEntitiesPendingCreation.insert(entityId);
-                        }
-
-                        if (replicator->GetRemoteNetworkRole() == NetEntityRole::ClientAutonomous)
+                        if (isAutonomous)
                         {
+                            if (!propPublisher->IsRemoteReplicatorEstablished())
+                            {
+                                m_remoteEntitiesPendingCreation.insert(entityId);
+                            }
                             autonomousReplicators.push_back(replicator);
                         }
                         else
                         {
-                            if (elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount())
-                            {
-                                proxyReplicators.push_back(replicator);
-                            }
+                            auto setIter = replicationSet.find(replicator->GetEntityHandle());
+                            const float priority = (setIter != replicationSet.end()) ? setIter->second.m_priority : 0.0f;
+                            proxyCandidates.push_back(PrioritizedReplicator{ replicator, priority });
                         }
                     }
-                    ++elementsAdded;
+                    else if (!isAutonomous && !propPublisher->IsRemoteReplicatorEstablished() && !CanCreateRemoteEntity(entityId))
+                    {
+                        clearPendingSend = false;
+                    }
                 }
             }
 
@@ -243,12 +250,54 @@ namespace Multiplayer
             }
         }
 
+        // Send the highest priority proxies first, anything over the send budget stays pending for the next update
         EntityReplicatorList toSendList;
         toSendList.swap(autonomousReplicators);
-        toSendList.insert(toSendList.end(), proxyReplicators.begin(), proxyReplicators.end());
+        AppendHighestPriorityReplicators(proxyCandidates, m_replicationWindow->GetMaxEntityReplicatorSendCount(),
+            [this](EntityReplicator* replicator)
+            {
+                if (!replicator->GetPropertyPublisher()->IsRemoteReplicatorEstablished())
+                {
+                    const NetEntityId entityId = replicator->GetEntityHandle().GetNetEntityId();
+                    if (!CanCreateRemoteEntity(entityId))
+                    {
+                        return false;
+                    }
+                    m_remoteEntitiesPendingCreation.insert(entityId);
+                }
+                return true;
+            }, toSendList);
         return toSendList;
     }
 
+    void EntityReplicationManager::AppendHighestPriorityReplicators(PrioritizedReplicatorList& candidates, uint32_t maxSendCount,
+        const AZStd::function<bool(EntityReplicator*)>& canSend, EntityReplicatorList& outSendList)
+    {
+        AZStd::sort(candidates.begin(), candidates.end(),
+            [](const PrioritizedReplicator& lhs, const PrioritizedReplicator& rhs) { return lhs.m_priority > rhs.m_priority; });
+
+        uint32_t replicatorsAdded = 0;
+        for (const PrioritizedReplicator& candidate : candidates)
+        {
+            if (replicatorsAdded >= maxSendCount)
+            {
+                break;
+            }
+
+            if (canSend(candidate.m_replicator))
+            {
+                outSendList.push_back(candidate.m_replicator);
+                ++replicatorsAdded;
+            }
+        }
+    }
+
+    bool EntityReplicationManager::CanCreateRemoteEntity(NetEntityId entityId) const
+    {
+        return (m_remoteEntitiesPendingCreation.size() < m_maxRemoteEntitiesPendingCreationCount)
+            || (m_remoteEntitiesPendingCreation.find(entityId) != m_remoteEntitiesPendingCreation.end());
+    }
+
     void EntityReplicationManager::SendEntityUpdates(AZ::TimeMs serverGameTimeMs)
     {
         EntityReplicatorList toSendList = GenerateEntityUpdateList();
@@ -259,6 +308,7 @@ namespace Multiplayer
         for (EntityReplicator* replicator : toSendList)
         {
             replicator->GetPropertyPublisher()->PrepareSerialization();
+            m_replicationWindow->OnEntityUpdateSent(replicator->GetEntityHandle());
         }
     
         // While our to send list is not empty, build up another packet to send
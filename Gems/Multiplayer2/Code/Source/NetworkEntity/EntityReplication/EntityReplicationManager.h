@@ -20,6 +20,7 @@
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -100,6 +101,20 @@ namespace Multiplayer
         
         bool IsUpdateModeToServerClient();
 
+        using EntityReplicatorList = AZStd::vector<EntityReplicator*>;
+
+        struct PrioritizedReplicator
+        {
+            EntityReplicator* m_replicator;
+            float m_priority;
+        };
+        using PrioritizedReplicatorList = AZStd::vector<PrioritizedReplicator>;
+
+        //! Sorts the candidates by descending priority, then appends the ones canSend accepts to outSendList until maxSendCount have been added.
+        //! Candidates that don't make the budget aren't added, so their replicators stay pending send and keep accumulating priority.
+        static void AppendHighestPriorityReplicators(PrioritizedReplicatorList& candidates, uint32_t maxSendCount,
+            const AZStd::function<bool(EntityReplicator*)>& canSend, EntityReplicatorList& outSendList);
+
     private:
         AZ_DISABLE_COPY_MOVE(EntityReplicationManager);
 
@@ -115,9 +130,11 @@ namespace Multiplayer
         using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
-        using EntityReplicatorList = AZStd::vector<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
+        //! Returns true if the entity is already pending creation on the remote host, or if there is room for another one.
+        bool CanCreateRemoteEntity(NetEntityId entityId) const;
+
         void SendEntityUpdatesPacketHelper(AZ::TimeMs serverGameTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
 
         void SendEntityUpdates(AZ::TimeMs serverGameTimeMs);
@@ -0,0 +1,118 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzCore/Console/IConsole.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, net_EntityUpdateCacheEnabled, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Share serialized entity updates between connections that have the same pending changes during a tick");
+
+    // Serialized updates contain the record bits and the property values selected by those bits, consumed bit counts and sent packet ids are per connection state
+    static bool RecordsMatch(const ReplicationRecord& lhs, const ReplicationRecord& rhs)
+    {
+        return (lhs.m_netEntityRole == rhs.m_netEntityRole)
+            && (lhs.m_authorityToClientRecord == rhs.m_authorityToClientRecord)
+            && (lhs.m_authorityToServerRecord == rhs.m_authorityToServerRecord)
+            && (lhs.m_authorityToAutonomousRecord == rhs.m_authorityToAutonomousRecord)
+            && (lhs.m_autonomousToAuthorityRecord == rhs.m_autonomousToAuthorityRecord);
+    }
+
+    void EntityUpdateCache::BeginTick(AZ::TimeMs serverGameTimeMs)
+    {
+        if (m_serverGameTimeMs != serverGameTimeMs)
+        {
+            Clear();
+            m_serverGameTimeMs = serverGameTimeMs;
+        }
+    }
+
+    void EntityUpdateCache::Clear()
+    {
+        m_cachedUpdates.clear();
+    }
+
+    void EntityUpdateCache::InvalidateEntity(NetEntityId netEntityId)
+    {
+        m_cachedUpdates.erase(netEntityId);
+    }
+
+    bool EntityUpdateCache::SerializeUpdate(NetEntityId netEntityId, const ReplicationRecord& record, bool isShareable, const SerializeFunction& serializeFunction, AzNetworking::PacketEncodingBuffer& outData)
+    {
+        const bool useCache = net_EntityUpdateCacheEnabled && isShareable;
+        if (useCache && CopyCachedUpdate(netEntityId, record, outData))
+        {
+            return true;
+        }
+
+        AzNetworking::NetworkInputSerializer inputSerializer(outData.GetBuffer(), static_cast<uint32_t>(outData.GetCapacity()));
+        const bool success = serializeFunction(inputSerializer);
+        outData.Resize(inputSerializer.GetSize());
+        if (success && useCache)
+        {
+            StoreUpdate(netEntityId, record, outData);
+        }
+        return success;
+    }
+
+    bool EntityUpdateCache::CopyCachedUpdate(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData)
+    {
+        auto iter = m_cachedUpdates.find(netEntityId);
+        if (iter != m_cachedUpdates.end())
+        {
+            for (const CachedUpdate& cachedUpdate : iter->second)
+            {
+                if (RecordsMatch(cachedUpdate.m_record, record))
+                {
+                    ++m_hitCount;
+                    return outData.CopyValues(cachedUpdate.m_data.data(), cachedUpdate.m_data.size());
+                }
+            }
+        }
+        ++m_missCount;
+        return false;
+    }
+
+    void EntityUpdateCache::StoreUpdate(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data)
+    {
+        CachedUpdates& cachedUpdates = m_cachedUpdates[netEntityId];
+        if (cachedUpdates.size() >= MaxCachedUpdatesPerEntity)
+        {
+            // Connections are too far out of sync for sharing to pay off, keep the lookups for this entity cheap
+            return;
+        }
+        cachedUpdates.push_back(CachedUpdate{ record, AZStd::vector<uint8_t>(data.GetBuffer(), data.GetBuffer() + data.GetSize()) });
+    }
+
+    uint32_t EntityUpdateCache::GetHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    uint32_t EntityUpdateCache::GetMissCount() const
+    {
+        return m_missCount;
+    }
+
+    void EntityUpdateCache::ResetStats()
+    {
+        m_hitCount = 0;
+        m_missCount = 0;
+    }
+
+    uint32_t EntityUpdateCache::GetCachedUpdateCount(NetEntityId netEntityId) const
+    {
+        auto iter = m_cachedUpdates.find(netEntityId);
+        return (iter != m_cachedUpdates.end()) ? static_cast<uint32_t>(iter->second.size()) : 0;
+    }
+}
@@ -0,0 +1,108 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <Source/MultiplayerTypes.h>
+#include <Source/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace AzNetworking
+{
+    class ISerializer;
+}
+
+namespace Multiplayer
+{
+    //! @class EntityUpdateCache
+    //! @brief Shares serialized entity updates between the EntityReplicationManagers of all connections during a tick.
+    //! An entity update only depends on the current property values of the entity and on the pending ReplicationRecord of
+    //! the connection it is sent to, so connections that have acknowledged the same changes can reuse the same bytes rather
+    //! than serializing the entity again. The cost of replication then scales with the number of dirty entities instead of
+    //! with the number of entities times the number of connections observing them.
+    class EntityUpdateCache
+    {
+    public:
+
+        //! Maximum number of distinct pending records cached for a single entity during a tick.
+        static constexpr uint32_t MaxCachedUpdatesPerEntity = 8;
+
+        using SerializeFunction = AZStd::function<bool(AzNetworking::ISerializer&)>;
+
+        EntityUpdateCache() = default;
+
+        //! Invalidates all cached updates if they were generated for a different server game time.
+        //! @param serverGameTimeMs the server game time the following updates are generated for
+        void BeginTick(AZ::TimeMs serverGameTimeMs);
+
+        //! Invalidates all cached updates.
+        void Clear();
+
+        //! Invalidates the cached updates of a single entity, must be invoked whenever properties of the entity change.
+        //! @param netEntityId the entity whose properties changed
+        void InvalidateEntity(NetEntityId netEntityId);
+
+        //! Writes the update for the provided entity and record into outData. The bytes another connection serialized for the same
+        //! record are copied when they exist, otherwise serializeFunction is invoked and its output is cached for the connections that follow.
+        //! @param netEntityId       the entity the update is for
+        //! @param record            the pending record of the connection the update is sent to
+        //! @param isShareable       false if the update doesn't only depend on the record and the entity's properties, which bypasses the cache
+        //! @param serializeFunction serializes the update when no cached update is used
+        //! @param outData           buffer to receive the serialized update
+        //! @return boolean true if the update was successfully written, false otherwise
+        bool SerializeUpdate(NetEntityId netEntityId, const ReplicationRecord& record, bool isShareable, const SerializeFunction& serializeFunction, AzNetworking::PacketEncodingBuffer& outData);
+
+        //! Copies a previously serialized update for the provided entity and record, if one exists.
+        //! @param netEntityId the entity the update is for
+        //! @param record      the pending record of the connection the update is sent to
+        //! @param outData     buffer to receive the serialized update
+        //! @return boolean true if a cached update was copied, false otherwise
+        bool CopyCachedUpdate(NetEntityId netEntityId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData);
+
+        //! Stores a serialized update so that other connections with the same pending record can reuse it.
+        //! @param netEntityId the entity the update is for
+        //! @param record      the pending record the update was serialized from
+        //! @param data        the serialized update
+        void StoreUpdate(NetEntityId netEntityId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data);
+
+        //! Returns the number of updates copied from the cache since the last call to ResetStats.
+        uint32_t GetHitCount() const;
+
+        //! Returns the number of updates that had to be serialized since the last call to ResetStats.
+        uint32_t GetMissCount() const;
+
+        void ResetStats();
+
+        //! Returns the number of distinct updates currently cached for the provided entity.
+        uint32_t GetCachedUpdateCount(NetEntityId netEntityId) const;
+
+        AZ_DISABLE_COPY_MOVE(EntityUpdateCache);
+
+    private:
+
+        struct CachedUpdate
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+        };
+        using CachedUpdates = AZStd::vector<CachedUpdate>;
+
+        AZStd::unordered_map<NetEntityId, CachedUpdates> m_cachedUpdates;
+        AZ::TimeMs m_serverGameTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_hitCount = 0;
+        uint32_t m_missCount = 0;
+    };
+}
@@ -39,6 +39,8 @@ namespace Multiplayer
         //! Max number of entities we can send updates for in one frame
         virtual uint32_t GetMaxEntityReplicatorSendCount() const = 0;
         virtual bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const = 0;
+        //! Invoked once an update for the entity has been sent, so its accumulated priority can be reset
+        virtual void OnEntityUpdateSent(const ConstNetworkEntityHandle& entityHandle) = 0;
         virtual void DebugDraw(DebugScopeDrawMode& drawMode) const = 0;
     };
 }
@@ -11,6 +11,8 @@
 */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
+#include <Source/NetworkEntity/INetworkEntityManager.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -311,6 +313,16 @@ namespace Multiplayer
         return success;
     }
 
+    bool PropertyPublisher::UpdateSerialization(AzNetworking::PacketEncodingBuffer& outData)
+    {
+        // Deletes carry no property data, only creates and updates are worth sharing between connections
+        const bool hasPropertyData = (m_replicatorState == PropertyPublisher::EntityReplicatorState::Creating)
+                                  || (m_replicatorState == PropertyPublisher::EntityReplicatorState::Updating);
+        AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
+        return GetNetworkEntityManager()->GetEntityUpdateCache()->SerializeUpdate(m_netBindComponent->GetNetEntityId(), m_pendingRecord, hasPropertyData,
+            [this](AzNetworking::ISerializer& serializer) { return UpdateSerialization(serializer); }, outData);
+    }
+
     void PropertyPublisher::FinalizeSerialization(AzNetworking::PacketId sentId)
     {
         switch (m_replicatorState)
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <Source/Components/NetBindComponent.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzCore/std/containers/ring_buffer.h>
 
 namespace AzNetworking
@@ -48,6 +49,7 @@ namespace Multiplayer
         bool RequiresSerialization();
         bool PrepareSerialization();
         bool UpdateSerialization(AzNetworking::ISerializer& serializer);
+        bool UpdateSerialization(AzNetworking::PacketEncodingBuffer& outData);
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
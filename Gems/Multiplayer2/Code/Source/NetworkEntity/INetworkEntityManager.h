@@ -21,6 +21,7 @@ namespace Multiplayer
 {
     class NetworkEntityTracker;
     class NetworkEntityAuthorityTracker;
+    class EntityUpdateCache;
     class NetworkEntityRpcMessage;
 
     using EntityExitDomainEvent = AZ::Event<const ConstNetworkEntityHandle&>;
@@ -46,6 +47,10 @@ namespace Multiplayer
         //! @return the NetworkEntityAuthorityTracker for this INetworkEntityManager instance
         virtual NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() = 0;
 
+        //! Returns the EntityUpdateCache shared by all replication managers of this INetworkEntityManager instance.
+        //! @return the EntityUpdateCache for this INetworkEntityManager instance
+        virtual EntityUpdateCache* GetEntityUpdateCache() = 0;
+
         //! Returns the HostId for this INetworkEntityManager instance.
         //! @return the HostId for this INetworkEntityManager instance
         virtual HostId GetHostId() const = 0;
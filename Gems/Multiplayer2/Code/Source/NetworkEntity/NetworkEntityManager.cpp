@@ -47,6 +47,11 @@ namespace Multiplayer
         return &m_networkEntityAuthorityTracker;
     }
 
+    EntityUpdateCache* NetworkEntityManager::GetEntityUpdateCache()
+    {
+        return &m_entityUpdateCache;
+    }
+
     HostId NetworkEntityManager::GetHostId() const
     {
         return m_hostId;
@@ -161,6 +166,8 @@ namespace Multiplayer
 
     void NetworkEntityManager::NotifyEntitiesDirtied()
     {
+        // Entity properties may have changed since the cached updates were serialized
+        m_entityUpdateCache.Clear();
         m_onEntityMarkedDirty.Signal();
     }
 
@@ -17,6 +17,7 @@
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <Source/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
 
 namespace Multiplayer
 {
@@ -33,6 +34,7 @@ namespace Multiplayer
         //! @{
         NetworkEntityTracker* GetNetworkEntityTracker() override;
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override;
+        EntityUpdateCache* GetEntityUpdateCache() override;
         HostId GetHostId() const override;
         ConstNetworkEntityHandle GetEntity(NetEntityId netEntityId) const override;
         uint32_t GetEntityCount() const override;
@@ -59,6 +61,7 @@ namespace Multiplayer
 
         NetworkEntityTracker m_networkEntityTracker;
         NetworkEntityAuthorityTracker m_networkEntityAuthorityTracker;
+        EntityUpdateCache m_entityUpdateCache;
         AZ::ScheduledEvent m_removeEntitiesEvent;
         AZStd::vector<NetEntityId> m_removeList;
         AZStd::vector<AZ::Entity*> m_nonNetworkedEntities; // Contains entities that we've instantiated, but are not networked entities
@@ -0,0 +1,224 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/Components/NetBindComponent.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The radius around a client's controlled entity in which networked entities are replicated to that client");
+    AZ_CVAR(uint32_t, sv_ClientMaxReplicatedEntities, 512, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of entities replicated to a single client, the most important entities in the awareness radius are kept");
+    AZ_CVAR(uint32_t, sv_ClientMaxEntityUpdatesPerTick, 128, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum number of entity updates sent to a single client each tick, highest priority first");
+    AZ_CVAR(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null, "How often the set of entities replicated to a client is recomputed, in milliseconds");
+
+    // Entities at the edge of the awareness radius still accumulate some priority, so they are eventually updated
+    static constexpr float MinProximityWeight = 0.1f;
+
+    ServerToClientReplicationWindow::ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity)
+        : m_controlledEntity(controlledEntity)
+    {
+    }
+
+    bool ServerToClientReplicationWindow::ReplicationSetUpdateReady()
+    {
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        const AZ::TimeMs elapsedTimeMs = currentTimeMs - m_lastUpdateTimeMs;
+        if (m_hasUpdated && (elapsedTimeMs < sv_ClientReplicationWindowUpdateMs))
+        {
+            return false;
+        }
+
+        const float elapsedSeconds = m_hasUpdated ? static_cast<float>(elapsedTimeMs) / 1000.0f : 0.0f;
+        m_lastUpdateTimeMs = currentTimeMs;
+        m_hasUpdated = true;
+        UpdateReplicationSet(elapsedSeconds);
+        return true;
+    }
+
+    const ReplicationSet& ServerToClientReplicationWindow::GetReplicationSet() const
+    {
+        return m_replicationSet;
+    }
+
+    uint32_t ServerToClientReplicationWindow::GetMaxEntityReplicatorCount() const
+    {
+        return sv_ClientMaxReplicatedEntities;
+    }
+
+    uint32_t ServerToClientReplicationWindow::GetMaxEntityReplicatorSendCount() const
+    {
+        return sv_ClientMaxEntityUpdatesPerTick;
+    }
+
+    bool ServerToClientReplicationWindow::IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
+    {
+        auto iter = m_replicationSet.find(entityHandle);
+        if (iter != m_replicationSet.end())
+        {
+            outNetworkRole = iter->second.m_networkRole;
+            return true;
+        }
+        outNetworkRole = NetEntityRole::InvalidRole;
+        return false;
+    }
+
+    void ServerToClientReplicationWindow::OnEntityUpdateSent(const ConstNetworkEntityHandle& entityHandle)
+    {
+        auto iter = m_replicationSet.find(entityHandle);
+        if (iter != m_replicationSet.end())
+        {
+            iter->second.m_priority = 0.0f;
+        }
+    }
+
+    void ServerToClientReplicationWindow::DebugDraw([[maybe_unused]] DebugScopeDrawMode& drawMode) const
+    {
+        const AZ::Entity* controlledEntity = m_controlledEntity.GetEntity();
+        if ((controlledEntity == nullptr) || (controlledEntity->GetTransform() == nullptr))
+        {
+            return;
+        }
+
+        // Draws the awareness sphere, and a line to every replicated entity colored by how much priority it has accumulated
+        const AZ::Vector3 controlledPosition = controlledEntity->GetTransform()->GetWorldTranslation();
+        AzFramework::DebugDisplayRequestBus::EnumerateHandlers([this, controlledEntity, &controlledPosition](AzFramework::DebugDisplayRequests* debugDisplay)
+        {
+            debugDisplay->SetColor(AZ::Colors::White);
+            debugDisplay->DrawWireSphere(controlledPosition, static_cast<float>(sv_ClientAwarenessRadius));
+
+            for (const auto& entry : m_replicationSet)
+            {
+                const AZ::Entity* entity = entry.first.GetEntity();
+                if ((entity == nullptr) || (entity == controlledEntity) || (entity->GetTransform() == nullptr))
+                {
+                    continue;
+                }
+
+                const float priority = AZ::GetMin(entry.second.m_priority, 1.0f);
+                const AZ::Vector4 color(priority, 1.0f - priority, 0.0f, 1.0f);
+                debugDisplay->DrawLine(controlledPosition, entity->GetTransform()->GetWorldTranslation(), color, color);
+            }
+            return true;
+        });
+    }
+
+    void ServerToClientReplicationWindow::UpdateReplicationSet(float elapsedSeconds)
+    {
+        m_candidates.clear();
+
+        AZ::Entity* controlledEntity = m_controlledEntity.GetEntity();
+        NetBindComponent* controlledNetBind = m_controlledEntity.GetNetBindComponent();
+        if ((controlledEntity == nullptr) || (controlledNetBind == nullptr) || (controlledEntity->GetTransform() == nullptr))
+        {
+            m_replicationSet.clear();
+            return;
+        }
+
+        const AZ::Vector3 controlledPosition = controlledEntity->GetTransform()->GetWorldTranslation();
+        const float awarenessRadius = AZ::GetMax(static_cast<float>(sv_ClientAwarenessRadius), 0.001f);
+
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem != nullptr)
+        {
+            const AZ::Sphere awarenessSphere(controlledPosition, awarenessRadius);
+            visibilitySystem->GetDefaultVisibilityScene()->Enumerate(awarenessSphere,
+                [this, controlledEntity, &awarenessSphere, &controlledPosition, awarenessRadius](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (const AzFramework::VisibilityEntry* visibilityEntry : nodeData.m_entries)
+                {
+                    if (visibilityEntry->m_typeFlags != AzFramework::VisibilityEntry::TYPE_Entity)
+                    {
+                        continue;
+                    }
+
+                    if (!AZ::ShapeIntersection::Overlaps(awarenessSphere, visibilityEntry->m_boundingVolume))
+                    {
+                        continue;
+                    }
+
+                    AZ::EntityId entityId;
+                    memcpy(&entityId, &visibilityEntry->m_userData, sizeof(AZ::EntityId));
+
+                    AZ::Entity* entity = nullptr;
+                    AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationRequests::FindEntity, entityId);
+                    if ((entity == nullptr) || (entity == controlledEntity))
+                    {
+                        continue;
+                    }
+
+                    NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+                    if (netBindComponent == nullptr)
+                    {
+                        continue;
+                    }
+
+                    const float distance = visibilityEntry->m_boundingVolume.GetDistance(controlledPosition);
+                    const float proximity = 1.0f - AZ::GetMin(distance / awarenessRadius, 1.0f);
+                    const float priority = netBindComponent->GetReplicationPriority() * AZ::GetMax(proximity, MinProximityWeight);
+                    m_candidates.push_back(ReplicationCandidate{ netBindComponent->GetEntityHandle(), priority });
+                }
+            });
+        }
+
+        MergeCandidates(controlledNetBind->GetReplicationPriority(), elapsedSeconds);
+    }
+
+    void ServerToClientReplicationWindow::MergeCandidates(float controlledEntityPriority, float elapsedSeconds)
+    {
+        // Keep the most important entities, the controlled entity always takes one of the slots
+        const size_t maxCandidates = AZ::GetMax<size_t>(GetMaxEntityReplicatorCount(), 1) - 1;
+        if (m_candidates.size() > maxCandidates)
+        {
+            AZStd::partial_sort(m_candidates.begin(), m_candidates.begin() + maxCandidates, m_candidates.end(),
+                [](const ReplicationCandidate& lhs, const ReplicationCandidate& rhs) { return lhs.m_priority > rhs.m_priority; });
+            m_candidates.resize(maxCandidates);
+        }
+        m_candidates.push_back(ReplicationCandidate{ m_controlledEntity, controlledEntityPriority });
+
+        AZStd::sort(m_candidates.begin(), m_candidates.end(),
+            [](const ReplicationCandidate& lhs, const ReplicationCandidate& rhs) { return lhs.m_entityHandle < rhs.m_entityHandle; });
+
+        // Both the candidates and the replication set are ordered by NetEntityId, so merge them in place
+        auto setIter = m_replicationSet.begin();
+        for (const ReplicationCandidate& candidate : m_candidates)
+        {
+            while ((setIter != m_replicationSet.end()) && (setIter->first < candidate.m_entityHandle))
+            {
+                setIter = m_replicationSet.erase(setIter);
+            }
+
+            if ((setIter != m_replicationSet.end()) && !(candidate.m_entityHandle < setIter->first))
+            {
+                // Already in the window, keep accumulating priority until an update for the entity is sent
+                setIter->second.m_priority += candidate.m_priority * elapsedSeconds;
+                ++setIter;
+            }
+            else
+            {
+                // New entities start with their full priority so their creation isn't delayed
+                EntityReplicationData replicationData;
+                replicationData.m_networkRole = (candidate.m_entityHandle == m_controlledEntity) ? NetEntityRole::ClientAutonomous : NetEntityRole::ClientSimulation;
+                replicationData.m_priority = candidate.m_priority;
+                m_replicationSet.insert(setIter, ReplicationSet::value_type(candidate.m_entityHandle, replicationData));
+            }
+        }
+        m_replicationSet.erase(setIter, m_replicationSet.end());
+    }
+}
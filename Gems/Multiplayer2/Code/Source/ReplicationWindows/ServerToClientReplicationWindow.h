@@ -0,0 +1,70 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#pragma once
+
+#include <Source/NetworkEntity/EntityReplication/IReplicationWindow.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class ServerToClientReplicationWindow
+    //! @brief Spatial replication window that replicates the networked entities surrounding a client's controlled entity.
+    //! Nearby entities are gathered from the default AzFramework::IVisibilityScene, so the cost of an update scales with the
+    //! number of entities around the client rather than with the number of entities in the world. Every entity in the window
+    //! accumulates priority based on its distance and its NetBindComponent replication priority until an update for it is sent,
+    //! and the EntityReplicationManager sends the highest priority entities first within GetMaxEntityReplicatorSendCount.
+    class ServerToClientReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+
+        //! Constructs a replication window centered on the provided entity.
+        //! @param controlledEntity the entity controlled by the client, replicated as ClientAutonomous
+        ServerToClientReplicationWindow(NetworkEntityHandle controlledEntity);
+        ~ServerToClientReplicationWindow() override = default;
+
+        //! IReplicationWindow interface
+        //! @{
+        bool ReplicationSetUpdateReady() override;
+        const ReplicationSet& GetReplicationSet() const override;
+        uint32_t GetMaxEntityReplicatorCount() const override;
+        uint32_t GetMaxEntityReplicatorSendCount() const override;
+        bool IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const override;
+        void OnEntityUpdateSent(const ConstNetworkEntityHandle& entityHandle) override;
+        void DebugDraw(DebugScopeDrawMode& drawMode) const override;
+        //! @}
+
+    protected:
+
+        struct ReplicationCandidate
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            float m_priority = 0.0f;
+        };
+
+        //! Gathers the entities surrounding the controlled entity and merges the most important ones into the replication set.
+        void UpdateReplicationSet(float elapsedSeconds);
+
+        //! Keeps the most important of m_candidates and merges them, along with the controlled entity, into the replication set.
+        //! @param controlledEntityPriority the replication priority of the controlled entity
+        //! @param elapsedSeconds           time since the last update, used to scale the priority accumulated by entities already in the set
+        void MergeCandidates(float controlledEntityPriority, float elapsedSeconds);
+
+        NetworkEntityHandle m_controlledEntity;
+        ReplicationSet m_replicationSet;
+        AZStd::vector<ReplicationCandidate> m_candidates;
+        AZ::TimeMs m_lastUpdateTimeMs = AZ::TimeMs{ 0 };
+        bool m_hasUpdated = false;
+    };
+}
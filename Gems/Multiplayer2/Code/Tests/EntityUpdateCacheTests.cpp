@@ -0,0 +1,242 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include <Source/Components/NetBindComponent.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateCache.h>
+#include <Source/NetworkEntity/NetworkEntityManager.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityUpdateCacheTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            AZ::NameDictionary::Create();
+
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_networkEntityManager = AZStd::make_unique<NetworkEntityManager>();
+            m_cache = m_networkEntityManager->GetEntityUpdateCache();
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand("net_EntityUpdateCacheEnabled true");
+
+            m_cache = nullptr;
+            m_networkEntityManager.reset();
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            AZ::NameDictionary::Destroy();
+            AllocatorsFixture::TearDown();
+        }
+
+        static ReplicationRecord MakeRecord(NetEntityRole netEntityRole, uint32_t dirtyBit)
+        {
+            ReplicationRecord record(netEntityRole);
+            record.m_authorityToClientRecord.Resize(8);
+            record.m_authorityToClientRecord.SetBit(dirtyBit, true);
+            return record;
+        }
+
+        //! Serializes an update for a publisher, the update holds the current value of m_propertyValue
+        bool SerializeUpdate(NetEntityId netEntityId, const ReplicationRecord& record, bool isShareable, AzNetworking::PacketEncodingBuffer& outData)
+        {
+            return m_cache->SerializeUpdate(netEntityId, record, isShareable,
+                [this](AzNetworking::ISerializer& serializer)
+                {
+                    ++m_serializeCount;
+                    uint32_t value = m_propertyValue;
+                    return serializer.Serialize(value, "Value");
+                }, outData);
+        }
+
+        AZ::Console* m_console = nullptr;
+        AZStd::unique_ptr<NetworkEntityManager> m_networkEntityManager;
+        EntityUpdateCache* m_cache = nullptr;
+        uint32_t m_propertyValue = 1;
+        uint32_t m_serializeCount = 0;
+    };
+
+    static constexpr NetEntityId TestNetEntityId = static_cast<NetEntityId>(7);
+
+    TEST_F(EntityUpdateCacheTests, SerializeUpdate_SameRecordAndRole_SecondPublisherCopiesTheBytes)
+    {
+        const ReplicationRecord record = MakeRecord(NetEntityRole::ClientSimulation, 3);
+
+        AzNetworking::PacketEncodingBuffer firstData;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, firstData));
+
+        // The second publisher has its own copy of an identical record
+        const ReplicationRecord secondRecord = MakeRecord(NetEntityRole::ClientSimulation, 3);
+        AzNetworking::PacketEncodingBuffer secondData;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, secondRecord, true, secondData));
+
+        EXPECT_EQ(1u, m_serializeCount);
+        EXPECT_EQ(1u, m_cache->GetMissCount());
+        EXPECT_EQ(1u, m_cache->GetHitCount());
+        EXPECT_GT(firstData.GetSize(), 0u);
+        EXPECT_TRUE(firstData == secondData);
+    }
+
+    TEST_F(EntityUpdateCacheTests, SerializeUpdate_DifferentRoleOrRecordBits_BytesAreNotShared)
+    {
+        AzNetworking::PacketEncodingBuffer data;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, MakeRecord(NetEntityRole::ClientSimulation, 3), true, data));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, MakeRecord(NetEntityRole::ClientAutonomous, 3), true, data));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, MakeRecord(NetEntityRole::ClientSimulation, 4), true, data));
+
+        // Same record, but for another entity
+        EXPECT_TRUE(SerializeUpdate(static_cast<NetEntityId>(8), MakeRecord(NetEntityRole::ClientSimulation, 3), true, data));
+
+        EXPECT_EQ(4u, m_serializeCount);
+        EXPECT_EQ(4u, m_cache->GetMissCount());
+        EXPECT_EQ(0u, m_cache->GetHitCount());
+        EXPECT_EQ(3u, m_cache->GetCachedUpdateCount(TestNetEntityId));
+    }
+
+    TEST_F(EntityUpdateCacheTests, NotifyEntitiesDirtied_CachedUpdatesAreInvalidated)
+    {
+        const ReplicationRecord record = MakeRecord(NetEntityRole::ClientSimulation, 3);
+        AzNetworking::PacketEncodingBuffer firstData;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, firstData));
+
+        m_propertyValue = 2;
+        m_networkEntityManager->NotifyEntitiesDirtied();
+        EXPECT_EQ(0u, m_cache->GetCachedUpdateCount(TestNetEntityId));
+
+        AzNetworking::PacketEncodingBuffer secondData;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, secondData));
+        EXPECT_EQ(2u, m_serializeCount);
+        EXPECT_EQ(0u, m_cache->GetHitCount());
+        EXPECT_FALSE(firstData == secondData);
+    }
+
+    TEST_F(EntityUpdateCacheTests, BeginTick_NewServerGameTime_CachedUpdatesAreInvalidated)
+    {
+        const ReplicationRecord record = MakeRecord(NetEntityRole::ClientSimulation, 3);
+        AzNetworking::PacketEncodingBuffer data;
+
+        m_cache->BeginTick(AZ::TimeMs{ 100 });
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, data));
+
+        // Other connections sending during the same tick keep the cached updates
+        m_cache->BeginTick(AZ::TimeMs{ 100 });
+        EXPECT_EQ(1u, m_cache->GetCachedUpdateCount(TestNetEntityId));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, data));
+        EXPECT_EQ(1u, m_serializeCount);
+
+        m_cache->BeginTick(AZ::TimeMs{ 116 });
+        EXPECT_EQ(0u, m_cache->GetCachedUpdateCount(TestNetEntityId));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, data));
+        EXPECT_EQ(2u, m_serializeCount);
+    }
+
+    TEST_F(EntityUpdateCacheTests, MarkDirty_PropertyChangedBetweenSendsWithTheSameTime_EntityUpdatesAreInvalidated)
+    {
+        // Network property setters mark the NetBindComponent of their entity dirty
+        NetBindComponent netBindComponent;
+        const NetEntityId dirtiedNetEntityId = netBindComponent.GetNetEntityId();
+        const ReplicationRecord record = MakeRecord(NetEntityRole::ClientSimulation, 3);
+
+        m_cache->BeginTick(AZ::TimeMs{ 100 });
+        AzNetworking::PacketEncodingBuffer firstData;
+        EXPECT_TRUE(SerializeUpdate(dirtiedNetEntityId, record, true, firstData));
+        AzNetworking::PacketEncodingBuffer otherEntityData;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, otherEntityData));
+
+        m_propertyValue = 2;
+        netBindComponent.MarkDirty();
+        EXPECT_EQ(0u, m_cache->GetCachedUpdateCount(dirtiedNetEntityId));
+        EXPECT_EQ(1u, m_cache->GetCachedUpdateCount(TestNetEntityId));
+
+        // The next send has the same server game time, so only the entity invalidation prevents sending the old value
+        m_cache->BeginTick(AZ::TimeMs{ 100 });
+        AzNetworking::PacketEncodingBuffer secondData;
+        EXPECT_TRUE(SerializeUpdate(dirtiedNetEntityId, record, true, secondData));
+        EXPECT_EQ(3u, m_serializeCount);
+        EXPECT_FALSE(firstData == secondData);
+
+        // Connections that send after the change share the new update
+        AzNetworking::PacketEncodingBuffer thirdData;
+        EXPECT_TRUE(SerializeUpdate(dirtiedNetEntityId, record, true, thirdData));
+        EXPECT_EQ(3u, m_serializeCount);
+        EXPECT_TRUE(secondData == thirdData);
+    }
+
+    TEST_F(EntityUpdateCacheTests, StoreUpdate_MoreRecordsThanMaxCachedUpdatesPerEntity_StorageIsBounded)
+    {
+        AzNetworking::PacketEncodingBuffer data;
+        for (uint32_t dirtyBit = 0; dirtyBit < EntityUpdateCache::MaxCachedUpdatesPerEntity; ++dirtyBit)
+        {
+            EXPECT_TRUE(SerializeUpdate(TestNetEntityId, MakeRecord(NetEntityRole::ClientSimulation, dirtyBit), true, data));
+        }
+        for (uint32_t dirtyBit = 0; dirtyBit < EntityUpdateCache::MaxCachedUpdatesPerEntity; ++dirtyBit)
+        {
+            EXPECT_TRUE(SerializeUpdate(TestNetEntityId, MakeRecord(NetEntityRole::ClientAutonomous, dirtyBit), true, data));
+        }
+        EXPECT_EQ(EntityUpdateCache::MaxCachedUpdatesPerEntity, m_cache->GetCachedUpdateCount(TestNetEntityId));
+
+        // Updates that didn't fit are serialized again, while the cached ones are still shared
+        m_serializeCount = 0;
+        m_cache->ResetStats();
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, MakeRecord(NetEntityRole::ClientAutonomous, 0), true, data));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, MakeRecord(NetEntityRole::ClientSimulation, 0), true, data));
+        EXPECT_EQ(1u, m_serializeCount);
+        EXPECT_EQ(1u, m_cache->GetHitCount());
+        EXPECT_EQ(EntityUpdateCache::MaxCachedUpdatesPerEntity, m_cache->GetCachedUpdateCount(TestNetEntityId));
+    }
+
+    TEST_F(EntityUpdateCacheTests, SerializeUpdate_CacheDisabled_AlwaysSerializes)
+    {
+        m_console->PerformCommand("net_EntityUpdateCacheEnabled false");
+
+        const ReplicationRecord record = MakeRecord(NetEntityRole::ClientSimulation, 3);
+        AzNetworking::PacketEncodingBuffer data;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, data));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, data));
+
+        EXPECT_EQ(2u, m_serializeCount);
+        EXPECT_EQ(0u, m_cache->GetHitCount());
+        EXPECT_EQ(0u, m_cache->GetMissCount());
+        EXPECT_EQ(0u, m_cache->GetCachedUpdateCount(TestNetEntityId));
+    }
+
+    TEST_F(EntityUpdateCacheTests, SerializeUpdate_NotShareable_AlwaysSerializes)
+    {
+        // Deleting publishers pass their updates as not shareable
+        const ReplicationRecord record = MakeRecord(NetEntityRole::ClientSimulation, 3);
+        AzNetworking::PacketEncodingBuffer data;
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, false, data));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, false, data));
+
+        EXPECT_EQ(2u, m_serializeCount);
+        EXPECT_EQ(0u, m_cache->GetHitCount());
+        EXPECT_EQ(0u, m_cache->GetCachedUpdateCount(TestNetEntityId));
+
+        // And don't use updates shareable publishers cached either
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, true, data));
+        EXPECT_TRUE(SerializeUpdate(TestNetEntityId, record, false, data));
+        EXPECT_EQ(4u, m_serializeCount);
+        EXPECT_EQ(0u, m_cache->GetHitCount());
+    }
+}
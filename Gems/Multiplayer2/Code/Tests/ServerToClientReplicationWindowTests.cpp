@@ -0,0 +1,222 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    //! Exposes the candidate merging of the window, so it can be tested without a visibility system and networked entities
+    class TestReplicationWindow
+        : public ServerToClientReplicationWindow
+    {
+    public:
+        using ServerToClientReplicationWindow::ServerToClientReplicationWindow;
+
+        void AddCandidate(const ConstNetworkEntityHandle& entityHandle, float priority)
+        {
+            m_candidates.push_back(ReplicationCandidate{ entityHandle, priority });
+        }
+
+        void Merge(float controlledEntityPriority, float elapsedSeconds)
+        {
+            MergeCandidates(controlledEntityPriority, elapsedSeconds);
+            m_candidates.clear();
+        }
+    };
+
+    class ServerToClientReplicationWindowTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            m_console->GetCvarValue("sv_ClientMaxReplicatedEntities", m_savedMaxReplicatedEntities);
+        }
+
+        void TearDown() override
+        {
+            AZStd::string commandString;
+            commandString.format("sv_ClientMaxReplicatedEntities %u", m_savedMaxReplicatedEntities);
+            m_console->PerformCommand(commandString.c_str());
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            AllocatorsFixture::TearDown();
+        }
+
+        static NetworkEntityHandle MakeHandle(uint32_t netEntityId)
+        {
+            // Handles compare by NetEntityId, which is all the window needs when it isn't gathering entities itself
+            return NetworkEntityHandle(nullptr, static_cast<NetEntityId>(netEntityId), nullptr);
+        }
+
+        static const EntityReplicationData* FindEntry(const ReplicationSet& replicationSet, uint32_t netEntityId)
+        {
+            auto iter = replicationSet.find(MakeHandle(netEntityId));
+            return (iter != replicationSet.end()) ? &iter->second : nullptr;
+        }
+
+        AZ::Console* m_console = nullptr;
+        uint32_t m_savedMaxReplicatedEntities = 0;
+    };
+
+    TEST_F(ServerToClientReplicationWindowTests, MergeCandidates_NewCandidates_AddedWithTheirPriority)
+    {
+        TestReplicationWindow window(MakeHandle(1));
+        window.AddCandidate(MakeHandle(5), 0.5f);
+        window.AddCandidate(MakeHandle(3), 2.0f);
+        window.Merge(1.0f, 0.0f);
+
+        const ReplicationSet& replicationSet = window.GetReplicationSet();
+        ASSERT_EQ(3u, replicationSet.size());
+
+        // The set is ordered by NetEntityId
+        auto iter = replicationSet.begin();
+        EXPECT_EQ(static_cast<NetEntityId>(1), (iter++)->first.GetNetEntityId());
+        EXPECT_EQ(static_cast<NetEntityId>(3), (iter++)->first.GetNetEntityId());
+        EXPECT_EQ(static_cast<NetEntityId>(5), (iter++)->first.GetNetEntityId());
+
+        EXPECT_EQ(NetEntityRole::ClientAutonomous, FindEntry(replicationSet, 1)->m_networkRole);
+        EXPECT_EQ(NetEntityRole::ClientSimulation, FindEntry(replicationSet, 3)->m_networkRole);
+        EXPECT_EQ(NetEntityRole::ClientSimulation, FindEntry(replicationSet, 5)->m_networkRole);
+        EXPECT_FLOAT_EQ(1.0f, FindEntry(replicationSet, 1)->m_priority);
+        EXPECT_FLOAT_EQ(2.0f, FindEntry(replicationSet, 3)->m_priority);
+        EXPECT_FLOAT_EQ(0.5f, FindEntry(replicationSet, 5)->m_priority);
+
+        NetEntityRole role = NetEntityRole::InvalidRole;
+        EXPECT_TRUE(window.IsInWindow(MakeHandle(3), role));
+        EXPECT_EQ(NetEntityRole::ClientSimulation, role);
+        EXPECT_FALSE(window.IsInWindow(MakeHandle(4), role));
+        EXPECT_EQ(NetEntityRole::InvalidRole, role);
+    }
+
+    TEST_F(ServerToClientReplicationWindowTests, MergeCandidates_EntitiesStayInWindow_AccumulatePriorityUntilUpdateSent)
+    {
+        TestReplicationWindow window(MakeHandle(1));
+        window.AddCandidate(MakeHandle(3), 2.0f);
+        window.AddCandidate(MakeHandle(5), 0.5f);
+        window.Merge(1.0f, 0.0f);
+
+        // 3 stays, 5 leaves the window and 7 enters it
+        window.AddCandidate(MakeHandle(3), 2.0f);
+        window.AddCandidate(MakeHandle(7), 4.0f);
+        window.Merge(1.0f, 0.5f);
+
+        const ReplicationSet& replicationSet = window.GetReplicationSet();
+        EXPECT_EQ(3u, replicationSet.size());
+        EXPECT_EQ(nullptr, FindEntry(replicationSet, 5));
+        EXPECT_FLOAT_EQ(1.0f + 1.0f * 0.5f, FindEntry(replicationSet, 1)->m_priority);
+        EXPECT_FLOAT_EQ(2.0f + 2.0f * 0.5f, FindEntry(replicationSet, 3)->m_priority);
+        EXPECT_FLOAT_EQ(4.0f, FindEntry(replicationSet, 7)->m_priority);
+
+        // Sending an update resets the accumulated priority, which then accumulates again
+        window.OnEntityUpdateSent(MakeHandle(3));
+        EXPECT_FLOAT_EQ(0.0f, FindEntry(replicationSet, 3)->m_priority);
+
+        window.AddCandidate(MakeHandle(3), 2.0f);
+        window.AddCandidate(MakeHandle(7), 4.0f);
+        window.Merge(1.0f, 0.25f);
+        EXPECT_FLOAT_EQ(2.0f * 0.25f, FindEntry(replicationSet, 3)->m_priority);
+        EXPECT_FLOAT_EQ(4.0f + 4.0f * 0.25f, FindEntry(replicationSet, 7)->m_priority);
+    }
+
+    TEST_F(ServerToClientReplicationWindowTests, MergeCandidates_MoreCandidatesThanMaxReplicatedEntities_KeepsControlledAndHighestPriority)
+    {
+        m_console->PerformCommand("sv_ClientMaxReplicatedEntities 3");
+
+        TestReplicationWindow window(MakeHandle(1));
+        EXPECT_EQ(3u, window.GetMaxEntityReplicatorCount());
+
+        window.AddCandidate(MakeHandle(2), 0.5f);
+        window.AddCandidate(MakeHandle(3), 3.0f);
+        window.AddCandidate(MakeHandle(4), 1.0f);
+        window.AddCandidate(MakeHandle(5), 2.0f);
+        window.AddCandidate(MakeHandle(6), 0.25f);
+
+        // The controlled entity has the lowest priority of all, but it always takes one of the slots
+        window.Merge(0.1f, 0.0f);
+
+        const ReplicationSet& replicationSet = window.GetReplicationSet();
+        ASSERT_EQ(3u, replicationSet.size());
+        ASSERT_NE(nullptr, FindEntry(replicationSet, 1));
+        EXPECT_EQ(NetEntityRole::ClientAutonomous, FindEntry(replicationSet, 1)->m_networkRole);
+        EXPECT_NE(nullptr, FindEntry(replicationSet, 3));
+        EXPECT_NE(nullptr, FindEntry(replicationSet, 5));
+
+        // With no room for anything else, only the controlled entity is replicated
+        m_console->PerformCommand("sv_ClientMaxReplicatedEntities 1");
+        window.AddCandidate(MakeHandle(3), 3.0f);
+        window.Merge(0.1f, 0.0f);
+        ASSERT_EQ(1u, replicationSet.size());
+        EXPECT_EQ(NetEntityRole::ClientAutonomous, FindEntry(replicationSet, 1)->m_networkRole);
+    }
+
+    class AppendHighestPriorityReplicatorsTests
+        : public AllocatorsFixture
+    {
+    public:
+        // The replicators are only compared, never dereferenced, so they just need distinct addresses
+        EntityReplicator* GetReplicator(size_t index)
+        {
+            return reinterpret_cast<EntityReplicator*>(&m_replicatorStorage[index]);
+        }
+
+        AZStd::array<uint64_t, 8> m_replicatorStorage;
+    };
+
+    TEST_F(AppendHighestPriorityReplicatorsTests, OverBudget_HighestPriorityAreSentAndTheRestStayPending)
+    {
+        EntityReplicationManager::PrioritizedReplicatorList candidates;
+        candidates.push_back({ GetReplicator(0), 0.5f });
+        candidates.push_back({ GetReplicator(1), 4.0f });
+        candidates.push_back({ GetReplicator(2), 1.0f });
+        candidates.push_back({ GetReplicator(3), 2.0f });
+
+        // Anything already in the list, like the autonomous replicators, is kept in front and doesn't count against the budget
+        EntityReplicationManager::EntityReplicatorList sendList{ GetReplicator(7) };
+        EntityReplicationManager::AppendHighestPriorityReplicators(candidates, 2, [](EntityReplicator*) { return true; }, sendList);
+
+        ASSERT_EQ(3u, sendList.size());
+        EXPECT_EQ(GetReplicator(7), sendList[0]);
+        EXPECT_EQ(GetReplicator(1), sendList[1]);
+        EXPECT_EQ(GetReplicator(3), sendList[2]);
+    }
+
+    TEST_F(AppendHighestPriorityReplicatorsTests, RejectedCandidates_DontUseTheBudget)
+    {
+        EntityReplicationManager::PrioritizedReplicatorList candidates;
+        candidates.push_back({ GetReplicator(0), 0.5f });
+        candidates.push_back({ GetReplicator(1), 4.0f });
+        candidates.push_back({ GetReplicator(2), 1.0f });
+        candidates.push_back({ GetReplicator(3), 2.0f });
+
+        // The highest priority replicator can't be sent, eg because too many entities are already pending creation
+        EntityReplicator* rejected = GetReplicator(1);
+        EntityReplicationManager::EntityReplicatorList sendList;
+        EntityReplicationManager::AppendHighestPriorityReplicators(candidates, 2,
+            [rejected](EntityReplicator* replicator) { return replicator != rejected; }, sendList);
+
+        ASSERT_EQ(2u, sendList.size());
+        EXPECT_EQ(GetReplicator(3), sendList[0]);
+        EXPECT_EQ(GetReplicator(2), sendList[1]);
+    }
+}
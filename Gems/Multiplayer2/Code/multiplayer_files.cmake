@@ -25,6 +25,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.inl
+    Source/NetworkEntity/EntityReplication/EntityUpdateCache.cpp
+    Source/NetworkEntity/EntityReplication/EntityUpdateCache.h
     Source/NetworkEntity/EntityReplication/IReplicationWindow.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
@@ -62,4 +64,6 @@ set(FILES
     Source/NetworkTime/NetworkTime.h
     Source/NetworkTime/RewindableObject.h
     Source/NetworkTime/RewindableObject.inl
+    Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
+    Source/ReplicationWindows/ServerToClientReplicationWindow.h
 )
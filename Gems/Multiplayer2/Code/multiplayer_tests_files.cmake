@@ -10,6 +10,8 @@
 #
 
 set(FILES
+    Tests/EntityUpdateCacheTests.cpp
     Tests/Main.cpp
     Tests/RewindableObjectTests.cpp
+    Tests/ServerToClientReplicationWindowTests.cpp
 )
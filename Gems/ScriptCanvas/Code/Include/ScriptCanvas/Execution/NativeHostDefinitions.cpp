@@ -11,7 +11,9 @@
 */
 
 #include "NativeHostDefinitions.h"
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/conversions.h>
 
 namespace NativeHostDefinitionsCPP
 {
@@ -23,6 +25,22 @@ namespace NativeHostDefinitionsCPP
 
 namespace ScriptCanvas
 {
+    AZStd::string GetNativeGraphStartName(AZStd::string_view assetPath)
+    {
+        AZStd::string name(assetPath);
+        AZStd::replace(name.begin(), name.end(), '\\', '/');
+        AZStd::to_lower(name.begin(), name.end());
+
+        const size_t fileNameStart = name.find_last_of('/');
+        const size_t extensionStart = name.find_last_of('.');
+        if (extensionStart != AZStd::string::npos && (fileNameStart == AZStd::string::npos || extensionStart > fileNameStart))
+        {
+            name.resize(extensionStart);
+        }
+
+        return name;
+    }
+
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context)
     {
         using namespace NativeHostDefinitionsCPP;
@@ -10,19 +10,60 @@
 *
 */
 
+#pragma once
+
 #include "NativeHostDeclarations.h"
 
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <limits>
+
 namespace ScriptCanvas
 {
     typedef void (*GraphStartFunction)(const RuntimeContext&);
 
     using GraphStartFunction = void(*)(const RuntimeContext&);
 
+    //! Returns the name native graph starts are registered under for the graph at the given asset path.
+    //! This is the path relative to the asset root without its extension, lower case and with forward slashes,
+    //! so the source graph and its compiled runtime asset map to the same name and graphs that share a file name
+    //! in different folders don't.
+    AZStd::string GetNativeGraphStartName(AZStd::string_view assetPath);
+
+    //! Runs the start function registered for the graph, returns false if the graph has no native version.
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context);
     
+    //! Registers the start function of a translated graph under the name returned by GetNativeGraphStartName.
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function);
     
     // this may never have to be necessary
     bool UnregisterNativeGraphStart(AZStd::string_view name);
 
+    // helpers for the code generated from graphs, these match the behavior of the nodes they replace
+
+    //! Divides like the Divide node, division by zero is reported and results in 0.
+    AZ_INLINE double NativeDivide(double dividend, double divisor)
+    {
+        if (AZ::IsClose(divisor, 0.0, std::numeric_limits<double>::epsilon()))
+        {
+            AZ_Error("Script Canvas", false, "Divide by Zero");
+            return 0.0;
+        }
+
+        return dividend / divisor;
+    }
+
+    //! Formats a number like the Print node does.
+    AZ_INLINE AZStd::string NativeToString(double value, int numericPrecision)
+    {
+        return AZStd::string::format("%.*lf", numericPrecision, value);
+    }
+
+    AZ_INLINE const char* NativeToString(bool value)
+    {
+        return value ? "true" : "false";
+    }
+
 } // namespace ScriptCanvas
\ No newline at end of file
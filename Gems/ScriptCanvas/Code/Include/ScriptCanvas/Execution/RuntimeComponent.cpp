@@ -24,6 +24,7 @@
 #include <ScriptCanvas/Core/Node.h>
 #include <ScriptCanvas/Core/ScriptCanvasBus.h>
 #include <ScriptCanvas/Core/GraphScopedTypes.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
 #include <ScriptCanvas/Libraries/Core/ErrorHandler.h>
 #include <ScriptCanvas/Libraries/Core/Start.h>
@@ -196,6 +197,17 @@ namespace ScriptCanvas
                 DeactivateGraph();
                 return;
             }
+
+            // If the graph was translated to C++ and compiled in, run that instead of interpreting the nodes.
+            // The generated code only knows the variable values from translation, so graphs with overrides stay interpreted.
+            if (m_variableOverrides.GetVariables().empty())
+            {
+                const AZStd::string graphName = GetNativeGraphStartName(GetAssetName());
+                if (!graphName.empty() && CallNativeGraphStart(graphName, RuntimeContext(GetScriptCanvasId())))
+                {
+                    return;
+                }
+            }
         }
 
         if (!m_createdAsset)
@@ -14,10 +14,13 @@
 
 #if !defined(_RELEASE)
 
+#include <AzCore/Component/EntityUtils.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <ScriptCanvas/Core/Graph.h>
 #include <ScriptCanvas/Core/Node.h>
 #include <ScriptCanvas/Variable/VariableData.h>
 #include <ScriptCanvas/Libraries/Core/EBusEventHandler.h>
+#include <ScriptCanvas/Libraries/Core/SetVariable.h>
 #include <ScriptCanvas/Libraries/Core/Start.h>
 #include <ScriptCanvas/Translation/TranslationUtilities.h>
 
@@ -52,6 +55,35 @@ namespace ScriptCanvas
             return m_startNode;
         }
 
+        const Variables& AbstractCodeModel::GetVariables() const
+        {
+            return m_variables;
+        }
+
+        AZ::Outcome<const Node*, AZStd::string> AbstractCodeModel::FindNextStatement(const Node& node) const
+        {
+            const Node* nextNode = nullptr;
+
+            for (const Slot* slot : node.GetAllSlotsByDescriptor(SlotDescriptors::ExecutionOut(), true))
+            {
+                for (const Endpoint& endpoint : m_source.m_graph.GetConnectedEndpoints(slot->GetEndpoint()))
+                {
+                    if (nextNode)
+                    {
+                        return AZ::Failure(AZStd::string::format("Node %s branches the execution, only a single line of execution can be translated", node.GetNodeName().c_str()));
+                    }
+
+                    nextNode = m_source.m_graph.FindNode(endpoint.GetNodeId());
+                    if (!nextNode)
+                    {
+                        return AZ::Failure(AZStd::string::format("Node %s is connected to a node missing from the graph", node.GetNodeName().c_str()));
+                    }
+                }
+            }
+
+            return AZ::Success(nextNode);
+        }
+
         const Source& AbstractCodeModel::GetSource() const
         {
             return m_source;
@@ -102,7 +134,24 @@ namespace ScriptCanvas
         
         AZ::Outcome<void, AZStd::string> AbstractCodeModel::Parse()
         {
-            return AZ::Success();
+            AZ::Outcome<void, AZStd::string> outcome = ProcessVariables();
+
+            if (outcome.IsSuccess())
+            {
+                outcome = ProcessFunctions();
+            }
+
+            if (outcome.IsSuccess())
+            {
+                outcome = ProcessHandlers();
+            }
+
+            if (outcome.IsSuccess())
+            {
+                outcome = ProcessDependencies();
+            }
+
+            return outcome;
         }
 
         AZ::Outcome<void, AZStd::string> AbstractCodeModel::Parse(const Node& node)
@@ -125,6 +174,88 @@ namespace ScriptCanvas
     
         AZ::Outcome<void, AZStd::string> AbstractCodeModel::ProcessFunctions()
         {
+            // only graphs driven by a single start node are supported for now, everything they execute becomes the start function
+            for (AZ::Entity* nodeEntity : m_source.m_graphData.m_nodes)
+            {
+                const Node* node = AZ::EntityUtils::FindFirstDerivedComponent<Node>(nodeEntity);
+                if (!node)
+                {
+                    return AZ::Failure(AZStd::string::format("Entity %s is missing its node component", nodeEntity->GetName().c_str()));
+                }
+
+                if (azrtti_cast<const Nodes::Core::Start*>(node))
+                {
+                    if (m_startNode)
+                    {
+                        return AZ::Failure(AZStd::string("Graphs with more than one Start node can't be translated"));
+                    }
+
+                    m_startNode = node;
+                }
+                else if (node->IsEntryPoint())
+                {
+                    return AZ::Failure(AZStd::string::format("Node %s is an entry point, only graphs driven by a Start node can be translated", node->GetNodeName().c_str()));
+                }
+            }
+
+            if (!m_startNode)
+            {
+                return AZ::Failure(AZStd::string("Graphs without a Start node can't be translated"));
+            }
+
+            m_isPureLibrary = false;
+            m_requiresActivation = true;
+
+            Function& startFunction = m_functions[m_startNode->GetEntityId()];
+            startFunction.m_function = m_startNode;
+            startFunction.m_isPublic = true;
+            startFunction.m_isStart = true;
+
+            AZStd::unordered_set<const Node*> executedNodes = { m_startNode };
+            const Node* currentNode = m_startNode;
+
+            while (true)
+            {
+                AZ::Outcome<const Node*, AZStd::string> nextOutcome = FindNextStatement(*currentNode);
+                if (!nextOutcome.IsSuccess())
+                {
+                    return AZ::Failure(nextOutcome.TakeError());
+                }
+
+                const Node* nextNode = nextOutcome.GetValue();
+                if (!nextNode)
+                {
+                    break;
+                }
+
+                if (!executedNodes.insert(nextNode).second)
+                {
+                    return AZ::Failure(AZStd::string::format("Node %s is executed more than once, loops can't be translated", nextNode->GetNodeName().c_str()));
+                }
+
+                if (auto setVariableNode = azrtti_cast<const Nodes::Core::SetVariableNode*>(nextNode))
+                {
+                    auto variableIter = m_variables.find(setVariableNode->GetId());
+                    if (variableIter != m_variables.end())
+                    {
+                        variableIter->second.m_isConstant = false;
+                    }
+                }
+
+                startFunction.m_statements.push_back(nextNode);
+                currentNode = nextNode;
+            }
+
+            // pure data nodes are only sources of values, every other node has to be executed by the start function
+            for (AZ::Entity* nodeEntity : m_source.m_graphData.m_nodes)
+            {
+                const Node* node = AZ::EntityUtils::FindFirstDerivedComponent<Node>(nodeEntity);
+                if (!node->IsPureData() && executedNodes.find(node) == executedNodes.end())
+                {
+                    return AZ::Failure(AZStd::string::format("Node %s isn't executed by the Start node's line of execution", node->GetNodeName().c_str()));
+                }
+            }
+
             return AZ::Success();
         }
         
@@ -135,6 +266,13 @@ namespace ScriptCanvas
 
         AZ::Outcome<void, AZStd::string> AbstractCodeModel::ProcessVariables()
         {
+            for (const auto& variablePair : m_source.m_variableData.GetVariables())
+            {
+                Variable& variable = m_variables[variablePair.first];
+                variable.m_variable = &variablePair.second;
+                variable.m_isMember = true;
+            }
+
             return AZ::Success();
         }
         
@@ -148,7 +286,7 @@ namespace ScriptCanvas
         
         AZ::Outcome<Source, AZStd::string> Source::Construct(const Graph& graph, const AZStd::string& name, const AZStd::string& path)
         {
-            const VariableData emptyVardata{};
+            static const VariableData emptyVardata{};
             auto graphVariableData = graph.GetVariableDataConst();
             const VariableData* sourceVariableData = graphVariableData ? graphVariableData : &emptyVardata;
 
@@ -15,6 +15,7 @@
 #if !defined(_RELEASE)
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <ScriptCanvas/Core/Core.h>
 #include <ScriptCanvas/Variable/VariableCore.h>
 #include <ScriptCanvas/Variable/GraphVariable.h>
@@ -57,6 +58,8 @@ namespace ScriptCanvas
             bool m_isPublic = false;
             bool m_isStatic = true;
             bool m_isStart = false;
+            // the nodes executed by the function, in execution order
+            AZStd::vector<const Node*> m_statements;
         }; // struct Function
 
         using Functions = AZStd::unordered_map<AZ::EntityId, Function>;
@@ -74,6 +77,8 @@ namespace ScriptCanvas
             bool m_isMember = false;
         }; // struct Variable
 
+        using Variables = AZStd::unordered_map<VariableId, Variable>;
+
         /// This class parses a graph into abstract programming concepts for easier translation
         /// into C++, LLVM-IR, Lua, or whatever else would be needed
         class AbstractCodeModel
@@ -89,6 +94,8 @@ namespace ScriptCanvas
             const Source& GetSource() const;
 
             const Node* GetStartNode() const;
+
+            const Variables& GetVariables() const;
             
             bool IsPureLibrary() const;
                                   
@@ -104,7 +111,7 @@ namespace ScriptCanvas
             Functions m_functions;
             // not just ebus event handlers, but implicit or time based handlers, like for the delay node, etc
             AZStd::unordered_map<AZ::EntityId, Node*> m_handlers;
-            AZStd::unordered_map<AZ::EntityId, Variable> m_variables;
+            Variables m_variables;
 
             // add as entry into the function list
             void AddFunction(const Node& node);
@@ -120,6 +127,9 @@ namespace ScriptCanvas
             AZ::Outcome<void, AZStd::string> ProcessVariables();
 
             bool IsFunction(const Node& node) const;
+
+            // returns the node the execution continues to after the node, or nullptr if the execution ends there
+            AZ::Outcome<const Node*, AZStd::string> FindNextStatement(const Node& node) const;
             
             void ParseLatentExecution(const Node& node);
 
@@ -41,6 +41,11 @@ namespace ScriptCanvas
                     ScriptCanvas_Node::Version(1)
                 );
 
+                //! The pieces of the format string, the pieces whose values come from slots are the keys of GetArrayBindingMap.
+                const AZStd::vector<AZStd::string>& GetUnresolvedString() const { return m_unresolvedString; }
+                const AZStd::map<AZ::u64, SlotId>& GetArrayBindingMap() const { return m_arrayBindingMap; }
+                int GetNumericPrecision() const { return m_numericPrecision; }
+
             protected:
 
                 // Inputs
@@ -83,7 +83,7 @@ namespace ScriptCanvas
                                 fallbackId = groupedSlotId;
                             }
 
-                            if ((groupedSlot->IsVariableReference() && groupedSlot->GetVariableReference().IsValid()) || IsConnected(groupedSlotId) || IsValidArithmeticSlot(groupedSlotId))
+                            if (IsApplicableInput(*groupedSlot))
                             {
                                 const Datum* inputDatum = groupedSlot->FindDatum();
 
@@ -355,6 +355,11 @@ namespace ScriptCanvas
                 }
             }
 
+            bool OperatorArithmetic::IsApplicableInput(const Slot& slot) const
+            {
+                return (slot.IsVariableReference() && slot.GetVariableReference().IsValid()) || IsConnected(slot.GetId()) || IsValidArithmeticSlot(slot.GetId());
+            }
+
             bool OperatorArithmetic::IsValidArithmeticSlot(const SlotId& slotId) const
             {
                 const Datum* datum = FindDatum(slotId);
@@ -107,6 +107,9 @@ namespace ScriptCanvas
 
                 void Evaluate(const ArithmeticOperands&, Datum&);
 
+                //! Returns true if the input slot takes part in the operation, inputs that can't change the result are skipped.
+                bool IsApplicableInput(const Slot& slot) const;
+
                 virtual void Operator(Data::eType type, const ArithmeticOperands& operands, Datum& result);
                 virtual void InitializeSlot(const SlotId& slotId, const Data::Type& dataType);
                 virtual void InvokeOperator();
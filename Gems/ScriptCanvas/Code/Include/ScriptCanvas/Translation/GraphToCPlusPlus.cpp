@@ -13,7 +13,99 @@
 #include "precompiled.h"
 #include "GraphToCPlusPlus.h"
 
+#if !defined(_RELEASE)
+
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/sort.h>
+#include <ScriptCanvas/Core/Graph.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Core/PureData.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Libraries/Core/GetVariable.h>
+#include <ScriptCanvas/Libraries/Core/SetVariable.h>
+#include <ScriptCanvas/Libraries/Operators/Math/OperatorAdd.h>
+#include <ScriptCanvas/Libraries/Operators/Math/OperatorDiv.h>
+#include <ScriptCanvas/Libraries/Operators/Math/OperatorMul.h>
+#include <ScriptCanvas/Libraries/Operators/Math/OperatorSub.h>
+#include <ScriptCanvas/Libraries/String/Print.h>
+
+#include <math.h>
+
+namespace GraphToCPlusPlusCPP
+{
+    using namespace ScriptCanvas;
+
+    // returns nullptr for the types the translation doesn't support yet
+    const char* GetNativeTypeName(const Data::Type& type)
+    {
+        switch (type.GetType())
+        {
+        case Data::eType::Boolean:
+            return "bool";
+        case Data::eType::Number:
+            return "double";
+        case Data::eType::String:
+            return "AZStd::string";
+        default:
+            return nullptr;
+        }
+    }
+
+    AZStd::string ToNumberLiteral(Data::NumberType value)
+    {
+        AZStd::string literal = AZStd::string::format("%.17g", value);
+
+        // keep it a double literal
+        if (literal.find_first_of(".e") == AZStd::string::npos)
+        {
+            literal.append(".0");
+        }
+
+        return literal;
+    }
+
+    AZStd::string ToStringLiteral(const Data::StringType& value)
+    {
+        AZStd::string literal = "\"";
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '\"':
+                literal.append("\\\"");
+                break;
+            case '\\':
+                literal.append("\\\\");
+                break;
+            case '\n':
+                literal.append("\\n");
+                break;
+            case '\r':
+                literal.append("\\r");
+                break;
+            case '\t':
+                literal.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    // octal escapes can't swallow the characters that follow them, unlike hex escapes
+                    literal.append(AZStd::string::format("\\%03o", static_cast<unsigned char>(character)));
+                }
+                else
+                {
+                    literal.push_back(character);
+                }
+                break;
+            }
+        }
+
+        literal.push_back('\"');
+        return literal;
+    }
+} // namespace GraphToCPlusPlusCPP
 
 namespace ScriptCanvas
 {
@@ -35,6 +127,7 @@ namespace ScriptCanvas
 
         GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
             : GraphToX(CreateCPlusPluseConfig(), model) 
+            , m_className(ToIdentifier(GetGraphName()))
         {
             WriteHeaderDotH();
             WriteHeaderDotCPP();
@@ -72,6 +165,36 @@ namespace ScriptCanvas
             return outcome;
         }
 
+        void GraphToCPlusPlus::AddFailure(const AZStd::string& reason)
+        {
+            // keep the first failure, the ones that follow it are usually caused by it
+            if (m_outcome.IsSuccess())
+            {
+                m_outcome = AZ::Failure(reason);
+            }
+        }
+
+        void GraphToCPlusPlus::AddLocal(const Endpoint& endpoint, const Expression& value)
+        {
+            const Graph& graph = m_model.GetSource().m_graph;
+
+            // values nothing reads are only computed for the side effects, and there are none yet
+            if (graph.GetConnectedEndpoints(endpoint).empty())
+            {
+                return;
+            }
+
+            const Node* node = graph.FindNode(endpoint.GetNodeId());
+            const Slot* slot = node ? node->GetSlot(endpoint.GetSlotId()) : nullptr;
+
+            Expression local;
+            local.m_text = AZStd::string::format("l_%s%zu", ToIdentifier(slot ? slot->GetName() : "value").c_str(), m_locals.size());
+            local.m_type = value.m_type;
+
+            WriteStatement(AZStd::string::format("const %s %s = %s;", GraphToCPlusPlusCPP::GetNativeTypeName(value.m_type), local.m_text.c_str(), value.m_text.c_str()));
+            m_locals[endpoint] = local;
+        }
+
         void GraphToCPlusPlus::TranslateClassClose()
         {
             m_dotH.Outdent();
@@ -80,13 +203,13 @@ namespace ScriptCanvas
             m_dotH.WriteSpace();
             SingleLineComment(m_dotH);
             m_dotH.WriteSpace();
-            m_dotH.WriteLine("class %s", GetGraphName());
+            m_dotH.WriteLine("class %s", m_className.c_str());
         }
 
         void GraphToCPlusPlus::TranslateClassOpen()
         {
             m_dotH.WriteIndent();
-            m_dotH.WriteLine("class %s", GetGraphName());
+            m_dotH.WriteLine("class %s", m_className.c_str());
             m_dotH.WriteIndent();
             m_dotH.WriteLine("{");
             m_dotH.Indent();
@@ -125,7 +248,31 @@ namespace ScriptCanvas
             for (const auto& functionsEntry : functions)
             {
                 const Grammar::Function& function = functionsEntry.second;
-                // TranslateFunction(function);
+
+                if (!function.m_isStart)
+                {
+                    AddFailure(AZStd::string::format("Node %s: only the Start node function can be translated", function.m_function->GetNodeName().c_str()));
+                    continue;
+                }
+
+                { // .h, public so a host can keep an instance, and the graph variables, alive across starts
+                    m_dotH.WriteIndent();
+                    m_dotH.WriteLine("public: void OnStart(const RuntimeContext& context);");
+                }
+
+                { // .cpp
+                    m_dotCPP.WriteIndent();
+                    m_dotCPP.WriteLine("void %s::OnStart([[maybe_unused]] const RuntimeContext& context)", m_className.c_str());
+                    OpenScope(m_dotCPP);
+                    {
+                        for (const Node* statement : function.m_statements)
+                        {
+                            TranslateStatement(*statement);
+                        }
+                    }
+                    CloseScope(m_dotCPP);
+                    m_dotCPP.WriteNewLine();
+                }
             }
         }
 
@@ -134,6 +281,91 @@ namespace ScriptCanvas
 
         }
 
+        AZ::Outcome<GraphToCPlusPlus::Expression, AZStd::string> GraphToCPlusPlus::TranslateInput(const Node& node, const Slot& slot)
+        {
+            if (slot.IsVariableReference())
+            {
+                auto memberIter = m_members.find(slot.GetVariableReference());
+                if (memberIter == m_members.end())
+                {
+                    return AZ::Failure(AZStd::string::format("Node %s: slot %s references a variable missing from the graph", node.GetNodeName().c_str(), slot.GetName().c_str()));
+                }
+
+                return AZ::Success(memberIter->second);
+            }
+
+            const Graph& graph = m_model.GetSource().m_graph;
+            const AZStd::vector<Endpoint> connectedEndpoints = graph.GetConnectedEndpoints(slot.GetEndpoint());
+
+            if (connectedEndpoints.empty())
+            {
+                const Datum* datum = node.FindDatum(slot.GetId());
+                if (!datum)
+                {
+                    return AZ::Failure(AZStd::string::format("Node %s: slot %s has no value", node.GetNodeName().c_str(), slot.GetName().c_str()));
+                }
+
+                return TranslateLiteral(*datum);
+            }
+
+            const Endpoint& source = connectedEndpoints.front();
+
+            auto localIter = m_locals.find(source);
+            if (localIter != m_locals.end())
+            {
+                return AZ::Success(localIter->second);
+            }
+
+            // a value node is just a constant
+            if (auto pureData = azrtti_cast<const PureData*>(graph.FindNode(source.GetNodeId())))
+            {
+                const AZStd::vector<const Slot*> valueSlots = pureData->GetAllSlotsByDescriptor(SlotDescriptors::DataIn());
+                if (pureData->GetPropertyNameSlotMap().empty() && valueSlots.size() == 1)
+                {
+                    if (const Datum* datum = pureData->FindDatum(valueSlots.front()->GetId()))
+                    {
+                        return TranslateLiteral(*datum);
+                    }
+                }
+            }
+
+            return AZ::Failure(AZStd::string::format("Node %s: the value of slot %s doesn't come from a variable, a constant, or a node executed before it", node.GetNodeName().c_str(), slot.GetName().c_str()));
+        }
+
+        AZ::Outcome<GraphToCPlusPlus::Expression, AZStd::string> GraphToCPlusPlus::TranslateLiteral(const Datum& datum)
+        {
+            Expression literal;
+            literal.m_type = datum.GetType();
+
+            switch (literal.m_type.GetType())
+            {
+            case Data::eType::Boolean:
+                literal.m_text = *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+                break;
+
+            case Data::eType::Number:
+            {
+                const Data::NumberType value = *datum.GetAs<Data::NumberType>();
+                if (!isfinite(value))
+                {
+                    return AZ::Failure(AZStd::string("Numbers that aren't finite can't be translated"));
+                }
+
+                literal.m_text = GraphToCPlusPlusCPP::ToNumberLiteral(value);
+                break;
+            }
+
+            case Data::eType::String:
+                literal.m_text = GraphToCPlusPlusCPP::ToStringLiteral(*datum.GetAs<Data::StringType>());
+                break;
+
+            default:
+                return AZ::Failure(AZStd::string::format("Values of type %s can't be translated", Data::GetName(literal.m_type).c_str()));
+            }
+
+            return AZ::Success(literal);
+        }
+
         void GraphToCPlusPlus::TranslateNamespaceOpen()
         {
             OpenNamespace(m_dotH, "ScriptCanvas");
@@ -144,16 +376,16 @@ namespace ScriptCanvas
 
         void GraphToCPlusPlus::TranslateNamespaceClose()
         {
-            CloseNamespace(m_dotH, "ScriptCanvas");
             CloseNamespace(m_dotH, GetAutoNativeNamespace());
-            CloseNamespace(m_dotCPP, "ScriptCanvas");
+            CloseNamespace(m_dotH, "ScriptCanvas");
             CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCPP, "ScriptCanvas");
         }
 
         void GraphToCPlusPlus::TranslateStartNode()
         {
             // write a start function
-            if (const Node* startNode = m_model.GetStartNode())
+            if (m_model.GetStartNode())
             {
                 { // .h
                     m_dotH.WriteIndent();
@@ -162,23 +394,307 @@ namespace ScriptCanvas
                 
                 { // .cpp
                     m_dotCPP.WriteIndent();
-                    m_dotCPP.WriteLine("void %s::OnGraphStart(const RuntimeContext& context)", GetGraphName());
+                    m_dotCPP.WriteLine("void %s::OnGraphStart(const RuntimeContext& context)", m_className.c_str());
                     OpenScope(m_dotCPP);
                     {
                         m_dotCPP.WriteIndent();
-                        m_dotCPP.WriteLine("AZ_TracePrintf(\"ScriptCanvas\", \"This call wasn't generated from parsing a print node!\");");
-                        m_dotCPP.WriteLine("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, \"This call wasn't generated from parsing a print node!\");");
-                        // get the related function call and call it
-                        // with possible appropriate variables
+                        m_dotCPP.WriteLine("%s graph;", m_className.c_str());
+                        m_dotCPP.WriteIndent();
+                        m_dotCPP.WriteLine("graph.OnStart(context);");
                     }
                     CloseScope(m_dotCPP);
+                    m_dotCPP.WriteNewLine();
+
+                    // graphs are looked up by their asset path when they're activated
+                    const AZStd::string registeredName = GetNativeGraphStartName(AZStd::string::format("%s%s", GetFullPath(), GetGraphName()));
+                    m_dotCPP.WriteIndent();
+                    m_dotCPP.WriteLine("static const bool s_%sRegistered = RegisterNativeGraphStart(%s, &%s::OnGraphStart);"
+                        , m_className.c_str(), GraphToCPlusPlusCPP::ToStringLiteral(registeredName).c_str(), m_className.c_str());
                 }
             }
         }
 
+        void GraphToCPlusPlus::TranslateStatement(const Node& node)
+        {
+            if (!m_outcome.IsSuccess())
+            {
+                return;
+            }
+
+            m_dotCPP.WriteIndent();
+            SingleLineComment(m_dotCPP);
+            m_dotCPP.WriteSpace();
+            m_dotCPP.WriteLine(AZStd::string_view(node.GetNodeName()));
+
+            if (auto getVariable = azrtti_cast<const Nodes::Core::GetVariableNode*>(&node))
+            {
+                TranslateStatementGetVariable(*getVariable);
+            }
+            else if (auto setVariable = azrtti_cast<const Nodes::Core::SetVariableNode*>(&node))
+            {
+                TranslateStatementSetVariable(*setVariable);
+            }
+            else if (auto print = azrtti_cast<const Nodes::String::Print*>(&node))
+            {
+                TranslateStatementPrint(*print);
+            }
+            else if (auto arithmetic = azrtti_cast<const Nodes::Operators::OperatorArithmetic*>(&node))
+            {
+                TranslateStatementArithmetic(*arithmetic);
+            }
+            else
+            {
+                AddFailure(AZStd::string::format("Node %s can't be translated to C++ yet", node.GetNodeName().c_str()));
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateStatementArithmetic(const Nodes::Operators::OperatorArithmetic& node)
+        {
+            const char* binaryOperator = nullptr;
+            if (azrtti_cast<const Nodes::Operators::OperatorAdd*>(&node))
+            {
+                binaryOperator = " + ";
+            }
+            else if (azrtti_cast<const Nodes::Operators::OperatorSub*>(&node))
+            {
+                binaryOperator = " - ";
+            }
+            else if (azrtti_cast<const Nodes::Operators::OperatorMul*>(&node))
+            {
+                binaryOperator = " * ";
+            }
+            else if (!azrtti_cast<const Nodes::Operators::OperatorDiv*>(&node))
+            {
+                AddFailure(AZStd::string::format("Node %s can't be translated to C++ yet", node.GetNodeName().c_str()));
+                return;
+            }
+
+            // select the operands the same way the node does at run time
+            const Slot* resultSlot = nullptr;
+            const Slot* fallbackSlot = nullptr;
+            AZStd::vector<const Slot*> operandSlots;
+
+            for (const Slot* slot : node.GetSlotsWithDynamicGroup(node.GetArithmeticDynamicTypeGroup()))
+            {
+                if (slot->IsInput())
+                {
+                    if (!fallbackSlot)
+                    {
+                        fallbackSlot = slot;
+                    }
+
+                    if (node.IsApplicableInput(*slot))
+                    {
+                        operandSlots.push_back(slot);
+                    }
+                }
+                else if (slot->IsOutput())
+                {
+                    resultSlot = slot;
+                }
+            }
+
+            if (operandSlots.empty() && fallbackSlot)
+            {
+                operandSlots.push_back(fallbackSlot);
+            }
+
+            if (!resultSlot || operandSlots.empty())
+            {
+                AddFailure(AZStd::string::format("Node %s has no operands", node.GetNodeName().c_str()));
+                return;
+            }
+
+            Expression result;
+            result.m_type = Data::Type::Number();
+
+            for (const Slot* operandSlot : operandSlots)
+            {
+                AZ::Outcome<Expression, AZStd::string> operand = TranslateInput(node, *operandSlot);
+                if (!operand.IsSuccess())
+                {
+                    AddFailure(operand.GetError());
+                    return;
+                }
+
+                if (operand.GetValue().m_type.GetType() != Data::eType::Number)
+                {
+                    AddFailure(AZStd::string::format("Node %s: only Number arithmetic can be translated", node.GetNodeName().c_str()));
+                    return;
+                }
+
+                if (result.m_text.empty())
+                {
+                    result.m_text = operand.GetValue().m_text;
+                }
+                else if (binaryOperator)
+                {
+                    result.m_text = AZStd::string::format("%s%s%s", result.m_text.c_str(), binaryOperator, operand.GetValue().m_text.c_str());
+                }
+                else
+                {
+                    result.m_text = AZStd::string::format("NativeDivide(%s, %s)", result.m_text.c_str(), operand.GetValue().m_text.c_str());
+                }
+            }
+
+            AddLocal(resultSlot->GetEndpoint(), result);
+        }
+
+        void GraphToCPlusPlus::TranslateStatementGetVariable(const Nodes::Core::GetVariableNode& node)
+        {
+            auto memberIter = m_members.find(node.GetId());
+            const Slot* outSlot = node.GetSlot(node.GetDataOutSlotId());
+
+            if (memberIter == m_members.end() || !outSlot)
+            {
+                AddFailure(AZStd::string::format("Node %s references a variable missing from the graph", node.GetNodeName().c_str()));
+                return;
+            }
+
+            AddLocal(outSlot->GetEndpoint(), memberIter->second);
+        }
+
+        void GraphToCPlusPlus::TranslateStatementPrint(const Nodes::String::Print& node)
+        {
+            // matches Print::OnInputSignal, which is compiled out of these builds
+            m_dotCPP.WriteLine("#if !defined(PERFORMANCE_BUILD) && !defined(_RELEASE)");
+            OpenScope(m_dotCPP);
+            {
+                WriteStatement("AZStd::string text;");
+
+                const AZStd::vector<AZStd::string>& pieces = node.GetUnresolvedString();
+                const AZStd::map<AZ::u64, SlotId>& bindings = node.GetArrayBindingMap();
+
+                for (AZ::u64 index = 0; index < pieces.size(); ++index)
+                {
+                    auto bindingIter = bindings.find(index);
+                    const Slot* slot = bindingIter != bindings.end() ? node.GetSlot(bindingIter->second) : nullptr;
+
+                    if (!slot)
+                    {
+                        if (!pieces[index].empty())
+                        {
+                            WriteStatement(AZStd::string::format("text.append(%s);", GraphToCPlusPlusCPP::ToStringLiteral(pieces[index]).c_str()));
+                        }
+
+                        continue;
+                    }
+
+                    AZ::Outcome<Expression, AZStd::string> value = TranslateInput(node, *slot);
+                    if (!value.IsSuccess())
+                    {
+                        AddFailure(value.GetError());
+                        break;
+                    }
+
+                    const Expression& expression = value.GetValue();
+                    switch (expression.m_type.GetType())
+                    {
+                    case Data::eType::Number:
+                        WriteStatement(AZStd::string::format("text.append(NativeToString(%s, %d));", expression.m_text.c_str(), node.GetNumericPrecision()));
+                        break;
+                    case Data::eType::Boolean:
+                        WriteStatement(AZStd::string::format("text.append(NativeToString(%s));", expression.m_text.c_str()));
+                        break;
+                    default:
+                        WriteStatement(AZStd::string::format("text.append(%s);", expression.m_text.c_str()));
+                        break;
+                    }
+                }
+
+                WriteStatement("AZ_TracePrintf(\"Script Canvas\", \"%s\\n\", text.c_str());");
+                WriteStatement("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, text);");
+            }
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteLine("#endif");
+        }
+
+        void GraphToCPlusPlus::TranslateStatementSetVariable(const Nodes::Core::SetVariableNode& node)
+        {
+            auto memberIter = m_members.find(node.GetId());
+            const Slot* inSlot = node.GetSlot(node.GetDataInSlotId());
+
+            if (memberIter == m_members.end() || !inSlot)
+            {
+                AddFailure(AZStd::string::format("Node %s references a variable missing from the graph", node.GetNodeName().c_str()));
+                return;
+            }
+
+            AZ::Outcome<Expression, AZStd::string> value = TranslateInput(node, *inSlot);
+            if (!value.IsSuccess())
+            {
+                AddFailure(value.GetError());
+                return;
+            }
+
+            if (value.GetValue().m_type.GetType() != memberIter->second.m_type.GetType())
+            {
+                AddFailure(AZStd::string::format("Node %s: the value doesn't match the type of the variable", node.GetNodeName().c_str()));
+                return;
+            }
+
+            WriteStatement(AZStd::string::format("%s = %s;", memberIter->second.m_text.c_str(), value.GetValue().m_text.c_str()));
+
+            if (const Slot* outSlot = node.GetSlot(node.GetDataOutSlotId()))
+            {
+                AddLocal(outSlot->GetEndpoint(), memberIter->second);
+            }
+        }
+
         void GraphToCPlusPlus::TranslateVariables()
         {
+            // sort by name, so the output doesn't change every time the graph is translated
+            AZStd::vector<const Grammar::Variable*> variables;
+            for (const auto& variableEntry : m_model.GetVariables())
+            {
+                variables.push_back(&variableEntry.second);
+            }
 
+            AZStd::sort(variables.begin(), variables.end(), [](const Grammar::Variable* lhs, const Grammar::Variable* rhs)
+            {
+                return lhs->m_variable->GetVariableName() < rhs->m_variable->GetVariableName();
+            });
+
+            AZStd::unordered_set<AZStd::string> memberNames;
+
+            for (const Grammar::Variable* variable : variables)
+            {
+                const GraphVariable& graphVariable = *variable->m_variable;
+
+                const Datum* datum = graphVariable.GetDatum();
+                AZ::Outcome<Expression, AZStd::string> value = AZ::Failure(AZStd::string("the variable has no value"));
+                if (datum)
+                {
+                    value = TranslateLiteral(*datum);
+                }
+
+                if (!value.IsSuccess())
+                {
+                    AddFailure(AZStd::string::format("Variable %.*s: %s", aznumeric_cast<int>(graphVariable.GetVariableName().size()), graphVariable.GetVariableName().data(), value.GetError().c_str()));
+                    continue;
+                }
+
+                Expression member;
+                member.m_type = value.GetValue().m_type;
+                member.m_text = AZStd::string::format("m_%s", ToIdentifier(graphVariable.GetVariableName()).c_str());
+                while (!memberNames.insert(member.m_text).second)
+                {
+                    member.m_text.append("_");
+                }
+
+                m_dotH.WriteIndent();
+                m_dotH.Write("private: %s", variable->m_isConstant ? "const " : "");
+                m_dotH.WriteLine(AZStd::string::format("%s %s = %s;", GraphToCPlusPlusCPP::GetNativeTypeName(member.m_type), member.m_text.c_str(), value.GetValue().m_text.c_str()));
+
+                m_members[graphVariable.GetVariableId()] = member;
+            }
+        }
+
+        void GraphToCPlusPlus::WriteStatement(const AZStd::string& statement)
+        {
+            // the statement may contain format characters, so it must not be written as a format string
+            m_dotCPP.WriteIndent();
+            m_dotCPP.WriteLine(AZStd::string_view(statement));
         }
 
         void GraphToCPlusPlus::WriterHeader()
@@ -196,6 +712,9 @@ namespace ScriptCanvas
             m_dotCPP.WriteLine("#include \"precompiled.h\"");
             m_dotCPP.WriteLine("#include \"%s.h\"", GetGraphName());
             m_dotCPP.WriteNewLine();
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Core/NodeBus.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/NativeHostDefinitions.h>");
+            m_dotCPP.WriteNewLine();
         }
 
         void GraphToCPlusPlus::WriteHeaderDotH()
@@ -206,9 +725,12 @@ namespace ScriptCanvas
             m_dotH.WriteNewLine();
             WriteDoNotModify(m_dotH);
             m_dotH.WriteNewLine();
+            m_dotH.WriteLine("#include <AzCore/std/string/string.h>");
             m_dotH.WriteLine("#include <Execution/NativeHostDeclarations.h>");
             m_dotH.WriteNewLine();
         }
 
     } // namespace Translation
-} // namespace ScriptCanvas
\ No newline at end of file
+} // namespace ScriptCanvas
+
+#endif
@@ -13,13 +13,39 @@
 #pragma once
 
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <ScriptCanvas/Core/Endpoint.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Variable/VariableCore.h>
 
 #include "TranslationUtilities.h"
 #include "GraphToX.h"
 
 namespace ScriptCanvas
 {
+    class Datum;
     class Graph;
+    class Node;
+    class Slot;
+
+    namespace Nodes
+    {
+        namespace Core
+        {
+            class GetVariableNode;
+            class SetVariableNode;
+        }
+
+        namespace Operators
+        {
+            class OperatorArithmetic;
+        }
+
+        namespace String
+        {
+            class Print;
+        }
+    }
 
     namespace Grammar
     {
@@ -36,12 +62,36 @@ namespace ScriptCanvas
             static AZ::Outcome<void, AZStd::string> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
             
         private:         
+            // a C++ expression, and the script canvas type of its value
+            struct Expression
+            {
+                AZStd::string m_text;
+                Data::Type m_type;
+            };
+
             // cpp only
             Writer m_dotH;
             Writer m_dotCPP;
+            // the graph name may not be a valid identifier
+            AZStd::string m_className;
+            // the data members that hold the graph variables
+            AZStd::unordered_map<VariableId, Expression> m_members;
+            // the locals that hold the data output of the statements translated so far
+            AZStd::unordered_map<Endpoint, Expression> m_locals;
             
             GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
 
+            void AddFailure(const AZStd::string& reason);
+            void AddLocal(const Endpoint& endpoint, const Expression& value);
+            AZ::Outcome<Expression, AZStd::string> TranslateInput(const Node& node, const Slot& slot);
+            AZ::Outcome<Expression, AZStd::string> TranslateLiteral(const Datum& datum);
+            void TranslateStatement(const Node& node);
+            void TranslateStatementArithmetic(const Nodes::Operators::OperatorArithmetic& node);
+            void TranslateStatementGetVariable(const Nodes::Core::GetVariableNode& node);
+            void TranslateStatementPrint(const Nodes::String::Print& node);
+            void TranslateStatementSetVariable(const Nodes::Core::SetVariableNode& node);
+            void WriteStatement(const AZStd::string& statement);
+
             void TranslateClassClose();
             void TranslateClassOpen();
             void TranslateConstruction();
@@ -13,15 +13,19 @@
 #include "precompiled.h"
 #include "GraphToLua.h"
 
+#if !defined(_RELEASE)
+
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
 
 namespace ScriptCanvas
 {
     namespace Translation
     {
-        AZ::Outcome<void, AZStd::string> GraphToLua::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& output)
+        AZ::Outcome<void, AZStd::string> GraphToLua::Translate([[maybe_unused]] const Grammar::AbstractCodeModel& model, [[maybe_unused]] AZStd::string& output)
         {
-            return AZ::Failure(AZStd::string("Finish me!"));
+            return AZ::Failure(AZStd::string("Translating graphs to Lua isn't supported yet"));
         }
     } // namespace Translation
-} // namespace ScriptCanvas
\ No newline at end of file
+} // namespace ScriptCanvas
+
+#endif
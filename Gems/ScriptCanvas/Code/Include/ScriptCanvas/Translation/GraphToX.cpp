@@ -13,6 +13,8 @@
 #include "precompiled.h"
 #include "GraphToX.h"
 
+#if !defined(_RELEASE)
+
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
 
 namespace ScriptCanvas
@@ -118,4 +120,6 @@ namespace ScriptCanvas
             CloseBlockComment(writer);
         }
     } // namespace Translation
-} // namespace ScriptCanvas
\ No newline at end of file
+} // namespace ScriptCanvas
+
+#endif
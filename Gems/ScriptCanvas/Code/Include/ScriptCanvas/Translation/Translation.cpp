@@ -13,6 +13,8 @@
 #include "precompiled.h"
 #include "Translation.h"
 
+#if !defined(_RELEASE)
+
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
 #include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
 #include <ScriptCanvas/Translation/GraphToLua.h>
@@ -132,4 +134,6 @@ namespace ScriptCanvas
         }
 
     } // namespace Translation
-} // namespace ScriptCanvas
\ No newline at end of file
+} // namespace ScriptCanvas
+
+#endif
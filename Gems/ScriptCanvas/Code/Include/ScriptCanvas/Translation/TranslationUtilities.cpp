@@ -13,10 +13,13 @@
 #include "precompiled.h"
 #include "TranslationUtilities.h"
 
+#if !defined(_RELEASE)
+
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/FileIOEventBus.h>
 #include <AzFramework/API/ApplicationAPI.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ctype.h>
 #include <stdarg.h> 
 
 namespace TranslationUtilitiesCPP
@@ -174,6 +177,24 @@ namespace ScriptCanvas
         {
             return TranslationUtilitiesCPP::k_namespaceNameNative;
         }
+
+        AZStd::string ToIdentifier(AZStd::string_view name)
+        {
+            AZStd::string identifier;
+            identifier.reserve(name.size() + 1);
+
+            if (name.empty() || isdigit(static_cast<unsigned char>(name[0])))
+            {
+                identifier.push_back('_');
+            }
+
+            for (char character : name)
+            {
+                identifier.push_back(isalnum(static_cast<unsigned char>(character)) ? character : '_');
+            }
+
+            return identifier;
+        }
                 
         AZ::Outcome<void, AZStd::string> SaveDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP)
         {
@@ -269,4 +290,6 @@ namespace ScriptCanvas
 
     } // namespace Translation
 
-} // namespace ScriptCanvas
\ No newline at end of file
+} // namespace ScriptCanvas
+
+#endif
@@ -35,6 +35,9 @@ namespace ScriptCanvas
 
         const char* GetAutoNativeNamespace();
 
+        // replaces every character that can't appear in an identifier with an underscore, and makes sure it doesn't start with a digit
+        AZStd::string ToIdentifier(AZStd::string_view name);
+
         AZ::Outcome<void, AZStd::string> SaveDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP);
 
         AZ::Outcome<void, AZStd::string> SaveDotH(const Grammar::Source& source, AZStd::string_view dotH);
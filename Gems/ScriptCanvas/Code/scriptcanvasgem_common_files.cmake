@@ -137,6 +137,16 @@ set(FILES
     Include/ScriptCanvas/Internal/Nodes/StringFormatted.ScriptCanvasNode.xml
     Include/ScriptCanvas/Grammar/AbstractCodeModel.cpp
     Include/ScriptCanvas/Grammar/AbstractCodeModel.h
+    Include/ScriptCanvas/Translation/GraphToCPlusPlus.cpp
+    Include/ScriptCanvas/Translation/GraphToCPlusPlus.h
+    Include/ScriptCanvas/Translation/GraphToLua.cpp
+    Include/ScriptCanvas/Translation/GraphToLua.h
+    Include/ScriptCanvas/Translation/GraphToX.cpp
+    Include/ScriptCanvas/Translation/GraphToX.h
+    Include/ScriptCanvas/Translation/Translation.cpp
+    Include/ScriptCanvas/Translation/Translation.h
+    Include/ScriptCanvas/Translation/TranslationUtilities.cpp
+    Include/ScriptCanvas/Translation/TranslationUtilities.h
     Include/ScriptCanvas/Libraries/Libraries.h
     Include/ScriptCanvas/Libraries/Libraries.cpp
     Include/ScriptCanvas/Libraries/Core/BehaviorContextObjectNode.cpp
@@ -413,4 +413,26 @@ namespace ScriptCanvasTests
         AZStd::unordered_set< AZ::ComponentDescriptor* > m_descriptors;
         
     };
+
+#if defined(HAVE_BENCHMARK)
+    //! Starts the application the tests share for the benchmarks, which don't run through the test fixture.
+    class ScriptCanvasBenchmarkEnvironment
+        : public AZ::Test::BenchmarkEnvironmentBase
+        , private ScriptCanvasTestFixture
+    {
+    protected:
+        void SetUpBenchmark() override
+        {
+            SetUpTestCase();
+        }
+
+        void TearDownBenchmark() override
+        {
+            TearDownTestCase();
+        }
+
+    private:
+        void TestBody() override {}
+    };
+#endif // HAVE_BENCHMARK
 }
@@ -11,4 +11,14 @@
 */
 #include <AzTest/AzTest.h>
 
+#if defined(HAVE_BENCHMARK)
+
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+
+AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV, ScriptCanvasTests::ScriptCanvasBenchmarkEnvironment);
+
+#else
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
+
+#endif // HAVE_BENCHMARK
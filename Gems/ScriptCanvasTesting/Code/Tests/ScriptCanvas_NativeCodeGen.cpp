@@ -0,0 +1,277 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+#include <AzCore/Component/EntityUtils.h>
+#include <ScriptCanvas/Core/SignalBus.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+#include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Libraries/Core/GetVariable.h>
+#include <ScriptCanvas/Libraries/Core/SetVariable.h>
+#include <ScriptCanvas/Libraries/Operators/Math/OperatorAdd.h>
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
+#include <ScriptCanvas/Variable/VariableBus.h>
+
+namespace ScriptCanvasTests
+{
+    using namespace ScriptCanvas;
+
+    static const char* k_additionChainGraphName = "NativeCodeGenBenchmark";
+    static const int k_additionCount = 8;
+
+    //! Start -> Get Counter -> (Add 1) x k_additionCount -> Set Counter
+    AZStd::unique_ptr<AZ::Entity> CreateAdditionChainGraph(AZ::EntityId& startIdOut)
+    {
+        AZStd::unique_ptr<AZ::Entity> graphEntity = AZStd::make_unique<AZ::Entity>(k_additionChainGraphName);
+        SystemRequestBus::Broadcast(&SystemRequests::CreateEngineComponentsOnEntity, graphEntity.get());
+        Graph* graph = AZ::EntityUtils::FindFirstDerivedComponent<Graph>(graphEntity.get());
+        const ScriptCanvasId graphUniqueId = graph->GetScriptCanvasId();
+        graphEntity->Init();
+
+        AZ::Outcome<VariableId, AZStd::string> addVariableOutcome(AZ::Failure(AZStd::string("Uninitialized")));
+        GraphVariableManagerRequestBus::EventResult(addVariableOutcome, graphUniqueId, &GraphVariableManagerRequests::AddVariable, "Counter", Datum(Data::NumberType(0.0)));
+        EXPECT_TRUE(addVariableOutcome);
+        const VariableId counterId = addVariableOutcome.GetValue();
+
+        AZ::EntityId nodeId;
+        CreateTestNode<Nodes::Core::Start>(graphUniqueId, startIdOut);
+
+        auto getCounter = CreateTestNode<Nodes::Core::GetVariableNode>(graphUniqueId, nodeId);
+        getCounter->SetId(counterId);
+        EXPECT_TRUE(Connect(*graph, startIdOut, "Out", getCounter->GetEntityId(), "In"));
+
+        Endpoint value(getCounter->GetEntityId(), getCounter->GetDataOutSlotId());
+        AZ::EntityId previousNodeId = getCounter->GetEntityId();
+
+        for (int i = 0; i < k_additionCount; ++i)
+        {
+            auto add = CreateTestNode<Nodes::Operators::OperatorAdd>(graphUniqueId, nodeId);
+            Node* one = CreateDataNode(graphUniqueId, Data::NumberType(1.0), nodeId);
+
+            AZStd::vector<SlotId> inputSlotIds;
+            SlotId resultSlotId;
+            for (Slot* slot : add->GetSlotsWithDynamicGroup(add->GetArithmeticDynamicTypeGroup()))
+            {
+                if (slot->IsInput())
+                {
+                    inputSlotIds.push_back(slot->GetId());
+                }
+                else
+                {
+                    resultSlotId = slot->GetId();
+                }
+            }
+
+            EXPECT_EQ(size_t(2), inputSlotIds.size());
+            EXPECT_TRUE(graph->Connect(value.GetNodeId(), value.GetSlotId(), add->GetEntityId(), inputSlotIds[0]));
+            EXPECT_TRUE(graph->Connect(one->GetEntityId(), one->GetSlotId("Get"), add->GetEntityId(), inputSlotIds[1]));
+            EXPECT_TRUE(Connect(*graph, previousNodeId, "Out", add->GetEntityId(), "In"));
+
+            value = Endpoint(add->GetEntityId(), resultSlotId);
+            previousNodeId = add->GetEntityId();
+        }
+
+        auto setCounter = CreateTestNode<Nodes::Core::SetVariableNode>(graphUniqueId, nodeId);
+        setCounter->SetId(counterId);
+        EXPECT_TRUE(graph->Connect(value.GetNodeId(), value.GetSlotId(), setCounter->GetEntityId(), setCounter->GetDataInSlotId()));
+        EXPECT_TRUE(Connect(*graph, previousNodeId, "Out", setCounter->GetEntityId(), "In"));
+
+        return graphEntity;
+    }
+
+    //! What GraphToCPlusPlus generates for CreateAdditionChainGraph, checked in so the benchmarks don't depend on
+    //! building the generated files into a module.
+    class NativeCodeGenBenchmark
+    {
+    public: static void OnGraphStart(const RuntimeContext& context);
+    public: void OnStart(const RuntimeContext& context);
+    private: double m_Counter = 0.0;
+    };
+
+    void NativeCodeGenBenchmark::OnStart([[maybe_unused]] const RuntimeContext& context)
+    {
+        // Get Variable
+        const double l_Number0 = m_Counter;
+        // Add
+        const double l_Result1 = l_Number0 + 1.0;
+        // Add
+        const double l_Result2 = l_Result1 + 1.0;
+        // Add
+        const double l_Result3 = l_Result2 + 1.0;
+        // Add
+        const double l_Result4 = l_Result3 + 1.0;
+        // Add
+        const double l_Result5 = l_Result4 + 1.0;
+        // Add
+        const double l_Result6 = l_Result5 + 1.0;
+        // Add
+        const double l_Result7 = l_Result6 + 1.0;
+        // Add
+        const double l_Result8 = l_Result7 + 1.0;
+        // Set Variable
+        m_Counter = l_Result8;
+    }
+
+    void NativeCodeGenBenchmark::OnGraphStart(const RuntimeContext& context)
+    {
+        NativeCodeGenBenchmark graph;
+        graph.OnStart(context);
+    }
+
+    AZ::Outcome<Grammar::Source, AZStd::string> ConstructSource(const AZ::Entity& graphEntity)
+    {
+        const Graph* graph = AZ::EntityUtils::FindFirstDerivedComponent<Graph>(&graphEntity);
+        return Grammar::Source::Construct(*graph, k_additionChainGraphName, "ScriptCanvas/Benchmarks/");
+    }
+
+    TEST_F(ScriptCanvasTestFixture, NativeCodeGen_TranslatesAdditionChain)
+    {
+        AZ::EntityId startId;
+        AZStd::unique_ptr<AZ::Entity> graphEntity = CreateAdditionChainGraph(startId);
+
+        AZ::Outcome<Grammar::Source, AZStd::string> sourceOutcome = ConstructSource(*graphEntity);
+        ASSERT_TRUE(sourceOutcome.IsSuccess());
+
+        const Grammar::AbstractCodeModel model(sourceOutcome.GetValue());
+        ASSERT_TRUE(model.GetOutcome().IsSuccess()) << model.GetOutcome().GetError().c_str();
+
+        AZStd::string dotH, dotCPP;
+        auto outcome = Translation::GraphToCPlusPlus::Translate(model, dotH, dotCPP);
+        ASSERT_TRUE(outcome.IsSuccess()) << outcome.GetError().c_str();
+
+        EXPECT_NE(AZStd::string::npos, dotH.find("class NativeCodeGenBenchmark"));
+        EXPECT_NE(AZStd::string::npos, dotH.find("private: double m_Counter = 0.0;"));
+        EXPECT_NE(AZStd::string::npos, dotCPP.find("const double l_Number0 = m_Counter;"));
+        EXPECT_NE(AZStd::string::npos, dotCPP.find("const double l_Result1 = l_Number0 + 1.0;"));
+        EXPECT_NE(AZStd::string::npos, dotCPP.find("m_Counter = l_Result8;"));
+        EXPECT_NE(AZStd::string::npos, dotCPP.find("RegisterNativeGraphStart(\"scriptcanvas/benchmarks/nativecodegenbenchmark\", &NativeCodeGenBenchmark::OnGraphStart);"));
+    }
+
+    TEST_F(ScriptCanvasTestFixture, NativeCodeGen_BranchingExecution_IsNotTranslated)
+    {
+        AZStd::unique_ptr<AZ::Entity> graphEntity = AZStd::make_unique<AZ::Entity>("NativeCodeGenBranching");
+        SystemRequestBus::Broadcast(&SystemRequests::CreateEngineComponentsOnEntity, graphEntity.get());
+        Graph* graph = AZ::EntityUtils::FindFirstDerivedComponent<Graph>(graphEntity.get());
+        const ScriptCanvasId graphUniqueId = graph->GetScriptCanvasId();
+        graphEntity->Init();
+
+        AZ::Outcome<VariableId, AZStd::string> addVariableOutcome(AZ::Failure(AZStd::string("Uninitialized")));
+        GraphVariableManagerRequestBus::EventResult(addVariableOutcome, graphUniqueId, &GraphVariableManagerRequests::AddVariable, "Counter", Datum(Data::NumberType(0.0)));
+        ASSERT_TRUE(addVariableOutcome);
+
+        AZ::EntityId startId;
+        CreateTestNode<Nodes::Core::Start>(graphUniqueId, startId);
+
+        for (int i = 0; i < 2; ++i)
+        {
+            AZ::EntityId nodeId;
+            auto getCounter = CreateTestNode<Nodes::Core::GetVariableNode>(graphUniqueId, nodeId);
+            getCounter->SetId(addVariableOutcome.GetValue());
+            EXPECT_TRUE(Connect(*graph, startId, "Out", nodeId, "In"));
+        }
+
+        AZ::Outcome<Grammar::Source, AZStd::string> sourceOutcome = Grammar::Source::Construct(*graph, "NativeCodeGenBranching", "");
+        ASSERT_TRUE(sourceOutcome.IsSuccess());
+
+        const Grammar::AbstractCodeModel model(sourceOutcome.GetValue());
+        EXPECT_FALSE(model.GetOutcome().IsSuccess());
+    }
+
+    TEST_F(ScriptCanvasTestFixture, NativeCodeGen_RegisteredGraphStart_IsCalledByName)
+    {
+        EXPECT_TRUE(RegisterNativeGraphStart(k_additionChainGraphName, &NativeCodeGenBenchmark::OnGraphStart));
+        EXPECT_FALSE(RegisterNativeGraphStart(k_additionChainGraphName, &NativeCodeGenBenchmark::OnGraphStart));
+
+        const RuntimeContext context{ AZ::EntityId() };
+        EXPECT_TRUE(CallNativeGraphStart(k_additionChainGraphName, context));
+        EXPECT_FALSE(CallNativeGraphStart("NativeCodeGenMissing", context));
+
+        EXPECT_TRUE(UnregisterNativeGraphStart(k_additionChainGraphName));
+        EXPECT_FALSE(CallNativeGraphStart(k_additionChainGraphName, context));
+    }
+
+    TEST_F(ScriptCanvasTestFixture, NativeCodeGen_GraphStartName_MatchesSourceAndRuntimeAssetPaths)
+    {
+        EXPECT_EQ(GetNativeGraphStartName("ScriptCanvas/Benchmarks/NativeCodeGenBenchmark.scriptcanvas"), "scriptcanvas/benchmarks/nativecodegenbenchmark");
+        EXPECT_EQ(GetNativeGraphStartName("scriptcanvas\\benchmarks\\nativecodegenbenchmark.scriptcanvas_compiled"), "scriptcanvas/benchmarks/nativecodegenbenchmark");
+        EXPECT_EQ(GetNativeGraphStartName("scriptcanvas.v2/nativecodegenbenchmark"), "scriptcanvas.v2/nativecodegenbenchmark");
+    }
+
+    TEST_F(ScriptCanvasTestFixture, NativeCodeGen_GraphsWithTheSameFileName_AreRegisteredSeparately)
+    {
+        const AZStd::string firstName = GetNativeGraphStartName("scriptcanvas/first/nativecodegenbenchmark.scriptcanvas_compiled");
+        const AZStd::string secondName = GetNativeGraphStartName("scriptcanvas/second/nativecodegenbenchmark.scriptcanvas_compiled");
+        EXPECT_NE(firstName, secondName);
+
+        EXPECT_TRUE(RegisterNativeGraphStart(firstName, &NativeCodeGenBenchmark::OnGraphStart));
+        EXPECT_TRUE(RegisterNativeGraphStart(secondName, &NativeCodeGenBenchmark::OnGraphStart));
+
+        EXPECT_TRUE(UnregisterNativeGraphStart(firstName));
+
+        const RuntimeContext context{ AZ::EntityId() };
+        EXPECT_FALSE(CallNativeGraphStart(firstName, context));
+        EXPECT_TRUE(CallNativeGraphStart(secondName, context));
+
+        EXPECT_TRUE(UnregisterNativeGraphStart(secondName));
+    }
+} // namespace ScriptCanvasTests
+
+#if defined(HAVE_BENCHMARK)
+
+namespace Benchmark
+{
+    using namespace ScriptCanvas;
+    using namespace ScriptCanvasTests;
+
+    //! Compares running the same graph through the interpreter and through the code generated from it.
+    class BM_NativeCodeGen
+        : public ::benchmark::Fixture
+    {
+    };
+
+    BENCHMARK_DEFINE_F(BM_NativeCodeGen, Interpreted)(benchmark::State& state)
+    {
+        AZ::EntityId startId;
+        AZStd::unique_ptr<AZ::Entity> graphEntity = CreateAdditionChainGraph(startId);
+        graphEntity->Activate();
+
+        for (auto _ : state)
+        {
+            // the start node signals its output whatever the input, which runs the graph again
+            SignalBus::Event(startId, &SignalInterface::SignalInput, SlotId());
+        }
+
+        graphEntity->Deactivate();
+        state.SetItemsProcessed(state.iterations() * k_additionCount);
+    }
+
+    BENCHMARK_DEFINE_F(BM_NativeCodeGen, Compiled)(benchmark::State& state)
+    {
+        const RuntimeContext context{ AZ::EntityId() };
+        NativeCodeGenBenchmark graph;
+
+        for (auto _ : state)
+        {
+            graph.OnStart(context);
+            benchmark::DoNotOptimize(graph);
+        }
+
+        state.SetItemsProcessed(state.iterations() * k_additionCount);
+    }
+
+    BENCHMARK_REGISTER_F(BM_NativeCodeGen, Interpreted)->Unit(benchmark::kNanosecond);
+    BENCHMARK_REGISTER_F(BM_NativeCodeGen, Compiled)->Unit(benchmark::kNanosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
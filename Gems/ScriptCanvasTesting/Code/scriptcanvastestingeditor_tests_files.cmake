@@ -26,6 +26,7 @@ set(FILES
     Tests/ScriptCanvas_Slots.cpp
     Tests/ScriptCanvas_EventHandlers.cpp
     Tests/ScriptCanvas_Math.cpp
+    Tests/ScriptCanvas_NativeCodeGen.cpp
     Tests/ScriptCanvas_NodeGenerics.cpp
     Tests/ScriptCanvas_OutcomeAutoUnpacking.cpp
     Tests/ScriptCanvas_Regressions.cpp
@@ -15,6 +15,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointBuffer.h>
 
 namespace SurfaceData
 {
@@ -36,6 +37,19 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Adds tag weights to the points in surfacePoints listed in pointIndices, which have already been filtered to the modifier's bounds.
+        //! Modifiers should override this to annotate a whole region at once; the default modifies point by point.
+        virtual void ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<AZ::u32>& pointIndices) const
+        {
+            SurfacePointList pointList(1);
+            for (AZ::u32 pointIndex : pointIndices)
+            {
+                surfacePoints.GetSurfacePoint(pointIndex, pointList.front());
+                ModifySurfacePoints(pointList);
+                surfacePoints.AddMaskValues(pointIndex, pointList.front().m_masks);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
@@ -14,6 +14,7 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointBuffer.h>
 
 namespace SurfaceData
 {
@@ -35,6 +36,22 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Appends the surface points for every position in inPositions to surfacePoints, tagged with the index of the input position
+        //! that generated them.  Providers should override this to query a whole region at once; the default queries point by point.
+        virtual void GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+        {
+            SurfacePointList pointList;
+            for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
+            {
+                pointList.clear();
+                GetSurfacePoints(inPositions[inPositionIndex], pointList);
+                for (const auto& point : pointList)
+                {
+                    surfacePoints.AddPoint(inPositionIndex, point);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
@@ -17,6 +17,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector2.h>
 #include <SurfaceData/SurfaceDataTypes.h>
+#include <SurfaceData/SurfacePointBuffer.h>
 
 namespace SurfaceData
 {
@@ -45,6 +46,21 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Same as GetSurfacePointsFromRegion, but fills a SurfacePointBuffer instead of allocating a SurfacePointList per position.
+        // The input positions are returned in inPositions, and surfacePoints has its point ranges built for them, so the points for
+        // inPositions[i] can be retrieved with surfacePoints.GetPointRange(i, ...).  Both outputs can be reused across queries.
+        virtual void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+                                                     AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const = 0;
+
+        // Same as GetSurfacePointsFromList, but fills a SurfacePointBuffer with point ranges built for each entry of inPositions.
+        virtual void GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags,
+                                                   SurfacePointBuffer& surfacePoints) const = 0;
+
+        // Get all surface points for every position in inPositions that match one or more of the desiredTags.  Only the XY components of
+        // each position are used.  The output contains one entry per input position, in the same order as inPositions.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags,
+                                              SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
@@ -0,0 +1,243 @@
+/*
+* All or portions of this file Copyright (c) Amazon.com, Inc. or its affiliates or
+* its licensors.
+*
+* For complete copyright and license terms please see the LICENSE at the root of this
+* distribution (the "License"). All use of this software is governed by the License,
+* or, if provided, by the license below or the license accompanying this file. Do not
+* remove or modify any license notices. This file is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+*/
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <SurfaceData/SurfaceDataTypes.h>
+
+namespace SurfaceData
+{
+    /**
+    * Structure-of-arrays storage for the surface points generated by a batch of input positions.
+    * Every point records the index of the input position that generated it.  The positions, normals and
+    * entity ids of all the points are stored in contiguous arrays, and the tag weights of all the points share
+    * one set of arrays in which each point's tags form a linked list.  Once the buffer has grown to the size of
+    * a typical query, it can be cleared and refilled without any further allocations.
+    */
+    class SurfacePointBuffer final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfacePointBuffer, AZ::SystemAllocator, 0);
+
+        static constexpr AZ::u32 InvalidIndex = AZStd::numeric_limits<AZ::u32>::max();
+
+        //! Removes all the points and point ranges, but keeps the allocated storage for reuse.
+        void Clear()
+        {
+            m_inPositionIndices.clear();
+            m_entityIds.clear();
+            m_positions.clear();
+            m_normals.clear();
+            m_firstMaskIndices.clear();
+            m_maskTags.clear();
+            m_maskValues.clear();
+            m_nextMaskIndices.clear();
+            m_inPositionPointOffsets.clear();
+        }
+
+        void Reserve(size_t pointCount, size_t maskCount)
+        {
+            m_inPositionIndices.reserve(pointCount);
+            m_entityIds.reserve(pointCount);
+            m_positions.reserve(pointCount);
+            m_normals.reserve(pointCount);
+            m_firstMaskIndices.reserve(pointCount);
+            m_maskTags.reserve(maskCount);
+            m_maskValues.reserve(maskCount);
+            m_nextMaskIndices.reserve(maskCount);
+        }
+
+        //! Adds a point generated by the input position at inPositionIndex, and returns the index of the new point.
+        size_t AddPoint(size_t inPositionIndex, const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal)
+        {
+            m_inPositionIndices.push_back(static_cast<AZ::u32>(inPositionIndex));
+            m_entityIds.push_back(entityId);
+            m_positions.push_back(position);
+            m_normals.push_back(normal);
+            m_firstMaskIndices.push_back(InvalidIndex);
+            return m_positions.size() - 1;
+        }
+
+        //! Adds a copy of a point from another buffer, including all of its tag weights.
+        size_t AddPoint(size_t inPositionIndex, const SurfacePointBuffer& source, size_t sourcePointIndex)
+        {
+            const size_t pointIndex = AddPoint(inPositionIndex, source.GetEntityId(sourcePointIndex), source.GetPosition(sourcePointIndex), source.GetNormal(sourcePointIndex));
+            AddMaskValues(pointIndex, source, sourcePointIndex);
+            return pointIndex;
+        }
+
+        //! Adds a point in the SurfacePoint format.
+        size_t AddPoint(size_t inPositionIndex, const SurfacePoint& point)
+        {
+            const size_t pointIndex = AddPoint(inPositionIndex, point.m_entityId, point.m_position, point.m_normal);
+            AddMaskValues(pointIndex, point.m_masks);
+            return pointIndex;
+        }
+
+        //! Adds a tag weight to a point.  If the point already has the tag, the larger of the two weights is kept.
+        void AddMaskValue(size_t pointIndex, AZ::Crc32 tag, float value)
+        {
+            for (AZ::u32 maskIndex = m_firstMaskIndices[pointIndex]; maskIndex != InvalidIndex; maskIndex = m_nextMaskIndices[maskIndex])
+            {
+                if (m_maskTags[maskIndex] == tag)
+                {
+                    m_maskValues[maskIndex] = AZ::GetMax(value, m_maskValues[maskIndex]);
+                    return;
+                }
+            }
+
+            m_maskTags.push_back(tag);
+            m_maskValues.push_back(value);
+            m_nextMaskIndices.push_back(m_firstMaskIndices[pointIndex]);
+            m_firstMaskIndices[pointIndex] = static_cast<AZ::u32>(m_maskTags.size() - 1);
+        }
+
+        void AddMaskValues(size_t pointIndex, const SurfaceTagVector& tags, float value)
+        {
+            for (const auto& tag : tags)
+            {
+                AddMaskValue(pointIndex, tag, value);
+            }
+        }
+
+        void AddMaskValues(size_t pointIndex, const SurfaceTagWeightMap& masks)
+        {
+            for (const auto& mask : masks)
+            {
+                AddMaskValue(pointIndex, mask.first, mask.second);
+            }
+        }
+
+        void AddMaskValues(size_t pointIndex, const SurfacePointBuffer& source, size_t sourcePointIndex)
+        {
+            source.EnumerateMasks(sourcePointIndex, [this, pointIndex](AZ::Crc32 tag, float value)
+            {
+                AddMaskValue(pointIndex, tag, value);
+            });
+        }
+
+        //! Calls fn(AZ::Crc32 tag, float value) for each tag weight on the point.
+        template<typename Fn>
+        void EnumerateMasks(size_t pointIndex, Fn&& fn) const
+        {
+            for (AZ::u32 maskIndex = m_firstMaskIndices[pointIndex]; maskIndex != InvalidIndex; maskIndex = m_nextMaskIndices[maskIndex])
+            {
+                fn(m_maskTags[maskIndex], m_maskValues[maskIndex]);
+            }
+        }
+
+        bool HasMasks(size_t pointIndex) const
+        {
+            return m_firstMaskIndices[pointIndex] != InvalidIndex;
+        }
+
+        bool HasMatchingTag(size_t pointIndex, AZ::Crc32 sampleTag) const
+        {
+            for (AZ::u32 maskIndex = m_firstMaskIndices[pointIndex]; maskIndex != InvalidIndex; maskIndex = m_nextMaskIndices[maskIndex])
+            {
+                if (m_maskTags[maskIndex] == sampleTag)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<typename SampleContainer>
+        bool HasMatchingTags(size_t pointIndex, const SampleContainer& sampleTags) const
+        {
+            for (const auto& sampleTag : sampleTags)
+            {
+                if (HasMatchingTag(pointIndex, sampleTag))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //! Copies a point out into the SurfacePoint format.
+        void GetSurfacePoint(size_t pointIndex, SurfacePoint& point) const
+        {
+            point.m_entityId = m_entityIds[pointIndex];
+            point.m_position = m_positions[pointIndex];
+            point.m_normal = m_normals[pointIndex];
+            point.m_masks.clear();
+            EnumerateMasks(pointIndex, [&point](AZ::Crc32 tag, float value)
+            {
+                point.m_masks[tag] = value;
+            });
+        }
+
+        size_t GetPointCount() const { return m_positions.size(); }
+        bool IsEmpty() const { return m_positions.empty(); }
+
+        size_t GetInPositionIndex(size_t pointIndex) const { return m_inPositionIndices[pointIndex]; }
+        void SetInPositionIndex(size_t pointIndex, size_t inPositionIndex) { m_inPositionIndices[pointIndex] = static_cast<AZ::u32>(inPositionIndex); }
+        const AZ::EntityId& GetEntityId(size_t pointIndex) const { return m_entityIds[pointIndex]; }
+        const AZ::Vector3& GetPosition(size_t pointIndex) const { return m_positions[pointIndex]; }
+        const AZ::Vector3& GetNormal(size_t pointIndex) const { return m_normals[pointIndex]; }
+
+        //! Builds the table used by GetPointRange().  The points must already be grouped by input position, in increasing order.
+        void BuildPointRanges(size_t inPositionCount)
+        {
+            m_inPositionPointOffsets.clear();
+            m_inPositionPointOffsets.resize(inPositionCount + 1, 0);
+
+            size_t pointIndex = 0;
+            for (size_t inPositionIndex = 0; inPositionIndex < inPositionCount; inPositionIndex++)
+            {
+                m_inPositionPointOffsets[inPositionIndex] = static_cast<AZ::u32>(pointIndex);
+                while ((pointIndex < m_inPositionIndices.size()) && (m_inPositionIndices[pointIndex] == inPositionIndex))
+                {
+                    pointIndex++;
+                }
+            }
+            m_inPositionPointOffsets[inPositionCount] = static_cast<AZ::u32>(pointIndex);
+
+            AZ_Assert(pointIndex == m_inPositionIndices.size(), "Surface points aren't grouped by input position.");
+        }
+
+        //! Gets the number of input positions that point ranges were built for.
+        size_t GetInPositionCount() const { return m_inPositionPointOffsets.empty() ? 0 : (m_inPositionPointOffsets.size() - 1); }
+
+        //! Gets the [begin, end) range of points that were generated by one input position.  Requires BuildPointRanges().
+        void GetPointRange(size_t inPositionIndex, size_t& beginPointIndex, size_t& endPointIndex) const
+        {
+            beginPointIndex = m_inPositionPointOffsets[inPositionIndex];
+            endPointIndex = m_inPositionPointOffsets[inPositionIndex + 1];
+        }
+
+    private:
+        // Per-point data
+        AZStd::vector<AZ::u32> m_inPositionIndices;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<AZ::u32> m_firstMaskIndices;
+
+        // Per-tag-weight data, shared by all the points
+        AZStd::vector<AZ::Crc32> m_maskTags;
+        AZStd::vector<float> m_maskValues;
+        AZStd::vector<AZ::u32> m_nextMaskIndices;
+
+        // Offsets of the first point for each input position, plus a final entry with the total point count
+        AZStd::vector<AZ::u32> m_inPositionPointOffsets;
+    };
+}
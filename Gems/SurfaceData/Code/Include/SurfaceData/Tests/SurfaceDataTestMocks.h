@@ -198,6 +198,42 @@ namespace UnitTest
         {
         }
 
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointListPerPosition& surfacePointListPerPosition) const override
+        {
+            surfacePointListPerPosition.clear();
+            for (const AZ::Vector3& position : inPositions)
+            {
+                surfacePointListPerPosition.emplace_back(position, SurfaceData::SurfacePointList{});
+                GetSurfacePoints(position, desiredTags, surfacePointListPerPosition.back().second);
+            }
+
+        void GetSurfacePointBufferFromRegion([[maybe_unused]] const AZ::Aabb& inRegion, [[maybe_unused]] const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointBuffer& surfacePoints) const override
+        {
+            inPositions.clear();
+            surfacePoints.Clear();
+            surfacePoints.BuildPointRanges(0);
+        }
+
+        void GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointBuffer& surfacePoints) const override
+        {
+            surfacePoints.Clear();
+            SurfaceData::SurfacePointList surfacePointList;
+            for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
+            {
+                surfacePointList.clear();
+                GetSurfacePoints(inPositions[inPositionIndex], desiredTags, surfacePointList);
+                for (const auto& point : surfacePointList)
+                {
+                    surfacePoints.AddPoint(inPositionIndex, point);
+                }
+            }
+            surfacePoints.BuildPointRanges(inPositions.size());
+        }
+        }
+
         SurfaceData::SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceData::SurfaceDataRegistryEntry& entry) override
         {
             return RegisterEntry(entry, m_providers);
@@ -255,6 +255,30 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Hold the lock for the whole list so the per-position ray traces don't contend on it.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        const AZ::EntityId entityId = GetEntityId();
+        AZ::Vector3 hitPosition;
+        AZ::Vector3 hitNormal;
+
+        // We want a full raycast, so don't just query the start point.
+        constexpr bool queryPointOnly = false;
+
+        for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
+        {
+            if (DoRayTrace(inPositions[inPositionIndex], queryPointOnly, hitPosition, hitNormal))
+            {
+                const size_t pointIndex = surfacePoints.AddPoint(inPositionIndex, entityId, hitPosition, hitNormal);
+                surfacePoints.AddMaskValues(pointIndex, m_configuration.m_providerTags, 1.0f);
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -280,6 +304,31 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<AZ::u32>& pointIndices) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_colliderBounds.IsValid() && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            AZ::Vector3 hitPosition;
+            AZ::Vector3 hitNormal;
+            constexpr bool queryPointOnly = true;
+
+            for (AZ::u32 pointIndex : pointIndices)
+            {
+                const AZ::Vector3& position = surfacePoints.GetPosition(pointIndex);
+                if (surfacePoints.GetEntityId(pointIndex) != entityId && m_colliderBounds.Contains(position) &&
+                    DoRayTrace(position, queryPointOnly, hitPosition, hitNormal))
+                {
+                    surfacePoints.AddMaskValues(pointIndex, m_configuration.m_modifierTags, 1.0f);
+                }
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::OnCompositionChanged()
     {
         if (!m_refresh)
@@ -85,10 +85,12 @@ namespace SurfaceData
         ////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<AZ::u32>& pointIndices) const override;
 
     private:
         bool DoRayTrace(const AZ::Vector3& inPosition, bool queryPointOnly, AZ::Vector3& outPosition, AZ::Vector3& outNormal) const;
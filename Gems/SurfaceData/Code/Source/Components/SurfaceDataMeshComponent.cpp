@@ -187,6 +187,45 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataMeshComponent::GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Take the lock and resolve the mesh once for the whole list instead of once per position.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        LmbrCentral::MeshAsset* mesh = m_meshAssetData.GetAs<LmbrCentral::MeshAsset>();
+        if (!mesh)
+        {
+            return;
+        }
+
+        const AZ::EntityId entityId = GetEntityId();
+        const float testHeight = (m_meshBounds.GetMax().GetZ() + m_meshBounds.GetMin().GetZ()) * 0.5f;
+        const float rayOriginHeight = m_meshBounds.GetMax().GetZ() + s_rayAABBHeightPadding;
+        const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+
+        AZ::Vector3 hitPosition;
+        AZ::Vector3 hitNormal;
+        for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
+        {
+            const AZ::Vector3& inPosition = inPositions[inPositionIndex];
+
+            // test AABB as first pass to claim the point
+            if (!m_meshBounds.Contains(AZ::Vector3(inPosition.GetX(), inPosition.GetY(), testHeight)))
+            {
+                continue;
+            }
+
+            const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), rayOriginHeight);
+            if (GetMeshRayIntersection(*mesh, m_meshWorldTM, m_meshWorldTMInverse, rayOrigin, rayDirection, hitPosition, hitNormal))
+            {
+                const size_t pointIndex = surfacePoints.AddPoint(inPositionIndex, entityId, hitPosition, hitNormal);
+                surfacePoints.AddMaskValues(pointIndex, m_configuration.m_tags, 1.0f);
+            }
+        }
+    }
+
     AZ::Aabb SurfaceDataMeshComponent::GetSurfaceAabb() const
     {
         return m_meshBounds;
@@ -86,6 +86,7 @@ namespace SurfaceData
         ////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const override;
 
     private:
         bool DoRayTrace(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, AZ::Vector3& outNormal) const;
@@ -171,6 +171,40 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            const float rayOriginHeight = m_shapeBounds.GetMax().GetZ();
+            const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+            const AZ::Vector3 normal = AZ::Vector3::CreateAxisZ();
+            const SurfaceTagVector& providerTags = m_configuration.m_providerTags;
+
+            // Look up the shape once for the whole list instead of dispatching an IntersectRay event per position.
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(entityId,
+                [&](LmbrCentral::ShapeComponentRequests* shapeRequests)
+                {
+                    for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
+                    {
+                        const AZ::Vector3& inPosition = inPositions[inPositionIndex];
+                        const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), rayOriginHeight);
+                        float intersectionDistance = 0.0f;
+                        if (shapeRequests->IntersectRay(rayOrigin, rayDirection, intersectionDistance))
+                        {
+                            const size_t pointIndex = surfacePoints.AddPoint(inPositionIndex, entityId, rayOrigin + intersectionDistance * rayDirection, normal);
+                            surfacePoints.AddMaskValues(pointIndex, providerTags, 1.0f);
+                        }
+                    }
+                    return false;
+                });
+        }
+    }
+
     void SurfaceDataShapeComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -195,6 +229,34 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::ModifySurfacePointBuffer(SurfacePointBuffer& surfacePoints, const AZStd::vector<AZ::u32>& pointIndices) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            const SurfaceTagVector& modifierTags = m_configuration.m_modifierTags;
+
+            LmbrCentral::ShapeComponentRequestsBus::EnumerateHandlersId(entityId,
+                [&](LmbrCentral::ShapeComponentRequests* shapeRequests)
+                {
+                    for (AZ::u32 pointIndex : pointIndices)
+                    {
+                        const AZ::Vector3& position = surfacePoints.GetPosition(pointIndex);
+                        if (surfacePoints.GetEntityId(pointIndex) != entityId && m_shapeBounds.Contains(position) &&
+                            shapeRequests->IsPointInside(position))
+                        {
+                            surfacePoints.AddMaskValues(pointIndex, modifierTags, 1.0f);
+                        }
+                    }
+                    return false;
+                });
+        }
+    }
+
     void SurfaceDataShapeComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         OnCompositionChanged();
@@ -238,44 +238,112 @@ namespace SurfaceData
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
-        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        AZStd::vector<AZ::Vector3> inPositions;
+        SurfacePointBuffer surfacePoints;
+        GetSurfacePointBufferFromRegion(inRegion, stepSize, desiredTags, inPositions, surfacePoints);
+        ConvertToSurfacePointListPerPosition(inPositions, surfacePoints, surfacePointListPerPosition);
+    }
 
-        surfacePointListPerPosition.clear();
-        surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+    void SurfaceDataSystemComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        SurfacePointBuffer surfacePoints;
+        GetSurfacePointBufferFromList(inPositions, desiredTags, surfacePoints);
+        ConvertToSurfacePointListPerPosition(inPositions, surfacePoints, surfacePointListPerPosition);
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
-        // Initialize our list-per-position list with every input position to query from the region.
+        inPositions.clear();
+        inPositions.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+
+        // Initialize our input position list with every position to query from the region.
         // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
         for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
         {
             for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
             {
-                surfacePointListPerPosition.emplace_back(AZ::Vector3(x, y, AZ::Constants::FloatMax), SurfaceData::SurfacePointList{});
+                inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
             }
         }
 
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        GetSurfacePointBufferForPositions(inRegion, inPositions, desiredTags, surfacePoints);
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Gather the bounds of all the input positions so that providers and modifiers that can't affect any of them are
+        // rejected once for the whole list instead of once per position.
+        AZ::Aabb inBounds = AZ::Aabb::CreateNull();
+        for (const AZ::Vector3& position : inPositions)
+        {
+            inBounds.AddPoint(position);
+        }
+
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+        GetSurfacePointBufferForPositions(inBounds, inPositions, desiredTags, surfacePoints);
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointBufferForPositions(const AZ::Aabb& inBounds, const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const
+    {
+        surfacePoints.Clear();
+
+        if (!inBounds.IsValid() || inPositions.empty())
+        {
+            surfacePoints.BuildPointRanges(inPositions.size());
+            return;
+        }
+
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
+        // These are locals rather than members because providers and modifiers are allowed to make nested surface queries
+        // (ex: a gradient modifier sampling a surface altitude gradient), which would overwrite any shared scratch space.
+        AZStd::vector<AZ::Vector3> providerPositions;
+        AZStd::vector<AZ::u32> providerPositionIndices;
+        providerPositions.reserve(inPositions.size());
+        providerPositionIndices.reserve(inPositions.size());
+
         // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // AABB bounds just once per provider, instead of once per point, and lets each provider process its whole batch of positions
+        // in one call.
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
             bool alwaysApplies = !entry.m_bounds.IsValid();
 
             if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
-                ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
+                ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inBounds) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                providerPositions.clear();
+                providerPositionIndices.clear();
+                for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
+                    const AZ::Vector3& point2d = inPositions[inPositionIndex];
                     AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                     if (alwaysApplies || entry.m_bounds.Contains(point3d))
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        providerPositions.push_back(point3d);
+                        providerPositionIndices.push_back(aznumeric_cast<AZ::u32>(inPositionIndex));
+                    }
+                }
+
+                if (!providerPositions.empty())
+                {
+                    const size_t firstNewPointIndex = surfacePoints.GetPointCount();
+                    SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointBufferFromList, providerPositions, surfacePoints);
+
+                    // The provider tagged its points with indices into providerPositions, so remap them to indices into inPositions.
+                    for (size_t pointIndex = firstNewPointIndex; pointIndex < surfacePoints.GetPointCount(); pointIndex++)
+                    {
+                        surfacePoints.SetInPositionIndex(pointIndex, providerPositionIndices[surfacePoints.GetInPositionIndex(pointIndex)]);
                     }
                 }
             }
@@ -286,39 +354,61 @@ namespace SurfaceData
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        if (!surfacePoints.IsEmpty())
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
+            AZStd::vector<AZ::u32> modifierPointIndices;
+            modifierPointIndices.reserve(surfacePoints.GetPointCount());
 
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                bool alwaysApplies = !entry.m_bounds.IsValid();
+
+                if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inBounds))
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    modifierPointIndices.clear();
+                    for (size_t pointIndex = 0; pointIndex < surfacePoints.GetPointCount(); pointIndex++)
                     {
+                        const AZ::Vector3& point2d = inPositions[surfacePoints.GetInPositionIndex(pointIndex)];
                         AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                         if (alwaysApplies || entry.m_bounds.Contains(point3d))
                         {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                            modifierPointIndices.push_back(aznumeric_cast<AZ::u32>(pointIndex));
                         }
                     }
+
+                    if (!modifierPointIndices.empty())
+                    {
+                        SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointBuffer, surfacePoints, modifierPointIndices);
+                    }
                 }
             }
         }
 
         // After we've finished creating and annotating all the surface points, combine any points together that have effectively the
-        // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
-        // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
-        // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+        // same XY coordinates and extremely similar Z values.  This produces results that are grouped by input position and sorted in
+        // decreasing Z order within each group.  Also, this filters out any remaining points that don't match the desired tag list.
+        // This can happen when a surface provider doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
+        CombineSortAndFilterNeighboringPoints(surfacePoints, inPositions.size(), hasDesiredTags, desiredTags);
+    }
+
+    void SurfaceDataSystemComponent::ConvertToSurfacePointListPerPosition(const AZStd::vector<AZ::Vector3>& inPositions, const SurfacePointBuffer& surfacePoints, SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        surfacePointListPerPosition.clear();
+        surfacePointListPerPosition.reserve(inPositions.size());
+
+        for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
         {
-            auto& surfacePointList = surfacePointListAndPoint.second;
-            if (!surfacePointList.empty())
+            surfacePointListPerPosition.emplace_back(inPositions[inPositionIndex], SurfaceData::SurfacePointList{});
+            SurfacePointList& surfacePointList = surfacePointListPerPosition.back().second;
+
+            size_t beginPointIndex = 0;
+            size_t endPointIndex = 0;
+            surfacePoints.GetPointRange(inPositionIndex, beginPointIndex, endPointIndex);
+            surfacePointList.resize(endPointIndex - beginPointIndex);
+            for (size_t pointIndex = beginPointIndex; pointIndex < endPointIndex; pointIndex++)
             {
-                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
+                surfacePoints.GetSurfacePoint(pointIndex, surfacePointList[pointIndex - beginPointIndex]);
             }
         }
     }
@@ -393,6 +483,71 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointBuffer& surfacePoints, size_t inPositionCount, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Filter and sort indices instead of the points themselves, so that each point's data is only copied once.
+        m_sortedPointIndices.clear();
+        m_sortedPointIndices.reserve(surfacePoints.GetPointCount());
+        for (size_t pointIndex = 0; pointIndex < surfacePoints.GetPointCount(); pointIndex++)
+        {
+            if (!hasDesiredTags || surfacePoints.HasMatchingTags(pointIndex, desiredTags))
+            {
+                m_sortedPointIndices.push_back(aznumeric_cast<AZ::u32>(pointIndex));
+            }
+        }
+
+        //group by input position, then sort by depth/distance before combining points
+        AZStd::sort(m_sortedPointIndices.begin(), m_sortedPointIndices.end(), [&surfacePoints](AZ::u32 a, AZ::u32 b)
+        {
+            const size_t inPositionIndexA = surfacePoints.GetInPositionIndex(a);
+            const size_t inPositionIndexB = surfacePoints.GetInPositionIndex(b);
+            if (inPositionIndexA != inPositionIndexB)
+            {
+                return inPositionIndexA < inPositionIndexB;
+            }
+
+            const float heightA = surfacePoints.GetPosition(a).GetZ();
+            const float heightB = surfacePoints.GetPosition(b).GetZ();
+            if (heightA != heightB)
+            {
+                return heightA > heightB;
+            }
+
+            // Keep the provider order for equal heights so that the results are deterministic.
+            return a < b;
+        });
+
+        //efficient point consolidation requires the points to be pre-sorted so we are only comparing/combining neighbors
+        m_targetPointBuffer.Clear();
+        for (AZ::u32 sourcePointIndex : m_sortedPointIndices)
+        {
+            const size_t inPositionIndex = surfacePoints.GetInPositionIndex(sourcePointIndex);
+
+            if (!m_targetPointBuffer.IsEmpty())
+            {
+                const size_t targetPointIndex = m_targetPointBuffer.GetPointCount() - 1;
+
+                // [LY-90907] need to add a configurable tolerance for comparison
+                if ((m_targetPointBuffer.GetInPositionIndex(targetPointIndex) == inPositionIndex) &&
+                    m_targetPointBuffer.GetPosition(targetPointIndex).IsClose(surfacePoints.GetPosition(sourcePointIndex)) &&
+                    m_targetPointBuffer.GetNormal(targetPointIndex).IsClose(surfacePoints.GetNormal(sourcePointIndex)))
+                {
+                    //consolidate points with similar attributes by adding masks to the target point and ignoring the source
+                    m_targetPointBuffer.AddMaskValues(targetPointIndex, surfacePoints, sourcePointIndex);
+                    continue;
+                }
+            }
+
+            //if the points were too different, we have to add a new target point to compare against
+            m_targetPointBuffer.AddPoint(inPositionIndex, surfacePoints, sourcePointIndex);
+        }
+
+        AZStd::swap(surfacePoints, m_targetPointBuffer);
+        surfacePoints.BuildPointRanges(inPositionCount);
+    }
+
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry)
     {
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
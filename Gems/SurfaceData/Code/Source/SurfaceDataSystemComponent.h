@@ -44,6 +44,9 @@ namespace SurfaceData
         // SurfaceDataSystemRequestBus implementation
         void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const override;
         void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const override;
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const override;
+        void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const override;
+        void GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const override;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) override;
         void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) override;
@@ -55,7 +58,12 @@ namespace SurfaceData
 
         void RefreshSurfaceData(const AZ::Aabb& dirtyArea) override;
     private:
+        //! Queries and annotates the surface points for every position in inPositions.  Must be called with m_registrationMutex held.
+        //! inBounds must contain all the positions, it's used to reject providers and modifiers for the whole batch at once.
+        void GetSurfacePointBufferForPositions(const AZ::Aabb& inBounds, const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const;
+        void ConvertToSurfacePointListPerPosition(const AZStd::vector<AZ::Vector3>& inPositions, const SurfacePointBuffer& surfacePoints, SurfacePointListPerPosition& surfacePointListPerPosition) const;
         void CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const;
+        void CombineSortAndFilterNeighboringPoints(SurfacePointBuffer& surfacePoints, size_t inPositionCount, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
         SurfaceDataRegistryEntry UnregisterSurfaceDataProviderInternal(const SurfaceDataRegistryHandle& handle);
@@ -74,5 +82,9 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //point buffer and sort indices reserved for reuse
+        mutable SurfacePointBuffer m_targetPointBuffer;
+        mutable AZStd::vector<AZ::u32> m_sortedPointIndices;
     };
 }
@@ -188,6 +188,35 @@ namespace SurfaceData
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointBufferFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointBuffer& surfacePoints) const
+    {
+        if (m_terrainBoundsIsValid)
+        {
+            const AZ::EntityId entityId = GetEntityId();
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                const AZ::Aabb terrainAabb = terrain->GetTerrainAabb();
+                for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
+                {
+                    const AZ::Vector3& inPosition = inPositions[inPositionIndex];
+                    if (terrainAabb.Contains(inPosition))
+                    {
+                        bool isTerrainValidAtPoint = false;
+                        const float terrainHeight = terrain->GetHeight(inPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &isTerrainValidAtPoint);
+                        const bool isHole = !isTerrainValidAtPoint;
+
+                        const size_t pointIndex = surfacePoints.AddPoint(inPositionIndex, entityId,
+                            AZ::Vector3(inPosition.GetX(), inPosition.GetY(), terrainHeight), terrain->GetNormal(inPosition));
+                        surfacePoints.AddMaskValue(pointIndex, isHole ? Constants::s_terrainHoleTagCrc : Constants::s_terrainTagCrc, 1.0f);
+                    }
+                }
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
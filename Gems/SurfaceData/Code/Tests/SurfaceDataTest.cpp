@@ -749,4 +749,62 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegion_MatchesSurfacePointsFromRegion)
+{
+    // This test verifies that the SurfacePointBuffer version of the region query produces the same points, in the same order,
+    // as the SurfacePointListPerPosition version, including the tags added by modifiers.
+
+    // Create a mock Surface Provider and a mock Surface Modifier that cover from (0, 0) - (8, 8) in space, with points spaced 1 apart.
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Query for all the surface points from (0, 0) - (4, 4) with a step size of 1, using both query types.
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, testTags, availablePointsPerPosition);
+
+    AZStd::vector<AZ::Vector3> inPositions;
+    SurfaceData::SurfacePointBuffer surfacePoints;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        regionBounds, stepSize, testTags, inPositions, surfacePoints);
+
+    ASSERT_EQ(inPositions.size(), availablePointsPerPosition.size());
+    ASSERT_EQ(surfacePoints.GetInPositionCount(), inPositions.size());
+
+    // We expect each input position to have the same two points (heights 4 and 0) with both tags in each query.
+    for (size_t inPositionIndex = 0; inPositionIndex < inPositions.size(); inPositionIndex++)
+    {
+        const SurfaceData::SurfacePointList& pointList = availablePointsPerPosition[inPositionIndex].second;
+        EXPECT_TRUE(inPositions[inPositionIndex].GetX() == availablePointsPerPosition[inPositionIndex].first.GetX());
+        EXPECT_TRUE(inPositions[inPositionIndex].GetY() == availablePointsPerPosition[inPositionIndex].first.GetY());
+
+        size_t beginPointIndex = 0;
+        size_t endPointIndex = 0;
+        surfacePoints.GetPointRange(inPositionIndex, beginPointIndex, endPointIndex);
+        ASSERT_EQ(endPointIndex - beginPointIndex, pointList.size());
+        EXPECT_TRUE(pointList.size() == 2);
+
+        for (size_t pointIndex = beginPointIndex; pointIndex < endPointIndex; pointIndex++)
+        {
+            const SurfaceData::SurfacePoint& point = pointList[pointIndex - beginPointIndex];
+            EXPECT_TRUE(surfacePoints.GetPosition(pointIndex).IsClose(point.m_position));
+            EXPECT_TRUE(surfacePoints.GetNormal(pointIndex).IsClose(point.m_normal));
+            EXPECT_TRUE(surfacePoints.HasMatchingTag(pointIndex, m_testSurface1Crc));
+            EXPECT_TRUE(surfacePoints.HasMatchingTag(pointIndex, m_testSurface2Crc));
+            EXPECT_TRUE(point.m_masks.size() == 2);
+        }
+    }
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -14,6 +14,7 @@ set(FILES
     Source/SurfaceData_precompiled.h
     Include/SurfaceData/SurfaceDataConstants.h
     Include/SurfaceData/SurfaceDataTypes.h
+    Include/SurfaceData/SurfacePointBuffer.h
     Include/SurfaceData/SurfaceDataSystemRequestBus.h
     Include/SurfaceData/SurfaceDataSystemNotificationBus.h
     Include/SurfaceData/SurfaceDataTagEnumeratorRequestBus.h
@@ -38,6 +38,9 @@ namespace Vegetation
         virtual void FillSectorStart([[maybe_unused]] int sectorX, [[maybe_unused]] int sectorY, [[maybe_unused]] TimePoint timePoint) {};
         virtual void FillSectorEnd([[maybe_unused]] int sectorX, [[maybe_unused]] int sectorY, [[maybe_unused]] TimePoint timePoint, [[maybe_unused]] AZ::u32 unusedClaimPointCount) {};
 
+        // sector surface points are gathered for a whole batch of sectors before they're filled, so the start and end are reported together
+        virtual void UpdateSectorPoints([[maybe_unused]] int sectorX, [[maybe_unused]] int sectorY, [[maybe_unused]] TimePoint startTime, [[maybe_unused]] TimePoint endTime) {};
+
         virtual void FillAreaStart([[maybe_unused]] AZ::EntityId areaId, [[maybe_unused]] TimePoint timePoint) {};
         virtual void MarkAreaRejectedByMask([[maybe_unused]] AZ::EntityId areaId) {};
         virtual void FillAreaEnd([[maybe_unused]] AZ::EntityId areaId, [[maybe_unused]] TimePoint timePoint, [[maybe_unused]] AZ::u32 unusedClaimPointCount) {};
@@ -58,6 +58,8 @@ namespace Vegetation
         {
             SectorId m_id;
             AZ::u32 m_numClaimPointsRemaining = 0; // number of sector points that were unused after a fill
+            TimeSpan m_surfacePointTimeUs = 0; // total time spent gathering the sector surface points, not included in the fill times
+            AZ::u32 m_surfacePointUpdateCount = 0; // number of times the sector surface points were gathered
             AZ::Vector3 m_worldPosition;
             AZStd::unordered_map<AreaId, AreaSectorTiming> m_perAreaData;
         };
@@ -134,6 +134,7 @@ namespace Vegetation
     const int AreaSystemConfig::s_maxSectorSizeInMeters = 1024;
     const int64_t AreaSystemConfig::s_maxVegetationInstances = 2 * 1024 * 1024;
     const int AreaSystemConfig::s_maxInstancesPerMeter = 16;
+    const int AreaSystemConfig::s_maxSectorUpdateBatchSize = 64;
 
     void AreaSystemConfig::Reflect(AZ::ReflectContext* context)
     {
@@ -148,6 +149,7 @@ namespace Vegetation
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("SectorUpdateBatchSize", &AreaSystemConfig::m_sectorUpdateBatchSize)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -178,6 +180,9 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_sectorUpdateBatchSize, "Sector Update Batch Size", "The maximum number of sectors updated together.  Surface points for a batch are gathered before the sectors are filled, closest sectors first.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, s_maxSectorUpdateBatchSize)
                 ;
             }
         }
@@ -192,6 +197,7 @@ namespace Vegetation
                 ->Property("sectorDensity", BehaviorValueProperty(&AreaSystemConfig::m_sectorDensity))
                 ->Property("sectorSizeInMeters", BehaviorValueProperty(&AreaSystemConfig::m_sectorSizeInMeters))
                 ->Property("threadProcessingIntervalMs", BehaviorValueProperty(&AreaSystemConfig::m_threadProcessingIntervalMs))
+                ->Property("sectorUpdateBatchSize", BehaviorValueProperty(&AreaSystemConfig::m_sectorUpdateBatchSize))
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
@@ -784,6 +790,7 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_sectorUpdateBatchSize = m_configuration.m_sectorUpdateBatchSize;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -1089,14 +1096,13 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorSizeInMeters)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         SectorInfo sectorInfo;
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1104,9 +1110,23 @@ namespace Vegetation
         return &sectorInfoRef;
     }
 
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(const AZStd::vector<SectorInfo*>& sectors, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // The surface data queries serialize on the surface data bus and registration mutexes, so the sectors are gathered
+        // one after another on the vegetation thread rather than being fanned out to jobs that would just wait on each other.
+        for (SectorInfo* sectorInfo : sectors)
+        {
+            UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        }
+    }
+
     void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+        [[maybe_unused]] const TimePoint startTime = AZStd::chrono::system_clock::now();
+
         const float vegStep = sectorSizeInMeters / static_cast<float>(sectorDensity);
 
         //build a free list of all points in the sector for areas to consume
@@ -1118,7 +1138,10 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        // The surface points for the whole sector are gathered in one region query into a structure-of-arrays buffer, which
+        // avoids allocating a separate surface point list for every sampled position.
+        AZStd::vector<AZ::Vector3> inPositions;
+        SurfaceData::SurfacePointBuffer availablePoints;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1133,30 +1156,35 @@ namespace Vegetation
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
         SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
             regionBounds,
             stepSize,
             SurfaceData::SurfaceTagVector(),
-            availablePointsPerPosition);
+            inPositions,
+            availablePoints);
 
-        AZ_Assert(availablePointsPerPosition.size() == (sectorDensity * sectorDensity),
-            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePointsPerPosition.size(),
+        AZ_Assert(inPositions.size() == (sectorDensity * sectorDensity),
+            "Veg sector ended up with unexpected density (%d points created, %d expected)", inPositions.size(),
             (sectorDensity * sectorDensity));
 
+        // The points are grouped by input position in the same order as the region query, so claim indices match the per-position order.
+        sectorInfo.m_baseContext.m_availablePoints.reserve(availablePoints.GetPointCount());
         uint claimIndex = 0;
-        for (auto& availablePoints : availablePointsPerPosition)
-        {
-            for (auto& surfacePoint : availablePoints.second)
+        for (size_t pointIndex = 0; pointIndex < availablePoints.GetPointCount(); pointIndex++)
+        {
+            sectorInfo.m_baseContext.m_availablePoints.push_back();
+            ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
+            claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
+            claimPoint.m_position = availablePoints.GetPosition(pointIndex);
+            claimPoint.m_normal = availablePoints.GetNormal(pointIndex);
+            availablePoints.EnumerateMasks(pointIndex, [&claimPoint, &sectorInfo](AZ::Crc32 tag, float value)
             {
-                sectorInfo.m_baseContext.m_availablePoints.push_back();
-                ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
-                claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
-                claimPoint.m_position = surfacePoint.m_position;
-                claimPoint.m_normal = surfacePoint.m_normal;
-                claimPoint.m_masks = surfacePoint.m_masks;
-                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, surfacePoint.m_masks);
-            }
+                claimPoint.m_masks[tag] = value;
+                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, tag, value);
+            });
         }
+
+        VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::UpdateSectorPoints, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), startTime, AZStd::chrono::system_clock::now()));
     }
 
     void AreaSystemComponent::VegetationThreadTasks::UpdateSectorCallbacks(SectorInfo& sectorInfo)
@@ -1512,7 +1540,7 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateSectorBatch(threadData, vegTasks);
             }
         }
     }
@@ -1778,13 +1806,13 @@ namespace Vegetation
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    bool AreaSystemComponent::UpdateContext::UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
         // This chooses work in the following order:
         // 1) Delete if we have more sectors than the total that should be in the view rectangle
-        // 2) Create/update if we have any sectors to create / update
+        // 2) Create/update a batch of sectors if we have any sectors to create / update
         // 3) Delete if we have any sectors to delete
 
         // Delete if there are more active sectors than the number of desired sectors or the update list is empty.
@@ -1803,44 +1831,80 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
-
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
+                // Pull the closest sectors off the end of the work list.  Creates stop the batch once they would grow the
+                // number of active sectors past the view rectangle size, so that pending deletes still get prioritized
+                // the same way they are when updating a single sector at a time.
+                const size_t maxBatchSize = static_cast<size_t>(AZ::GetMax(m_cachedMainThreadData.m_sectorUpdateBatchSize, 1));
+                size_t activeSectorCount = vegTasks->m_sectorRollingWindow.size();
+                m_updateBatch.clear();
+                while (!m_updateWorkList.empty() && (m_updateBatch.size() < maxBatchSize))
+                {
+                    if (m_updateWorkList.back().second == UpdateMode::Create)
+                    {
+                        if (!m_updateBatch.empty() && (activeSectorCount >= m_viewRectSectorCount))
+                        {
+                            break;
+                        }
+                        ++activeSectorCount;
+                    }
+
+                    m_updateBatch.push_back(m_updateWorkList.back());
+                    m_updateWorkList.pop_back();
+                }
+
                 auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
                 auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
                 auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
 
-                switch (mode)
+                // Find or create all the sectors in the batch, and determine which ones need their surface points rebuilt.
+                m_batchSectors.clear();
+                m_batchSectorsNeedingPoints.clear();
+                for (const auto& updateEntry : m_updateBatch)
                 {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
-                    {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                    const SectorId& sectorId = updateEntry.first;
+                    SectorInfo* sectorInfo = nullptr;
 
-                    case UpdateMode::Fill:
+                    switch (updateEntry.second)
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                        case UpdateMode::RebuildSurfaceCacheAndFill:
+                        {
+                            sectorInfo = vegTasks->GetSector(sectorId);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
+                            m_batchSectorsNeedingPoints.push_back(sectorInfo);
+                        }
+                        break;
 
-                    case UpdateMode::Create:
-                    {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        case UpdateMode::Fill:
+                        {
+                            sectorInfo = vegTasks->GetSector(sectorId);
+                            AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
+                        }
+                        break;
+
+                        case UpdateMode::Create:
+                        {
+                            AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
+                            sectorInfo = vegTasks->CreateSector(sectorId, sectorSizeInMeters);
+                            m_batchSectorsNeedingPoints.push_back(sectorInfo);
+                        }
+                        break;
                     }
-                    break;
+
+                    m_batchSectors.push_back(sectorInfo);
+                }
+
+                // Gather the surface points for every sector in the batch before any of them get filled.
+                vegTasks->UpdateSectorPoints(m_batchSectorsNeedingPoints, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+
+                // Claiming and spawning goes through the area buses, which connect and disconnect the areas around every claim,
+                // so the fills are run one sector at a time.  The sectors are filled closest first, and within each sector the
+                // areas are processed in layer / priority order, so the results are deterministic regardless of the batch size.
+                for (SectorInfo* sectorInfo : m_batchSectors)
+                {
+                    vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                 }
             }
 
@@ -26,6 +26,11 @@
 #include <ISystem.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 
+namespace UnitTest
+{
+    class VegetationSectorBatchTest;
+}
+
 namespace Vegetation
 {
     struct DebugData;
@@ -54,7 +59,8 @@ namespace Vegetation
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
-                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                   && m_sectorUpdateBatchSize == other.m_sectorUpdateBatchSize;
         }
 
         int m_viewRectangleSize = 13;
@@ -63,12 +69,14 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        int m_sectorUpdateBatchSize = 8;
     private:
         static const int s_maxViewRectangleSize;
         static const int s_maxSectorDensity;
         static const int s_maxSectorSizeInMeters;
 
         static const int s_maxInstancesPerMeter;
+        static const int s_maxSectorUpdateBatchSize;
         static const int64_t s_maxVegetationInstances;
 
         AZ::Outcome<void, AZStd::string> ValidateViewArea(void* newValue, const AZ::Uuid& valueType);
@@ -93,6 +101,7 @@ namespace Vegetation
     {
     public:
         friend class EditorAreaSystemComponent;
+        friend class UnitTest::VegetationSectorBatchTest;
         AZ_COMPONENT(AreaSystemComponent, "{7CE8E791-6BC6-4C88-8727-A476DE00F9A1}");
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
@@ -276,6 +285,7 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_sectorUpdateBatchSize = 1;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -296,8 +306,11 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Creates a new sector with no surface points, UpdateSectorPoints needs to be called on it before it's filled.
+            SectorInfo* CreateSector(const SectorId& sectorId, int sectorSizeInMeters);
             void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Updates the surface points for a batch of sectors, in the order given.
+            void UpdateSectorPoints(const AZStd::vector<SectorInfo*>& sectors, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
@@ -434,7 +447,7 @@ namespace Vegetation
 
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateSectorBatch(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -451,6 +464,12 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // The set of sectors currently being created / updated by UpdateSectorBatch(), in the order they get filled.
+            // These are effectively local variables, but are kept persistent to avoid reallocating them for every batch.
+            AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateBatch;
+            AZStd::vector<SectorInfo*> m_batchSectors;
+            AZStd::vector<SectorInfo*> m_batchSectorsNeedingPoints;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
@@ -324,10 +324,13 @@ void DebugComponent::DrawSectorTimingData()
 
         if (distanceToCamera <= maxTextDisplayDistance)
         {
-            azsnprintf(displayString, AZ_ARRAY_SIZE(displayString), "Sector %d, %d\nTime: %dus\nUpdate Count: %d", 
+            const int averageSurfacePointTimeUs = (sectorTiming.m_surfacePointUpdateCount > 0) ?
+                static_cast<int>(sectorTiming.m_surfacePointTimeUs / sectorTiming.m_surfacePointUpdateCount) : 0;
+            azsnprintf(displayString, AZ_ARRAY_SIZE(displayString), "Sector %d, %d\nTime: %dus\nSurface Points: %dus\nUpdate Count: %d", 
                 sectorTiming.m_id.first, 
                 sectorTiming.m_id.second,
                 static_cast<int>(sectorTiming.m_averageTimeUs),
+                averageSurfacePointTimeUs,
                 sectorTiming.m_updateCount);
 
             float textColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
@@ -359,6 +362,8 @@ void DebugComponent::FillSectorStart(int sectorX, int sectorY, TimePoint timePoi
     m_currentSectorTiming.m_id = { sectorX, sectorY };
     m_currentSectorTiming.m_numInstancesCreated = 0;
     m_currentSectorTiming.m_numClaimPointsRemaining = 0;
+    m_currentSectorTiming.m_surfacePointTimeUs = 0;
+    m_currentSectorTiming.m_surfacePointUpdateCount = 0;
     m_currentSectorTiming.m_perAreaTracking.clear();
 }
 
@@ -367,12 +372,28 @@ void DebugComponent::FillSectorEnd([[maybe_unused]] int sectorX, [[maybe_unused]
     AZ_Error("vegetation", m_currentSectorTiming.m_id == AZStd::make_pair(sectorX, sectorY), "Attempting to end a sector other than the one started");
     m_currentSectorTiming.m_end = timePoint;
     m_currentSectorTiming.m_numClaimPointsRemaining = unusedClaimPointCount;
+
+    auto pendingSurfacePointTiming = m_pendingSurfacePointTiming.find(m_currentSectorTiming.m_id);
+    if (pendingSurfacePointTiming != m_pendingSurfacePointTiming.end())
+    {
+        m_currentSectorTiming.m_surfacePointTimeUs = pendingSurfacePointTiming->second.m_totalTimeUs;
+        m_currentSectorTiming.m_surfacePointUpdateCount = pendingSurfacePointTiming->second.m_updateCount;
+        m_pendingSurfacePointTiming.erase(pendingSurfacePointTiming);
+    }
+
     m_sectorData.emplace_back(m_currentSectorTiming);
 
     // clear the per area tracking so all attempt to increment instance counts fail and we get a visible error
     m_currentSectorTiming.m_perAreaTracking.clear();
 }
 
+void DebugComponent::UpdateSectorPoints(int sectorX, int sectorY, TimePoint startTime, TimePoint endTime)
+{
+    SurfacePointTracker& surfacePointTracker = m_pendingSurfacePointTiming[AZStd::make_pair(sectorX, sectorY)];
+    surfacePointTracker.m_totalTimeUs += AZStd::chrono::microseconds(endTime - startTime).count();
+    ++surfacePointTracker.m_updateCount;
+}
+
 namespace DebugComponentUtilities
 {
     constexpr uint32 RoundUpAndDivide(uint32 value, uint32 divide)
@@ -688,7 +709,7 @@ namespace DebugUtility
         {
         case Vegetation::DebugRequests::SortType::BySector:
         {
-            written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "sector x, sector y, update count, avg update time ms, peak update time ms, lowest update time ms, total update time ms, number of instances created, number of unused claim points, worldPos X, WorldPos Y,\n");
+            written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "sector x, sector y, update count, avg update time ms, peak update time ms, lowest update time ms, total update time ms, number of instances created, number of unused claim points, surface point update count, avg surface point time ms, worldPos X, WorldPos Y,\n");
         }
         break;
         case Vegetation::DebugRequests::SortType::BySectorDetailed:
@@ -765,7 +786,9 @@ namespace DebugUtility
             {
                 DebugRequests::SectorTiming* sectorTiming = (DebugRequests::SectorTiming*)s;
                 DebugRequests::SectorId sectorId = sectorTiming->m_id;
-                written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "%d, %d, %d, %4.2f, %4.2f, %4.2f, %4.2f, %d, %d, %8.1f, %8.1f,\n",
+                const float averageSurfacePointTimeMs = (sectorTiming->m_surfacePointUpdateCount > 0) ?
+                    (sectorTiming->m_surfacePointTimeUs / 1000.0f) / sectorTiming->m_surfacePointUpdateCount : 0.0f;
+                written = azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "%d, %d, %d, %4.2f, %4.2f, %4.2f, %4.2f, %d, %d, %d, %4.2f, %8.1f, %8.1f,\n",
                     sectorId.first, sectorId.second,
                     s->m_updateCount,
                     s->m_averageTimeUs / 1000.0f,
@@ -774,6 +797,8 @@ namespace DebugUtility
                     s->m_totalUpdateTimeUs / 1000.0f,
                     s->m_numInstancesCreated,
                     sectorTiming->m_numClaimPointsRemaining,
+                    sectorTiming->m_surfacePointUpdateCount,
+                    averageSurfacePointTimeMs,
                     (float)sectorTiming->m_worldPosition.GetX(),
                     (float)sectorTiming->m_worldPosition.GetY());
 
@@ -907,6 +932,9 @@ void DebugComponent::PrepareNextReport()
     },
     [](const SectorTracker& sectorTracker, SectorTiming& sectorTiming)
     {
+        sectorTiming.m_surfacePointTimeUs += sectorTracker.m_surfacePointTimeUs;
+        sectorTiming.m_surfacePointUpdateCount += sectorTracker.m_surfacePointUpdateCount;
+
         for (const auto& sectorTracking : sectorTracker.m_perAreaTracking)
         {
             const AreaId& areaId = sectorTracking.first;
@@ -983,6 +1011,8 @@ void DebugComponent::PrepareNextReport()
     m_thePerformanceReport.m_lastUpdateTime = AZStd::chrono::system_clock::now();
     DebugUtility::MergeResults(sectorTimingMap, m_thePerformanceReport.m_sectorTimingData, m_thePerformanceReport.m_lastUpdateTime, [](const SectorTiming& newTiming, SectorTiming& timing)
     {
+        timing.m_surfacePointTimeUs += newTiming.m_surfacePointTimeUs;
+        timing.m_surfacePointUpdateCount += newTiming.m_surfacePointUpdateCount;
         for (const auto& newData : newTiming.m_perAreaData)
         {
             timing.m_perAreaData[newData.first] = newData.second;
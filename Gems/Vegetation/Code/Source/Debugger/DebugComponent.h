@@ -90,6 +90,7 @@ namespace Vegetation
         // DebugNotifications
         void FillSectorStart(int sectorX, int sectorY, TimePoint timePoint) override;
         void FillSectorEnd(int sectorX, int sectorY, TimePoint timePoint, AZ::u32 unusedClaimPointCount) override;
+        void UpdateSectorPoints(int sectorX, int sectorY, TimePoint startTime, TimePoint endTime) override;
         void FillAreaStart(AZ::EntityId areaId, TimePoint timePoint) override;
         void MarkAreaRejectedByMask(AZ::EntityId areaId) override;
         void FillAreaEnd(AZ::EntityId areaId, TimePoint timePoint, AZ::u32 unusedClaimPointCount) override;
@@ -148,12 +149,22 @@ namespace Vegetation
             TimePoint m_end;
             size_t m_numInstancesCreated = 0;// number of instances in the sector over all areas.
             size_t m_numClaimPointsRemaining = 0;
+            TimeSpan m_surfacePointTimeUs = 0;
+            AZ::u32 m_surfacePointUpdateCount = 0;
             AZStd::unordered_map<AreaId, SectorAreaData> m_perAreaTracking;
         };
         using SectorData = AZStd::vector<SectorTracker>;
         SectorTracker m_currentSectorTiming;
         SectorData m_sectorData;
 
+        // surface point timings for sectors that haven't been filled yet, these get attached to the sector's next fill
+        struct SurfacePointTracker
+        {
+            TimeSpan m_totalTimeUs = 0;
+            AZ::u32 m_updateCount = 0;
+        };
+        AZStd::unordered_map<SectorId, SurfacePointTracker> m_pendingSurfacePointTiming;
+
         struct AreaTracker
         {
             AreaId m_id;
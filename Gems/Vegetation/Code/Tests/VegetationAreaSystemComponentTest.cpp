@@ -25,8 +25,12 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
+#include <Vegetation/Ebuses/DebugNotificationBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include <AzCore/std/sort.h>
+
+#include "VegetationMocks.h"
 
 namespace UnitTest
 {
@@ -165,5 +169,272 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
+
+    // Surface handler that returns one point per queried position, with a height and mask value that vary by position so
+    // that any mix-up between sectors or claim indices shows up in the comparisons.
+    struct MockSurfaceGridHandler
+        : public MockSurfaceHandler
+    {
+        AZ::Crc32 m_maskTag = AZ_CRC("test_mask", 0x7a16e9ff);
+
+        void GetSurfacePoints(const AZ::Vector3& inPosition, [[maybe_unused]] const SurfaceData::SurfaceTagVector& masks, SurfaceData::SurfacePointList& surfacePointList) const override
+        {
+            SurfaceData::SurfacePoint outPoint;
+            outPoint.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), (inPosition.GetX() * 0.25f) + inPosition.GetY());
+            outPoint.m_normal = AZ::Vector3::CreateAxisZ();
+            outPoint.m_masks[m_maskTag] = AZ::GetClamp((inPosition.GetX() + inPosition.GetY()) / 64.0f, 0.0f, 1.0f);
+            surfacePointList.push_back(outPoint);
+        }
+
+        void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceData::SurfaceTagVector& desiredTags,
+            AZStd::vector<AZ::Vector3>& inPositions, SurfaceData::SurfacePointBuffer& surfacePoints) const override
+        {
+            // Same traversal as the surface data system: inclusive on the min sides of the region, exclusive on the max sides.
+            inPositions.clear();
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
+                }
+            }
+
+            GetSurfacePointBufferFromList(inPositions, desiredTags, surfacePoints);
+        }
+    };
+
+    // Area that claims every other available point, so that each fill leaves a known pattern of claimed points behind.
+    struct MockClaimEveryOtherPointArea
+        : public Vegetation::AreaRequestBus::Handler
+    {
+        AZ::EntityId m_areaId;
+
+        MockClaimEveryOtherPointArea(AZ::EntityId areaId)
+            : m_areaId(areaId)
+        {
+            Vegetation::AreaRequestBus::Handler::BusConnect(m_areaId);
+        }
+
+        ~MockClaimEveryOtherPointArea() override
+        {
+            Vegetation::AreaRequestBus::Handler::BusDisconnect();
+        }
+
+        bool PrepareToClaim([[maybe_unused]] Vegetation::EntityIdStack& stackIds) override
+        {
+            return true;
+        }
+
+        void ClaimPositions([[maybe_unused]] Vegetation::EntityIdStack& stackIds, Vegetation::ClaimContext& context) override
+        {
+            AZStd::vector<Vegetation::ClaimPoint> unclaimedPoints;
+            for (size_t pointIndex = 0; pointIndex < context.m_availablePoints.size(); ++pointIndex)
+            {
+                const Vegetation::ClaimPoint& point = context.m_availablePoints[pointIndex];
+                if ((pointIndex % 2) != 0)
+                {
+                    unclaimedPoints.push_back(point);
+                    continue;
+                }
+
+                Vegetation::InstanceData instanceData;
+                instanceData.m_id = m_areaId;
+                instanceData.m_position = point.m_position;
+                instanceData.m_normal = point.m_normal;
+                instanceData.m_masks = point.m_masks;
+                context.m_createdCallback(point, instanceData);
+            }
+            context.m_availablePoints = AZStd::move(unclaimedPoints);
+        }
+
+        void UnclaimPosition([[maybe_unused]] const Vegetation::ClaimHandle handle) override
+        {
+        }
+    };
+
+    // Records the sectors reported by the UpdateSectorPoints debug event.
+    struct MockSectorPointsDebugHandler
+        : public Vegetation::DebugNotificationBus::Handler
+    {
+        AZStd::vector<AZStd::pair<int, int>> m_updatedSectors;
+
+        MockSectorPointsDebugHandler()
+        {
+            Vegetation::DebugNotificationBus::Handler::BusConnect();
+            Vegetation::DebugNotificationBus::AllowFunctionQueuing(true);
+        }
+
+        ~MockSectorPointsDebugHandler() override
+        {
+            Vegetation::DebugNotificationBus::AllowFunctionQueuing(false);
+            Vegetation::DebugNotificationBus::ClearQueuedEvents();
+            Vegetation::DebugNotificationBus::Handler::BusDisconnect();
+        }
+
+        void UpdateSectorPoints(int sectorX, int sectorY, Vegetation::TimePoint startTime, Vegetation::TimePoint endTime) override
+        {
+            EXPECT_LE(startTime, endTime);
+            m_updatedSectors.emplace_back(sectorX, sectorY);
+        }
+    };
+
+    // Runs sectors through the vegetation thread tasks directly, so that the batched surface point path used by
+    // UpdateSectorBatch() can be compared against processing one sector at a time.
+    class VegetationSectorBatchTest
+        : public VegetationTestApp
+    {
+    protected:
+        using SectorId = Vegetation::AreaSystemComponent::SectorId;
+        using SectorInfo = Vegetation::AreaSystemComponent::SectorInfo;
+        using VegetationThreadTasks = Vegetation::AreaSystemComponent::VegetationThreadTasks;
+        using VegetationAreaInfo = Vegetation::AreaSystemComponent::VegetationAreaInfo;
+        using VegetationAreaVector = Vegetation::AreaSystemComponent::VegetationAreaVector;
+
+        static constexpr int SectorDensity = 8;
+        static constexpr int SectorSizeInMeters = 16;
+
+        void SetUp() override
+        {
+            VegetationTestApp::SetUp();
+
+            // Include sectors on both sides of the origin so that negative sector ids are covered too.
+            for (int y = -1; y <= 1; ++y)
+            {
+                for (int x = -2; x <= 1; ++x)
+                {
+                    m_sectorIds.emplace_back(x, y);
+                }
+            }
+
+            // An invalid area bounds means the area applies to every sector.
+            VegetationAreaInfo areaInfo;
+            areaInfo.m_id = m_areaId;
+            areaInfo.m_bounds = AZ::Aabb::CreateNull();
+            m_areas.push_back(areaInfo);
+        }
+
+        void TearDown() override
+        {
+            m_areas.set_capacity(0);
+            m_sectorIds.set_capacity(0);
+            VegetationTestApp::TearDown();
+        }
+
+        // Creates, gathers the surface points for, and fills each sector one at a time.
+        void ProcessSectorsIndividually(VegetationThreadTasks& vegTasks)
+        {
+            AZStd::lock_guard<decltype(vegTasks.m_sectorRollingWindowMutex)> lock(vegTasks.m_sectorRollingWindowMutex);
+            for (const SectorId& sectorId : m_sectorIds)
+            {
+                SectorInfo* sectorInfo = vegTasks.CreateSector(sectorId, SectorSizeInMeters);
+                vegTasks.UpdateSectorPoints(*sectorInfo, SectorDensity, SectorSizeInMeters, Vegetation::SnapMode::Corner);
+                vegTasks.FillSector(*sectorInfo, m_areas);
+            }
+        }
+
+        // Creates all the sectors, gathers their surface points as one batch, then fills them in order.
+        void ProcessSectorsAsBatch(VegetationThreadTasks& vegTasks)
+        {
+            AZStd::lock_guard<decltype(vegTasks.m_sectorRollingWindowMutex)> lock(vegTasks.m_sectorRollingWindowMutex);
+            AZStd::vector<SectorInfo*> sectors;
+            for (const SectorId& sectorId : m_sectorIds)
+            {
+                sectors.push_back(vegTasks.CreateSector(sectorId, SectorSizeInMeters));
+            }
+
+            vegTasks.UpdateSectorPoints(sectors, SectorDensity, SectorSizeInMeters, Vegetation::SnapMode::Corner);
+
+            for (SectorInfo* sectorInfo : sectors)
+            {
+                vegTasks.FillSector(*sectorInfo, m_areas);
+            }
+        }
+
+        void ExpectSectorsMatch(const VegetationThreadTasks& expectedTasks, const VegetationThreadTasks& actualTasks)
+        {
+            ASSERT_EQ(expectedTasks.m_sectorRollingWindow.size(), actualTasks.m_sectorRollingWindow.size());
+
+            for (const auto& sectorPair : expectedTasks.m_sectorRollingWindow)
+            {
+                const SectorInfo& expectedSector = sectorPair.second;
+                const SectorInfo* actualSector = actualTasks.GetSector(sectorPair.first);
+                ASSERT_NE(actualSector, nullptr);
+                EXPECT_TRUE(expectedSector.m_bounds == actualSector->m_bounds);
+
+                // The claim points are what the areas get to choose from, so their handles, order and surface data need to match.
+                const auto& expectedPoints = expectedSector.m_baseContext.m_availablePoints;
+                const auto& actualPoints = actualSector->m_baseContext.m_availablePoints;
+                ASSERT_EQ(expectedPoints.size(), actualPoints.size());
+                for (size_t pointIndex = 0; pointIndex < expectedPoints.size(); ++pointIndex)
+                {
+                    EXPECT_EQ(expectedPoints[pointIndex].m_handle, actualPoints[pointIndex].m_handle);
+                    EXPECT_TRUE(expectedPoints[pointIndex].m_position.IsClose(actualPoints[pointIndex].m_position));
+                    EXPECT_TRUE(expectedPoints[pointIndex].m_normal.IsClose(actualPoints[pointIndex].m_normal));
+                    EXPECT_TRUE(expectedPoints[pointIndex].m_masks == actualPoints[pointIndex].m_masks);
+                }
+                EXPECT_TRUE(expectedSector.m_baseContext.m_masks == actualSector->m_baseContext.m_masks);
+
+                ASSERT_EQ(expectedSector.m_claimedWorldPoints.size(), actualSector->m_claimedWorldPoints.size());
+                for (const auto& claimPair : expectedSector.m_claimedWorldPoints)
+                {
+                    auto actualClaim = actualSector->m_claimedWorldPoints.find(claimPair.first);
+                    ASSERT_NE(actualClaim, actualSector->m_claimedWorldPoints.end());
+                    EXPECT_EQ(claimPair.second.m_id, actualClaim->second.m_id);
+                    EXPECT_TRUE(claimPair.second.m_position.IsClose(actualClaim->second.m_position));
+                }
+            }
+        }
+
+        AZ::EntityId m_areaId = AZ::EntityId(1234);
+        AZStd::vector<SectorId> m_sectorIds;
+        VegetationAreaVector m_areas;
+    };
+
+    TEST_F(VegetationSectorBatchTest, BatchedSectorUpdate_MatchesIndividualSectorUpdate)
+    {
+        MockSurfaceGridHandler mockSurfaceHandler;
+        MockClaimEveryOtherPointArea mockArea(m_areaId);
+
+        VegetationThreadTasks individualTasks;
+        VegetationThreadTasks batchedTasks;
+        ProcessSectorsIndividually(individualTasks);
+        ProcessSectorsAsBatch(batchedTasks);
+
+        // Make sure the fills actually did something, so that the comparison below isn't between two empty sets of sectors.
+        ASSERT_EQ(individualTasks.m_sectorRollingWindow.size(), m_sectorIds.size());
+        for (const auto& sectorPair : individualTasks.m_sectorRollingWindow)
+        {
+            EXPECT_EQ(sectorPair.second.m_baseContext.m_availablePoints.size(), static_cast<size_t>(SectorDensity * SectorDensity));
+            EXPECT_EQ(sectorPair.second.m_claimedWorldPoints.size(), static_cast<size_t>((SectorDensity * SectorDensity) / 2));
+        }
+
+        ExpectSectorsMatch(individualTasks, batchedTasks);
+
+        individualTasks.ClearSectors();
+        batchedTasks.ClearSectors();
+    }
+
+    TEST_F(VegetationSectorBatchTest, BatchedSectorUpdate_SendsOneUpdateSectorPointsEventPerSector)
+    {
+        MockSurfaceGridHandler mockSurfaceHandler;
+        MockClaimEveryOtherPointArea mockArea(m_areaId);
+        MockSectorPointsDebugHandler mockDebugHandler;
+
+        VegetationThreadTasks batchedTasks;
+        ProcessSectorsAsBatch(batchedTasks);
+        Vegetation::DebugNotificationBus::ExecuteQueuedEvents();
+
+#if defined(VEG_PROFILE_ENABLED)
+        AZStd::vector<AZStd::pair<int, int>> expectedSectors(m_sectorIds.begin(), m_sectorIds.end());
+#else
+        // The debug events are compiled out when vegetation profiling is disabled.
+        AZStd::vector<AZStd::pair<int, int>> expectedSectors;
+#endif
+        AZStd::sort(expectedSectors.begin(), expectedSectors.end());
+        AZStd::sort(mockDebugHandler.m_updatedSectors.begin(), mockDebugHandler.m_updatedSectors.end());
+        EXPECT_EQ(mockDebugHandler.m_updatedSectors, expectedSectors);
+
+        batchedTasks.ClearSectors();
+    }
 }
 